@@ -154,6 +154,13 @@ enum {
 
 extern const struct TypePower gNaturalGiftTable[];
 
+#if TESTING
+// Lets tests benchmark AbilityBattleEffects without sAbilityEffectHooks.
+extern bool8 gTestSkipAbilityEffectHooks;
+#else
+#define gTestSkipAbilityEffectHooks FALSE
+#endif
+
 struct DamageCalculationData
 {
     u32 battlerAtk:3;
@@ -223,6 +230,8 @@ u32 AbilityBattleEffects(u32 caseID, u32 battler, u32 ability, u32 special, u32
 bool32 TryPrimalReversion(u32 battler);
 bool32 IsNeutralizingGasOnField(void);
 bool32 IsMoldBreakerTypeAbility(u32 battler, u32 ability);
+void BeginHotBattlerCache(void);
+void EndHotBattlerCache(void);
 u32 GetBattlerAbility(u32 battler);
 u32 IsAbilityOnSide(u32 battler, u32 ability);
 u32 IsAbilityOnOpposingSide(u32 battler, u32 ability);
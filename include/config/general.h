@@ -74,6 +74,7 @@
 #define COMPETITIVE_PARTY_SYNTAX     TRUE    // If TRUE, parties are defined in "competitive syntax".
 #define AUTO_SCROLL_TEXT             FALSE   // If TRUE, text will automatically scroll to the next line after NUM_FRAMES_AUTO_SCROLL_DELAY. Players can still press A_BUTTON or B_BUTTON to scroll on their own.
 #define NUM_FRAMES_AUTO_SCROLL_DELAY 49
+#define FAST_PALETTE_BLEND           TRUE    // If TRUE, palette blending, weather color maps and grayscale/sepia tints use ARM routines in IWRAM which work on two colors at a time.
 
 
 // Measurement system constants to be used for UNITS
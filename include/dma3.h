@@ -46,10 +46,20 @@
 #define Dma3FillLarge16_(value, dest, size) Dma3FillLarge_(value, dest, size, 16)
 #define Dma3FillLarge32_(value, dest, size) Dma3FillLarge_(value, dest, size, 32)
 
+struct Dma3Stats
+{
+    u32 bytesTransferred; // In the last VBlank.
+    u16 requestsProcessed; // In the last VBlank.
+    u16 requestsDeferred; // Left for the next VBlank by the last one.
+    u16 requestsMerged; // Into the request before them, since boot.
+    u16 scanlinesUsed; // By the last VBlank.
+};
+
 void ClearDma3Requests(void);
 void ProcessDma3Requests(void);
 s16 RequestDma3Copy(const void *src, void *dest, u16 size, u32 mode);
 s16 RequestDma3Fill(s32 value, void *dest, u16 size, u32 mode);
 s16 CheckForSpaceForDma3Request(s16 index);
+void GetDma3Stats(struct Dma3Stats *stats);
 
 #endif // GUARD_DMA3_H
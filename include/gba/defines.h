@@ -15,6 +15,9 @@
 #define USED __attribute__((used))
 
 #define ARM_FUNC __attribute__((target("arm")))
+// Copied to IWRAM at boot. Callers in ROM are too far away for a plain
+// BL, so the calls go through a register.
+#define IWRAM_CODE __attribute__((section(".iwram.code"), long_call))
 
 #if MODERN
 #define NOINLINE __attribute__((noinline))
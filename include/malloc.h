@@ -44,15 +44,27 @@ struct MemBlock
 #define HEAP_SIZE 0x1C000
 extern u8 gHeap[HEAP_SIZE];
 
+// A single heap allocation that a scene can hand out piece by piece, and
+// then give back all at once with ResetHeapArena or FreeHeapArena instead
+// of freeing each piece.
+struct HeapArena
+{
+    u8 *data;
+    u32 size;
+    u32 used;
+};
+
 #if TESTING || !defined(NDEBUG)
 
 #define Alloc(size) Alloc_(size, __FILE__ ":" STR(__LINE__))
 #define AllocZeroed(size) AllocZeroed_(size, __FILE__ ":" STR(__LINE__))
+#define InitHeapArena(arena, size) InitHeapArena_(arena, size, __FILE__ ":" STR(__LINE__))
 
 #else
 
 #define Alloc(size) Alloc_(size, NULL)
 #define AllocZeroed(size) AllocZeroed_(size, NULL)
+#define InitHeapArena(arena, size) InitHeapArena_(arena, size, NULL)
 
 #endif
 
@@ -60,6 +72,13 @@ void *Alloc_(u32 size, const char *location);
 void *AllocZeroed_(u32 size, const char *location);
 void Free(void *pointer);
 void InitHeap(void *pointer, u32 size);
+bool32 CheckMemBlock(void *pointer);
+bool32 CheckHeap(void);
+
+bool32 InitHeapArena_(struct HeapArena *arena, u32 size, const char *location);
+void *AllocFromHeapArena(struct HeapArena *arena, u32 size);
+void ResetHeapArena(struct HeapArena *arena);
+void FreeHeapArena(struct HeapArena *arena);
 
 const struct MemBlock *HeapHead(void);
 const char *MemBlockLocation(const struct MemBlock *block);
@@ -60,7 +60,10 @@ extern u16 ALIGNED(4) gPlttBufferFaded[PLTT_BUFFER_SIZE];
 void LoadCompressedPalette(const u32 *src, u32 offset, u32 size);
 void LoadPalette(const void *src, u32 offset, u32 size);
 void FillPalette(u32 value, u32 offset, u32 size);
+void MarkPalettesDirty(u32 selectedPalettes);
+void MarkPlttBufferDirty(u32 offset, u32 count);
 void TransferPlttBuffer(void);
+void TransferDirtyPlttBuffer(void);
 u32 UpdatePaletteFade(void);
 void ResetPaletteFade(void);
 bool32 BeginNormalPaletteFade(u32 selectedPalettes, s8 delay, u8 startY, u8 targetY, u32 blendColor);
@@ -77,6 +80,10 @@ void TintPalette_GrayScale(u16 *palette, u32 count);
 void TintPalette_GrayScale2(u16 *palette, u32 count);
 void TintPalette_SepiaTone(u16 *palette, u32 count);
 void TintPalette_CustomTone(u16 *palette, u32 count, u16 rTone, u16 gTone, u16 bTone);
+ARM_FUNC IWRAM_CODE void BlendColors(const u16 *src, u16 *dest, u32 count, u32 coeff, u32 blendColor);
+ARM_FUNC IWRAM_CODE void ApplyColorMapToColors(const u16 *src, u16 *dest, u32 count, const u8 *colorMap);
+ARM_FUNC IWRAM_CODE void GrayScaleColors(u16 *palette, u32 count, bool32 roundDown);
+ARM_FUNC IWRAM_CODE void SepiaToneColors(u16 *palette, u32 count);
 
 static inline void SetBackdropFromColor(u32 color)
 {
@@ -277,6 +277,7 @@ u32 CreateSpriteAtEnd(const struct SpriteTemplate *template, s16 x, s16 y, u32 s
 u32 CreateInvisibleSprite(void (*callback)(struct Sprite *));
 u32 CreateSpriteAndAnimate(const struct SpriteTemplate *template, s16 x, s16 y, u32 subpriority);
 void DestroySprite(struct Sprite *sprite);
+void CloneSpriteAt(u32 index, const struct Sprite *sprite);
 void ResetOamRange(u32 start, u32 end);
 void LoadOam(void);
 void SetOamMatrix(u8 matrixNum, u16 a, u16 b, u16 c, u16 d);
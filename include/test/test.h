@@ -43,7 +43,6 @@ struct TestRunnerState
     const char *skipFilename;
     u32 failedAssumptionsBlockLine;
     const struct Test *test;
-    u32 processCosts[MAX_PROCESSES];
 
     u8 result;
     u8 expectedResult;
@@ -55,6 +54,8 @@ struct TestRunnerState
 
 extern const u8 gTestRunnerN;
 extern const u8 gTestRunnerI;
+extern const bool8 gTestRunnerDynamic;
+extern const u32 gTestRunnerNonce[4];
 extern const char gTestRunnerArgv[256];
 
 extern const struct TestRunner gAssumptionsRunner;
@@ -167,40 +168,73 @@ s32 Test_MgbaPrintf(const char *fmt, ...);
             Test_ExitWithResult(TEST_RESULT_FAIL, __LINE__, ":L%s:%d: EXPECT_GE(%d, %d) failed", gTestRunnerState.test->filename, __LINE__, _a, _b); \
     } while (0)
 
-struct Benchmark { s32 ticks; };
+// Test runner timeouts are counted by timer 2 interrupts.
+#define TIMEOUT_TIMER_RELOAD (UINT16_MAX - (274 * 60)) // Approx. 1 second.
 
+static inline void StartTimeoutTimer(void)
+{
+    REG_TM2CNT_L = TIMEOUT_TIMER_RELOAD;
+    REG_TM2CNT_H = TIMER_ENABLE | TIMER_INTR_ENABLE | TIMER_1024CLK;
+}
+
+struct Benchmark { u32 ticks; }; // CPU cycles.
+
+// Timers 2 and 3 are cascaded into one 32-bit cycle counter, so the
+// timeout is paused while a benchmark runs. Instead, timer 3 overflowing
+// (after about 256 seconds) is treated as a timeout.
 static inline void BenchmarkStart(void)
 {
     gTestRunnerState.inBenchmark = TRUE;
+    REG_TM2CNT_H = 0;
+    REG_TM3CNT_H = 0;
+    REG_TM2CNT_L = 0;
+    REG_TM3CNT_L = 0;
     // Wait for a v-blank so that comparing two benchmarks is not affected
     // by the v-count (different numbers of IRQs may run).
     VBlankIntrWait();
-    REG_TM3CNT = (TIMER_ENABLE | TIMER_64CLK) << 16;
+    REG_TM3CNT_H = TIMER_ENABLE | TIMER_INTR_ENABLE | TIMER_COUNTUP;
+    REG_TM2CNT_H = TIMER_ENABLE | TIMER_1CLK;
 }
 
 static inline struct Benchmark BenchmarkStop(void)
 {
+    u32 ticks;
+    REG_TM2CNT_H = 0;
+    ticks = REG_TM2CNT_L | ((u32)REG_TM3CNT_L << 16);
     REG_TM3CNT_H = 0;
+    StartTimeoutTimer();
     gTestRunnerState.inBenchmark = FALSE;
-    return (struct Benchmark) { REG_TM3CNT_L };
+    return (struct Benchmark) { ticks };
 }
 
 #define BENCHMARK(id) \
     for (BenchmarkStart(); gTestRunnerState.inBenchmark; *(id) = BenchmarkStop())
 
+// Reports a benchmark to Hydra under the name of the variable holding it.
+// Hydra collects the reports of every test into a JSON file, and compares
+// them against a baseline if one is given (see BENCHMARK_BASELINE in the
+// Makefile).
+#define REPORT_BENCHMARK(a) \
+    Test_MgbaPrintf(":B%u %s", (a).ticks, #a)
+
 // An approximation of how much overhead benchmarks introduce.
-#define BENCHMARK_ABS 2
+#define BENCHMARK_ABS 128
 
 // An approximation for what percentage faster a benchmark has to be for
 // us to be confident that it's faster than another.
 #define BENCHMARK_REL 95
 
+// Ticks with the overhead removed, clamped at 0 for very short benchmarks.
+// The comparisons below are done in u64 because ticks * 100 overflows a
+// u32 for benchmarks longer than about 42M ticks.
+#define BENCHMARK_SUB_ABS(ticks) ((ticks) > BENCHMARK_ABS ? (ticks) - BENCHMARK_ABS : 0)
+
 #define EXPECT_FASTER(a, b) \
     do \
     { \
         u32 a_ = (a).ticks; u32 b_ = (b).ticks; \
-        Test_MgbaPrintf(#a ": %d ticks, " #b ": %d ticks", a_, b_); \
-        if (((a_ - BENCHMARK_ABS) * BENCHMARK_REL) >= (b_ * 100)) \
+        Test_MgbaPrintf(#a ": %u ticks, " #b ": %u ticks", a_, b_); \
+        if ((u64)BENCHMARK_SUB_ABS(a_) * BENCHMARK_REL >= (u64)b_ * 100) \
             Test_ExitWithResult(TEST_RESULT_FAIL, __LINE__, ":L%s:%d: EXPECT_FASTER(" #a ", " #b ") failed", gTestRunnerState.test->filename, __LINE__); \
     } while (0)
 
@@ -208,8 +242,8 @@ static inline struct Benchmark BenchmarkStop(void)
     do \
     { \
         u32 a_ = (a).ticks; u32 b_ = (b).ticks; \
-        Test_MgbaPrintf(#a ": %d ticks, " #b ": %d ticks", a_, b_); \
-        if ((a_ * 100) <= ((b_ - BENCHMARK_ABS) * BENCHMARK_REL)) \
+        Test_MgbaPrintf(#a ": %u ticks, " #b ": %u ticks", a_, b_); \
+        if ((u64)a_ * 100 <= (u64)BENCHMARK_SUB_ABS(b_) * BENCHMARK_REL) \
             Test_ExitWithResult(TEST_RESULT_FAIL, __LINE__, ":L%s:%d: EXPECT_SLOWER(" #a ", " #b ") failed", gTestRunnerState.test->filename, __LINE__); \
     } while (0)
 
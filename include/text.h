@@ -139,6 +139,15 @@ extern TextFlags gTextFlags;
 extern u8 gDisableTextPrinters;
 extern struct TextGlyph gCurGlyph;
 
+#if TESTING
+// Lets tests benchmark RenderText without the glyph cache.
+extern bool8 gTestSkipGlyphCache;
+#else
+#define gTestSkipGlyphCache FALSE
+#endif
+
+void ResetGlyphCache(void);
+void GetGlyphCacheStats(u32 *hits, u32 *misses);
 void DeactivateAllTextPrinters(void);
 u16 AddTextPrinterParameterized(u8 windowId, u8 fontId, const u8 *str, u8 x, u8 y, u8 speed, void (*callback)(struct TextPrinterTemplate *, u16));
 bool32 AddTextPrinter(struct TextPrinterTemplate *template, u8 speed, void (*callback)(struct TextPrinterTemplate *, u16));
@@ -12,18 +12,33 @@ INCLUDECONSTS_OUTDIR := include/constants
 AUTO_GEN_TARGETS += $(INCLUDECONSTS_OUTDIR)/map_groups.h
 AUTO_GEN_TARGETS += $(INCLUDECONSTS_OUTDIR)/layouts.h
 
-MAP_DIRS := $(dir $(wildcard $(MAPS_DIR)/*/map.json))
+MAP_JSONS := $(wildcard $(MAPS_DIR)/*/map.json)
+MAP_DIRS := $(dir $(MAP_JSONS))
 MAP_CONNECTIONS := $(patsubst $(MAPS_DIR)/%/,$(MAPS_DIR)/%/connections.inc,$(MAP_DIRS))
 MAP_EVENTS := $(patsubst $(MAPS_DIR)/%/,$(MAPS_DIR)/%/events.inc,$(MAP_DIRS))
 MAP_HEADERS := $(patsubst $(MAPS_DIR)/%/,$(MAPS_DIR)/%/header.inc,$(MAP_DIRS))
+# Defined before the rules below, whose prerequisites are expanded as they are read.
+MAPS_STAMP := $(MAPS_OUTDIR)/maps.stamp
 
-$(DATA_ASM_BUILDDIR)/maps.o: $(DATA_ASM_SUBDIR)/maps.s $(LAYOUTS_DIR)/layouts.inc $(LAYOUTS_DIR)/layouts_table.inc $(MAPS_DIR)/headers.inc $(MAPS_DIR)/groups.inc $(MAPS_DIR)/connections.inc $(MAP_CONNECTIONS) $(MAP_HEADERS)
+$(DATA_ASM_BUILDDIR)/maps.o: $(DATA_ASM_SUBDIR)/maps.s $(LAYOUTS_DIR)/layouts.inc $(LAYOUTS_DIR)/layouts_table.inc $(MAPS_DIR)/headers.inc $(MAPS_DIR)/groups.inc $(MAPS_DIR)/connections.inc $(MAPS_STAMP) $(MAP_CONNECTIONS) $(MAP_HEADERS)
 	$(PREPROC) $< charmap.txt | $(CPP) -I include - | $(PREPROC) -ie $< charmap.txt | $(AS) $(ASFLAGS) -o $@
-$(DATA_ASM_BUILDDIR)/map_events.o: $(DATA_ASM_SUBDIR)/map_events.s $(MAPS_DIR)/events.inc $(MAP_EVENTS)
+$(DATA_ASM_BUILDDIR)/map_events.o: $(DATA_ASM_SUBDIR)/map_events.s $(MAPS_DIR)/events.inc $(MAPS_STAMP) $(MAP_EVENTS)
 	$(PREPROC) $< charmap.txt | $(CPP) -I include - | $(PREPROC) -ie $< charmap.txt | $(AS) $(ASFLAGS) -o $@
 
-$(MAPS_OUTDIR)/%/header.inc $(MAPS_OUTDIR)/%/events.inc $(MAPS_OUTDIR)/%/connections.inc: $(MAPS_DIR)/%/map.json
-	$(MAPJSON) map emerald $< $(LAYOUTS_DIR)/layouts.json $(@D)
+# A single mapjson process writes the files of every map, and leaves the ones whose contents
+# have not changed alone. The stamp records when that last happened, and maps.o and
+# map_events.o depend on it directly: make has already looked at the per-map files by the
+# time the stamp's recipe runs, so it would not notice them changing until the next build.
+# The per-map files only wait on the stamp, so they are never older than a prerequisite
+# and cost nothing once they exist. A file that has gone missing is regenerated on its own.
+
+$(MAPS_STAMP): $(MAP_JSONS) $(LAYOUTS_DIR)/layouts.json
+	@echo "$(MAPJSON) maps emerald $(LAYOUTS_DIR)/layouts.json <map files>"
+	@$(MAPJSON) maps emerald $(LAYOUTS_DIR)/layouts.json $(MAP_JSONS)
+	@touch $@
+
+$(MAP_CONNECTIONS) $(MAP_EVENTS) $(MAP_HEADERS): | $(MAPS_STAMP)
+	@test -f $@ || $(MAPJSON) map emerald $(@D)/map.json $(LAYOUTS_DIR)/layouts.json $(@D)
 
 $(MAPS_OUTDIR)/connections.inc $(MAPS_OUTDIR)/groups.inc $(MAPS_OUTDIR)/events.inc $(MAPS_OUTDIR)/headers.inc $(INCLUDECONSTS_OUTDIR)/map_groups.h $(DATA_SRC_SUBDIR)/map_group_count.h: $(MAPS_DIR)/map_groups.json
 	$(MAPJSON) groups emerald $< $(MAPS_OUTDIR) $(INCLUDECONSTS_OUTDIR)
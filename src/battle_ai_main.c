@@ -410,7 +410,9 @@ static u32 Ai_SetMoveAccuracy(struct AiLogicData *aiData, u32 battlerAtk, u32 ba
     return accuracy;
 }
 
-static void CalcBattlerAiMovesData(struct AiLogicData *aiData, u32 battlerAtk, u32 battlerDef, u32 weather)
+#define ALL_MOVE_SLOTS ((1u << MAX_MON_MOVES) - 1)
+
+static void CalcBattlerAiMovesData(struct AiLogicData *aiData, u32 battlerAtk, u32 battlerDef, u32 weather, u32 moveSlots)
 {
     u32 moveIndex, move;
     u32 rollType = GetDmgRollType(battlerAtk);
@@ -420,6 +422,10 @@ static void CalcBattlerAiMovesData(struct AiLogicData *aiData, u32 battlerAtk, u
     {
         struct SimulatedDamage dmg = {0};
         uq4_12_t effectiveness = Q_4_12(0.0);
+        u32 accuracy = 0;
+
+        if (!(moveSlots & (1u << moveIndex)))
+            continue;
         move = moves[moveIndex];
 
         if (move != MOVE_NONE
@@ -428,38 +434,222 @@ static void CalcBattlerAiMovesData(struct AiLogicData *aiData, u32 battlerAtk, u
             && !(aiData->moveLimitations[battlerAtk] & (1u << moveIndex)))
         {
             dmg = AI_CalcDamage(move, battlerAtk, battlerDef, &effectiveness, TRUE, weather, rollType);
-            aiData->moveAccuracy[battlerAtk][battlerDef][moveIndex] = Ai_SetMoveAccuracy(aiData, battlerAtk, battlerDef, move);
+            accuracy = Ai_SetMoveAccuracy(aiData, battlerAtk, battlerDef, move);
         }
         aiData->simulatedDmg[battlerAtk][battlerDef][moveIndex] = dmg;
         aiData->effectiveness[battlerAtk][battlerDef][moveIndex] = effectiveness;
+        aiData->moveAccuracy[battlerAtk][battlerDef][moveIndex] = accuracy;
+    }
+}
+
+static void ClearBattlerAiMovesData(struct AiLogicData *aiData, u32 battlerAtk, u32 battlerDef)
+{
+    memset(aiData->simulatedDmg[battlerAtk][battlerDef], 0, sizeof(aiData->simulatedDmg[battlerAtk][battlerDef]));
+    memset(aiData->effectiveness[battlerAtk][battlerDef], 0, sizeof(aiData->effectiveness[battlerAtk][battlerDef]));
+    memset(aiData->moveAccuracy[battlerAtk][battlerDef], 0, sizeof(aiData->moveAccuracy[battlerAtk][battlerDef]));
+    aiData->movesDataKeys[battlerAtk][battlerDef] = 0;
+}
+
+// FNV-1a. Used to tell whether anything a damage calculation reads has changed since the last turn.
+#define AI_STATE_HASH_INIT 2166136261u
+#define HASH_AI_STATE(hash, value) HashAiState(hash, &(value), sizeof(value))
+
+static u32 HashAiState(u32 hash, const void *data, u32 size)
+{
+    const u8 *bytes = data;
+
+    while (size-- != 0)
+    {
+        hash ^= *bytes++;
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+static u32 HashAiValue(u32 hash, u32 value)
+{
+    return HASH_AI_STATE(hash, value);
+}
+
+// Only what the damage, effectiveness and accuracy calculations read. Timers
+// and the last used move change nearly every turn, so they are left out, and
+// the moves that do depend on them are recalculated every turn instead.
+static u32 GetFieldAiStateHash(struct AiLogicData *aiData, u32 weather)
+{
+    u32 hash = AI_STATE_HASH_INIT;
+    u32 side;
+
+    hash = HashAiValue(hash, weather);
+    hash = HashAiValue(hash, aiData->weatherHasEffect);
+    hash = HashAiValue(hash, gFieldStatuses);
+    hash = HashAiValue(hash, gBattlersCount);
+    hash = HashAiValue(hash, gBattleStruct->pledgeMove);
+    hash = HashAiValue(hash, gBattleStruct->fickleBeamBoosted);
+    hash = HASH_AI_STATE(hash, gBattleStruct->gimmick.usableGimmick);
+    hash = HASH_AI_STATE(hash, gBattleStruct->gimmick.activeGimmick);
+    hash = HashAiValue(hash, gBattleStruct->gimmick.toActivate);
+    for (side = 0; side < NUM_BATTLE_SIDES; side++)
+    {
+        hash = HashAiValue(hash, gSideStatuses[side]);
+        hash = HashAiValue(hash, gSideTimers[side].retaliateTimer);
+    }
+    return hash;
+}
+
+// Hashes the battler as the AI sees it, along with the parts of its partner that can change its damage.
+static u32 GetBattlerAiStateHash(struct AiLogicData *aiData, u32 battler)
+{
+    u32 hash = AI_STATE_HASH_INIT;
+    u32 partner = BATTLE_PARTNER(battler);
+    u32 partyIndex = gBattlerPartyIndexes[battler];
+    struct BattlePokemon mon;
+
+    SaveBattlerData(battler);
+    SetBattlerData(battler);
+    mon = gBattleMons[battler];
+    RestoreBattlerData(battler);
+    // PP goes down every time a move is used. Only Trump Card reads it.
+    memset(mon.pp, 0, sizeof(mon.pp));
+
+    hash = HASH_AI_STATE(hash, mon);
+    hash = HashAiValue(hash, partyIndex);
+    hash = HashAiValue(hash, gStatuses3[battler]);
+    hash = HashAiValue(hash, gStatuses4[battler]);
+    hash = HashAiValue(hash, gDisableStructs[battler].isFirstTurn);
+    hash = HashAiValue(hash, gDisableStructs[battler].stockpileCounter);
+    hash = HashAiValue(hash, gDisableStructs[battler].furyCutterCounter);
+    hash = HashAiValue(hash, gDisableStructs[battler].rolloutTimer);
+    hash = HashAiValue(hash, gDisableStructs[battler].slowStartTimer != 0);
+    hash = HashAiValue(hash, gDisableStructs[battler].tarShot);
+    hash = HashAiValue(hash, gDisableStructs[battler].autotomizeCount);
+    hash = HashAiValue(hash, gDisableStructs[battler].flashFireBoosted);
+    hash = HashAiValue(hash, gDisableStructs[battler].boosterEnergyActivates);
+    hash = HashAiValue(hash, gProtectStructs[battler].helpingHand);
+    hash = HashAiValue(hash, gProtectStructs[battler].statFell);
+    hash = HashAiValue(hash, gProtectStructs[battler].physicalDmg != 0);
+    hash = HashAiValue(hash, gProtectStructs[battler].specialDmg != 0);
+    hash = HashAiValue(hash, gProtectStructs[battler].physicalBattlerId);
+    hash = HashAiValue(hash, gProtectStructs[battler].specialBattlerId);
+    hash = HashAiValue(hash, gProtectStructs[battler].confusionSelfDmg);
+    hash = HashAiValue(hash, gBattleStruct->battlerState[battler].pursuitTarget);
+    hash = HashAiValue(hash, gBattleStruct->battlerState[battler].lastMoveFailed);
+    hash = HashAiValue(hash, gBattleStruct->battlerState[battler].usedMicleBerry);
+    hash = HashAiValue(hash, gBattleStruct->battlerState[battler].commandingDondozo);
+    hash = HASH_AI_STATE(hash, gBattleStruct->illusion[battler]);
+    hash = HashAiValue(hash, gBattleStruct->ateBoost[battler]);
+    hash = HashAiValue(hash, gBattleStruct->supremeOverlordCounter[battler]);
+    hash = HashAiValue(hash, gBattleStruct->sameMoveTurns[battler]);
+    hash = HashAiValue(hash, gBattleStruct->chosenMovePositions[battler]);
+    hash = HashAiValue(hash, gBattleStruct->timesGotHit[GetBattlerSide(battler)][partyIndex]);
+    hash = HASH_AI_STATE(hash, BATTLE_HISTORY->usedMoves[battler]);
+    hash = HashAiValue(hash, AI_THINKING_STRUCT->aiFlags[battler]);
+    hash = HashAiValue(hash, aiData->abilities[battler]);
+    hash = HashAiValue(hash, aiData->items[battler]);
+    hash = HashAiValue(hash, aiData->holdEffects[battler]);
+    hash = HashAiValue(hash, aiData->holdEffectParams[battler]);
+    hash = HashAiValue(hash, aiData->moveLimitations[battler]);
+    hash = HashAiValue(hash, IsBattlerAlive(partner));
+    hash = HashAiValue(hash, aiData->abilities[partner]);
+    return hash;
+}
+
+// Moves whose damage depends on state that isn't hashed: turn order,
+// the last used move, the rest of the party, PP, or values rolled while
+// the move is being used.
+static bool32 IsAiMoveDataVolatile(u32 move)
+{
+    switch (GetMoveEffect(move))
+    {
+    case EFFECT_PAYBACK:
+    case EFFECT_BOLT_BEAK:
+    case EFFECT_ROUND:
+    case EFFECT_FUSION_COMBO:
+    case EFFECT_ECHOED_VOICE:
+    case EFFECT_BEAT_UP:
+    case EFFECT_LAST_RESPECTS:
+    case EFFECT_TRUMP_CARD:
+    case EFFECT_MAGNITUDE:
+    case EFFECT_PRESENT:
+    case EFFECT_TRIPLE_KICK:
+    case EFFECT_ACROBATICS:
+        return TRUE;
+    default:
+        return FALSE;
     }
 }
 
-static void SetBattlerAiMovesData(struct AiLogicData *aiData, u32 battlerAtk, u32 battlersCount, u32 weather)
+// The move slots of battlerAtk that are recalculated even when nothing hashed has changed.
+static u32 GetVolatileAiMoveSlots(struct AiLogicData *aiData, u32 battlerAtk)
 {
-    u32 battlerDef;
-    SaveBattlerData(battlerAtk);
-    SetBattlerData(battlerAtk);
+    u32 moveIndex, slots = 0;
+    u16 *moves = GetMovesArray(battlerAtk);
+
+    // Analytic depends on turn order.
+    if (aiData->abilities[battlerAtk] == ABILITY_ANALYTIC)
+        return ALL_MOVE_SLOTS;
+
+    for (moveIndex = 0; moveIndex < MAX_MON_MOVES; moveIndex++)
+    {
+        if (IsAiMoveDataVolatile(moves[moveIndex]))
+            slots |= 1u << moveIndex;
+    }
+    return slots;
+}
+
+static void SetBattlerAiMovesData(struct AiLogicData *aiData, u32 battlerAtk, u32 battlersCount, u32 weather, u32 fieldHash, const u32 *battlerHashes)
+{
+    u32 battlerDef, key, moveSlots, volatileSlots;
+    bool32 attackerSet = FALSE;
+
+    volatileSlots = GetVolatileAiMoveSlots(aiData, battlerAtk);
 
     // Simulate dmg for both ai controlled mons and for player controlled mons.
     for (battlerDef = 0; battlerDef < battlersCount; battlerDef++)
     {
         if (battlerAtk == battlerDef || !IsBattlerAlive(battlerDef))
+        {
+            ClearBattlerAiMovesData(aiData, battlerAtk, battlerDef);
             continue;
+        }
+
+        // Reuse last turn's entries if neither battler nor the field has changed since.
+        key = HashAiValue(fieldHash, battlerHashes[battlerAtk]);
+        key = HashAiValue(key, battlerHashes[battlerDef]);
+        if (key == 0)
+            key = 1;
+        if (aiData->movesDataKeys[battlerAtk][battlerDef] == key)
+            moveSlots = volatileSlots;
+        else
+            moveSlots = ALL_MOVE_SLOTS;
 
+        aiData->movesDataMisses += __builtin_popcount(moveSlots);
+        aiData->movesDataHits += MAX_MON_MOVES - __builtin_popcount(moveSlots);
+        if (moveSlots == 0)
+            continue;
+
+        if (!attackerSet)
+        {
+            SaveBattlerData(battlerAtk);
+            SetBattlerData(battlerAtk);
+            attackerSet = TRUE;
+        }
         SaveBattlerData(battlerDef);
         SetBattlerData(battlerDef);
-        CalcBattlerAiMovesData(aiData, battlerAtk, battlerDef, weather);
+        CalcBattlerAiMovesData(aiData, battlerAtk, battlerDef, weather, moveSlots);
         RestoreBattlerData(battlerDef);
+        aiData->movesDataKeys[battlerAtk][battlerDef] = key;
     }
-    RestoreBattlerData(battlerAtk);
+    if (attackerSet)
+        RestoreBattlerData(battlerAtk);
 }
 
 void SetAiLogicDataForTurn(struct AiLogicData *aiData)
 {
-    u32 battlerAtk, battlersCount, weather;
+    u32 battlerAtk, battlerDef, battlersCount, weather, fieldHash;
+    u32 battlerHashes[MAX_BATTLERS_COUNT];
 
-    memset(aiData, 0, sizeof(struct AiLogicData));
+    // The moves data is kept, and only recalculated for the battlers whose state has changed.
+    memset(aiData, 0, offsetof(struct AiLogicData, simulatedDmg));
     if (!(gBattleTypeFlags & BATTLE_TYPE_HAS_AI) && !IsWildMonSmart())
         return;
 
@@ -481,12 +671,23 @@ void SetAiLogicDataForTurn(struct AiLogicData *aiData)
         SetBattlerAiData(battlerAtk, aiData);
     }
 
+    fieldHash = GetFieldAiStateHash(aiData, weather);
+    for (battlerAtk = 0; battlerAtk < battlersCount; battlerAtk++)
+    {
+        if (IsBattlerAlive(battlerAtk))
+            battlerHashes[battlerAtk] = GetBattlerAiStateHash(aiData, battlerAtk);
+    }
+
     for (battlerAtk = 0; battlerAtk < battlersCount; battlerAtk++)
     {
         if (!IsBattlerAlive(battlerAtk))
+        {
+            for (battlerDef = 0; battlerDef < battlersCount; battlerDef++)
+                ClearBattlerAiMovesData(aiData, battlerAtk, battlerDef);
             continue;
+        }
 
-        SetBattlerAiMovesData(aiData, battlerAtk, battlersCount, weather);
+        SetBattlerAiMovesData(aiData, battlerAtk, battlersCount, weather, fieldHash, battlerHashes);
     }
     AI_DATA->aiCalcInProgress = FALSE;
 }
@@ -745,7 +946,7 @@ void BattleAI_DoAIProcessing_PredictedSwitchin(struct AI_ThinkingStruct *aiThink
     PokemonToBattleMon(&party[aiData->mostSuitableMonId[battlerDef]], &switchinCandidate);
     gBattleMons[battlerDef] = switchinCandidate;
     SetBattlerAiData(battlerDef, aiData);
-    CalcBattlerAiMovesData(aiData, battlerAtk, battlerDef, AI_GetWeather());
+    CalcBattlerAiMovesData(aiData, battlerAtk, battlerDef, AI_GetWeather(), ALL_MOVE_SLOTS);
 
     // Regular processing with new battler
     do
@@ -1596,7 +1596,7 @@ s16 CloneBattlerSpriteWithBlend(u8 animBattler)
         {
             if (!gSprites[i].inUse)
             {
-                gSprites[i] = gSprites[spriteId];
+                CloneSpriteAt(i, &gSprites[spriteId]);
                 gSprites[i].oam.objMode = ST_OAM_OBJ_BLEND;
                 gSprites[i].invisible = FALSE;
                 return i;
@@ -2218,7 +2218,7 @@ void SetAverageBattlerPositions(u8 battlerId, bool8 respectMonPicOffsets, s16 *x
 u8 CreateInvisibleSpriteCopy(int battlerId, u8 spriteId, int species)
 {
     u8 newSpriteId = CreateInvisibleSpriteWithCallback(SpriteCallbackDummy);
-    gSprites[newSpriteId] = gSprites[spriteId];
+    CloneSpriteAt(newSpriteId, &gSprites[spriteId]);
     gSprites[newSpriteId].usingSheet = TRUE;
     gSprites[newSpriteId].oam.priority = 0;
     gSprites[newSpriteId].oam.objMode = ST_OAM_OBJ_WINDOW;
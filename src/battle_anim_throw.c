@@ -694,8 +694,8 @@ void AnimTask_UnusedLevelUpHealthBox(u8 taskId)
     gSprites[healthBoxSpriteId].oam.priority = 1;
     gSprites[spriteId1].oam.priority = 1;
     gSprites[spriteId2].oam.priority = 1;
-    gSprites[spriteId3] = gSprites[healthBoxSpriteId];
-    gSprites[spriteId4] = gSprites[spriteId1];
+    CloneSpriteAt(spriteId3, &gSprites[healthBoxSpriteId]);
+    CloneSpriteAt(spriteId4, &gSprites[spriteId1]);
     gSprites[spriteId3].oam.objMode = ST_OAM_OBJ_WINDOW;
     gSprites[spriteId4].oam.objMode = ST_OAM_OBJ_WINDOW;
     gSprites[spriteId3].callback = SpriteCallbackDummy;
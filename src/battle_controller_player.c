@@ -1494,7 +1494,7 @@ static void Task_GiveExpWithExpBar(u8 taskId)
     u32 oldMaxHP;
     s32 currExp, expOnNextLvl, newExpPoints;
 
-    if (gTasks[taskId].tExpTask_frames < 13)
+    if (gTasks[taskId].tExpTask_frames < 13 && !gTestRunnerHeadless)
     {
         gTasks[taskId].tExpTask_frames++;
     }
@@ -1505,7 +1505,10 @@ static void Task_GiveExpWithExpBar(u8 taskId)
         u8 battler = gTasks[taskId].tExpTask_battler;
         struct Pokemon *mon = &gPlayerParty[monId];
 
-        newExpPoints = MoveBattleBar(battler, gHealthboxSpriteIds[battler], EXP_BAR, 0);
+        do
+        {
+            newExpPoints = MoveBattleBar(battler, gHealthboxSpriteIds[battler], EXP_BAR, 0);
+        } while (gTestRunnerHeadless && newExpPoints != -1);
         SetHealthboxSpriteVisible(gHealthboxSpriteIds[battler]);
         if (newExpPoints == -1) // The bar has been filled with given exp points.
         {
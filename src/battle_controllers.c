@@ -2237,6 +2237,17 @@ void Controller_WaitForHealthBar(u32 battler)
 {
     s16 hpValue = MoveBattleBar(battler, gHealthboxSpriteIds[battler], HEALTH_BAR, 0);
 
+    // Headless tests drain the whole bar in a single frame.
+    if (gTestRunnerHeadless)
+    {
+        s16 nextHpValue;
+        while (hpValue != -1 && (nextHpValue = MoveBattleBar(battler, gHealthboxSpriteIds[battler], HEALTH_BAR, 0)) != -1)
+            hpValue = nextHpValue;
+        if (hpValue != -1)
+            UpdateHpTextInHealthbox(gHealthboxSpriteIds[battler], HP_CURRENT, hpValue, gBattleMons[battler].maxHP);
+        hpValue = -1;
+    }
+
     SetHealthboxSpriteVisible(gHealthboxSpriteIds[battler]);
     if (hpValue != -1)
     {
@@ -2728,7 +2739,7 @@ void BtlController_HandleStatusAnimation(u32 battler)
 
 void BtlController_HandleHitAnimation(u32 battler)
 {
-    if (gSprites[gBattlerSpriteIds[battler]].invisible == TRUE)
+    if (gSprites[gBattlerSpriteIds[battler]].invisible == TRUE || gTestRunnerHeadless)
     {
         BattleControllerComplete(battler);
     }
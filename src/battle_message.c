@@ -3417,6 +3417,10 @@ void BattlePutTextOnWindow(const u8 *text, u8 windowId)
     struct TextPrinterTemplate printerTemplate;
     u8 speed;
 
+    // Nothing looks at the battle windows in headless tests.
+    if (gTestRunnerHeadless)
+        return;
+
     if (windowId & B_WIN_COPYTOVRAM)
     {
         windowId &= ~B_WIN_COPYTOVRAM;
@@ -4427,6 +4427,7 @@ static bool8 FrontierSquares_Shrink(struct Task *task)
                 gPlttBufferUnfaded[i] = RGB_BLACK;
                 gPlttBufferFaded[i] = RGB_BLACK;
             }
+            MarkPalettesDirty(1 << 15);
             break;
         case 1:
             BlendPalettes(PALETTES_ALL & ~(1 << 15), 16, RGB_BLACK);
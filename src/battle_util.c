@@ -49,6 +49,7 @@
 #include "constants/trainers.h"
 #include "constants/weather.h"
 #include "constants/pokemon.h"
+#include "data/battle/ability_hooks.h"
 
 /*
 NOTE: The data and functions in this file up until (but not including) sSoundMovesTable
@@ -71,6 +72,10 @@ extern const u8 *const gBattlescriptsForRunningByItem[];
 extern const u8 *const gBattlescriptsForUsingItem[];
 extern const u8 *const gBattlescriptsForSafariActions[];
 
+#if TESTING
+EWRAM_DATA bool8 gTestSkipAbilityEffectHooks = FALSE;
+#endif
+
 static const u8 sPkblToEscapeFactor[][3] = {
     {
         [B_MSG_MON_CURIOUS]    = 0,
@@ -4399,6 +4404,34 @@ u32 AbilityBattleEffects(u32 caseID, u32 battler, u32 ability, u32 special, u32
     else
         gLastUsedAbility = GetBattlerAbility(battler);
 
+    // Cases that only switch on the ability have nothing to do for
+    // abilities they have no handler for.
+    if ((ABILITY_EFFECT_KEYED_CASES & (1u << caseID)) && !gTestSkipAbilityEffectHooks)
+    {
+        u32 hookAbility = gLastUsedAbility;
+
+        switch (caseID)
+        {
+        case ABILITYEFFECT_ON_SWITCHIN:
+            gBattleScripting.battler = battler;
+            break;
+        case ABILITYEFFECT_ENDTURN:
+            if (IsBattlerAlive(battler))
+                gBattlerAttacker = battler;
+            break;
+        case ABILITYEFFECT_MOVE_END_OTHER:
+            hookAbility = GetBattlerAbility(battler);
+            break;
+        case ABILITYEFFECT_ON_WEATHER:
+        case ABILITYEFFECT_ON_TERRAIN:
+            hookAbility = gLastUsedAbility = GetBattlerAbility(battler);
+            break;
+        }
+
+        if (hookAbility < ABILITIES_COUNT && !(sAbilityEffectHooks[hookAbility] & (1u << caseID)))
+            return 0;
+    }
+
     if (moveArg)
         move = moveArg;
     else
@@ -6662,7 +6695,73 @@ static inline bool32 CanBreakThroughAbility(u32 battlerAtk, u32 battlerDef, u32
          && gCurrentTurnActionNumber < gBattlersCount);
 }
 
+// Battler state that is read over and over by a damage calculation, and
+// that a damage calculation never changes. It is cached between
+// BeginHotBattlerCache and EndHotBattlerCache.
+struct HotBattlerCache
+{
+    u16 abilities[MAX_BATTLERS_COUNT];
+    u16 holdEffects[MAX_BATTLERS_COUNT];
+    u8 holdEffectParams[MAX_BATTLERS_COUNT];
+    u8 types[MAX_BATTLERS_COUNT][3];
+    u8 cachedAbilities;
+    u8 cachedHoldEffects;
+    u8 cachedHoldEffectParams;
+    u8 cachedTypes;
+    // The distinct abilities of the living battlers, each with the
+    // battlers that have it.
+    u16 presentAbilities[MAX_BATTLERS_COUNT];
+    u8 presentBattlers[MAX_BATTLERS_COUNT];
+    u8 presentCount;
+    bool8 presenceBuilt;
+    u8 depth;
+};
+
+static struct HotBattlerCache sHotBattlers;
+
+static void ClearHotBattlerCache(void)
+{
+    sHotBattlers.cachedAbilities = 0;
+    sHotBattlers.cachedHoldEffects = 0;
+    sHotBattlers.cachedHoldEffectParams = 0;
+    sHotBattlers.cachedTypes = 0;
+    sHotBattlers.presenceBuilt = FALSE;
+}
+
+void BeginHotBattlerCache(void)
+{
+    if (sHotBattlers.depth++ == 0)
+        ClearHotBattlerCache();
+}
+
+// Abilities, items and types do change outside of damage calculations
+// (switch-ins, consumed items, the AI's temporary Protean/Tera types),
+// so nothing cached may outlive the outermost one.
+void EndHotBattlerCache(void)
+{
+    if (--sHotBattlers.depth == 0)
+        ClearHotBattlerCache();
+}
+
+static u32 GetBattlerAbilityInternal(u32 battler);
+
 u32 GetBattlerAbility(u32 battler)
+{
+    u32 ability;
+
+    if (sHotBattlers.cachedAbilities & (1u << battler))
+        return sHotBattlers.abilities[battler];
+
+    ability = GetBattlerAbilityInternal(battler);
+    if (sHotBattlers.depth != 0)
+    {
+        sHotBattlers.abilities[battler] = ability;
+        sHotBattlers.cachedAbilities |= 1u << battler;
+    }
+    return ability;
+}
+
+static u32 GetBattlerAbilityInternal(u32 battler)
 {
     bool32 noAbilityShield = GetBattlerHoldEffectIgnoreAbility(battler, TRUE) != HOLD_EFFECT_ABILITY_SHIELD;
     bool32 abilityCantBeSuppressed = gAbilitiesInfo[gBattleMons[battler].ability].cantBeSuppressed;
@@ -6695,8 +6794,57 @@ u32 GetBattlerAbility(u32 battler)
     return gBattleMons[battler].ability;
 }
 
+static u32 GetBattlersWithAbility(u32 ability)
+{
+    u32 i, j, battlerAbility;
+
+    if (!sHotBattlers.presenceBuilt)
+    {
+        sHotBattlers.presentCount = 0;
+        for (i = 0; i < gBattlersCount; i++)
+        {
+            if (!IsBattlerAlive(i))
+                continue;
+
+            battlerAbility = GetBattlerAbility(i);
+            for (j = 0; j < sHotBattlers.presentCount; j++)
+            {
+                if (sHotBattlers.presentAbilities[j] == battlerAbility)
+                    break;
+            }
+            if (j == sHotBattlers.presentCount)
+            {
+                sHotBattlers.presentAbilities[j] = battlerAbility;
+                sHotBattlers.presentBattlers[j] = 0;
+                sHotBattlers.presentCount++;
+            }
+            sHotBattlers.presentBattlers[j] |= 1u << i;
+        }
+        sHotBattlers.presenceBuilt = TRUE;
+    }
+
+    for (i = 0; i < sHotBattlers.presentCount; i++)
+    {
+        if (sHotBattlers.presentAbilities[i] == ability)
+            return sHotBattlers.presentBattlers[i];
+    }
+    return 0;
+}
+
 u32 IsAbilityOnSide(u32 battler, u32 ability)
 {
+    if (sHotBattlers.depth != 0)
+    {
+        u32 battlers = GetBattlersWithAbility(ability);
+
+        if (battlers & (1u << battler))
+            return battler + 1;
+        else if (battlers & (1u << BATTLE_PARTNER(battler)))
+            return BATTLE_PARTNER(battler) + 1;
+        else
+            return 0;
+    }
+
     if (IsBattlerAlive(battler) && GetBattlerAbility(battler) == ability)
         return battler + 1;
     else if (IsBattlerAlive(BATTLE_PARTNER(battler)) && GetBattlerAbility(BATTLE_PARTNER(battler)) == ability)
@@ -6714,6 +6862,12 @@ u32 IsAbilityOnField(u32 ability)
 {
     u32 i;
 
+    if (sHotBattlers.depth != 0)
+    {
+        u32 battlers = GetBattlersWithAbility(ability);
+        return battlers != 0 ? __builtin_ctz(battlers) + 1 : 0;
+    }
+
     for (i = 0; i < gBattlersCount; i++)
     {
         if (IsBattlerAlive(i) && GetBattlerAbility(i) == ability)
@@ -6727,6 +6881,12 @@ u32 IsAbilityOnFieldExcept(u32 battler, u32 ability)
 {
     u32 i;
 
+    if (sHotBattlers.depth != 0)
+    {
+        u32 battlers = GetBattlersWithAbility(ability) & ~(1u << battler);
+        return battlers != 0 ? __builtin_ctz(battlers) + 1 : 0;
+    }
+
     for (i = 0; i < gBattlersCount; i++)
     {
         if (i != battler && IsBattlerAlive(i) && GetBattlerAbility(i) == ability)
@@ -8706,7 +8866,24 @@ u8 GetAttackerObedienceForAction()
 
 u32 GetBattlerHoldEffect(u32 battler, bool32 checkNegating)
 {
-    return GetBattlerHoldEffectInternal(battler, checkNegating, TRUE);
+    u32 holdEffect;
+
+    if (!checkNegating)
+        return GetBattlerHoldEffectInternal(battler, FALSE, TRUE);
+
+    if (sHotBattlers.cachedHoldEffects & (1u << battler))
+    {
+        gPotentialItemEffectBattler = battler;
+        return sHotBattlers.holdEffects[battler];
+    }
+
+    holdEffect = GetBattlerHoldEffectInternal(battler, TRUE, TRUE);
+    if (sHotBattlers.depth != 0)
+    {
+        sHotBattlers.holdEffects[battler] = holdEffect;
+        sHotBattlers.cachedHoldEffects |= 1u << battler;
+    }
+    return holdEffect;
 }
 
 u32 GetBattlerHoldEffectIgnoreAbility(u32 battler, bool32 checkNegating)
@@ -8744,10 +8921,22 @@ static u32 GetBattlerItemHoldEffectParam(u32 battler, u32 item)
 
 u32 GetBattlerHoldEffectParam(u32 battler)
 {
+    u32 param;
+
+    if (sHotBattlers.cachedHoldEffectParams & (1u << battler))
+        return sHotBattlers.holdEffectParams[battler];
+
     if (gBattleMons[battler].item == ITEM_ENIGMA_BERRY_E_READER)
-        return gEnigmaBerries[battler].holdEffectParam;
+        param = gEnigmaBerries[battler].holdEffectParam;
     else
-        return ItemId_GetHoldEffectParam(gBattleMons[battler].item);
+        param = ItemId_GetHoldEffectParam(gBattleMons[battler].item);
+
+    if (sHotBattlers.depth != 0)
+    {
+        sHotBattlers.holdEffectParams[battler] = param;
+        sHotBattlers.cachedHoldEffectParams |= 1u << battler;
+    }
+    return param;
 }
 
 bool32 IsMoveMakingContact(u32 move, u32 battlerAtk)
@@ -10572,17 +10761,23 @@ static inline bool32 IsFutureSightAttackerInParty(struct DamageCalculationData *
 
 s32 CalculateMoveDamage(struct DamageCalculationData *damageCalcData, u32 fixedBasePower)
 {
-    u32 typeEffectivenessMultiplier = CalcTypeEffectivenessMultiplier(damageCalcData->move,
-                                                                      damageCalcData->moveType,
-                                                                      damageCalcData->battlerAtk,
-                                                                      damageCalcData->battlerDef,
-                                                                      GetBattlerAbility(damageCalcData->battlerDef),
-                                                                      damageCalcData->updateFlags);
+    s32 dmg;
+    u32 typeEffectivenessMultiplier;
 
-    if (IsFutureSightAttackerInParty(damageCalcData))
-        return DoFutureSightAttackDamageCalc(damageCalcData, typeEffectivenessMultiplier, GetWeather());
+    BeginHotBattlerCache();
+    typeEffectivenessMultiplier = CalcTypeEffectivenessMultiplier(damageCalcData->move,
+                                                                  damageCalcData->moveType,
+                                                                  damageCalcData->battlerAtk,
+                                                                  damageCalcData->battlerDef,
+                                                                  GetBattlerAbility(damageCalcData->battlerDef),
+                                                                  damageCalcData->updateFlags);
 
-    return DoMoveDamageCalc(damageCalcData, fixedBasePower, typeEffectivenessMultiplier, GetWeather());
+    if (IsFutureSightAttackerInParty(damageCalcData))
+        dmg = DoFutureSightAttackDamageCalc(damageCalcData, typeEffectivenessMultiplier, GetWeather());
+    else
+        dmg = DoMoveDamageCalc(damageCalcData, fixedBasePower, typeEffectivenessMultiplier, GetWeather());
+    EndHotBattlerCache();
+    return dmg;
 }
 
 // for AI so that typeEffectivenessModifier, weather, abilities and holdEffects are calculated only once
@@ -12024,7 +12219,35 @@ bool8 IsMonBannedFromSkyBattles(u16 species)
     }
 }
 
+static void GetBattlerTypesInternal(u32 battler, bool32 ignoreTera, u32 types[static 3]);
+
 void GetBattlerTypes(u32 battler, bool32 ignoreTera, u32 types[static 3])
+{
+    if (ignoreTera)
+    {
+        GetBattlerTypesInternal(battler, TRUE, types);
+        return;
+    }
+
+    if (sHotBattlers.cachedTypes & (1u << battler))
+    {
+        types[0] = sHotBattlers.types[battler][0];
+        types[1] = sHotBattlers.types[battler][1];
+        types[2] = sHotBattlers.types[battler][2];
+        return;
+    }
+
+    GetBattlerTypesInternal(battler, FALSE, types);
+    if (sHotBattlers.depth != 0)
+    {
+        sHotBattlers.types[battler][0] = types[0];
+        sHotBattlers.types[battler][1] = types[1];
+        sHotBattlers.types[battler][2] = types[2];
+        sHotBattlers.cachedTypes |= 1u << battler;
+    }
+}
+
+static void GetBattlerTypesInternal(u32 battler, bool32 ignoreTera, u32 types[static 3])
 {
     // Terastallization.
     bool32 isTera = GetActiveGimmick(battler) == GIMMICK_TERA;
@@ -0,0 +1,132 @@
+//
+// DO NOT MODIFY THIS FILE! It is auto-generated from tools/battle_helpers/ability_hooks.py
+//
+
+#define ABILITY_EFFECT_KEYED_CASES ((1u << ABILITYEFFECT_ON_SWITCHIN) | (1u << ABILITYEFFECT_ENDTURN) | (1u << ABILITYEFFECT_MOVE_END) | (1u << ABILITYEFFECT_MOVE_END_ATTACKER) | (1u << ABILITYEFFECT_MOVE_END_OTHER) | (1u << ABILITYEFFECT_ON_WEATHER) | (1u << ABILITYEFFECT_ON_TERRAIN))
+
+static const u32 sAbilityEffectHooks[ABILITIES_COUNT] =
+{
+    [ABILITY_AFTERMATH] = (1u << ABILITYEFFECT_MOVE_END),
+    [ABILITY_AIR_LOCK] = (1u << ABILITYEFFECT_ON_SWITCHIN),
+    [ABILITY_ANGER_POINT] = (1u << ABILITYEFFECT_MOVE_END),
+    [ABILITY_ANGER_SHELL] = (1u << ABILITYEFFECT_MOVE_END),
+    [ABILITY_ANTICIPATION] = (1u << ABILITYEFFECT_ON_SWITCHIN),
+    [ABILITY_AS_ONE_ICE_RIDER] = (1u << ABILITYEFFECT_ON_SWITCHIN),
+    [ABILITY_AS_ONE_SHADOW_RIDER] = (1u << ABILITYEFFECT_ON_SWITCHIN),
+    [ABILITY_AURA_BREAK] = (1u << ABILITYEFFECT_ON_SWITCHIN),
+    [ABILITY_BAD_DREAMS] = (1u << ABILITYEFFECT_ENDTURN),
+    [ABILITY_BALL_FETCH] = (1u << ABILITYEFFECT_ENDTURN),
+    [ABILITY_BEADS_OF_RUIN] = (1u << ABILITYEFFECT_ON_SWITCHIN),
+    [ABILITY_BERSERK] = (1u << ABILITYEFFECT_MOVE_END),
+    [ABILITY_CLOUD_NINE] = (1u << ABILITYEFFECT_ON_SWITCHIN),
+    [ABILITY_COLOR_CHANGE] = (1u << ABILITYEFFECT_MOVE_END),
+    [ABILITY_COMATOSE] = (1u << ABILITYEFFECT_ON_SWITCHIN),
+    [ABILITY_COMMANDER] = (1u << ABILITYEFFECT_ON_SWITCHIN),
+    [ABILITY_COSTAR] = (1u << ABILITYEFFECT_ON_SWITCHIN),
+    [ABILITY_COTTON_DOWN] = (1u << ABILITYEFFECT_MOVE_END),
+    [ABILITY_CUD_CHEW] = (1u << ABILITYEFFECT_ENDTURN),
+    [ABILITY_CURIOUS_MEDICINE] = (1u << ABILITYEFFECT_ON_SWITCHIN),
+    [ABILITY_CURSED_BODY] = (1u << ABILITYEFFECT_MOVE_END),
+    [ABILITY_CUTE_CHARM] = (1u << ABILITYEFFECT_MOVE_END),
+    [ABILITY_DANCER] = (1u << ABILITYEFFECT_MOVE_END_OTHER),
+    [ABILITY_DARK_AURA] = (1u << ABILITYEFFECT_ON_SWITCHIN),
+    [ABILITY_DAUNTLESS_SHIELD] = (1u << ABILITYEFFECT_ON_SWITCHIN),
+    [ABILITY_DELTA_STREAM] = (1u << ABILITYEFFECT_ON_SWITCHIN),
+    [ABILITY_DESOLATE_LAND] = (1u << ABILITYEFFECT_ON_SWITCHIN),
+    [ABILITY_DOWNLOAD] = (1u << ABILITYEFFECT_ON_SWITCHIN),
+    [ABILITY_DRIZZLE] = (1u << ABILITYEFFECT_ON_SWITCHIN),
+    [ABILITY_DROUGHT] = (1u << ABILITYEFFECT_ON_SWITCHIN),
+    [ABILITY_DRY_SKIN] = (1u << ABILITYEFFECT_ENDTURN),
+    [ABILITY_EFFECT_SPORE] = (1u << ABILITYEFFECT_MOVE_END),
+    [ABILITY_ELECTRIC_SURGE] = (1u << ABILITYEFFECT_ON_SWITCHIN),
+    [ABILITY_ELECTROMORPHOSIS] = (1u << ABILITYEFFECT_MOVE_END),
+    [ABILITY_EMBODY_ASPECT_CORNERSTONE_MASK] = (1u << ABILITYEFFECT_ON_SWITCHIN),
+    [ABILITY_EMBODY_ASPECT_HEARTHFLAME_MASK] = (1u << ABILITYEFFECT_ON_SWITCHIN),
+    [ABILITY_EMBODY_ASPECT_TEAL_MASK] = (1u << ABILITYEFFECT_ON_SWITCHIN),
+    [ABILITY_EMBODY_ASPECT_WELLSPRING_MASK] = (1u << ABILITYEFFECT_ON_SWITCHIN),
+    [ABILITY_EMERGENCY_EXIT] = (1u << ABILITYEFFECT_MOVE_END),
+    [ABILITY_FAIRY_AURA] = (1u << ABILITYEFFECT_ON_SWITCHIN),
+    [ABILITY_FLAME_BODY] = (1u << ABILITYEFFECT_MOVE_END),
+    [ABILITY_FLOWER_GIFT] = (1u << ABILITYEFFECT_ON_WEATHER),
+    [ABILITY_FORECAST] = (1u << ABILITYEFFECT_ON_WEATHER),
+    [ABILITY_FOREWARN] = (1u << ABILITYEFFECT_ON_SWITCHIN),
+    [ABILITY_FRISK] = (1u << ABILITYEFFECT_ON_SWITCHIN),
+    [ABILITY_GOOEY] = (1u << ABILITYEFFECT_MOVE_END),
+    [ABILITY_GRASSY_SURGE] = (1u << ABILITYEFFECT_ON_SWITCHIN),
+    [ABILITY_GULP_MISSILE] = (1u << ABILITYEFFECT_MOVE_END) | (1u << ABILITYEFFECT_MOVE_END_ATTACKER),
+    [ABILITY_HADRON_ENGINE] = (1u << ABILITYEFFECT_ON_SWITCHIN),
+    [ABILITY_HARVEST] = (1u << ABILITYEFFECT_ENDTURN),
+    [ABILITY_HEALER] = (1u << ABILITYEFFECT_ENDTURN),
+    [ABILITY_HOSPITALITY] = (1u << ABILITYEFFECT_ON_SWITCHIN),
+    [ABILITY_HUNGER_SWITCH] = (1u << ABILITYEFFECT_ENDTURN),
+    [ABILITY_HYDRATION] = (1u << ABILITYEFFECT_ENDTURN),
+    [ABILITY_ICE_FACE] = (1u << ABILITYEFFECT_ON_SWITCHIN) | (1u << ABILITYEFFECT_ON_WEATHER),
+    [ABILITY_ILLUSION] = (1u << ABILITYEFFECT_MOVE_END),
+    [ABILITY_IMPOSTER] = (1u << ABILITYEFFECT_ON_SWITCHIN),
+    [ABILITY_INNARDS_OUT] = (1u << ABILITYEFFECT_MOVE_END),
+    [ABILITY_INTIMIDATE] = (1u << ABILITYEFFECT_ON_SWITCHIN),
+    [ABILITY_INTREPID_SWORD] = (1u << ABILITYEFFECT_ON_SWITCHIN),
+    [ABILITY_IRON_BARBS] = (1u << ABILITYEFFECT_MOVE_END),
+    [ABILITY_JUSTIFIED] = (1u << ABILITYEFFECT_MOVE_END),
+    [ABILITY_LINGERING_AROMA] = (1u << ABILITYEFFECT_MOVE_END),
+    [ABILITY_MIMICRY] = (1u << ABILITYEFFECT_ON_TERRAIN),
+    [ABILITY_MISTY_SURGE] = (1u << ABILITYEFFECT_ON_SWITCHIN),
+    [ABILITY_MOLD_BREAKER] = (1u << ABILITYEFFECT_ON_SWITCHIN),
+    [ABILITY_MOODY] = (1u << ABILITYEFFECT_ENDTURN),
+    [ABILITY_MUMMY] = (1u << ABILITYEFFECT_MOVE_END),
+    [ABILITY_ORICHALCUM_PULSE] = (1u << ABILITYEFFECT_ON_SWITCHIN),
+    [ABILITY_PASTEL_VEIL] = (1u << ABILITYEFFECT_ON_SWITCHIN),
+    [ABILITY_PERISH_BODY] = (1u << ABILITYEFFECT_MOVE_END),
+    [ABILITY_PICKUP] = (1u << ABILITYEFFECT_ENDTURN),
+    [ABILITY_POISON_POINT] = (1u << ABILITYEFFECT_MOVE_END),
+    [ABILITY_POISON_PUPPETEER] = (1u << ABILITYEFFECT_MOVE_END_ATTACKER),
+    [ABILITY_POISON_TOUCH] = (1u << ABILITYEFFECT_MOVE_END_ATTACKER),
+    [ABILITY_POWER_CONSTRUCT] = (1u << ABILITYEFFECT_ENDTURN),
+    [ABILITY_PRESSURE] = (1u << ABILITYEFFECT_ON_SWITCHIN),
+    [ABILITY_PRIMORDIAL_SEA] = (1u << ABILITYEFFECT_ON_SWITCHIN),
+    [ABILITY_PROTOSYNTHESIS] = (1u << ABILITYEFFECT_ON_WEATHER),
+    [ABILITY_PSYCHIC_SURGE] = (1u << ABILITYEFFECT_ON_SWITCHIN),
+    [ABILITY_QUARK_DRIVE] = (1u << ABILITYEFFECT_ON_TERRAIN),
+    [ABILITY_RAIN_DISH] = (1u << ABILITYEFFECT_ENDTURN),
+    [ABILITY_RATTLED] = (1u << ABILITYEFFECT_MOVE_END),
+    [ABILITY_ROUGH_SKIN] = (1u << ABILITYEFFECT_MOVE_END),
+    [ABILITY_SAND_SPIT] = (1u << ABILITYEFFECT_MOVE_END),
+    [ABILITY_SAND_STREAM] = (1u << ABILITYEFFECT_ON_SWITCHIN),
+    [ABILITY_SCHOOLING] = (1u << ABILITYEFFECT_ON_SWITCHIN) | (1u << ABILITYEFFECT_ENDTURN),
+    [ABILITY_SCREEN_CLEANER] = (1u << ABILITYEFFECT_ON_SWITCHIN),
+    [ABILITY_SEED_SOWER] = (1u << ABILITYEFFECT_MOVE_END),
+    [ABILITY_SHED_SKIN] = (1u << ABILITYEFFECT_ENDTURN),
+    [ABILITY_SHIELDS_DOWN] = (1u << ABILITYEFFECT_ON_SWITCHIN) | (1u << ABILITYEFFECT_ENDTURN),
+    [ABILITY_SLOW_START] = (1u << ABILITYEFFECT_ON_SWITCHIN),
+    [ABILITY_SNOW_WARNING] = (1u << ABILITYEFFECT_ON_SWITCHIN),
+    [ABILITY_SOLAR_POWER] = (1u << ABILITYEFFECT_ENDTURN),
+    [ABILITY_SPEED_BOOST] = (1u << ABILITYEFFECT_ENDTURN),
+    [ABILITY_STAMINA] = (1u << ABILITYEFFECT_MOVE_END),
+    [ABILITY_STATIC] = (1u << ABILITYEFFECT_MOVE_END),
+    [ABILITY_STEAM_ENGINE] = (1u << ABILITYEFFECT_MOVE_END),
+    [ABILITY_STENCH] = (1u << ABILITYEFFECT_MOVE_END_ATTACKER),
+    [ABILITY_SUPERSWEET_SYRUP] = (1u << ABILITYEFFECT_ON_SWITCHIN),
+    [ABILITY_SUPREME_OVERLORD] = (1u << ABILITYEFFECT_ON_SWITCHIN),
+    [ABILITY_SWORD_OF_RUIN] = (1u << ABILITYEFFECT_ON_SWITCHIN),
+    [ABILITY_TABLETS_OF_RUIN] = (1u << ABILITYEFFECT_ON_SWITCHIN),
+    [ABILITY_TANGLING_HAIR] = (1u << ABILITYEFFECT_MOVE_END),
+    [ABILITY_TERAFORM_ZERO] = (1u << ABILITYEFFECT_ON_SWITCHIN),
+    [ABILITY_TERAVOLT] = (1u << ABILITYEFFECT_ON_SWITCHIN),
+    [ABILITY_TERA_SHIFT] = (1u << ABILITYEFFECT_ON_SWITCHIN),
+    [ABILITY_THERMAL_EXCHANGE] = (1u << ABILITYEFFECT_MOVE_END),
+    [ABILITY_TOXIC_CHAIN] = (1u << ABILITYEFFECT_MOVE_END_ATTACKER),
+    [ABILITY_TOXIC_DEBRIS] = (1u << ABILITYEFFECT_MOVE_END),
+    [ABILITY_TRACE] = (1u << ABILITYEFFECT_ON_SWITCHIN),
+    [ABILITY_TRUANT] = (1u << ABILITYEFFECT_ENDTURN),
+    [ABILITY_TURBOBLAZE] = (1u << ABILITYEFFECT_ON_SWITCHIN),
+    [ABILITY_UNNERVE] = (1u << ABILITYEFFECT_ON_SWITCHIN),
+    [ABILITY_VESSEL_OF_RUIN] = (1u << ABILITYEFFECT_ON_SWITCHIN),
+    [ABILITY_WANDERING_SPIRIT] = (1u << ABILITYEFFECT_MOVE_END),
+    [ABILITY_WATER_COMPACTION] = (1u << ABILITYEFFECT_MOVE_END),
+    [ABILITY_WEAK_ARMOR] = (1u << ABILITYEFFECT_MOVE_END),
+    [ABILITY_WIMP_OUT] = (1u << ABILITYEFFECT_MOVE_END),
+    [ABILITY_WIND_POWER] = (1u << ABILITYEFFECT_MOVE_END),
+    [ABILITY_WIND_RIDER] = (1u << ABILITYEFFECT_ON_SWITCHIN),
+    [ABILITY_ZEN_MODE] = (1u << ABILITYEFFECT_ON_SWITCHIN) | (1u << ABILITYEFFECT_ENDTURN),
+    [ABILITY_ZERO_TO_HERO] = (1u << ABILITYEFFECT_ON_SWITCHIN),
+};
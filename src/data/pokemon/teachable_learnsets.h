@@ -2,6 +2,95 @@
 // DO NOT MODIFY THIS FILE! It is auto-generated from tools/learnset_helpers/teachable.py
 //
 
+#define TEACHABLE_BITSET_SIZE 6
+#define TEACHABLE_BITSET(...) __VA_ARGS__
+
+// 1 + the index of each move's bit in the learnsets' bitsets, or 0 if no learnset has the move.
+static const u8 sTeachableMoveBitIndexes[MOVES_COUNT] = {
+    [MOVE_FOCUS_PUNCH] = 1,
+    [MOVE_DRAGON_CLAW] = 2,
+    [MOVE_WATER_PULSE] = 3,
+    [MOVE_CALM_MIND] = 4,
+    [MOVE_ROAR] = 5,
+    [MOVE_TOXIC] = 6,
+    [MOVE_HAIL] = 7,
+    [MOVE_BULK_UP] = 8,
+    [MOVE_BULLET_SEED] = 9,
+    [MOVE_SUNNY_DAY] = 10,
+    [MOVE_TAUNT] = 11,
+    [MOVE_ICE_BEAM] = 12,
+    [MOVE_BLIZZARD] = 13,
+    [MOVE_HYPER_BEAM] = 14,
+    [MOVE_LIGHT_SCREEN] = 15,
+    [MOVE_PROTECT] = 16,
+    [MOVE_RAIN_DANCE] = 17,
+    [MOVE_GIGA_DRAIN] = 18,
+    [MOVE_SAFEGUARD] = 19,
+    [MOVE_SOLAR_BEAM] = 20,
+    [MOVE_IRON_TAIL] = 21,
+    [MOVE_THUNDERBOLT] = 22,
+    [MOVE_THUNDER] = 23,
+    [MOVE_EARTHQUAKE] = 24,
+    [MOVE_DIG] = 25,
+    [MOVE_PSYCHIC] = 26,
+    [MOVE_SHADOW_BALL] = 27,
+    [MOVE_BRICK_BREAK] = 28,
+    [MOVE_DOUBLE_TEAM] = 29,
+    [MOVE_REFLECT] = 30,
+    [MOVE_SHOCK_WAVE] = 31,
+    [MOVE_FLAMETHROWER] = 32,
+    [MOVE_SLUDGE_BOMB] = 33,
+    [MOVE_SANDSTORM] = 34,
+    [MOVE_FIRE_BLAST] = 35,
+    [MOVE_ROCK_TOMB] = 36,
+    [MOVE_AERIAL_ACE] = 37,
+    [MOVE_TORMENT] = 38,
+    [MOVE_FACADE] = 39,
+    [MOVE_REST] = 40,
+    [MOVE_ATTRACT] = 41,
+    [MOVE_THIEF] = 42,
+    [MOVE_STEEL_WING] = 43,
+    [MOVE_SKILL_SWAP] = 44,
+    [MOVE_SNATCH] = 45,
+    [MOVE_OVERHEAT] = 46,
+    [MOVE_CUT] = 47,
+    [MOVE_FLY] = 48,
+    [MOVE_SURF] = 49,
+    [MOVE_STRENGTH] = 50,
+    [MOVE_FLASH] = 51,
+    [MOVE_ROCK_SMASH] = 52,
+    [MOVE_WATERFALL] = 53,
+    [MOVE_DIVE] = 54,
+    [MOVE_BODY_SLAM] = 55,
+    [MOVE_COUNTER] = 56,
+    [MOVE_DEFENSE_CURL] = 57,
+    [MOVE_DOUBLE_EDGE] = 58,
+    [MOVE_DREAM_EATER] = 59,
+    [MOVE_DYNAMIC_PUNCH] = 60,
+    [MOVE_ENDURE] = 61,
+    [MOVE_EXPLOSION] = 62,
+    [MOVE_FIRE_PUNCH] = 63,
+    [MOVE_FURY_CUTTER] = 64,
+    [MOVE_ICE_PUNCH] = 65,
+    [MOVE_ICY_WIND] = 66,
+    [MOVE_MEGA_KICK] = 67,
+    [MOVE_MEGA_PUNCH] = 68,
+    [MOVE_METRONOME] = 69,
+    [MOVE_MUD_SLAP] = 70,
+    [MOVE_PSYCH_UP] = 71,
+    [MOVE_ROCK_SLIDE] = 72,
+    [MOVE_ROLLOUT] = 73,
+    [MOVE_SEISMIC_TOSS] = 74,
+    [MOVE_SLEEP_TALK] = 75,
+    [MOVE_SNORE] = 76,
+    [MOVE_SOFT_BOILED] = 77,
+    [MOVE_SWAGGER] = 78,
+    [MOVE_SWIFT] = 79,
+    [MOVE_SWORDS_DANCE] = 80,
+    [MOVE_THUNDER_PUNCH] = 81,
+    [MOVE_THUNDER_WAVE] = 82,
+};
+
 // *************************************************** //
 // TM/HM moves found in "include/constants/tms_hms.h": //
 // - MOVE_FOCUS_PUNCH                                  //
@@ -108,12 +197,15 @@
 // - MOVE_TERA_BLAST                                   //
 // *************************************************** //
 
-static const u16 sNoneTeachableLearnset[] = {
+static const u16 sNoneTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000),
     MOVE_UNAVAILABLE,
 };
+#define sNoneTeachableLearnset (sNoneTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
 #if P_FAMILY_BULBASAUR
-static const u16 sBulbasaurTeachableLearnset[] = {
+static const u16 sBulbasaurTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC320, 0x300E, 0x41C1, 0x934E, 0xAC20, 0x0000),
     MOVE_ATTRACT,
     MOVE_BULLET_SEED,
     MOVE_CUT,
@@ -144,8 +236,10 @@ static const u16 sBulbasaurTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sBulbasaurTeachableLearnset (sBulbasaurTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sIvysaurTeachableLearnset[] = {
+static const u16 sIvysaurTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC330, 0x300E, 0x41C1, 0x934E, 0xAC20, 0x0000),
     MOVE_ATTRACT,
     MOVE_BULLET_SEED,
     MOVE_CUT,
@@ -177,8 +271,10 @@ static const u16 sIvysaurTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sIvysaurTeachableLearnset (sIvysaurTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sVenusaurTeachableLearnset[] = {
+static const u16 sVenusaurTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE330, 0x308E, 0x41C1, 0x934E, 0xAC20, 0x0000),
     MOVE_ATTRACT,
     MOVE_BULLET_SEED,
     MOVE_CUT,
@@ -212,10 +308,12 @@ static const u16 sVenusaurTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sVenusaurTeachableLearnset (sVenusaurTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_BULBASAUR
 
 #if P_FAMILY_CHARMANDER
-static const u16 sCharmanderTeachableLearnset[] = {
+static const u16 sCharmanderTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8233, 0xB910, 0x61DC, 0xDBCA, 0xEEAC, 0x0001),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -259,8 +357,10 @@ static const u16 sCharmanderTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sCharmanderTeachableLearnset (sCharmanderTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sCharmeleonTeachableLearnset[] = {
+static const u16 sCharmeleonTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8233, 0xB910, 0x61DC, 0xDBCA, 0xEEAC, 0x0001),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -304,8 +404,10 @@ static const u16 sCharmeleonTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sCharmeleonTeachableLearnset (sCharmeleonTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sCharizardTeachableLearnset[] = {
+static const u16 sCharizardTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA233, 0xB998, 0xE5DE, 0xDBCA, 0xEEAC, 0x0001),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -355,10 +457,12 @@ static const u16 sCharizardTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sCharizardTeachableLearnset (sCharizardTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_CHARMANDER
 
 #if P_FAMILY_SQUIRTLE
-static const u16 sSquirtleTeachableLearnset[] = {
+static const u16 sSquirtleTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9865, 0x3911, 0x01C8, 0x1BFB, 0x2FAF, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_BRICK_BREAK,
@@ -400,8 +504,10 @@ static const u16 sSquirtleTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sSquirtleTeachableLearnset (sSquirtleTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sWartortleTeachableLearnset[] = {
+static const u16 sWartortleTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9865, 0x3911, 0x01C8, 0x1BFB, 0x2FAF, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_BRICK_BREAK,
@@ -443,8 +549,10 @@ static const u16 sWartortleTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sWartortleTeachableLearnset (sWartortleTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sBlastoiseTeachableLearnset[] = {
+static const u16 sBlastoiseTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xB875, 0x3991, 0x01C8, 0x1BFB, 0x2FAF, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_BRICK_BREAK,
@@ -489,19 +597,25 @@ static const u16 sBlastoiseTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sBlastoiseTeachableLearnset (sBlastoiseTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_SQUIRTLE
 
 #if P_FAMILY_CATERPIE
-static const u16 sCaterpieTeachableLearnset[] = {
+static const u16 sCaterpieTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0000),
     MOVE_SNORE,
     MOVE_UNAVAILABLE,
 };
+#define sCaterpieTeachableLearnset (sCaterpieTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sMetapodTeachableLearnset[] = {
+static const u16 sMetapodTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000),
     MOVE_UNAVAILABLE,
 };
+#define sMetapodTeachableLearnset (sMetapodTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sButterfreeTeachableLearnset[] = {
+static const u16 sButterfreeTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA220, 0x360F, 0x0BD0, 0x1604, 0x6C40, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_DOUBLE_TEAM,
@@ -531,18 +645,24 @@ static const u16 sButterfreeTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sButterfreeTeachableLearnset (sButterfreeTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_CATERPIE
 
 #if P_FAMILY_WEEDLE
-static const u16 sWeedleTeachableLearnset[] = {
+static const u16 sWeedleTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000),
     MOVE_UNAVAILABLE,
 };
+#define sWeedleTeachableLearnset (sWeedleTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sKakunaTeachableLearnset[] = {
+static const u16 sKakunaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000),
     MOVE_UNAVAILABLE,
 };
+#define sKakunaTeachableLearnset (sKakunaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sBeedrillTeachableLearnset[] = {
+static const u16 sBeedrillTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA220, 0x380A, 0x43D1, 0x920C, 0xEC00, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -571,10 +691,12 @@ static const u16 sBeedrillTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sBeedrillTeachableLearnset (sBeedrillTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_WEEDLE
 
 #if P_FAMILY_PIDGEY
-static const u16 sPidgeyTeachableLearnset[] = {
+static const u16 sPidgeyTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8220, 0x3001, 0x87D0, 0x1200, 0x6C20, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_DOUBLE_TEAM,
@@ -597,8 +719,10 @@ static const u16 sPidgeyTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sPidgeyTeachableLearnset (sPidgeyTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sPidgeottoTeachableLearnset[] = {
+static const u16 sPidgeottoTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8220, 0x3001, 0x87D0, 0x1200, 0x6C20, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_DOUBLE_TEAM,
@@ -621,8 +745,10 @@ static const u16 sPidgeottoTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sPidgeottoTeachableLearnset (sPidgeottoTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sPidgeotTeachableLearnset[] = {
+static const u16 sPidgeotTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA220, 0x3001, 0x87D0, 0x1200, 0x6C20, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_DOUBLE_TEAM,
@@ -646,10 +772,12 @@ static const u16 sPidgeotTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sPidgeotTeachableLearnset (sPidgeotTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_PIDGEY
 
 #if P_FAMILY_RATTATA
-static const u16 sRattataTeachableLearnset[] = {
+static const u16 sRattataTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9E20, 0x5571, 0x43C1, 0x13C8, 0x6C22, 0x0002),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_CUT,
@@ -685,8 +813,10 @@ static const u16 sRattataTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sRattataTeachableLearnset (sRattataTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sRaticateTeachableLearnset[] = {
+static const u16 sRaticateTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xBE30, 0x5571, 0x43C1, 0x13CA, 0xEC22, 0x0002),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_CUT,
@@ -726,9 +856,11 @@ static const u16 sRaticateTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sRaticateTeachableLearnset (sRaticateTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
 #if P_ALOLAN_FORMS
-static const u16 sRattataAlolaTeachableLearnset[] = {
+static const u16 sRattataAlolaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9E20, 0x5511, 0x13E1, 0x0280, 0x2C02, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_DIG,
@@ -756,8 +888,10 @@ static const u16 sRattataAlolaTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sRattataAlolaTeachableLearnset (sRattataAlolaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sRaticateAlolaTeachableLearnset[] = {
+static const u16 sRaticateAlolaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xBEB0, 0x5511, 0x13E1, 0x0280, 0xAC02, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_BULK_UP,
@@ -789,11 +923,13 @@ static const u16 sRaticateAlolaTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sRaticateAlolaTeachableLearnset (sRaticateAlolaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_ALOLAN_FORMS
 #endif //P_FAMILY_RATTATA
 
 #if P_FAMILY_SPEAROW
-static const u16 sSpearowTeachableLearnset[] = {
+static const u16 sSpearowTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8220, 0x1001, 0x87D0, 0x1200, 0x6C20, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_DOUBLE_TEAM,
@@ -815,8 +951,10 @@ static const u16 sSpearowTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sSpearowTeachableLearnset (sSpearowTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sFearowTeachableLearnset[] = {
+static const u16 sFearowTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA220, 0x1001, 0x87D0, 0x1200, 0x6C20, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_DOUBLE_TEAM,
@@ -839,10 +977,12 @@ static const u16 sFearowTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sFearowTeachableLearnset (sFearowTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_SPEAROW
 
 #if P_FAMILY_EKANS
-static const u16 sEkansTeachableLearnset[] = {
+static const u16 sEkansTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8220, 0x1193, 0x13E9, 0x1242, 0x2CA0, 0x0000),
     MOVE_ATTRACT,
     MOVE_DIG,
     MOVE_DOUBLE_TEAM,
@@ -871,8 +1011,10 @@ static const u16 sEkansTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sEkansTeachableLearnset (sEkansTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sArbokTeachableLearnset[] = {
+static const u16 sArbokTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA220, 0x1193, 0x13E9, 0x1242, 0x2CA0, 0x0000),
     MOVE_ATTRACT,
     MOVE_DIG,
     MOVE_DOUBLE_TEAM,
@@ -902,11 +1044,13 @@ static const u16 sArbokTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sArbokTeachableLearnset (sArbokTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_EKANS
 
 #if P_FAMILY_PIKACHU
 #if P_GEN_2_CROSS_EVOS
-static const u16 sPichuTeachableLearnset[] = {
+static const u16 sPichuTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC020, 0x7071, 0x01C0, 0x13C5, 0x6F2C, 0x0003),
     MOVE_ATTRACT,
     MOVE_DOUBLE_TEAM,
     MOVE_FACADE,
@@ -940,9 +1084,11 @@ static const u16 sPichuTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sPichuTeachableLearnset (sPichuTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_GEN_2_CROSS_EVOS
 
-static const u16 sPikachuTeachableLearnset[] = {
+static const u16 sPikachuTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC029, 0x7971, 0x03C0, 0x1BCF, 0x6F2C, 0x0003),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_CALM_MIND,
@@ -984,8 +1130,10 @@ static const u16 sPikachuTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sPikachuTeachableLearnset (sPikachuTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sRaichuTeachableLearnset[] = {
+static const u16 sRaichuTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE029, 0x7975, 0x03C0, 0x1BCF, 0x6F2C, 0x0003),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_CALM_MIND,
@@ -1029,9 +1177,11 @@ static const u16 sRaichuTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sRaichuTeachableLearnset (sRaichuTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
 #if P_ALOLAN_FORMS
-static const u16 sRaichuAlolaTeachableLearnset[] = {
+static const u16 sRaichuAlolaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE029, 0x7B75, 0x0BC0, 0x1049, 0x6E0C, 0x0003),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_CALM_MIND,
@@ -1069,11 +1219,13 @@ static const u16 sRaichuAlolaTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sRaichuAlolaTeachableLearnset (sRaichuAlolaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_ALOLAN_FORMS
 #endif //P_FAMILY_PIKACHU
 
 #if P_FAMILY_SANDSHREW
-static const u16 sSandshrewTeachableLearnset[] = {
+static const u16 sSandshrewTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8221, 0x1994, 0x43DA, 0x9BCA, 0xEFA0, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -1112,8 +1264,10 @@ static const u16 sSandshrewTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sSandshrewTeachableLearnset (sSandshrewTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sSandslashTeachableLearnset[] = {
+static const u16 sSandslashTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA221, 0x1994, 0x43DA, 0x9BCA, 0xEFA0, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -1153,9 +1307,11 @@ static const u16 sSandslashTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sSandslashTeachableLearnset (sSandslashTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
 #if P_ALOLAN_FORMS
-static const u16 sSandshrewAlolaTeachableLearnset[] = {
+static const u16 sSandshrewAlolaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9A61, 0x1994, 0x03D8, 0x93C0, 0xEF83, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
@@ -1193,8 +1349,10 @@ static const u16 sSandshrewAlolaTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sSandshrewAlolaTeachableLearnset (sSandshrewAlolaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sSandslashAlolaTeachableLearnset[] = {
+static const u16 sSandslashAlolaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xBA61, 0x1994, 0x03D8, 0x93C0, 0xEF83, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
@@ -1233,11 +1391,13 @@ static const u16 sSandslashAlolaTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sSandslashAlolaTeachableLearnset (sSandslashAlolaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_ALOLAN_FORMS
 #endif //P_FAMILY_SANDSHREW
 
 #if P_FAMILY_NIDORAN
-static const u16 sNidoranFTeachableLearnset[] = {
+static const u16 sNidoranFTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9A24, 0x7171, 0x43D1, 0x13CA, 0x2C20, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
@@ -1272,8 +1432,10 @@ static const u16 sNidoranFTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sNidoranFTeachableLearnset (sNidoranFTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sNidorinaTeachableLearnset[] = {
+static const u16 sNidorinaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9A24, 0x7171, 0x43D1, 0x13CA, 0x2C20, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
@@ -1308,8 +1470,10 @@ static const u16 sNidorinaTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sNidorinaTeachableLearnset (sNidorinaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sNidoqueenTeachableLearnset[] = {
+static const u16 sNidoqueenTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xBE35, 0xFDF1, 0x43FF, 0xDBCB, 0x2EAF, 0x0001),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
@@ -1367,8 +1531,10 @@ static const u16 sNidoqueenTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sNidoqueenTeachableLearnset (sNidoqueenTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sNidoranMTeachableLearnset[] = {
+static const u16 sNidoranMTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9A24, 0x7171, 0x43C1, 0x13CA, 0x2C20, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_CUT,
@@ -1402,8 +1568,10 @@ static const u16 sNidoranMTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sNidoranMTeachableLearnset (sNidoranMTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sNidorinoTeachableLearnset[] = {
+static const u16 sNidorinoTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9A24, 0x7171, 0x43C1, 0x13CA, 0x2C20, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_CUT,
@@ -1437,8 +1605,10 @@ static const u16 sNidorinoTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sNidorinoTeachableLearnset (sNidorinoTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sNidokingTeachableLearnset[] = {
+static const u16 sNidokingTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xBE35, 0xFDF1, 0x43EF, 0xDBCB, 0x2EAF, 0x0001),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_BRICK_BREAK,
@@ -1495,11 +1665,13 @@ static const u16 sNidokingTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sNidokingTeachableLearnset (sNidokingTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_NIDORAN
 
 #if P_FAMILY_CLEFAIRY
 #if P_GEN_2_CROSS_EVOS
-static const u16 sCleffaTeachableLearnset[] = {
+static const u16 sCleffaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC22C, 0xF71D, 0x01C4, 0x17C4, 0x7F7E, 0x0002),
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
     MOVE_DIG,
@@ -1544,9 +1716,11 @@ static const u16 sCleffaTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sCleffaTeachableLearnset (sCleffaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_GEN_2_CROSS_EVOS
 
-static const u16 sClefairyTeachableLearnset[] = {
+static const u16 sClefairyTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xDA2D, 0xFF7D, 0x1BC4, 0x5FCE, 0x7F7F, 0x0003),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_BRICK_BREAK,
@@ -1606,8 +1780,10 @@ static const u16 sClefairyTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sClefairyTeachableLearnset (sClefairyTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sClefableTeachableLearnset[] = {
+static const u16 sClefableTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xFA2D, 0xFF7D, 0x1BC4, 0x5FCE, 0x7F7F, 0x0003),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_BRICK_BREAK,
@@ -1668,10 +1844,12 @@ static const u16 sClefableTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sClefableTeachableLearnset (sClefableTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_CLEFAIRY
 
 #if P_FAMILY_VULPIX
-static const u16 sVulpixTeachableLearnset[] = {
+static const u16 sVulpixTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8230, 0xB114, 0x21C4, 0x1240, 0x6C40, 0x0000),
     MOVE_ATTRACT,
     MOVE_DIG,
     MOVE_DOUBLE_TEAM,
@@ -1697,8 +1875,10 @@ static const u16 sVulpixTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sVulpixTeachableLearnset (sVulpixTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sNinetalesTeachableLearnset[] = {
+static const u16 sNinetalesTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA238, 0xB51C, 0x21C4, 0x1640, 0x6C40, 0x0000),
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
     MOVE_DIG,
@@ -1729,9 +1909,11 @@ static const u16 sNinetalesTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sNinetalesTeachableLearnset (sNinetalesTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
 #if P_ALOLAN_FORMS
-static const u16 sVulpixAlolaTeachableLearnset[] = {
+static const u16 sVulpixAlolaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9870, 0x3115, 0x01C0, 0x1240, 0x6C42, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_DIG,
@@ -1758,8 +1940,10 @@ static const u16 sVulpixAlolaTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sVulpixAlolaTeachableLearnset (sVulpixAlolaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sNinetalesAlolaTeachableLearnset[] = {
+static const u16 sNinetalesAlolaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xB878, 0x311D, 0x01C0, 0x1640, 0x6C42, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_CALM_MIND,
@@ -1790,12 +1974,14 @@ static const u16 sNinetalesAlolaTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sNinetalesAlolaTeachableLearnset (sNinetalesAlolaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_ALOLAN_FORMS
 #endif //P_FAMILY_VULPIX
 
 #if P_FAMILY_JIGGLYPUFF
 #if P_GEN_2_CROSS_EVOS
-static const u16 sIgglybuffTeachableLearnset[] = {
+static const u16 sIgglybuffTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC224, 0xF70D, 0x01C4, 0x17C4, 0x6F6E, 0x0002),
     MOVE_ATTRACT,
     MOVE_DIG,
     MOVE_DOUBLE_TEAM,
@@ -1836,9 +2022,11 @@ static const u16 sIgglybuffTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sIgglybuffTeachableLearnset (sIgglybuffTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_GEN_2_CROSS_EVOS
 
-static const u16 sJigglypuffTeachableLearnset[] = {
+static const u16 sJigglypuffTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xDE2D, 0xFF6D, 0x1BC6, 0x5FC6, 0x6F7F, 0x0003),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_BRICK_BREAK,
@@ -1897,8 +2085,10 @@ static const u16 sJigglypuffTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sJigglypuffTeachableLearnset (sJigglypuffTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sWigglytuffTeachableLearnset[] = {
+static const u16 sWigglytuffTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xFE2D, 0xFF6D, 0x1BC6, 0x5FC6, 0x6F7F, 0x0003),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_BRICK_BREAK,
@@ -1958,10 +2148,12 @@ static const u16 sWigglytuffTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sWigglytuffTeachableLearnset (sWigglytuffTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_JIGGLYPUFF
 
 #if P_FAMILY_ZUBAT
-static const u16 sZubatTeachableLearnset[] = {
+static const u16 sZubatTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8620, 0x1403, 0x97F1, 0x1200, 0x6C00, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_DOUBLE_TEAM,
@@ -1988,8 +2180,10 @@ static const u16 sZubatTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sZubatTeachableLearnset (sZubatTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sGolbatTeachableLearnset[] = {
+static const u16 sGolbatTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA620, 0x1403, 0x97F1, 0x1200, 0x6C00, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_DOUBLE_TEAM,
@@ -2017,9 +2211,11 @@ static const u16 sGolbatTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sGolbatTeachableLearnset (sGolbatTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
 #if P_GEN_2_CROSS_EVOS
-static const u16 sCrobatTeachableLearnset[] = {
+static const u16 sCrobatTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA620, 0x1403, 0x97F1, 0x1200, 0x6C00, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_DOUBLE_TEAM,
@@ -2047,11 +2243,13 @@ static const u16 sCrobatTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sCrobatTeachableLearnset (sCrobatTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_GEN_2_CROSS_EVOS
 #endif //P_FAMILY_ZUBAT
 
 #if P_FAMILY_ODDISH
-static const u16 sOddishTeachableLearnset[] = {
+static const u16 sOddishTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8320, 0x300A, 0x41C1, 0x1204, 0xAC00, 0x0000),
     MOVE_ATTRACT,
     MOVE_BULLET_SEED,
     MOVE_CUT,
@@ -2074,8 +2272,10 @@ static const u16 sOddishTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sOddishTeachableLearnset (sOddishTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sGloomTeachableLearnset[] = {
+static const u16 sGloomTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8320, 0x300A, 0x41C1, 0x1204, 0xAC00, 0x0000),
     MOVE_ATTRACT,
     MOVE_BULLET_SEED,
     MOVE_CUT,
@@ -2098,8 +2298,10 @@ static const u16 sGloomTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sGloomTeachableLearnset (sGloomTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sVileplumeTeachableLearnset[] = {
+static const u16 sVileplumeTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA320, 0x300E, 0x41C1, 0x1244, 0xAC00, 0x0000),
     MOVE_ATTRACT,
     MOVE_BULLET_SEED,
     MOVE_CUT,
@@ -2125,9 +2327,11 @@ static const u16 sVileplumeTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sVileplumeTeachableLearnset (sVileplumeTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
 #if P_GEN_2_CROSS_EVOS
-static const u16 sBellossomTeachableLearnset[] = {
+static const u16 sBellossomTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA320, 0x100E, 0x41C1, 0x1204, 0xAC00, 0x0000),
     MOVE_ATTRACT,
     MOVE_BULLET_SEED,
     MOVE_CUT,
@@ -2151,11 +2355,13 @@ static const u16 sBellossomTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sBellossomTeachableLearnset (sBellossomTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_GEN_2_CROSS_EVOS
 #endif //P_FAMILY_ODDISH
 
 #if P_FAMILY_PARAS
-static const u16 sParasTeachableLearnset[] = {
+static const u16 sParasTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC320, 0x390A, 0x43D1, 0x92CC, 0xAC00, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -2187,8 +2393,10 @@ static const u16 sParasTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sParasTeachableLearnset (sParasTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sParasectTeachableLearnset[] = {
+static const u16 sParasectTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE320, 0x390A, 0x43D1, 0x92CC, 0xAC00, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -2221,10 +2429,12 @@ static const u16 sParasectTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sParasectTeachableLearnset (sParasectTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_PARAS
 
 #if P_FAMILY_VENONAT
-static const u16 sVenonatTeachableLearnset[] = {
+static const u16 sVenonatTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8220, 0x320A, 0x0BC1, 0x1204, 0x6C00, 0x0000),
     MOVE_ATTRACT,
     MOVE_DOUBLE_TEAM,
     MOVE_FACADE,
@@ -2248,8 +2458,10 @@ static const u16 sVenonatTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sVenonatTeachableLearnset (sVenonatTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sVenomothTeachableLearnset[] = {
+static const u16 sVenomothTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA220, 0x320A, 0x0BD1, 0x1604, 0x6C00, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_DOUBLE_TEAM,
@@ -2276,10 +2488,12 @@ static const u16 sVenomothTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sVenomothTeachableLearnset (sVenomothTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_VENONAT
 
 #if P_FAMILY_DIGLETT
-static const u16 sDiglettTeachableLearnset[] = {
+static const u16 sDiglettTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8220, 0x1180, 0x43DB, 0x1248, 0xACA0, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_CUT,
@@ -2307,8 +2521,10 @@ static const u16 sDiglettTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sDiglettTeachableLearnset (sDiglettTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sDugtrioTeachableLearnset[] = {
+static const u16 sDugtrioTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA220, 0x1180, 0x43DB, 0x1248, 0xACA0, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_CUT,
@@ -2337,9 +2553,11 @@ static const u16 sDugtrioTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sDugtrioTeachableLearnset (sDugtrioTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
 #if P_ALOLAN_FORMS
-static const u16 sDiglettAlolaTeachableLearnset[] = {
+static const u16 sDiglettAlolaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8220, 0x1180, 0x03DB, 0x1040, 0xACA0, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_DIG,
@@ -2364,8 +2582,10 @@ static const u16 sDiglettAlolaTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sDiglettAlolaTeachableLearnset (sDiglettAlolaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sDugtrioAlolaTeachableLearnset[] = {
+static const u16 sDugtrioAlolaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA220, 0x1180, 0x03DB, 0x1240, 0xACA0, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_DIG,
@@ -2392,11 +2612,13 @@ static const u16 sDugtrioAlolaTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sDugtrioAlolaTeachableLearnset (sDugtrioAlolaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_ALOLAN_FORMS
 #endif //P_FAMILY_DIGLETT
 
 #if P_FAMILY_MEOWTH
-static const u16 sMeowthTeachableLearnset[] = {
+static const u16 sMeowthTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8624, 0x5571, 0x53F0, 0x1744, 0x6C62, 0x0002),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_CUT,
@@ -2434,8 +2656,10 @@ static const u16 sMeowthTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sMeowthTeachableLearnset (sMeowthTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sPersianTeachableLearnset[] = {
+static const u16 sPersianTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA634, 0x5571, 0x53F0, 0x1744, 0x6C62, 0x0002),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_CUT,
@@ -2475,9 +2699,11 @@ static const u16 sPersianTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sPersianTeachableLearnset (sPersianTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
 #if P_ALOLAN_FORMS
-static const u16 sMeowthAlolaTeachableLearnset[] = {
+static const u16 sMeowthAlolaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8624, 0x5571, 0x13F0, 0x1640, 0x6C42, 0x0002),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_DIG,
@@ -2511,8 +2737,10 @@ static const u16 sMeowthAlolaTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sMeowthAlolaTeachableLearnset (sMeowthAlolaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sPersianAlolaTeachableLearnset[] = {
+static const u16 sPersianAlolaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA634, 0x5571, 0x13F0, 0x1640, 0x6C42, 0x0002),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_DIG,
@@ -2548,10 +2776,12 @@ static const u16 sPersianAlolaTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sPersianAlolaTeachableLearnset (sPersianAlolaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_ALOLAN_FORMS
 
 #if P_GALARIAN_FORMS
-static const u16 sMeowthGalarTeachableLearnset[] = {
+static const u16 sMeowthGalarTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8600, 0x0D71, 0x03D0, 0x1240, 0xAC10, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -2577,8 +2807,10 @@ static const u16 sMeowthGalarTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sMeowthGalarTeachableLearnset (sMeowthGalarTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sPerrserkerTeachableLearnset[] = {
+static const u16 sPerrserkerTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA600, 0x0D71, 0x03D0, 0x1240, 0xAC10, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -2605,11 +2837,13 @@ static const u16 sPerrserkerTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sPerrserkerTeachableLearnset (sPerrserkerTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_GALARIAN_FORMS
 #endif //P_FAMILY_MEOWTH
 
 #if P_FAMILY_PSYDUCK
-static const u16 sPsyduckTeachableLearnset[] = {
+static const u16 sPsyduckTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xDC6D, 0x1B11, 0x0BD0, 0x1AFF, 0x6E7F, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
@@ -2657,8 +2891,10 @@ static const u16 sPsyduckTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sPsyduckTeachableLearnset (sPsyduckTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sGolduckTeachableLearnset[] = {
+static const u16 sGolduckTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xFC6D, 0x1B11, 0x0BD0, 0x9AFF, 0x6E7F, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
@@ -2708,10 +2944,12 @@ static const u16 sGolduckTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sGolduckTeachableLearnset (sGolduckTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_PSYDUCK
 
 #if P_FAMILY_MANKEY
-static const u16 sMankeyTeachableLearnset[] = {
+static const u16 sMankeyTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x86A1, 0x19F1, 0x23D8, 0x5BCA, 0x6EFD, 0x0001),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -2757,8 +2995,10 @@ static const u16 sMankeyTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sMankeyTeachableLearnset (sMankeyTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sPrimeapeTeachableLearnset[] = {
+static const u16 sPrimeapeTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA6A1, 0x19F1, 0x23D8, 0x5BCA, 0x6EFD, 0x0001),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -2805,9 +3045,11 @@ static const u16 sPrimeapeTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sPrimeapeTeachableLearnset (sPrimeapeTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
 #if P_GEN_9_CROSS_EVOS
-static const u16 sAnnihilapeTeachableLearnset[] = {
+static const u16 sAnnihilapeTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA681, 0x0DE1, 0x22C8, 0x52C0, 0x6691, 0x0001),
     MOVE_BRICK_BREAK,
     MOVE_BULK_UP,
     MOVE_DIG,
@@ -2841,11 +3083,13 @@ static const u16 sAnnihilapeTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sAnnihilapeTeachableLearnset (sAnnihilapeTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_GEN_9_CROSS_EVOS
 #endif //P_FAMILY_MANKEY
 
 #if P_FAMILY_GROWLITHE
-static const u16 sGrowlitheTeachableLearnset[] = {
+static const u16 sGrowlitheTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8230, 0xB114, 0x23D4, 0x124A, 0x6C20, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_DIG,
@@ -2875,8 +3119,10 @@ static const u16 sGrowlitheTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sGrowlitheTeachableLearnset (sGrowlitheTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sArcanineTeachableLearnset[] = {
+static const u16 sArcanineTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA230, 0xB11C, 0x23D4, 0x124A, 0x6C20, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_DIG,
@@ -2908,9 +3154,11 @@ static const u16 sArcanineTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sArcanineTeachableLearnset (sArcanineTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
 #if P_HISUIAN_FORMS
-static const u16 sGrowlitheHisuiTeachableLearnset[] = {
+static const u16 sGrowlitheHisuiTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8210, 0x8110, 0x20DE, 0x1248, 0x4480, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_DIG,
     MOVE_FACADE,
@@ -2933,8 +3181,10 @@ static const u16 sGrowlitheHisuiTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sGrowlitheHisuiTeachableLearnset (sGrowlitheHisuiTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sArcanineHisuiTeachableLearnset[] = {
+static const u16 sArcanineHisuiTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA210, 0x8118, 0x22DE, 0x1248, 0x4480, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_DIG,
     MOVE_FACADE,
@@ -2960,11 +3210,13 @@ static const u16 sArcanineHisuiTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sArcanineHisuiTeachableLearnset (sArcanineHisuiTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_HISUIAN_FORMS
 #endif //P_FAMILY_GROWLITHE
 
 #if P_FAMILY_POLIWAG
-static const u16 sPoliwagTeachableLearnset[] = {
+static const u16 sPoliwagTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9865, 0x1301, 0x03C0, 0x1371, 0x6C22, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_DIG,
@@ -2995,8 +3247,10 @@ static const u16 sPoliwagTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sPoliwagTeachableLearnset (sPoliwagTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sPoliwhirlTeachableLearnset[] = {
+static const u16 sPoliwhirlTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9865, 0x1B81, 0x03C0, 0x13FB, 0x6E7F, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_BRICK_BREAK,
@@ -3038,8 +3292,10 @@ static const u16 sPoliwhirlTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sPoliwhirlTeachableLearnset (sPoliwhirlTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sPoliwrathTeachableLearnset[] = {
+static const u16 sPoliwrathTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xBCE5, 0x1B81, 0x03C8, 0x1BFB, 0x6EFF, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_BRICK_BREAK,
@@ -3087,9 +3343,11 @@ static const u16 sPoliwrathTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sPoliwrathTeachableLearnset (sPoliwrathTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
 #if P_GEN_2_CROSS_EVOS
-static const u16 sPolitoedTeachableLearnset[] = {
+static const u16 sPolitoedTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xB865, 0x1B81, 0x03C0, 0x1BFB, 0x6E7F, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_BRICK_BREAK,
@@ -3133,11 +3391,13 @@ static const u16 sPolitoedTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sPolitoedTeachableLearnset (sPolitoedTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_GEN_2_CROSS_EVOS
 #endif //P_FAMILY_POLIWAG
 
 #if P_FAMILY_ABRA
-static const u16 sAbraTeachableLearnset[] = {
+static const u16 sAbraTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC629, 0x7615, 0x1BE0, 0x5EC4, 0x6E5D, 0x0003),
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
     MOVE_DOUBLE_TEAM,
@@ -3182,8 +3442,10 @@ static const u16 sAbraTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sAbraTeachableLearnset (sAbraTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sKadabraTeachableLearnset[] = {
+static const u16 sKadabraTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC629, 0x7715, 0x1BE0, 0x5EC4, 0x6E5D, 0x0003),
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
     MOVE_DIG,
@@ -3229,8 +3491,10 @@ static const u16 sKadabraTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sKadabraTeachableLearnset (sKadabraTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sAlakazamTeachableLearnset[] = {
+static const u16 sAlakazamTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE629, 0x7715, 0x1BE0, 0x5EC4, 0x6E5D, 0x0003),
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
     MOVE_DIG,
@@ -3277,10 +3541,12 @@ static const u16 sAlakazamTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sAlakazamTeachableLearnset (sAlakazamTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_ABRA
 
 #if P_FAMILY_MACHOP
-static const u16 sMachopTeachableLearnset[] = {
+static const u16 sMachopTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC2A1, 0x9981, 0x03CC, 0x5ACA, 0x2EBD, 0x0001),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_BULK_UP,
@@ -3320,8 +3586,10 @@ static const u16 sMachopTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sMachopTeachableLearnset (sMachopTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sMachokeTeachableLearnset[] = {
+static const u16 sMachokeTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC2A1, 0x9981, 0x03CC, 0x5ACA, 0x2EBD, 0x0001),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_BULK_UP,
@@ -3361,8 +3629,10 @@ static const u16 sMachokeTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sMachokeTeachableLearnset (sMachokeTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sMachampTeachableLearnset[] = {
+static const u16 sMachampTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE2A1, 0x9981, 0x03CC, 0x5ACA, 0x2EBD, 0x0001),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_BULK_UP,
@@ -3403,10 +3673,12 @@ static const u16 sMachampTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sMachampTeachableLearnset (sMachampTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_MACHOP
 
 #if P_FAMILY_BELLSPROUT
-static const u16 sBellsproutTeachableLearnset[] = {
+static const u16 sBellsproutTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8320, 0x300A, 0x43C1, 0x1204, 0xAC00, 0x0000),
     MOVE_ATTRACT,
     MOVE_BULLET_SEED,
     MOVE_CUT,
@@ -3430,8 +3702,10 @@ static const u16 sBellsproutTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sBellsproutTeachableLearnset (sBellsproutTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sWeepinbellTeachableLearnset[] = {
+static const u16 sWeepinbellTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8320, 0x300A, 0x43C1, 0x1244, 0xEC00, 0x0000),
     MOVE_ATTRACT,
     MOVE_BULLET_SEED,
     MOVE_CUT,
@@ -3457,8 +3731,10 @@ static const u16 sWeepinbellTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sWeepinbellTeachableLearnset (sWeepinbellTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sVictreebelTeachableLearnset[] = {
+static const u16 sVictreebelTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA320, 0x300A, 0x43C1, 0x1244, 0xEC00, 0x0000),
     MOVE_ATTRACT,
     MOVE_BULLET_SEED,
     MOVE_CUT,
@@ -3485,10 +3761,12 @@ static const u16 sVictreebelTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sVictreebelTeachableLearnset (sVictreebelTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_BELLSPROUT
 
 #if P_FAMILY_TENTACOOL
-static const u16 sTentacoolTeachableLearnset[] = {
+static const u16 sTentacoolTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9864, 0x3007, 0x43C1, 0x1231, 0xEC02, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_CUT,
@@ -3519,8 +3797,10 @@ static const u16 sTentacoolTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sTentacoolTeachableLearnset (sTentacoolTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sTentacruelTeachableLearnset[] = {
+static const u16 sTentacruelTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xB864, 0x3007, 0x43C1, 0x1231, 0xEC02, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_CUT,
@@ -3552,10 +3832,12 @@ static const u16 sTentacruelTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sTentacruelTeachableLearnset (sTentacruelTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_TENTACOOL
 
 #if P_FAMILY_GEODUDE
-static const u16 sGeodudeTeachableLearnset[] = {
+static const u16 sGeodudeTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8221, 0x9980, 0x01CE, 0x7BCA, 0x2FB8, 0x0001),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_DIG,
@@ -3593,8 +3875,10 @@ static const u16 sGeodudeTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sGeodudeTeachableLearnset (sGeodudeTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sGravelerTeachableLearnset[] = {
+static const u16 sGravelerTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8221, 0x9980, 0x01CE, 0x7BCA, 0x2FB8, 0x0001),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_DIG,
@@ -3632,8 +3916,10 @@ static const u16 sGravelerTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sGravelerTeachableLearnset (sGravelerTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sGolemTeachableLearnset[] = {
+static const u16 sGolemTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA231, 0x9980, 0x01CE, 0xFBCA, 0x2FBC, 0x0001),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_DIG,
@@ -3675,9 +3961,11 @@ static const u16 sGolemTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sGolemTeachableLearnset (sGolemTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
 #if P_ALOLAN_FORMS
-static const u16 sGeodudeAlolaTeachableLearnset[] = {
+static const u16 sGeodudeAlolaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8221, 0x99E0, 0x01CE, 0x73C8, 0x2FA0, 0x0003),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_DIG,
@@ -3714,8 +4002,10 @@ static const u16 sGeodudeAlolaTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sGeodudeAlolaTeachableLearnset (sGeodudeAlolaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sGravelerAlolaTeachableLearnset[] = {
+static const u16 sGravelerAlolaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8221, 0xD9E0, 0x01CE, 0x73C8, 0x2FB0, 0x0003),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_DIG,
@@ -3754,8 +4044,10 @@ static const u16 sGravelerAlolaTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sGravelerAlolaTeachableLearnset (sGravelerAlolaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sGolemAlolaTeachableLearnset[] = {
+static const u16 sGolemAlolaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA231, 0xD9E0, 0x01CE, 0x73C8, 0x2FB8, 0x0003),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_DIG,
@@ -3797,11 +4089,13 @@ static const u16 sGolemAlolaTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sGolemAlolaTeachableLearnset (sGolemAlolaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_ALOLAN_FORMS
 #endif //P_FAMILY_GEODUDE
 
 #if P_FAMILY_PONYTA
-static const u16 sPonytaTeachableLearnset[] = {
+static const u16 sPonytaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8220, 0xB018, 0x21C4, 0x1242, 0x6C00, 0x0000),
     MOVE_ATTRACT,
     MOVE_DOUBLE_TEAM,
     MOVE_FACADE,
@@ -3825,8 +4119,10 @@ static const u16 sPonytaTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sPonytaTeachableLearnset (sPonytaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sRapidashTeachableLearnset[] = {
+static const u16 sRapidashTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA220, 0xB018, 0x21C4, 0x1242, 0xEC00, 0x0000),
     MOVE_ATTRACT,
     MOVE_DOUBLE_TEAM,
     MOVE_FACADE,
@@ -3852,9 +4148,11 @@ static const u16 sRapidashTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sRapidashTeachableLearnset (sRapidashTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
 #if P_GALARIAN_FORMS
-static const u16 sPonytaGalarTeachableLearnset[] = {
+static const u16 sPonytaGalarTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8008, 0x8210, 0x01C4, 0x1240, 0x4C00, 0x0000),
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
     MOVE_FACADE,
@@ -3872,8 +4170,10 @@ static const u16 sPonytaGalarTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sPonytaGalarTeachableLearnset (sPonytaGalarTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sRapidashGalarTeachableLearnset[] = {
+static const u16 sRapidashGalarTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA008, 0x8210, 0x01C4, 0x1240, 0xCC00, 0x0000),
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
     MOVE_FACADE,
@@ -3893,11 +4193,13 @@ static const u16 sRapidashGalarTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sRapidashGalarTeachableLearnset (sRapidashGalarTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_GALARIAN_FORMS
 #endif //P_FAMILY_PONYTA
 
 #if P_FAMILY_SLOWPOKE
-static const u16 sSlowpokeTeachableLearnset[] = {
+static const u16 sSlowpokeTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xDA6C, 0xB795, 0x09C4, 0x1677, 0x6C62, 0x0002),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_CALM_MIND,
@@ -3941,8 +4243,10 @@ static const u16 sSlowpokeTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sSlowpokeTeachableLearnset (sSlowpokeTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sSlowbroTeachableLearnset[] = {
+static const u16 sSlowbroTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xFA6D, 0xBF95, 0x09D4, 0x9EFF, 0x6E7F, 0x0002),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
@@ -3999,9 +4303,11 @@ static const u16 sSlowbroTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sSlowbroTeachableLearnset (sSlowbroTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
 #if P_GEN_2_CROSS_EVOS
-static const u16 sSlowkingTeachableLearnset[] = {
+static const u16 sSlowkingTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xFA6D, 0xBF95, 0x09CC, 0xDEFF, 0x6EFF, 0x0003),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_BRICK_BREAK,
@@ -4061,10 +4367,12 @@ static const u16 sSlowkingTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sSlowkingTeachableLearnset (sSlowkingTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_GEN_2_CROSS_EVOS
 
 #if P_GALARIAN_FORMS
-static const u16 sSlowpokeGalarTeachableLearnset[] = {
+static const u16 sSlowpokeGalarTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xDA4C, 0x8795, 0x09C4, 0x1071, 0x4C42, 0x0002),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_CALM_MIND,
@@ -4099,8 +4407,10 @@ static const u16 sSlowpokeGalarTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sSlowpokeGalarTeachableLearnset (sSlowpokeGalarTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sSlowbroGalarTeachableLearnset[] = {
+static const u16 sSlowbroGalarTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xFA6C, 0x8F95, 0x09C7, 0x1271, 0x4C5F, 0x0002),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_BRICK_BREAK,
@@ -4145,9 +4455,11 @@ static const u16 sSlowbroGalarTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sSlowbroGalarTeachableLearnset (sSlowbroGalarTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
 #if P_GEN_2_CROSS_EVOS
-static const u16 sSlowkingGalarTeachableLearnset[] = {
+static const u16 sSlowkingGalarTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xFE6C, 0x8F95, 0x09C5, 0x5071, 0x6C5F, 0x0003),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_BRICK_BREAK,
@@ -4194,12 +4506,14 @@ static const u16 sSlowkingGalarTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sSlowkingGalarTeachableLearnset (sSlowkingGalarTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_GEN_2_CROSS_EVOS
 #endif //P_GALARIAN_FORMS
 #endif //P_FAMILY_SLOWPOKE
 
 #if P_FAMILY_MAGNEMITE
-static const u16 sMagnemiteTeachableLearnset[] = {
+static const u16 sMagnemiteTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC220, 0x7061, 0x00C2, 0x3204, 0x6D40, 0x0002),
     MOVE_DOUBLE_TEAM,
     MOVE_FACADE,
     MOVE_FLASH,
@@ -4226,8 +4540,10 @@ static const u16 sMagnemiteTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sMagnemiteTeachableLearnset (sMagnemiteTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sMagnetonTeachableLearnset[] = {
+static const u16 sMagnetonTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE220, 0x7061, 0x00C2, 0x3204, 0x6D40, 0x0002),
     MOVE_DOUBLE_TEAM,
     MOVE_FACADE,
     MOVE_FLASH,
@@ -4255,9 +4571,11 @@ static const u16 sMagnetonTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sMagnetonTeachableLearnset (sMagnetonTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
 #if P_GEN_4_CROSS_EVOS
-static const u16 sMagnezoneTeachableLearnset[] = {
+static const u16 sMagnezoneTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE220, 0x7061, 0x00C2, 0x3244, 0x6D40, 0x0002),
     MOVE_DOUBLE_TEAM,
     MOVE_FACADE,
     MOVE_FLASH,
@@ -4286,11 +4604,13 @@ static const u16 sMagnezoneTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sMagnezoneTeachableLearnset (sMagnezoneTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_GEN_4_CROSS_EVOS
 #endif //P_FAMILY_MAGNEMITE
 
 #if P_FAMILY_FARFETCHD
-static const u16 sFarfetchdTeachableLearnset[] = {
+static const u16 sFarfetchdTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8220, 0x3010, 0xC7D0, 0x9240, 0xEC60, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_CUT,
@@ -4318,9 +4638,11 @@ static const u16 sFarfetchdTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sFarfetchdTeachableLearnset (sFarfetchdTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
 #if P_GALARIAN_FORMS
-static const u16 sFarfetchdGalarTeachableLearnset[] = {
+static const u16 sFarfetchdGalarTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8200, 0x0800, 0x05C0, 0x92C8, 0x8C00, 0x0000),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_FACADE,
@@ -4339,8 +4661,10 @@ static const u16 sFarfetchdGalarTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sFarfetchdGalarTeachableLearnset (sFarfetchdGalarTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sSirfetchdTeachableLearnset[] = {
+static const u16 sSirfetchdTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8200, 0x0800, 0x05C0, 0x92C8, 0x8C00, 0x0000),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_FACADE,
@@ -4359,11 +4683,13 @@ static const u16 sSirfetchdTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sSirfetchdTeachableLearnset (sSirfetchdTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_GALARIAN_FORMS
 #endif //P_FAMILY_FARFETCHD
 
 #if P_FAMILY_DODUO
-static const u16 sDoduoTeachableLearnset[] = {
+static const u16 sDoduoTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8220, 0x3001, 0x87D0, 0x1240, 0xEC20, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_DOUBLE_TEAM,
@@ -4388,8 +4714,10 @@ static const u16 sDoduoTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sDoduoTeachableLearnset (sDoduoTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sDodrioTeachableLearnset[] = {
+static const u16 sDodrioTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA620, 0x3001, 0x87F0, 0x1240, 0xEC20, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_DOUBLE_TEAM,
@@ -4417,10 +4745,12 @@ static const u16 sDodrioTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sDodrioTeachableLearnset (sDodrioTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_DODUO
 
 #if P_FAMILY_SEEL
-static const u16 sSeelTeachableLearnset[] = {
+static const u16 sSeelTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9864, 0x1015, 0x03C0, 0x1273, 0x2C02, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_DIVE,
@@ -4448,8 +4778,10 @@ static const u16 sSeelTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sSeelTeachableLearnset (sSeelTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sDewgongTeachableLearnset[] = {
+static const u16 sDewgongTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xB864, 0x1015, 0x03C0, 0x1273, 0x2C02, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_DIVE,
@@ -4478,10 +4810,12 @@ static const u16 sDewgongTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sDewgongTeachableLearnset (sDewgongTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_SEEL
 
 #if P_FAMILY_GRIMER
-static const u16 sGrimerTeachableLearnset[] = {
+static const u16 sGrimerTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8620, 0xD563, 0x03EF, 0x7842, 0x2CB1, 0x0001),
     MOVE_ATTRACT,
     MOVE_DIG,
     MOVE_DOUBLE_TEAM,
@@ -4520,8 +4854,10 @@ static const u16 sGrimerTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sGrimerTeachableLearnset (sGrimerTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sMukTeachableLearnset[] = {
+static const u16 sMukTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA621, 0xDD63, 0x03EF, 0x784A, 0x6CB1, 0x0001),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_DIG,
@@ -4565,9 +4901,11 @@ static const u16 sMukTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sMukTeachableLearnset (sMukTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
 #if P_ALOLAN_FORMS
-static const u16 sGrimerAlolaTeachableLearnset[] = {
+static const u16 sGrimerAlolaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA620, 0xDD63, 0x03EF, 0x7040, 0x6CB1, 0x0001),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_DIG,
@@ -4607,8 +4945,10 @@ static const u16 sGrimerAlolaTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sGrimerAlolaTeachableLearnset (sGrimerAlolaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sMukAlolaTeachableLearnset[] = {
+static const u16 sMukAlolaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA621, 0xDD63, 0x03EF, 0x7040, 0x6CB1, 0x0001),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_DIG,
@@ -4649,11 +4989,13 @@ static const u16 sMukAlolaTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sMukAlolaTeachableLearnset (sMukAlolaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_ALOLAN_FORMS
 #endif //P_FAMILY_GRIMER
 
 #if P_FAMILY_SHELLDER
-static const u16 sShellderTeachableLearnset[] = {
+static const u16 sShellderTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9864, 0x3001, 0x01C0, 0x3231, 0x6C02, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_DIVE,
@@ -4679,8 +5021,10 @@ static const u16 sShellderTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sShellderTeachableLearnset (sShellderTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sCloysterTeachableLearnset[] = {
+static const u16 sCloysterTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xF864, 0x3001, 0x01E0, 0x3271, 0x6C02, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_DIVE,
@@ -4710,10 +5054,12 @@ static const u16 sCloysterTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sCloysterTeachableLearnset (sCloysterTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_SHELLDER
 
 #if P_FAMILY_GASTLY
-static const u16 sGastlyTeachableLearnset[] = {
+static const u16 sGastlyTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8620, 0x1663, 0x1BE1, 0x7400, 0x2C43, 0x0001),
     MOVE_ATTRACT,
     MOVE_DOUBLE_TEAM,
     MOVE_FACADE,
@@ -4746,8 +5092,10 @@ static const u16 sGastlyTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sGastlyTeachableLearnset (sGastlyTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sHaunterTeachableLearnset[] = {
+static const u16 sHaunterTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8620, 0x1663, 0x1BE1, 0x7400, 0x2C53, 0x0001),
     MOVE_ATTRACT,
     MOVE_DOUBLE_TEAM,
     MOVE_FACADE,
@@ -4781,8 +5129,10 @@ static const u16 sHaunterTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sHaunterTeachableLearnset (sHaunterTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sGengarTeachableLearnset[] = {
+static const u16 sGengarTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA621, 0x1E63, 0x1BE1, 0x7ECA, 0x2E5F, 0x0003),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_DOUBLE_TEAM,
@@ -4829,10 +5179,12 @@ static const u16 sGengarTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sGengarTeachableLearnset (sGengarTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_GASTLY
 
 #if P_FAMILY_ONIX
-static const u16 sOnixTeachableLearnset[] = {
+static const u16 sOnixTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8630, 0x1190, 0x01EA, 0x334A, 0x2DE0, 0x0000),
     MOVE_ATTRACT,
     MOVE_DIG,
     MOVE_DOUBLE_TEAM,
@@ -4864,9 +5216,11 @@ static const u16 sOnixTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sOnixTeachableLearnset (sOnixTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
 #if P_GEN_2_CROSS_EVOS
-static const u16 sSteelixTeachableLearnset[] = {
+static const u16 sSteelixTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA630, 0x1190, 0x41EA, 0x334A, 0x2DE0, 0x0000),
     MOVE_ATTRACT,
     MOVE_CUT,
     MOVE_DIG,
@@ -4900,11 +5254,13 @@ static const u16 sSteelixTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sSteelixTeachableLearnset (sSteelixTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_GEN_2_CROSS_EVOS
 #endif //P_FAMILY_ONIX
 
 #if P_FAMILY_DROWZEE
-static const u16 sDrowzeeTeachableLearnset[] = {
+static const u16 sDrowzeeTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC629, 0x3E05, 0x1BE0, 0x5EC4, 0x6E5D, 0x0003),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_CALM_MIND,
@@ -4948,8 +5304,10 @@ static const u16 sDrowzeeTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sDrowzeeTeachableLearnset (sDrowzeeTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sHypnoTeachableLearnset[] = {
+static const u16 sHypnoTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE629, 0x3E05, 0x1BE0, 0x5EC4, 0x6E5D, 0x0003),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_CALM_MIND,
@@ -4994,10 +5352,12 @@ static const u16 sHypnoTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sHypnoTeachableLearnset (sHypnoTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_DROWZEE
 
 #if P_FAMILY_KRABBY
-static const u16 sKrabbyTeachableLearnset[] = {
+static const u16 sKrabbyTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9864, 0x1901, 0x43C8, 0x926B, 0xACA2, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_BRICK_BREAK,
@@ -5031,8 +5391,10 @@ static const u16 sKrabbyTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sKrabbyTeachableLearnset (sKrabbyTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sKinglerTeachableLearnset[] = {
+static const u16 sKinglerTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xB864, 0x1901, 0x43C8, 0x926B, 0xACA2, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_BRICK_BREAK,
@@ -5067,10 +5429,12 @@ static const u16 sKinglerTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sKinglerTeachableLearnset (sKinglerTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_KRABBY
 
 #if P_FAMILY_VOLTORB
-static const u16 sVoltorbTeachableLearnset[] = {
+static const u16 sVoltorbTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC420, 0x7061, 0x02E0, 0x3204, 0x6D00, 0x0002),
     MOVE_DOUBLE_TEAM,
     MOVE_FACADE,
     MOVE_FLASH,
@@ -5097,8 +5461,10 @@ static const u16 sVoltorbTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sVoltorbTeachableLearnset (sVoltorbTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sElectrodeTeachableLearnset[] = {
+static const u16 sElectrodeTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE420, 0x7061, 0x02E0, 0x3204, 0x6D00, 0x0002),
     MOVE_DOUBLE_TEAM,
     MOVE_FACADE,
     MOVE_FLASH,
@@ -5126,9 +5492,11 @@ static const u16 sElectrodeTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sElectrodeTeachableLearnset (sElectrodeTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
 #if P_HISUIAN_FORMS
-static const u16 sVoltorbHisuiTeachableLearnset[] = {
+static const u16 sVoltorbHisuiTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8500, 0x206B, 0x02C0, 0x3200, 0x4500, 0x0002),
     MOVE_BULLET_SEED,
     MOVE_FACADE,
     MOVE_GIGA_DRAIN,
@@ -5150,8 +5518,10 @@ static const u16 sVoltorbHisuiTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sVoltorbHisuiTeachableLearnset (sVoltorbHisuiTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sElectrodeHisuiTeachableLearnset[] = {
+static const u16 sElectrodeHisuiTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA500, 0x206B, 0x02C0, 0x3200, 0x4500, 0x0002),
     MOVE_BULLET_SEED,
     MOVE_FACADE,
     MOVE_GIGA_DRAIN,
@@ -5174,11 +5544,13 @@ static const u16 sElectrodeHisuiTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sElectrodeHisuiTeachableLearnset (sElectrodeHisuiTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_HISUIAN_FORMS
 #endif //P_FAMILY_VOLTORB
 
 #if P_FAMILY_EXEGGCUTE
-static const u16 sExeggcuteTeachableLearnset[] = {
+static const u16 sExeggcuteTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC320, 0x320A, 0x0BC1, 0x3606, 0xAD40, 0x0000),
     MOVE_ATTRACT,
     MOVE_BULLET_SEED,
     MOVE_DOUBLE_TEAM,
@@ -5209,8 +5581,10 @@ static const u16 sExeggcuteTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sExeggcuteTeachableLearnset (sExeggcuteTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sExeggutorTeachableLearnset[] = {
+static const u16 sExeggutorTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE328, 0x328A, 0x0BC1, 0x3646, 0xAD40, 0x0000),
     MOVE_ATTRACT,
     MOVE_BULLET_SEED,
     MOVE_CALM_MIND,
@@ -5245,9 +5619,11 @@ static const u16 sExeggutorTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sExeggutorTeachableLearnset (sExeggutorTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
 #if P_ALOLAN_FORMS
-static const u16 sExeggutorAlolaTeachableLearnset[] = {
+static const u16 sExeggutorAlolaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE328, 0xBA9A, 0x0BC1, 0x3640, 0xAC40, 0x0000),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_BULLET_SEED,
@@ -5282,11 +5658,13 @@ static const u16 sExeggutorAlolaTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sExeggutorAlolaTeachableLearnset (sExeggutorAlolaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_ALOLAN_FORMS
 #endif //P_FAMILY_EXEGGCUTE
 
 #if P_FAMILY_CUBONE
-static const u16 sCuboneTeachableLearnset[] = {
+static const u16 sCuboneTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9A21, 0x9990, 0x03DE, 0xDACA, 0xEEAE, 0x0001),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
@@ -5330,8 +5708,10 @@ static const u16 sCuboneTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sCuboneTeachableLearnset (sCuboneTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sMarowakTeachableLearnset[] = {
+static const u16 sMarowakTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xBA21, 0x9990, 0x03DE, 0xDACA, 0xEEAE, 0x0001),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
@@ -5376,9 +5756,11 @@ static const u16 sMarowakTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sMarowakTeachableLearnset (sMarowakTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
 #if P_ALOLAN_FORMS
-static const u16 sMarowakAlolaTeachableLearnset[] = {
+static const u16 sMarowakAlolaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xBA21, 0x9DF1, 0x03DE, 0x5640, 0xEEAE, 0x0001),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
@@ -5423,12 +5805,14 @@ static const u16 sMarowakAlolaTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sMarowakAlolaTeachableLearnset (sMarowakAlolaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_ALOLAN_FORMS
 #endif //P_FAMILY_CUBONE
 
 #if P_FAMILY_HITMONS
 #if P_GEN_2_CROSS_EVOS
-static const u16 sTyrogueTeachableLearnset[] = {
+static const u16 sTyrogueTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x82A0, 0x1881, 0x03C0, 0x12CA, 0x6EAC, 0x0000),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_BULK_UP,
@@ -5458,9 +5842,11 @@ static const u16 sTyrogueTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sTyrogueTeachableLearnset (sTyrogueTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_GEN_2_CROSS_EVOS
 
-static const u16 sHitmonleeTeachableLearnset[] = {
+static const u16 sHitmonleeTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x86A1, 0x1881, 0x03C8, 0x1ACA, 0xEEBC, 0x0000),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_BULK_UP,
@@ -5496,8 +5882,10 @@ static const u16 sHitmonleeTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sHitmonleeTeachableLearnset (sHitmonleeTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sHitmonchanTeachableLearnset[] = {
+static const u16 sHitmonchanTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x86A1, 0x1881, 0x03C8, 0x5ACA, 0xEEBD, 0x0001),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_BULK_UP,
@@ -5536,9 +5924,11 @@ static const u16 sHitmonchanTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sHitmonchanTeachableLearnset (sHitmonchanTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
 #if P_GEN_2_CROSS_EVOS
-static const u16 sHitmontopTeachableLearnset[] = {
+static const u16 sHitmontopTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x82A0, 0x1981, 0x03D2, 0x12CA, 0x6FAC, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -5572,11 +5962,13 @@ static const u16 sHitmontopTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sHitmontopTeachableLearnset (sHitmontopTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_GEN_2_CROSS_EVOS
 #endif //P_FAMILY_HITMONS
 
 #if P_FAMILY_LICKITUNG
-static const u16 sLickitungTeachableLearnset[] = {
+static const u16 sLickitungTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xBA25, 0xDDF9, 0x43CE, 0x5FCB, 0xAFEF, 0x0001),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_BRICK_BREAK,
@@ -5632,9 +6024,11 @@ static const u16 sLickitungTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sLickitungTeachableLearnset (sLickitungTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
 #if P_GEN_4_CROSS_EVOS
-static const u16 sLickilickyTeachableLearnset[] = {
+static const u16 sLickilickyTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xBA25, 0xDDF9, 0x43CE, 0x774B, 0xADEF, 0x0001),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_BRICK_BREAK,
@@ -5688,11 +6082,13 @@ static const u16 sLickilickyTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sLickilickyTeachableLearnset (sLickilickyTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_GEN_4_CROSS_EVOS
 #endif //P_FAMILY_LICKITUNG
 
 #if P_FAMILY_KOFFING
-static const u16 sKoffingTeachableLearnset[] = {
+static const u16 sKoffingTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8620, 0xD461, 0x03E5, 0x3044, 0x2D00, 0x0000),
     MOVE_ATTRACT,
     MOVE_DOUBLE_TEAM,
     MOVE_FACADE,
@@ -5721,8 +6117,10 @@ static const u16 sKoffingTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sKoffingTeachableLearnset (sKoffingTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sWeezingTeachableLearnset[] = {
+static const u16 sWeezingTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA620, 0xD461, 0x03E5, 0x3044, 0x2D00, 0x0000),
     MOVE_ATTRACT,
     MOVE_DOUBLE_TEAM,
     MOVE_FACADE,
@@ -5752,9 +6150,11 @@ static const u16 sWeezingTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sWeezingTeachableLearnset (sWeezingTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
 #if P_GALARIAN_FORMS
-static const u16 sWeezingGalarTeachableLearnset[] = {
+static const u16 sWeezingGalarTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA620, 0x8461, 0x23C5, 0x3240, 0x0C00, 0x0000),
     MOVE_ATTRACT,
     MOVE_FACADE,
     MOVE_FIRE_BLAST,
@@ -5780,11 +6180,13 @@ static const u16 sWeezingGalarTeachableLearnset[] = {
     MOVE_SNORE,
     MOVE_UNAVAILABLE,
 };
+#define sWeezingGalarTeachableLearnset (sWeezingGalarTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_GALARIAN_FORMS
 #endif //P_FAMILY_KOFFING
 
 #if P_FAMILY_RHYHORN
-static const u16 sRhyhornTeachableLearnset[] = {
+static const u16 sRhyhornTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9A30, 0xD1F1, 0x03CE, 0x12CA, 0xADA2, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_DIG,
@@ -5823,8 +6225,10 @@ static const u16 sRhyhornTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sRhyhornTeachableLearnset (sRhyhornTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sRhydonTeachableLearnset[] = {
+static const u16 sRhydonTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xBA31, 0xD9F1, 0x43CE, 0xDACB, 0xAFAF, 0x0001),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_BRICK_BREAK,
@@ -5876,9 +6280,11 @@ static const u16 sRhydonTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sRhydonTeachableLearnset (sRhydonTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
 #if P_GEN_4_CROSS_EVOS
-static const u16 sRhyperiorTeachableLearnset[] = {
+static const u16 sRhyperiorTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xBA31, 0xD9F1, 0x43CE, 0xD2CB, 0xADAF, 0x0001),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_BRICK_BREAK,
@@ -5928,12 +6334,14 @@ static const u16 sRhyperiorTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sRhyperiorTeachableLearnset (sRhyperiorTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_GEN_4_CROSS_EVOS
 #endif //P_FAMILY_RHYHORN
 
 #if P_FAMILY_CHANSEY
 #if P_GEN_4_CROSS_EVOS
-static const u16 sHappinyTeachableLearnset[] = {
+static const u16 sHappinyTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC26C, 0xD60D, 0x01C4, 0x1784, 0x3F72, 0x0002),
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
     MOVE_DOUBLE_TEAM,
@@ -5972,9 +6380,11 @@ static const u16 sHappinyTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sHappinyTeachableLearnset (sHappinyTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_GEN_4_CROSS_EVOS
 
-static const u16 sChanseyTeachableLearnset[] = {
+static const u16 sChanseyTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xFA6D, 0xFEFD, 0x1BCE, 0x5FCE, 0x7FFF, 0x0003),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_BRICK_BREAK,
@@ -6039,9 +6449,11 @@ static const u16 sChanseyTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sChanseyTeachableLearnset (sChanseyTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
 #if P_GEN_2_CROSS_EVOS
-static const u16 sBlisseyTeachableLearnset[] = {
+static const u16 sBlisseyTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xFA6D, 0xDEFD, 0x1BCE, 0x5FCE, 0x7FFF, 0x0003),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_BRICK_BREAK,
@@ -6105,11 +6517,13 @@ static const u16 sBlisseyTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sBlisseyTeachableLearnset (sBlisseyTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_GEN_2_CROSS_EVOS
 #endif //P_FAMILY_CHANSEY
 
 #if P_FAMILY_TANGELA
-static const u16 sTangelaTeachableLearnset[] = {
+static const u16 sTangelaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA320, 0x700A, 0x43C1, 0x124C, 0xAC40, 0x0000),
     MOVE_ATTRACT,
     MOVE_BULLET_SEED,
     MOVE_CUT,
@@ -6138,9 +6552,11 @@ static const u16 sTangelaTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sTangelaTeachableLearnset (sTangelaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
 #if P_GEN_4_CROSS_EVOS
-static const u16 sTangrowthTeachableLearnset[] = {
+static const u16 sTangrowthTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA320, 0x788A, 0x43D9, 0x104E, 0xACE0, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -6175,11 +6591,13 @@ static const u16 sTangrowthTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sTangrowthTeachableLearnset (sTangrowthTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_GEN_4_CROSS_EVOS
 #endif //P_FAMILY_TANGELA
 
 #if P_FAMILY_KANGASKHAN
-static const u16 sKangaskhanTeachableLearnset[] = {
+static const u16 sKangaskhanTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xBA75, 0xDDFD, 0x43DE, 0xDACB, 0x2EAF, 0x0001),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
@@ -6235,10 +6653,12 @@ static const u16 sKangaskhanTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sKangaskhanTeachableLearnset (sKangaskhanTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_KANGASKHAN
 
 #if P_FAMILY_HORSEA
-static const u16 sHorseaTeachableLearnset[] = {
+static const u16 sHorseaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9864, 0x1001, 0x01C0, 0x1231, 0x6C02, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_DIVE,
@@ -6262,8 +6682,10 @@ static const u16 sHorseaTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sHorseaTeachableLearnset (sHorseaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sSeadraTeachableLearnset[] = {
+static const u16 sSeadraTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xB864, 0x1001, 0x01C0, 0x1231, 0x6C02, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_DIVE,
@@ -6288,9 +6710,11 @@ static const u16 sSeadraTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sSeadraTeachableLearnset (sSeadraTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
 #if P_GEN_2_CROSS_EVOS
-static const u16 sKingdraTeachableLearnset[] = {
+static const u16 sKingdraTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xB864, 0x1001, 0x01C0, 0x1271, 0x6C02, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_DIVE,
@@ -6316,11 +6740,13 @@ static const u16 sKingdraTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sKingdraTeachableLearnset (sKingdraTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_GEN_2_CROSS_EVOS
 #endif //P_FAMILY_HORSEA
 
 #if P_FAMILY_GOLDEEN
-static const u16 sGoldeenTeachableLearnset[] = {
+static const u16 sGoldeenTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9864, 0x1001, 0x01C0, 0x9271, 0xEC22, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_DIVE,
@@ -6348,8 +6774,10 @@ static const u16 sGoldeenTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sGoldeenTeachableLearnset (sGoldeenTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sSeakingTeachableLearnset[] = {
+static const u16 sSeakingTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xB864, 0x1001, 0x01C0, 0x9271, 0xEC22, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_DIVE,
@@ -6378,10 +6806,12 @@ static const u16 sSeakingTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sSeakingTeachableLearnset (sSeakingTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_GOLDEEN
 
 #if P_FAMILY_STARYU
-static const u16 sStaryuTeachableLearnset[] = {
+static const u16 sStaryuTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xD864, 0x3261, 0x01C0, 0x1235, 0x6D42, 0x0002),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_DIVE,
@@ -6414,8 +6844,10 @@ static const u16 sStaryuTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sStaryuTeachableLearnset (sStaryuTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sStarmieTeachableLearnset[] = {
+static const u16 sStarmieTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xF864, 0x3261, 0x09C0, 0x1635, 0x6D42, 0x0002),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_DIVE,
@@ -6451,11 +6883,13 @@ static const u16 sStarmieTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sStarmieTeachableLearnset (sStarmieTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_STARYU
 
 #if P_FAMILY_MR_MIME
 #if P_GEN_4_CROSS_EVOS
-static const u16 sMimeJrTeachableLearnset[] = {
+static const u16 sMimeJrTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC629, 0x7E6D, 0x1BE0, 0x1404, 0x2C62, 0x0002),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_CALM_MIND,
@@ -6493,9 +6927,11 @@ static const u16 sMimeJrTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sMimeJrTeachableLearnset (sMimeJrTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_GEN_4_CROSS_EVOS
 
-static const u16 sMrMimeTeachableLearnset[] = {
+static const u16 sMrMimeTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE629, 0x7E6D, 0x1BF0, 0x5EC4, 0x2E7F, 0x0003),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -6546,9 +6982,11 @@ static const u16 sMrMimeTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sMrMimeTeachableLearnset (sMrMimeTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
 #if P_GALARIAN_FORMS
-static const u16 sMrMimeGalarTeachableLearnset[] = {
+static const u16 sMrMimeGalarTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xFE48, 0x2E6D, 0x0BC0, 0x1040, 0x0C1F, 0x0002),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_BRICK_BREAK,
@@ -6584,8 +7022,10 @@ static const u16 sMrMimeGalarTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sMrMimeGalarTeachableLearnset (sMrMimeGalarTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sMrRimeTeachableLearnset[] = {
+static const u16 sMrRimeTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xFE48, 0x2E6D, 0x0BC0, 0x1040, 0x0C1F, 0x0002),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_BRICK_BREAK,
@@ -6621,11 +7061,13 @@ static const u16 sMrRimeTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sMrRimeTeachableLearnset (sMrRimeTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_GALARIAN_FORMS
 #endif //P_FAMILY_MR_MIME
 
 #if P_FAMILY_SCYTHER
-static const u16 sScytherTeachableLearnset[] = {
+static const u16 sScytherTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE228, 0x1805, 0x47D0, 0x9288, 0xEC00, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -6655,9 +7097,11 @@ static const u16 sScytherTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sScytherTeachableLearnset (sScytherTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
 #if P_GEN_2_CROSS_EVOS
-static const u16 sScizorTeachableLearnset[] = {
+static const u16 sScizorTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE228, 0x1805, 0x47D2, 0x928A, 0xEC00, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -6689,10 +7133,12 @@ static const u16 sScizorTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sScizorTeachableLearnset (sScizorTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_GEN_2_CROSS_EVOS
 
 #if P_GEN_8_CROSS_EVOS
-static const u16 sKleavorTeachableLearnset[] = {
+static const u16 sKleavorTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE208, 0x1801, 0x02DA, 0x9288, 0xC480, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_BRICK_BREAK,
     MOVE_CALM_MIND,
@@ -6718,12 +7164,14 @@ static const u16 sKleavorTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sKleavorTeachableLearnset (sKleavorTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_GEN_8_CROSS_EVOS
 #endif //P_FAMILY_SCYTHER
 
 #if P_FAMILY_JYNX
 #if P_GEN_2_CROSS_EVOS
-static const u16 sSmoochumTeachableLearnset[] = {
+static const u16 sSmoochumTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xD86C, 0x3601, 0x0BC0, 0x1EC4, 0x2E7F, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_CALM_MIND,
@@ -6762,9 +7210,11 @@ static const u16 sSmoochumTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sSmoochumTeachableLearnset (sSmoochumTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_GEN_2_CROSS_EVOS
 
-static const u16 sJynxTeachableLearnset[] = {
+static const u16 sJynxTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xFC6D, 0x3E01, 0x0BE0, 0x1EC4, 0x2E7F, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_BRICK_BREAK,
@@ -6808,11 +7258,13 @@ static const u16 sJynxTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sJynxTeachableLearnset (sJynxTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_JYNX
 
 #if P_FAMILY_ELECTABUZZ
 #if P_GEN_2_CROSS_EVOS
-static const u16 sElekidTeachableLearnset[] = {
+static const u16 sElekidTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC421, 0x5A61, 0x03C0, 0x5ACC, 0x6E2D, 0x0003),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_DOUBLE_TEAM,
@@ -6850,9 +7302,11 @@ static const u16 sElekidTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sElekidTeachableLearnset (sElekidTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_GEN_2_CROSS_EVOS
 
-static const u16 sElectabuzzTeachableLearnset[] = {
+static const u16 sElectabuzzTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE4A1, 0x7A71, 0x03C0, 0x5ACE, 0x6E3D, 0x0003),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_BULK_UP,
@@ -6896,9 +7350,11 @@ static const u16 sElectabuzzTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sElectabuzzTeachableLearnset (sElectabuzzTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
 #if P_GEN_4_CROSS_EVOS
-static const u16 sElectivireTeachableLearnset[] = {
+static const u16 sElectivireTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE4A1, 0xFBF1, 0x03E8, 0x5A4E, 0x6CBD, 0x0003),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_BULK_UP,
@@ -6946,12 +7402,14 @@ static const u16 sElectivireTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sElectivireTeachableLearnset (sElectivireTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_GEN_4_CROSS_EVOS
 #endif //P_FAMILY_ELECTABUZZ
 
 #if P_FAMILY_MAGMAR
 #if P_GEN_2_CROSS_EVOS
-static const u16 sMagbyTeachableLearnset[] = {
+static const u16 sMagbyTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8221, 0x9A10, 0x23C4, 0x5AC8, 0x2E2C, 0x0001),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_DOUBLE_TEAM,
@@ -6984,9 +7442,11 @@ static const u16 sMagbyTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sMagbyTeachableLearnset (sMagbyTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_GEN_2_CROSS_EVOS
 
-static const u16 sMagmarTeachableLearnset[] = {
+static const u16 sMagmarTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA631, 0x9A10, 0x23C4, 0x5ACA, 0x2E3C, 0x0001),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_DOUBLE_TEAM,
@@ -7024,9 +7484,11 @@ static const u16 sMagmarTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sMagmarTeachableLearnset (sMagmarTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
 #if P_GEN_4_CROSS_EVOS
-static const u16 sMagmortarTeachableLearnset[] = {
+static const u16 sMagmortarTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA631, 0x9AB8, 0x23EC, 0x5A4A, 0x2CBC, 0x0001),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_DOUBLE_TEAM,
@@ -7068,11 +7530,13 @@ static const u16 sMagmortarTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sMagmortarTeachableLearnset (sMagmortarTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_GEN_4_CROSS_EVOS
 #endif //P_FAMILY_MAGMAR
 
 #if P_FAMILY_PINSIR
-static const u16 sPinsirTeachableLearnset[] = {
+static const u16 sPinsirTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA2A1, 0x1981, 0x43C8, 0x924A, 0xAE80, 0x0000),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_BULK_UP,
@@ -7104,10 +7568,12 @@ static const u16 sPinsirTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sPinsirTeachableLearnset (sPinsirTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_PINSIR
 
 #if P_FAMILY_TAUROS
-static const u16 sTaurosTeachableLearnset[] = {
+static const u16 sTaurosTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xBA24, 0xD5F9, 0x03CE, 0x124B, 0x2C82, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_DIG,
@@ -7146,9 +7612,11 @@ static const u16 sTaurosTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sTaurosTeachableLearnset (sTaurosTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
 #if P_PALDEAN_FORMS
-static const u16 sTaurosPaldeaCombatTeachableLearnset[] = {
+static const u16 sTaurosPaldeaCombatTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA280, 0x0181, 0x02CA, 0x1241, 0x2480, 0x0000),
     MOVE_BULK_UP,
     MOVE_DIG,
     MOVE_EARTHQUAKE,
@@ -7170,8 +7638,10 @@ static const u16 sTaurosPaldeaCombatTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sTaurosPaldeaCombatTeachableLearnset (sTaurosPaldeaCombatTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sTaurosPaldeaBlazeTeachableLearnset[] = {
+static const u16 sTaurosPaldeaBlazeTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA280, 0x8181, 0x22CE, 0x1240, 0x2480, 0x0000),
     MOVE_BULK_UP,
     MOVE_DIG,
     MOVE_EARTHQUAKE,
@@ -7195,8 +7665,10 @@ static const u16 sTaurosPaldeaBlazeTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sTaurosPaldeaBlazeTeachableLearnset (sTaurosPaldeaBlazeTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sTaurosPaldeaAquaTeachableLearnset[] = {
+static const u16 sTaurosPaldeaAquaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA084, 0x0181, 0x02CA, 0x1241, 0x2480, 0x0000),
     MOVE_BULK_UP,
     MOVE_DIG,
     MOVE_EARTHQUAKE,
@@ -7218,15 +7690,19 @@ static const u16 sTaurosPaldeaAquaTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sTaurosPaldeaAquaTeachableLearnset (sTaurosPaldeaAquaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_PALDEAN_FORMS
 #endif //P_FAMILY_TAUROS
 
 #if P_FAMILY_MAGIKARP
-static const u16 sMagikarpTeachableLearnset[] = {
+static const u16 sMagikarpTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000),
     MOVE_UNAVAILABLE,
 };
+#define sMagikarpTeachableLearnset (sMagikarpTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sGyaradosTeachableLearnset[] = {
+static const u16 sGyaradosTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xBE74, 0xB0F1, 0x01E6, 0x127B, 0x2C02, 0x0002),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_DIVE,
@@ -7266,10 +7742,12 @@ static const u16 sGyaradosTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sGyaradosTeachableLearnset (sGyaradosTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_MAGIKARP
 
 #if P_FAMILY_LAPRAS
-static const u16 sLaprasTeachableLearnset[] = {
+static const u16 sLaprasTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xB874, 0x72FD, 0x01C0, 0x167B, 0x2C02, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_DIVE,
@@ -7307,16 +7785,20 @@ static const u16 sLaprasTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sLaprasTeachableLearnset (sLaprasTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_LAPRAS
 
 #if P_FAMILY_DITTO
-static const u16 sDittoTeachableLearnset[] = {
+static const u16 sDittoTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000),
     MOVE_UNAVAILABLE,
 };
+#define sDittoTeachableLearnset (sDittoTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_DITTO
 
 #if P_FAMILY_EEVEE
-static const u16 sEeveeTeachableLearnset[] = {
+static const u16 sEeveeTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8238, 0x3511, 0x01C0, 0x1240, 0x6C20, 0x0000),
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
     MOVE_DIG,
@@ -7341,8 +7823,10 @@ static const u16 sEeveeTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sEeveeTeachableLearnset (sEeveeTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sVaporeonTeachableLearnset[] = {
+static const u16 sVaporeonTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xBA7C, 0x3511, 0x01C0, 0x127B, 0x6C22, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_CALM_MIND,
@@ -7378,8 +7862,10 @@ static const u16 sVaporeonTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sVaporeonTeachableLearnset (sVaporeonTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sJolteonTeachableLearnset[] = {
+static const u16 sJolteonTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE238, 0x7571, 0x01C0, 0x124E, 0x6C20, 0x0002),
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
     MOVE_DIG,
@@ -7413,8 +7899,10 @@ static const u16 sJolteonTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sJolteonTeachableLearnset (sJolteonTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sFlareonTeachableLearnset[] = {
+static const u16 sFlareonTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA238, 0xB511, 0x21C4, 0x124A, 0x6C20, 0x0000),
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
     MOVE_DIG,
@@ -7445,9 +7933,11 @@ static const u16 sFlareonTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sFlareonTeachableLearnset (sFlareonTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
 #if P_GEN_2_CROSS_EVOS
-static const u16 sEspeonTeachableLearnset[] = {
+static const u16 sEspeonTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE238, 0x3711, 0x49C0, 0x164C, 0x6C60, 0x0002),
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
     MOVE_CUT,
@@ -7482,8 +7972,10 @@ static const u16 sEspeonTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sEspeonTeachableLearnset (sEspeonTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sUmbreonTeachableLearnset[] = {
+static const u16 sUmbreonTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE638, 0x3711, 0x5BE0, 0x164C, 0x6C60, 0x0002),
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
     MOVE_CUT,
@@ -7522,10 +8014,12 @@ static const u16 sUmbreonTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sUmbreonTeachableLearnset (sUmbreonTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_GEN_2_CROSS_EVOS
 
 #if P_GEN_4_CROSS_EVOS
-static const u16 sLeafeonTeachableLearnset[] = {
+static const u16 sLeafeonTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA338, 0x151B, 0x01D0, 0x924E, 0xEC20, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BULLET_SEED,
@@ -7559,8 +8053,10 @@ static const u16 sLeafeonTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sLeafeonTeachableLearnset (sLeafeonTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sGlaceonTeachableLearnset[] = {
+static const u16 sGlaceonTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xBA7C, 0x1511, 0x01C0, 0x124A, 0x6C22, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_CALM_MIND,
@@ -7592,10 +8088,12 @@ static const u16 sGlaceonTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sGlaceonTeachableLearnset (sGlaceonTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_GEN_4_CROSS_EVOS
 
 #if P_GEN_6_CROSS_EVOS
-static const u16 sSylveonTeachableLearnset[] = {
+static const u16 sSylveonTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE238, 0x3715, 0x49C0, 0x124C, 0x6C60, 0x0000),
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
     MOVE_CUT,
@@ -7629,11 +8127,13 @@ static const u16 sSylveonTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sSylveonTeachableLearnset (sSylveonTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_GEN_6_CROSS_EVOS
 #endif //P_FAMILY_EEVEE
 
 #if P_FAMILY_PORYGON
-static const u16 sPorygonTeachableLearnset[] = {
+static const u16 sPorygonTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xBA20, 0x7679, 0x02D0, 0x1604, 0x6C42, 0x0002),
     MOVE_AERIAL_ACE,
     MOVE_BLIZZARD,
     MOVE_DOUBLE_TEAM,
@@ -7667,9 +8167,11 @@ static const u16 sPorygonTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sPorygonTeachableLearnset (sPorygonTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
 #if P_GEN_2_CROSS_EVOS
-static const u16 sPorygon2TeachableLearnset[] = {
+static const u16 sPorygon2TeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xBA20, 0x5679, 0x02D0, 0x1704, 0x6C42, 0x0002),
     MOVE_AERIAL_ACE,
     MOVE_BLIZZARD,
     MOVE_DOUBLE_TEAM,
@@ -7703,9 +8205,11 @@ static const u16 sPorygon2TeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sPorygon2TeachableLearnset (sPorygon2TeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
 #if P_GEN_4_CROSS_EVOS
-static const u16 sPorygonZTeachableLearnset[] = {
+static const u16 sPorygonZTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xBA20, 0x5679, 0x02D0, 0x1704, 0x6C42, 0x0002),
     MOVE_AERIAL_ACE,
     MOVE_BLIZZARD,
     MOVE_DOUBLE_TEAM,
@@ -7739,12 +8243,14 @@ static const u16 sPorygonZTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sPorygonZTeachableLearnset (sPorygonZTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_GEN_4_CROSS_EVOS
 #endif //P_GEN_2_CROSS_EVOS
 #endif //P_FAMILY_PORYGON
 
 #if P_FAMILY_OMANYTE
-static const u16 sOmanyteTeachableLearnset[] = {
+static const u16 sOmanyteTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9864, 0x3001, 0x03CA, 0x1279, 0x2D82, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_DIVE,
@@ -7775,8 +8281,10 @@ static const u16 sOmanyteTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sOmanyteTeachableLearnset (sOmanyteTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sOmastarTeachableLearnset[] = {
+static const u16 sOmastarTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xB864, 0x3001, 0x03CA, 0x1279, 0x2F82, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_DIVE,
@@ -7809,10 +8317,12 @@ static const u16 sOmastarTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sOmastarTeachableLearnset (sOmastarTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_OMANYTE
 
 #if P_FAMILY_KABUTO
-static const u16 sKabutoTeachableLearnset[] = {
+static const u16 sKabutoTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9864, 0x3103, 0x03DA, 0x1259, 0x2DA2, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
@@ -7846,8 +8356,10 @@ static const u16 sKabutoTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sKabutoTeachableLearnset (sKabutoTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sKabutopsTeachableLearnset[] = {
+static const u16 sKabutopsTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xB864, 0x3903, 0x43DA, 0x9279, 0xAFA6, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
@@ -7889,10 +8401,12 @@ static const u16 sKabutopsTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sKabutopsTeachableLearnset (sKabutopsTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_KABUTO
 
 #if P_FAMILY_AERODACTYL
-static const u16 sAerodactylTeachableLearnset[] = {
+static const u16 sAerodactylTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA632, 0xB091, 0x87FE, 0x120A, 0x6C80, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_DOUBLE_TEAM,
@@ -7928,11 +8442,13 @@ static const u16 sAerodactylTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sAerodactylTeachableLearnset (sAerodactylTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_AERODACTYL
 
 #if P_FAMILY_SNORLAX
 #if P_GEN_4_CROSS_EVOS
-static const u16 sMunchlaxTeachableLearnset[] = {
+static const u16 sMunchlaxTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9A25, 0xDFE9, 0x11CE, 0x53CB, 0x2DBF, 0x0001),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_BRICK_BREAK,
@@ -7982,9 +8498,11 @@ static const u16 sMunchlaxTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sMunchlaxTeachableLearnset (sMunchlaxTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_GEN_4_CROSS_EVOS
 
-static const u16 sSnorlaxTeachableLearnset[] = {
+static const u16 sSnorlaxTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xBA25, 0xFFE9, 0x11CE, 0x5BCB, 0x2FFF, 0x0001),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_BRICK_BREAK,
@@ -8039,10 +8557,12 @@ static const u16 sSnorlaxTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sSnorlaxTeachableLearnset (sSnorlaxTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_SNORLAX
 
 #if P_FAMILY_ARTICUNO
-static const u16 sArticunoTeachableLearnset[] = {
+static const u16 sArticunoTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xFA74, 0x3001, 0x84D2, 0x1208, 0x6C22, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_BLIZZARD,
     MOVE_DOUBLE_TEAM,
@@ -8073,9 +8593,11 @@ static const u16 sArticunoTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sArticunoTeachableLearnset (sArticunoTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
 #if P_GALARIAN_FORMS
-static const u16 sArticunoGalarTeachableLearnset[] = {
+static const u16 sArticunoGalarTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE208, 0x3601, 0x8CC0, 0x1400, 0x4C00, 0x0000),
     MOVE_CALM_MIND,
     MOVE_DOUBLE_TEAM,
     MOVE_FACADE,
@@ -8098,11 +8620,13 @@ static const u16 sArticunoGalarTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sArticunoGalarTeachableLearnset (sArticunoGalarTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_GALARIAN_FORMS
 #endif //P_FAMILY_ARTICUNO
 
 #if P_FAMILY_ZAPDOS
-static const u16 sZapdosTeachableLearnset[] = {
+static const u16 sZapdosTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE270, 0x7061, 0x84D2, 0x120C, 0x6C20, 0x0002),
     MOVE_AERIAL_ACE,
     MOVE_DOUBLE_TEAM,
     MOVE_FACADE,
@@ -8134,9 +8658,11 @@ static const u16 sZapdosTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sZapdosTeachableLearnset (sZapdosTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
 #if P_GALARIAN_FORMS
-static const u16 sZapdosGalarTeachableLearnset[] = {
+static const u16 sZapdosGalarTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE680, 0x0801, 0x84D2, 0x1288, 0x4C04, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_BRICK_BREAK,
     MOVE_BULK_UP,
@@ -8161,11 +8687,13 @@ static const u16 sZapdosGalarTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sZapdosGalarTeachableLearnset (sZapdosGalarTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_GALARIAN_FORMS
 #endif //P_FAMILY_ZAPDOS
 
 #if P_FAMILY_MOLTRES
-static const u16 sMoltresTeachableLearnset[] = {
+static const u16 sMoltresTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA230, 0xB00D, 0xA4D6, 0x1208, 0x6C20, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_DOUBLE_TEAM,
     MOVE_FACADE,
@@ -8195,9 +8723,11 @@ static const u16 sMoltresTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sMoltresTeachableLearnset (sMoltresTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
 #if P_GALARIAN_FORMS
-static const u16 sMoltresGalarTeachableLearnset[] = {
+static const u16 sMoltresGalarTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA600, 0x0405, 0x86D2, 0x1000, 0x4C00, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_FACADE,
     MOVE_FLY,
@@ -8218,11 +8748,13 @@ static const u16 sMoltresGalarTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sMoltresGalarTeachableLearnset (sMoltresGalarTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_GALARIAN_FORMS
 #endif //P_FAMILY_MOLTRES
 
 #if P_FAMILY_DRATINI
-static const u16 sDratiniTeachableLearnset[] = {
+static const u16 sDratiniTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xFA64, 0xF075, 0x01C4, 0x1251, 0x6C02, 0x0002),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_DOUBLE_TEAM,
@@ -8258,8 +8790,10 @@ static const u16 sDratiniTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sDratiniTeachableLearnset (sDratiniTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sDragonairTeachableLearnset[] = {
+static const u16 sDragonairTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xFA64, 0xF075, 0x01C4, 0x1251, 0x6C02, 0x0002),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_DOUBLE_TEAM,
@@ -8295,8 +8829,10 @@ static const u16 sDragonairTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sDragonairTeachableLearnset (sDragonairTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sDragoniteTeachableLearnset[] = {
+static const u16 sDragoniteTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xFA77, 0xF8F5, 0xC5DE, 0xDA7B, 0x6CBF, 0x0003),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
@@ -8356,10 +8892,12 @@ static const u16 sDragoniteTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sDragoniteTeachableLearnset (sDragoniteTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_DRATINI
 
 #if P_FAMILY_MEWTWO
-static const u16 sMewtwoTeachableLearnset[] = {
+static const u16 sMewtwoTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xFEED, 0xFEFD, 0x18FE, 0x5EEE, 0x6EFF, 0x0003),
     MOVE_AERIAL_ACE,
     MOVE_BLIZZARD,
     MOVE_BRICK_BREAK,
@@ -8424,17 +8962,21 @@ static const u16 sMewtwoTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sMewtwoTeachableLearnset (sMewtwoTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_MEWTWO
 
 #if P_FAMILY_MEW
 // Instead of reading this array for Mew, it checks for exceptions in CanLearnTeachableMove instead.
-static const u16 sMewTeachableLearnset[] = {
+static const u16 sMewTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000),
     MOVE_UNAVAILABLE,
 };
+#define sMewTeachableLearnset (sMewTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_MEW
 
 #if P_FAMILY_CHIKORITA
-static const u16 sChikoritaTeachableLearnset[] = {
+static const u16 sChikoritaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC320, 0x301E, 0x41C0, 0x92C4, 0xAC20, 0x0000),
     MOVE_ATTRACT,
     MOVE_BULLET_SEED,
     MOVE_CUT,
@@ -8463,8 +9005,10 @@ static const u16 sChikoritaTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sChikoritaTeachableLearnset (sChikoritaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sBayleefTeachableLearnset[] = {
+static const u16 sBayleefTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC320, 0x301E, 0x41C0, 0x92CE, 0xAC20, 0x0000),
     MOVE_ATTRACT,
     MOVE_BULLET_SEED,
     MOVE_CUT,
@@ -8495,8 +9039,10 @@ static const u16 sBayleefTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sBayleefTeachableLearnset (sBayleefTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sMeganiumTeachableLearnset[] = {
+static const u16 sMeganiumTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE320, 0x309E, 0x41C0, 0x92CE, 0xAC20, 0x0000),
     MOVE_ATTRACT,
     MOVE_BULLET_SEED,
     MOVE_CUT,
@@ -8529,10 +9075,12 @@ static const u16 sMeganiumTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sMeganiumTeachableLearnset (sMeganiumTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_CHIKORITA
 
 #if P_FAMILY_CYNDAQUIL
-static const u16 sCyndaquilTeachableLearnset[] = {
+static const u16 sCyndaquilTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8230, 0x9110, 0x61D4, 0x1340, 0x6D20, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_CUT,
@@ -8560,8 +9108,10 @@ static const u16 sCyndaquilTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sCyndaquilTeachableLearnset (sCyndaquilTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sQuilavaTeachableLearnset[] = {
+static const u16 sQuilavaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8231, 0x9910, 0x61D4, 0x934A, 0x6D20, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -8594,8 +9144,10 @@ static const u16 sQuilavaTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sQuilavaTeachableLearnset (sQuilavaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sTyphlosionTeachableLearnset[] = {
+static const u16 sTyphlosionTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA231, 0x9D98, 0x61DC, 0xDBCA, 0x6FAC, 0x0001),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -8641,9 +9193,11 @@ static const u16 sTyphlosionTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sTyphlosionTeachableLearnset (sTyphlosionTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
 #if P_HISUIAN_FORMS
-static const u16 sTyphlosionHisuiTeachableLearnset[] = {
+static const u16 sTyphlosionHisuiTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA219, 0x8D98, 0x20D4, 0x5348, 0x4580, 0x0001),
     MOVE_AERIAL_ACE,
     MOVE_BRICK_BREAK,
     MOVE_CALM_MIND,
@@ -8675,11 +9229,13 @@ static const u16 sTyphlosionHisuiTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sTyphlosionHisuiTeachableLearnset (sTyphlosionHisuiTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_HISUIAN_FORMS
 #endif //P_FAMILY_CYNDAQUIL
 
 #if P_FAMILY_TOTODILE
-static const u16 sTotodileTeachableLearnset[] = {
+static const u16 sTotodileTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9867, 0x1911, 0x43D8, 0x1AF1, 0xAEAF, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
@@ -8721,8 +9277,10 @@ static const u16 sTotodileTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sTotodileTeachableLearnset (sTotodileTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sCroconawTeachableLearnset[] = {
+static const u16 sCroconawTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9877, 0x1911, 0x43D8, 0x9AFB, 0xAEAF, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
@@ -8768,8 +9326,10 @@ static const u16 sCroconawTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sCroconawTeachableLearnset (sCroconawTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sFeraligatrTeachableLearnset[] = {
+static const u16 sFeraligatrTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xB877, 0x1991, 0x43D8, 0x9AFB, 0xAEAF, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
@@ -8817,10 +9377,12 @@ static const u16 sFeraligatrTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sFeraligatrTeachableLearnset (sFeraligatrTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_TOTODILE
 
 #if P_FAMILY_SENTRET
-static const u16 sSentretTeachableLearnset[] = {
+static const u16 sSentretTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9A25, 0xDD79, 0x43C0, 0xDB41, 0x6D21, 0x0001),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_BRICK_BREAK,
@@ -8862,8 +9424,10 @@ static const u16 sSentretTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sSentretTeachableLearnset (sSentretTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sFurretTeachableLearnset[] = {
+static const u16 sFurretTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xBA25, 0xDD79, 0x43C0, 0xDB4B, 0x6D21, 0x0001),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_BRICK_BREAK,
@@ -8908,10 +9472,12 @@ static const u16 sFurretTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sFurretTeachableLearnset (sFurretTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_SENTRET
 
 #if P_FAMILY_HOOTHOOT
-static const u16 sHoothootTeachableLearnset[] = {
+static const u16 sHoothootTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8228, 0x3601, 0x8FD0, 0x1604, 0x6C60, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
@@ -8941,8 +9507,10 @@ static const u16 sHoothootTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sHoothootTeachableLearnset (sHoothootTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sNoctowlTeachableLearnset[] = {
+static const u16 sNoctowlTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA228, 0x3601, 0x8FD0, 0x1644, 0x6C60, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
@@ -8974,10 +9542,12 @@ static const u16 sNoctowlTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sNoctowlTeachableLearnset (sNoctowlTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_HOOTHOOT
 
 #if P_FAMILY_LEDYBA
-static const u16 sLedybaTeachableLearnset[] = {
+static const u16 sLedybaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC221, 0x390E, 0x03D0, 0x1A84, 0xED09, 0x0001),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -9011,8 +9581,10 @@ static const u16 sLedybaTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sLedybaTeachableLearnset (sLedybaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sLedianTeachableLearnset[] = {
+static const u16 sLedianTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE221, 0x390E, 0x03D0, 0x1A8E, 0xED09, 0x0001),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -9049,10 +9621,12 @@ static const u16 sLedianTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sLedianTeachableLearnset (sLedianTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_LEDYBA
 
 #if P_FAMILY_SPINARAK
-static const u16 sSpinarakTeachableLearnset[] = {
+static const u16 sSpinarakTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8220, 0x130A, 0x03C1, 0x1244, 0x2C00, 0x0000),
     MOVE_ATTRACT,
     MOVE_DIG,
     MOVE_DOUBLE_TEAM,
@@ -9075,8 +9649,10 @@ static const u16 sSpinarakTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sSpinarakTeachableLearnset (sSpinarakTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sAriadosTeachableLearnset[] = {
+static const u16 sAriadosTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA220, 0x130A, 0x03C1, 0x1244, 0xAC00, 0x0000),
     MOVE_ATTRACT,
     MOVE_DIG,
     MOVE_DOUBLE_TEAM,
@@ -9101,10 +9677,12 @@ static const u16 sAriadosTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sAriadosTeachableLearnset (sAriadosTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_SPINARAK
 
 #if P_FAMILY_CHINCHOU
-static const u16 sChinchouTeachableLearnset[] = {
+static const u16 sChinchouTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9864, 0x5061, 0x01C0, 0x1235, 0x2C02, 0x0002),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_DIVE,
@@ -9132,8 +9710,10 @@ static const u16 sChinchouTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sChinchouTeachableLearnset (sChinchouTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sLanturnTeachableLearnset[] = {
+static const u16 sLanturnTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xB864, 0x5061, 0x01C0, 0x1235, 0x2C02, 0x0002),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_DIVE,
@@ -9162,10 +9742,12 @@ static const u16 sLanturnTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sLanturnTeachableLearnset (sLanturnTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_CHINCHOU
 
 #if P_FAMILY_TOGEPI
-static const u16 sTogepiTeachableLearnset[] = {
+static const u16 sTogepiTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC22C, 0xF60D, 0x01D4, 0x17CC, 0x7F7C, 0x0002),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
@@ -9209,8 +9791,10 @@ static const u16 sTogepiTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sTogepiTeachableLearnset (sTogepiTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sTogeticTeachableLearnset[] = {
+static const u16 sTogeticTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE22D, 0xFE0D, 0x85D4, 0x17CC, 0x7F7C, 0x0002),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -9259,9 +9843,11 @@ static const u16 sTogeticTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sTogeticTeachableLearnset (sTogeticTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
 #if P_GEN_4_CROSS_EVOS
-static const u16 sTogekissTeachableLearnset[] = {
+static const u16 sTogekissTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE22D, 0xFE0D, 0x85D4, 0x164C, 0x6D7C, 0x0002),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -9306,11 +9892,13 @@ static const u16 sTogekissTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sTogekissTeachableLearnset (sTogekissTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_GEN_4_CROSS_EVOS
 #endif //P_FAMILY_TOGEPI
 
 #if P_FAMILY_NATU
-static const u16 sNatuTeachableLearnset[] = {
+static const u16 sNatuTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC228, 0x360B, 0x0FD0, 0x1604, 0x6C40, 0x0002),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
@@ -9342,8 +9930,10 @@ static const u16 sNatuTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sNatuTeachableLearnset (sNatuTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sXatuTeachableLearnset[] = {
+static const u16 sXatuTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE228, 0x360B, 0x8FD0, 0x1604, 0x6C40, 0x0002),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
@@ -9377,10 +9967,12 @@ static const u16 sXatuTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sXatuTeachableLearnset (sXatuTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_NATU
 
 #if P_FAMILY_MAREEP
-static const u16 sMareepTeachableLearnset[] = {
+static const u16 sMareepTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC220, 0x7175, 0x01C0, 0x1344, 0x6C00, 0x0002),
     MOVE_ATTRACT,
     MOVE_DIG,
     MOVE_DOUBLE_TEAM,
@@ -9409,8 +10001,10 @@ static const u16 sMareepTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sMareepTeachableLearnset (sMareepTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sFlaaffyTeachableLearnset[] = {
+static const u16 sFlaaffyTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC231, 0x7975, 0x01C0, 0x5BCE, 0x6E0D, 0x0003),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_DIG,
@@ -9452,8 +10046,10 @@ static const u16 sFlaaffyTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sFlaaffyTeachableLearnset (sFlaaffyTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sAmpharosTeachableLearnset[] = {
+static const u16 sAmpharosTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE231, 0x7975, 0x01C0, 0x5BCE, 0x6E0D, 0x0003),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_DIG,
@@ -9496,11 +10092,13 @@ static const u16 sAmpharosTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sAmpharosTeachableLearnset (sAmpharosTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_MAREEP
 
 #if P_FAMILY_MARILL
 #if P_GEN_3_CROSS_EVOS
-static const u16 sAzurillTeachableLearnset[] = {
+static const u16 sAzurillTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xD864, 0x1011, 0x01C0, 0x1351, 0x6D22, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_DOUBLE_TEAM,
@@ -9529,9 +10127,11 @@ static const u16 sAzurillTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sAzurillTeachableLearnset (sAzurillTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_GEN_3_CROSS_EVOS
 
-static const u16 sMarillTeachableLearnset[] = {
+static const u16 sMarillTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xD865, 0x1911, 0x01C0, 0x1B7B, 0x6F3F, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_BRICK_BREAK,
@@ -9572,8 +10172,10 @@ static const u16 sMarillTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sMarillTeachableLearnset (sMarillTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sAzumarillTeachableLearnset[] = {
+static const u16 sAzumarillTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xF865, 0x1911, 0x01C0, 0x1B7B, 0x6F3F, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_BRICK_BREAK,
@@ -9615,11 +10217,13 @@ static const u16 sAzumarillTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sAzumarillTeachableLearnset (sAzumarillTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_MARILL
 
 #if P_FAMILY_SUDOWOODO
 #if P_GEN_4_CROSS_EVOS
-static const u16 sBonslyTeachableLearnset[] = {
+static const u16 sBonslyTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8228, 0x1980, 0x03CA, 0x33C0, 0x2DE0, 0x0000),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_CALM_MIND,
@@ -9649,9 +10253,11 @@ static const u16 sBonslyTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sBonslyTeachableLearnset (sBonslyTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_GEN_4_CROSS_EVOS
 
-static const u16 sSudowoodoTeachableLearnset[] = {
+static const u16 sSudowoodoTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA629, 0x1980, 0x03EA, 0x7BCA, 0x2FED, 0x0001),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_CALM_MIND,
@@ -9694,10 +10300,12 @@ static const u16 sSudowoodoTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sSudowoodoTeachableLearnset (sSudowoodoTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_SUDOWOODO
 
 #if P_FAMILY_HOPPIP
-static const u16 sHoppipTeachableLearnset[] = {
+static const u16 sHoppipTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC320, 0x300B, 0x03D0, 0x1304, 0xAC40, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BULLET_SEED,
@@ -9724,8 +10332,10 @@ static const u16 sHoppipTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sHoppipTeachableLearnset (sHoppipTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sSkiploomTeachableLearnset[] = {
+static const u16 sSkiploomTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC320, 0x300B, 0x03D0, 0x1304, 0xAC40, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BULLET_SEED,
@@ -9752,8 +10362,10 @@ static const u16 sSkiploomTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sSkiploomTeachableLearnset (sSkiploomTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sJumpluffTeachableLearnset[] = {
+static const u16 sJumpluffTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE320, 0x300B, 0x03D0, 0x1304, 0xAC40, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BULLET_SEED,
@@ -9781,10 +10393,12 @@ static const u16 sJumpluffTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sJumpluffTeachableLearnset (sJumpluffTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_HOPPIP
 
 #if P_FAMILY_AIPOM
-static const u16 sAipomTeachableLearnset[] = {
+static const u16 sAipomTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8625, 0x5D79, 0x53D0, 0xDFCA, 0x6E3D, 0x0003),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -9833,9 +10447,11 @@ static const u16 sAipomTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sAipomTeachableLearnset (sAipomTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
 #if P_GEN_4_CROSS_EVOS
-static const u16 sAmbipomTeachableLearnset[] = {
+static const u16 sAmbipomTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA625, 0x5D79, 0x53D0, 0xD68A, 0x6C31, 0x0003),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -9879,11 +10495,13 @@ static const u16 sAmbipomTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sAmbipomTeachableLearnset (sAmbipomTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_GEN_4_CROSS_EVOS
 #endif //P_FAMILY_AIPOM
 
 #if P_FAMILY_SUNKERN
-static const u16 sSunkernTeachableLearnset[] = {
+static const u16 sSunkernTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC320, 0x100F, 0x41C1, 0x1204, 0xAC00, 0x0000),
     MOVE_ATTRACT,
     MOVE_BULLET_SEED,
     MOVE_CUT,
@@ -9908,8 +10526,10 @@ static const u16 sSunkernTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sSunkernTeachableLearnset (sSunkernTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sSunfloraTeachableLearnset[] = {
+static const u16 sSunfloraTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE320, 0x100F, 0x41C1, 0x1204, 0xAC00, 0x0000),
     MOVE_ATTRACT,
     MOVE_BULLET_SEED,
     MOVE_CUT,
@@ -9935,10 +10555,12 @@ static const u16 sSunfloraTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sSunfloraTeachableLearnset (sSunfloraTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_SUNKERN
 
 #if P_FAMILY_YANMA
-static const u16 sYanmaTeachableLearnset[] = {
+static const u16 sYanmaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8220, 0x160A, 0x07D0, 0x1604, 0xEC40, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_DOUBLE_TEAM,
@@ -9965,9 +10587,11 @@ static const u16 sYanmaTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sYanmaTeachableLearnset (sYanmaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
 #if P_GEN_4_CROSS_EVOS
-static const u16 sYanmegaTeachableLearnset[] = {
+static const u16 sYanmegaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA220, 0x160A, 0x07D0, 0x1604, 0xEC60, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_DOUBLE_TEAM,
@@ -9996,11 +10620,13 @@ static const u16 sYanmegaTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sYanmegaTeachableLearnset (sYanmegaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_GEN_4_CROSS_EVOS
 #endif //P_FAMILY_YANMA
 
 #if P_FAMILY_WOOPER
-static const u16 sWooperTeachableLearnset[] = {
+static const u16 sWooperTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9864, 0x1195, 0x01CB, 0x1BFD, 0x2DA3, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_DIG,
@@ -10040,8 +10666,10 @@ static const u16 sWooperTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sWooperTeachableLearnset (sWooperTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sQuagsireTeachableLearnset[] = {
+static const u16 sQuagsireTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xB865, 0x1995, 0x03CB, 0x1BFF, 0x2FAF, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_BRICK_BREAK,
@@ -10089,9 +10717,11 @@ static const u16 sQuagsireTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sQuagsireTeachableLearnset (sQuagsireTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
 #if P_PALDEAN_FORMS
-static const u16 sWooperPaldeaTeachableLearnset[] = {
+static const u16 sWooperPaldeaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8024, 0x0181, 0x00CB, 0x12D1, 0x04A0, 0x0000),
     MOVE_DIG,
     MOVE_EARTHQUAKE,
     MOVE_FACADE,
@@ -10114,8 +10744,10 @@ static const u16 sWooperPaldeaTeachableLearnset[] = {
     MOVE_SLEEP_TALK,
     MOVE_UNAVAILABLE,
 };
+#define sWooperPaldeaTeachableLearnset (sWooperPaldeaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sClodsireTeachableLearnset[] = {
+static const u16 sClodsireTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA024, 0x0181, 0x00CB, 0x12D1, 0x04A0, 0x0000),
     MOVE_DIG,
     MOVE_EARTHQUAKE,
     MOVE_FACADE,
@@ -10139,11 +10771,13 @@ static const u16 sClodsireTeachableLearnset[] = {
     MOVE_SLEEP_TALK,
     MOVE_UNAVAILABLE,
 };
+#define sClodsireTeachableLearnset (sClodsireTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_PALDEAN_FORMS
 #endif //P_FAMILY_WOOPER
 
 #if P_FAMILY_MURKROW
-static const u16 sMurkrowTeachableLearnset[] = {
+static const u16 sMurkrowTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA628, 0x1601, 0x97F0, 0x1600, 0x6C62, 0x0002),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
@@ -10176,9 +10810,11 @@ static const u16 sMurkrowTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sMurkrowTeachableLearnset (sMurkrowTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
 #if P_GEN_4_CROSS_EVOS
-static const u16 sHonchkrowTeachableLearnset[] = {
+static const u16 sHonchkrowTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA628, 0x1601, 0x97F0, 0x1600, 0x6C62, 0x0002),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
@@ -10211,11 +10847,13 @@ static const u16 sHonchkrowTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sHonchkrowTeachableLearnset (sHonchkrowTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_GEN_4_CROSS_EVOS
 #endif //P_FAMILY_MURKROW
 
 #if P_FAMILY_MISDREAVUS
-static const u16 sMisdreavusTeachableLearnset[] = {
+static const u16 sMisdreavusTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA628, 0x5661, 0x1BF0, 0x1704, 0x6C42, 0x0002),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
@@ -10251,9 +10889,11 @@ static const u16 sMisdreavusTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sMisdreavusTeachableLearnset (sMisdreavusTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
 #if P_GEN_4_CROSS_EVOS
-static const u16 sMismagiusTeachableLearnset[] = {
+static const u16 sMismagiusTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA628, 0x5661, 0x1BF0, 0x1404, 0x6C42, 0x0002),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
@@ -10287,33 +10927,41 @@ static const u16 sMismagiusTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sMismagiusTeachableLearnset (sMismagiusTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_GEN_4_CROSS_EVOS
 #endif //P_FAMILY_MISDREAVUS
 
 #if P_FAMILY_UNOWN
-static const u16 sUnownTeachableLearnset[] = {
+static const u16 sUnownTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000),
     MOVE_UNAVAILABLE,
 };
+#define sUnownTeachableLearnset (sUnownTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_UNOWN
 
 #if P_FAMILY_WOBBUFFET
 #if P_GEN_3_CROSS_EVOS
-static const u16 sWynautTeachableLearnset[] = {
+static const u16 sWynautTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x0000, 0x0004, 0x0000, 0x0080, 0x0000, 0x0000),
     MOVE_SAFEGUARD,
     MOVE_COUNTER,
     MOVE_UNAVAILABLE,
 };
+#define sWynautTeachableLearnset (sWynautTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_GEN_3_CROSS_EVOS
 
-static const u16 sWobbuffetTeachableLearnset[] = {
+static const u16 sWobbuffetTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x0000, 0x0004, 0x0000, 0x0080, 0x0000, 0x0000),
     MOVE_SAFEGUARD,
     MOVE_COUNTER,
     MOVE_UNAVAILABLE,
 };
+#define sWobbuffetTeachableLearnset (sWobbuffetTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_WOBBUFFET
 
 #if P_FAMILY_GIRAFARIG
-static const u16 sGirafarigTeachableLearnset[] = {
+static const u16 sGirafarigTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE228, 0x76F1, 0x0BC0, 0x164E, 0x6C60, 0x0002),
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
     MOVE_DOUBLE_TEAM,
@@ -10351,9 +10999,11 @@ static const u16 sGirafarigTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sGirafarigTeachableLearnset (sGirafarigTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
 #if P_GEN_9_CROSS_EVOS
-static const u16 sFarigirafTeachableLearnset[] = {
+static const u16 sFarigirafTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE218, 0x26E1, 0x0AC0, 0x1240, 0x4440, 0x0002),
     MOVE_CALM_MIND,
     MOVE_EARTHQUAKE,
     MOVE_FACADE,
@@ -10380,11 +11030,13 @@ static const u16 sFarigirafTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sFarigirafTeachableLearnset (sFarigirafTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_GEN_9_CROSS_EVOS
 #endif //P_FAMILY_GIRAFARIG
 
 #if P_FAMILY_PINECO
-static const u16 sPinecoTeachableLearnset[] = {
+static const u16 sPinecoTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC220, 0x318B, 0x01CA, 0x33CA, 0x6D80, 0x0000),
     MOVE_ATTRACT,
     MOVE_DIG,
     MOVE_DOUBLE_TEAM,
@@ -10417,8 +11069,10 @@ static const u16 sPinecoTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sPinecoTeachableLearnset (sPinecoTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sForretressTeachableLearnset[] = {
+static const u16 sForretressTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE220, 0x318B, 0x01CA, 0x33CA, 0x6D80, 0x0002),
     MOVE_ATTRACT,
     MOVE_DIG,
     MOVE_DOUBLE_TEAM,
@@ -10453,10 +11107,12 @@ static const u16 sForretressTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sForretressTeachableLearnset (sForretressTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_PINECO
 
 #if P_FAMILY_DUNSPARCE
-static const u16 sDunsparceTeachableLearnset[] = {
+static const u16 sDunsparceTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xBA2C, 0xD5F9, 0x03CE, 0x17CA, 0x2DE0, 0x0002),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_CALM_MIND,
@@ -10501,9 +11157,11 @@ static const u16 sDunsparceTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sDunsparceTeachableLearnset (sDunsparceTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
 #if P_GEN_9_CROSS_EVOS
-static const u16 sDudunsparceTeachableLearnset[] = {
+static const u16 sDudunsparceTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xBA28, 0x85E9, 0x02CE, 0x1340, 0x05E0, 0x0000),
     MOVE_BLIZZARD,
     MOVE_CALM_MIND,
     MOVE_DIG,
@@ -10536,11 +11194,13 @@ static const u16 sDudunsparceTeachableLearnset[] = {
     MOVE_SLEEP_TALK,
     MOVE_UNAVAILABLE,
 };
+#define sDudunsparceTeachableLearnset (sDudunsparceTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_GEN_9_CROSS_EVOS
 #endif //P_FAMILY_DUNSPARCE
 
 #if P_FAMILY_GLIGAR
-static const u16 sGligarTeachableLearnset[] = {
+static const u16 sGligarTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8620, 0x1991, 0x47FB, 0x968A, 0xECA0, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -10578,9 +11238,11 @@ static const u16 sGligarTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sGligarTeachableLearnset (sGligarTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
 #if P_GEN_4_CROSS_EVOS
-static const u16 sGliscorTeachableLearnset[] = {
+static const u16 sGliscorTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA620, 0x1991, 0x47FB, 0x928A, 0xECA0, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -10618,11 +11280,13 @@ static const u16 sGliscorTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sGliscorTeachableLearnset (sGliscorTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_GEN_4_CROSS_EVOS
 #endif //P_FAMILY_GLIGAR
 
 #if P_FAMILY_SNUBBULL
-static const u16 sSnubbullTeachableLearnset[] = {
+static const u16 sSnubbullTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x86B5, 0xFDE9, 0x23E5, 0x5BCA, 0x2E3D, 0x0003),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_BULK_UP,
@@ -10673,8 +11337,10 @@ static const u16 sSnubbullTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sSnubbullTeachableLearnset (sSnubbullTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sGranbullTeachableLearnset[] = {
+static const u16 sGranbullTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA6B5, 0xFDF9, 0x23ED, 0x5BCA, 0x2EBD, 0x0003),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_BULK_UP,
@@ -10729,10 +11395,12 @@ static const u16 sGranbullTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sGranbullTeachableLearnset (sGranbullTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_SNUBBULL
 
 #if P_FAMILY_QWILFISH
-static const u16 sQwilfishTeachableLearnset[] = {
+static const u16 sQwilfishTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9C64, 0x5401, 0x01C1, 0x3331, 0xED02, 0x0002),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_DIVE,
@@ -10765,9 +11433,11 @@ static const u16 sQwilfishTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sQwilfishTeachableLearnset (sQwilfishTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
 #if P_HISUIAN_FORMS
-static const u16 sQwilfishHisuiTeachableLearnset[] = {
+static const u16 sQwilfishHisuiTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9C24, 0x0401, 0x00C1, 0x1211, 0xC402, 0x0000),
     MOVE_BLIZZARD,
     MOVE_FACADE,
     MOVE_ICE_BEAM,
@@ -10789,8 +11459,10 @@ static const u16 sQwilfishHisuiTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sQwilfishHisuiTeachableLearnset (sQwilfishHisuiTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sOverqwilTeachableLearnset[] = {
+static const u16 sOverqwilTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xBC24, 0x0401, 0x00C1, 0x1211, 0xC402, 0x0000),
     MOVE_BLIZZARD,
     MOVE_FACADE,
     MOVE_HYPER_BEAM,
@@ -10813,11 +11485,13 @@ static const u16 sOverqwilTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sOverqwilTeachableLearnset (sOverqwilTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_HISUIAN_FORMS
 #endif //P_FAMILY_QWILFISH
 
 #if P_FAMILY_SHUCKLE
-static const u16 sShuckleTeachableLearnset[] = {
+static const u16 sShuckleTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8220, 0x1184, 0x01CB, 0x134E, 0x2DA0, 0x0000),
     MOVE_ATTRACT,
     MOVE_DIG,
     MOVE_DOUBLE_TEAM,
@@ -10846,10 +11520,12 @@ static const u16 sShuckleTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sShuckleTeachableLearnset (sShuckleTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_SHUCKLE
 
 #if P_FAMILY_HERACROSS
-static const u16 sHeracrossTeachableLearnset[] = {
+static const u16 sHeracrossTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA3A9, 0x1981, 0x43D8, 0x92CA, 0xAE80, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -10885,10 +11561,12 @@ static const u16 sHeracrossTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sHeracrossTeachableLearnset (sHeracrossTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_HERACROSS
 
 #if P_FAMILY_SNEASEL
-static const u16 sSneaselTeachableLearnset[] = {
+static const u16 sSneaselTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9E6D, 0x3D11, 0x53F0, 0x9F8B, 0xEC6F, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
@@ -10937,9 +11615,11 @@ static const u16 sSneaselTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sSneaselTeachableLearnset (sSneaselTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
 #if P_GEN_4_CROSS_EVOS
-static const u16 sWeavileTeachableLearnset[] = {
+static const u16 sWeavileTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xBE6D, 0x3D11, 0x53F0, 0x948B, 0xEC7F, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
@@ -10987,10 +11667,12 @@ static const u16 sWeavileTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sWeavileTeachableLearnset (sWeavileTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_GEN_4_CROSS_EVOS
 
 #if P_HISUIAN_FORMS
-static const u16 sSneaselHisuiTeachableLearnset[] = {
+static const u16 sSneaselHisuiTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x86A9, 0x0D11, 0x02D1, 0x1088, 0xC400, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_BRICK_BREAK,
     MOVE_BULK_UP,
@@ -11016,8 +11698,10 @@ static const u16 sSneaselHisuiTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sSneaselHisuiTeachableLearnset (sSneaselHisuiTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sSneaslerTeachableLearnset[] = {
+static const u16 sSneaslerTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA6A9, 0x0D11, 0x02D9, 0x5088, 0xC480, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_BRICK_BREAK,
     MOVE_BULK_UP,
@@ -11047,11 +11731,13 @@ static const u16 sSneaslerTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sSneaslerTeachableLearnset (sSneaslerTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_HISUIAN_FORMS
 #endif //P_FAMILY_SNEASEL
 
 #if P_FAMILY_TEDDIURSA
-static const u16 sTeddiursaTeachableLearnset[] = {
+static const u16 sTeddiursaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x86B1, 0x1981, 0x43F8, 0xDBCA, 0xEFBD, 0x0001),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -11098,8 +11784,10 @@ static const u16 sTeddiursaTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sTeddiursaTeachableLearnset (sTeddiursaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sUrsaringTeachableLearnset[] = {
+static const u16 sUrsaringTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA6B1, 0x1981, 0x43F8, 0xDBCA, 0xEFBD, 0x0001),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -11147,9 +11835,11 @@ static const u16 sUrsaringTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sUrsaringTeachableLearnset (sUrsaringTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
 #if P_GEN_8_CROSS_EVOS
-static const u16 sUrsalunaTeachableLearnset[] = {
+static const u16 sUrsalunaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA691, 0x0981, 0x02D8, 0xD2C8, 0xCE91, 0x0001),
     MOVE_AERIAL_ACE,
     MOVE_BRICK_BREAK,
     MOVE_BULK_UP,
@@ -11184,8 +11874,10 @@ static const u16 sUrsalunaTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sUrsalunaTeachableLearnset (sUrsalunaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sUrsalunaBloodmoonTeachableLearnset[] = {
+static const u16 sUrsalunaBloodmoonTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA619, 0x0981, 0x02C8, 0xD2C0, 0xCE81, 0x0001),
     MOVE_BRICK_BREAK,
     MOVE_CALM_MIND,
     MOVE_DIG,
@@ -11217,11 +11909,13 @@ static const u16 sUrsalunaBloodmoonTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sUrsalunaBloodmoonTeachableLearnset (sUrsalunaBloodmoonTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_GEN_8_CROSS_EVOS
 #endif //P_FAMILY_TEDDIURSA
 
 #if P_FAMILY_SLUGMA
-static const u16 sSlugmaTeachableLearnset[] = {
+static const u16 sSlugmaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC220, 0xB080, 0x21CE, 0x1348, 0x2DA0, 0x0000),
     MOVE_ATTRACT,
     MOVE_DOUBLE_TEAM,
     MOVE_EARTHQUAKE,
@@ -11250,8 +11944,10 @@ static const u16 sSlugmaTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sSlugmaTeachableLearnset (sSlugmaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sMagcargoTeachableLearnset[] = {
+static const u16 sMagcargoTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE220, 0xB088, 0x21CE, 0x334A, 0x2DA0, 0x0000),
     MOVE_ATTRACT,
     MOVE_DOUBLE_TEAM,
     MOVE_EARTHQUAKE,
@@ -11284,10 +11980,12 @@ static const u16 sMagcargoTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sMagcargoTeachableLearnset (sMagcargoTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_SLUGMA
 
 #if P_FAMILY_SWINUB
-static const u16 sSwinubTeachableLearnset[] = {
+static const u16 sSwinubTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xD870, 0x3181, 0x01CA, 0x134A, 0x2CA2, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_DIG,
@@ -11319,8 +12017,10 @@ static const u16 sSwinubTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sSwinubTeachableLearnset (sSwinubTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sPiloswineTeachableLearnset[] = {
+static const u16 sPiloswineTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xF870, 0x3181, 0x01CA, 0x134A, 0x2CA2, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_DIG,
@@ -11353,9 +12053,11 @@ static const u16 sPiloswineTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sPiloswineTeachableLearnset (sPiloswineTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
 #if P_GEN_4_CROSS_EVOS
-static const u16 sMamoswineTeachableLearnset[] = {
+static const u16 sMamoswineTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xF870, 0x3181, 0x01CA, 0x924A, 0x2CA2, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_DIG,
@@ -11388,11 +12090,13 @@ static const u16 sMamoswineTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sMamoswineTeachableLearnset (sMamoswineTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_GEN_4_CROSS_EVOS
 #endif //P_FAMILY_SWINUB
 
 #if P_FAMILY_CORSOLA
-static const u16 sCorsolaTeachableLearnset[] = {
+static const u16 sCorsolaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xDA6C, 0x3785, 0x01CA, 0x334B, 0x2DA2, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_CALM_MIND,
@@ -11432,9 +12136,11 @@ static const u16 sCorsolaTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sCorsolaTeachableLearnset (sCorsolaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
 #if P_GALARIAN_FORMS
-static const u16 sCorsolaGalarTeachableLearnset[] = {
+static const u16 sCorsolaGalarTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xDA4C, 0x2787, 0x01CA, 0x1041, 0x0C82, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_CALM_MIND,
@@ -11465,8 +12171,10 @@ static const u16 sCorsolaGalarTeachableLearnset[] = {
     MOVE_SNORE,
     MOVE_UNAVAILABLE,
 };
+#define sCorsolaGalarTeachableLearnset (sCorsolaGalarTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sCursolaTeachableLearnset[] = {
+static const u16 sCursolaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xFA4C, 0x2787, 0x01CA, 0x1041, 0x0C82, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_CALM_MIND,
@@ -11498,11 +12206,13 @@ static const u16 sCursolaTeachableLearnset[] = {
     MOVE_SNORE,
     MOVE_UNAVAILABLE,
 };
+#define sCursolaTeachableLearnset (sCursolaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_GALARIAN_FORMS
 #endif //P_FAMILY_CORSOLA
 
 #if P_FAMILY_REMORAID
-static const u16 sRemoraidTeachableLearnset[] = {
+static const u16 sRemoraidTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xBB24, 0x9201, 0x03C4, 0x1331, 0x6C22, 0x0002),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_BULLET_SEED,
@@ -11535,8 +12245,10 @@ static const u16 sRemoraidTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sRemoraidTeachableLearnset (sRemoraidTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sOctilleryTeachableLearnset[] = {
+static const u16 sOctilleryTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xBB24, 0x9201, 0x03C5, 0x1331, 0x6E22, 0x0002),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_BULLET_SEED,
@@ -11571,10 +12283,12 @@ static const u16 sOctilleryTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sOctilleryTeachableLearnset (sOctilleryTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_REMORAID
 
 #if P_FAMILY_DELIBIRD
-static const u16 sDelibirdTeachableLearnset[] = {
+static const u16 sDelibirdTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xB865, 0x1801, 0x87D0, 0x12C0, 0x6F2F, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
@@ -11610,11 +12324,13 @@ static const u16 sDelibirdTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sDelibirdTeachableLearnset (sDelibirdTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_DELIBIRD
 
 #if P_FAMILY_MANTINE
 #if P_GEN_4_CROSS_EVOS
-static const u16 sMantykeTeachableLearnset[] = {
+static const u16 sMantykeTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9864, 0x1081, 0x01D0, 0x1231, 0x6CA2, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
@@ -11642,9 +12358,11 @@ static const u16 sMantykeTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sMantykeTeachableLearnset (sMantykeTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_GEN_4_CROSS_EVOS
 
-static const u16 sMantineTeachableLearnset[] = {
+static const u16 sMantineTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xB964, 0x1081, 0x01D8, 0x1271, 0x6CA2, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
@@ -11676,10 +12394,12 @@ static const u16 sMantineTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sMantineTeachableLearnset (sMantineTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_MANTINE
 
 #if P_FAMILY_SKARMORY
-static const u16 sSkarmoryTeachableLearnset[] = {
+static const u16 sSkarmoryTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA630, 0x1000, 0xC7FA, 0x928C, 0xECA2, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_CUT,
@@ -11714,10 +12434,12 @@ static const u16 sSkarmoryTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sSkarmoryTeachableLearnset (sSkarmoryTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_SKARMORY
 
 #if P_FAMILY_HOUNDOUR
-static const u16 sHoundourTeachableLearnset[] = {
+static const u16 sHoundourTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8630, 0x9419, 0x33E5, 0x16C8, 0x6C20, 0x0000),
     MOVE_ATTRACT,
     MOVE_DOUBLE_TEAM,
     MOVE_FACADE,
@@ -11751,8 +12473,10 @@ static const u16 sHoundourTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sHoundourTeachableLearnset (sHoundourTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sHoundoomTeachableLearnset[] = {
+static const u16 sHoundoomTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA630, 0x9419, 0x33E5, 0x16CA, 0x6C20, 0x0000),
     MOVE_ATTRACT,
     MOVE_DOUBLE_TEAM,
     MOVE_FACADE,
@@ -11788,10 +12512,12 @@ static const u16 sHoundoomTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sHoundoomTeachableLearnset (sHoundoomTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_HOUNDOUR
 
 #if P_FAMILY_PHANPY
-static const u16 sPhanpyTeachableLearnset[] = {
+static const u16 sPhanpyTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8230, 0x1191, 0x03CA, 0x13CA, 0x2DA0, 0x0000),
     MOVE_ATTRACT,
     MOVE_DIG,
     MOVE_DOUBLE_TEAM,
@@ -11822,8 +12548,10 @@ static const u16 sPhanpyTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sPhanpyTeachableLearnset (sPhanpyTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sDonphanTeachableLearnset[] = {
+static const u16 sDonphanTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA230, 0x1191, 0x03CA, 0x13CA, 0x2DA0, 0x0000),
     MOVE_ATTRACT,
     MOVE_DIG,
     MOVE_DOUBLE_TEAM,
@@ -11855,10 +12583,12 @@ static const u16 sDonphanTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sDonphanTeachableLearnset (sDonphanTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_PHANPY
 
 #if P_FAMILY_STANTLER
-static const u16 sStantlerTeachableLearnset[] = {
+static const u16 sStantlerTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE238, 0x77F9, 0x0BC0, 0x1644, 0x6C60, 0x0002),
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
     MOVE_DIG,
@@ -11897,9 +12627,11 @@ static const u16 sStantlerTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sStantlerTeachableLearnset (sStantlerTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
 #if P_GEN_8_CROSS_EVOS
-static const u16 sWyrdeerTeachableLearnset[] = {
+static const u16 sWyrdeerTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE218, 0x27F9, 0x0AC0, 0x1240, 0x4440, 0x0002),
     MOVE_CALM_MIND,
     MOVE_DIG,
     MOVE_EARTHQUAKE,
@@ -11929,17 +12661,21 @@ static const u16 sWyrdeerTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sWyrdeerTeachableLearnset (sWyrdeerTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_GEN_8_CROSS_EVOS
 #endif //P_FAMILY_STANTLER
 
 #if P_FAMILY_SMEARGLE
-static const u16 sSmeargleTeachableLearnset[] = {
+static const u16 sSmeargleTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000),
     MOVE_UNAVAILABLE,
 };
+#define sSmeargleTeachableLearnset (sSmeargleTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_SMEARGLE
 
 #if P_FAMILY_MILTANK
-static const u16 sMiltankTeachableLearnset[] = {
+static const u16 sMiltankTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xBA25, 0x5CF9, 0x01CA, 0x5BCB, 0x2FFF, 0x0003),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_BRICK_BREAK,
@@ -11990,10 +12726,12 @@ static const u16 sMiltankTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sMiltankTeachableLearnset (sMiltankTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_MILTANK
 
 #if P_FAMILY_RAIKOU
-static const u16 sRaikouTeachableLearnset[] = {
+static const u16 sRaikouTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE238, 0x7571, 0x40C2, 0x124E, 0x6C60, 0x0002),
     MOVE_CALM_MIND,
     MOVE_CUT,
     MOVE_DIG,
@@ -12029,10 +12767,12 @@ static const u16 sRaikouTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sRaikouTeachableLearnset (sRaikouTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_RAIKOU
 
 #if P_FAMILY_ENTEI
-static const u16 sEnteiTeachableLearnset[] = {
+static const u16 sEnteiTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA238, 0xB519, 0x60C6, 0x124E, 0x6C60, 0x0000),
     MOVE_CALM_MIND,
     MOVE_CUT,
     MOVE_DIG,
@@ -12067,10 +12807,12 @@ static const u16 sEnteiTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sEnteiTeachableLearnset (sEnteiTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_ENTEI
 
 #if P_FAMILY_SUICUNE
-static const u16 sSuicuneTeachableLearnset[] = {
+static const u16 sSuicuneTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xBA7C, 0x3511, 0x40C2, 0x1279, 0x6C62, 0x0000),
     MOVE_BLIZZARD,
     MOVE_CALM_MIND,
     MOVE_CUT,
@@ -12107,10 +12849,12 @@ static const u16 sSuicuneTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sSuicuneTeachableLearnset (sSuicuneTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_SUICUNE
 
 #if P_FAMILY_LARVITAR
-static const u16 sLarvitarTeachableLearnset[] = {
+static const u16 sLarvitarTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA620, 0x1991, 0x01EA, 0x1248, 0x2CA0, 0x0000),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_DIG,
@@ -12139,8 +12883,10 @@ static const u16 sLarvitarTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sLarvitarTeachableLearnset (sLarvitarTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sPupitarTeachableLearnset[] = {
+static const u16 sPupitarTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA620, 0x1991, 0x01FA, 0x1248, 0x2CA0, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -12170,8 +12916,10 @@ static const u16 sPupitarTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sPupitarTeachableLearnset (sPupitarTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sTyranitarTeachableLearnset[] = {
+static const u16 sTyranitarTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xBE37, 0xD9F1, 0x41FE, 0xDACB, 0x2EAF, 0x0003),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
@@ -12226,10 +12974,12 @@ static const u16 sTyranitarTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sTyranitarTeachableLearnset (sTyranitarTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_LARVITAR
 
 #if P_FAMILY_LUGIA
-static const u16 sLugiaTeachableLearnset[] = {
+static const u16 sLugiaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xFA7C, 0x76F7, 0x8CD2, 0x167F, 0x6C62, 0x0002),
     MOVE_AERIAL_ACE,
     MOVE_BLIZZARD,
     MOVE_CALM_MIND,
@@ -12280,10 +13030,12 @@ static const u16 sLugiaTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sLugiaTeachableLearnset (sLugiaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_LUGIA
 
 #if P_FAMILY_HO_OH
-static const u16 sHoOhTeachableLearnset[] = {
+static const u16 sHoOhTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE238, 0xF6EF, 0xA4D6, 0x164E, 0x6C60, 0x0002),
     MOVE_AERIAL_ACE,
     MOVE_CALM_MIND,
     MOVE_DOUBLE_TEAM,
@@ -12328,10 +13080,12 @@ static const u16 sHoOhTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sHoOhTeachableLearnset (sHoOhTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_HO_OH
 
 #if P_FAMILY_CELEBI
-static const u16 sCelebiTeachableLearnset[] = {
+static const u16 sCelebiTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE22C, 0x760F, 0x48D2, 0x1704, 0xEC70, 0x0002),
     MOVE_AERIAL_ACE,
     MOVE_CALM_MIND,
     MOVE_CUT,
@@ -12370,10 +13124,12 @@ static const u16 sCelebiTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sCelebiTeachableLearnset (sCelebiTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_CELEBI
 
 #if P_FAMILY_TREECKO
-static const u16 sTreeckoTeachableLearnset[] = {
+static const u16 sTreeckoTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8321, 0x191E, 0x43D8, 0x9ACE, 0xEEAC, 0x0001),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -12415,8 +13171,10 @@ static const u16 sTreeckoTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sTreeckoTeachableLearnset (sTreeckoTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sGrovyleTeachableLearnset[] = {
+static const u16 sGrovyleTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8321, 0x191E, 0x43D8, 0x9ACE, 0xEEAC, 0x0001),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -12458,8 +13216,10 @@ static const u16 sGrovyleTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sGrovyleTeachableLearnset (sGrovyleTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sSceptileTeachableLearnset[] = {
+static const u16 sSceptileTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA333, 0x199E, 0x43D8, 0x9ACE, 0xEEAC, 0x0001),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -12505,10 +13265,12 @@ static const u16 sSceptileTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sSceptileTeachableLearnset (sSceptileTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_TREECKO
 
 #if P_FAMILY_TORCHIC
-static const u16 sTorchicTeachableLearnset[] = {
+static const u16 sTorchicTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8220, 0x9100, 0x61DC, 0x12CA, 0xEEAC, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_CUT,
@@ -12541,8 +13303,10 @@ static const u16 sTorchicTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sTorchicTeachableLearnset (sTorchicTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sCombuskenTeachableLearnset[] = {
+static const u16 sCombuskenTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x82A1, 0x9900, 0x63DC, 0xDACA, 0xEEAC, 0x0001),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -12583,8 +13347,10 @@ static const u16 sCombuskenTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sCombuskenTeachableLearnset (sCombuskenTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sBlazikenTeachableLearnset[] = {
+static const u16 sBlazikenTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA2B1, 0x9988, 0x63DC, 0xDACA, 0xEEAC, 0x0001),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -12629,10 +13395,12 @@ static const u16 sBlazikenTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sBlazikenTeachableLearnset (sBlazikenTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_TORCHIC
 
 #if P_FAMILY_MUDKIP
-static const u16 sMudkipTeachableLearnset[] = {
+static const u16 sMudkipTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9874, 0x1111, 0x01C8, 0x13FB, 0x2DA2, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_DIG,
@@ -12667,8 +13435,10 @@ static const u16 sMudkipTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sMudkipTeachableLearnset (sMudkipTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sMarshtompTeachableLearnset[] = {
+static const u16 sMarshtompTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9875, 0x1991, 0x01C8, 0x1BFB, 0x2FAF, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_BRICK_BREAK,
@@ -12711,8 +13481,10 @@ static const u16 sMarshtompTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sMarshtompTeachableLearnset (sMarshtompTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sSwampertTeachableLearnset[] = {
+static const u16 sSwampertTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xB8F5, 0x1991, 0x01C8, 0x1BFB, 0x2FAF, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_BRICK_BREAK,
@@ -12757,10 +13529,12 @@ static const u16 sSwampertTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sSwampertTeachableLearnset (sSwampertTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_MUDKIP
 
 #if P_FAMILY_POOCHYENA
-static const u16 sPoochyenaTeachableLearnset[] = {
+static const u16 sPoochyenaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8630, 0x1511, 0x13E0, 0x12C8, 0x2C60, 0x0000),
     MOVE_ATTRACT,
     MOVE_DIG,
     MOVE_DOUBLE_TEAM,
@@ -12789,8 +13563,10 @@ static const u16 sPoochyenaTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sPoochyenaTeachableLearnset (sPoochyenaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sMightyenaTeachableLearnset[] = {
+static const u16 sMightyenaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA630, 0x1511, 0x13E0, 0x12CA, 0x2C60, 0x0000),
     MOVE_ATTRACT,
     MOVE_DIG,
     MOVE_DOUBLE_TEAM,
@@ -12821,10 +13597,12 @@ static const u16 sMightyenaTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sMightyenaTeachableLearnset (sMightyenaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_POOCHYENA
 
 #if P_FAMILY_ZIGZAGOON
-static const u16 sZigzagoonTeachableLearnset[] = {
+static const u16 sZigzagoonTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9A24, 0x5571, 0x43C0, 0x9349, 0x6D22, 0x0002),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_CUT,
@@ -12861,8 +13639,10 @@ static const u16 sZigzagoonTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sZigzagoonTeachableLearnset (sZigzagoonTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sLinooneTeachableLearnset[] = {
+static const u16 sLinooneTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xBA34, 0x5571, 0x43C0, 0x934B, 0x6D22, 0x0002),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_CUT,
@@ -12902,9 +13682,11 @@ static const u16 sLinooneTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sLinooneTeachableLearnset (sLinooneTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
 #if P_GALARIAN_FORMS
-static const u16 sZigzagoonGalarTeachableLearnset[] = {
+static const u16 sZigzagoonGalarTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9E00, 0x0571, 0x03C0, 0x12C1, 0x4C02, 0x0002),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_DIG,
@@ -12932,8 +13714,10 @@ static const u16 sZigzagoonGalarTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sZigzagoonGalarTeachableLearnset (sZigzagoonGalarTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sLinooneGalarTeachableLearnset[] = {
+static const u16 sLinooneGalarTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xBE00, 0x0571, 0x03C0, 0x12C1, 0x4C02, 0x0002),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_DIG,
@@ -12962,8 +13746,10 @@ static const u16 sLinooneGalarTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sLinooneGalarTeachableLearnset (sLinooneGalarTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sObstagoonTeachableLearnset[] = {
+static const u16 sObstagoonTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xBE80, 0x0D71, 0x03C0, 0x52C1, 0x4C0F, 0x0003),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_BRICK_BREAK,
@@ -12999,20 +13785,26 @@ static const u16 sObstagoonTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sObstagoonTeachableLearnset (sObstagoonTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_GALARIAN_FORMS
 #endif //P_FAMILY_ZIGZAGOON
 
 #if P_FAMILY_WURMPLE
-static const u16 sWurmpleTeachableLearnset[] = {
+static const u16 sWurmpleTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0000),
     MOVE_SNORE,
     MOVE_UNAVAILABLE,
 };
+#define sWurmpleTeachableLearnset (sWurmpleTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sSilcoonTeachableLearnset[] = {
+static const u16 sSilcoonTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000),
     MOVE_UNAVAILABLE,
 };
+#define sSilcoonTeachableLearnset (sSilcoonTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sBeautiflyTeachableLearnset[] = {
+static const u16 sBeautiflyTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA220, 0x160E, 0x03D0, 0x1204, 0x6C00, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_DOUBLE_TEAM,
@@ -13037,12 +13829,16 @@ static const u16 sBeautiflyTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sBeautiflyTeachableLearnset (sBeautiflyTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sCascoonTeachableLearnset[] = {
+static const u16 sCascoonTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000),
     MOVE_UNAVAILABLE,
 };
+#define sCascoonTeachableLearnset (sCascoonTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sDustoxTeachableLearnset[] = {
+static const u16 sDustoxTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE220, 0x160A, 0x03D1, 0x1204, 0x6C00, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_DOUBLE_TEAM,
@@ -13068,10 +13864,12 @@ static const u16 sDustoxTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sDustoxTeachableLearnset (sDustoxTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_WURMPLE
 
 #if P_FAMILY_LOTAD
-static const u16 sLotadTeachableLearnset[] = {
+static const u16 sLotadTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9B64, 0x100B, 0x03C0, 0x12C5, 0xAC02, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_BULLET_SEED,
@@ -13101,8 +13899,10 @@ static const u16 sLotadTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sLotadTeachableLearnset (sLotadTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sLombreTeachableLearnset[] = {
+static const u16 sLombreTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9B64, 0x180B, 0x03C0, 0x5AFF, 0xAC3F, 0x0001),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_BRICK_BREAK,
@@ -13145,8 +13945,10 @@ static const u16 sLombreTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sLombreTeachableLearnset (sLombreTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sLudicoloTeachableLearnset[] = {
+static const u16 sLudicoloTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xBB65, 0x180B, 0x03C0, 0x5AFF, 0xEE3F, 0x0001),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_BRICK_BREAK,
@@ -13193,10 +13995,12 @@ static const u16 sLudicoloTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sLudicoloTeachableLearnset (sLudicoloTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_LOTAD
 
 #if P_FAMILY_SEEDOT
-static const u16 sSeedotTeachableLearnset[] = {
+static const u16 sSeedotTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8320, 0x150B, 0x01C0, 0x334C, 0xAD00, 0x0000),
     MOVE_ATTRACT,
     MOVE_BULLET_SEED,
     MOVE_DIG,
@@ -13224,8 +14028,10 @@ static const u16 sSeedotTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sSeedotTeachableLearnset (sSeedotTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sNuzleafTeachableLearnset[] = {
+static const u16 sNuzleafTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA320, 0x1D0B, 0x43E8, 0xB34E, 0xEDE4, 0x0000),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_BULLET_SEED,
@@ -13266,8 +14072,10 @@ static const u16 sNuzleafTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sNuzleafTeachableLearnset (sNuzleafTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sShiftryTeachableLearnset[] = {
+static const u16 sShiftryTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA720, 0x1D0B, 0x43F8, 0xB34E, 0xEDE6, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -13311,10 +14119,12 @@ static const u16 sShiftryTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sShiftryTeachableLearnset (sShiftryTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_SEEDOT
 
 #if P_FAMILY_TAILLOW
-static const u16 sTaillowTeachableLearnset[] = {
+static const u16 sTaillowTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8220, 0x1001, 0x87D0, 0x1280, 0x6C20, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_DOUBLE_TEAM,
@@ -13337,8 +14147,10 @@ static const u16 sTaillowTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sTaillowTeachableLearnset (sTaillowTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sSwellowTeachableLearnset[] = {
+static const u16 sSwellowTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA220, 0x1001, 0x87D0, 0x1280, 0x6C20, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_DOUBLE_TEAM,
@@ -13362,10 +14174,12 @@ static const u16 sSwellowTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sSwellowTeachableLearnset (sSwellowTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_TAILLOW
 
 #if P_FAMILY_WINGULL
-static const u16 sWingullTeachableLearnset[] = {
+static const u16 sWingullTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9864, 0x5001, 0x87D0, 0x1211, 0x6C22, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
@@ -13394,8 +14208,10 @@ static const u16 sWingullTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sWingullTeachableLearnset (sWingullTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sPelipperTeachableLearnset[] = {
+static const u16 sPelipperTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xB864, 0x5001, 0x87D0, 0x1251, 0x6C22, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
@@ -13426,10 +14242,12 @@ static const u16 sPelipperTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sPelipperTeachableLearnset (sPelipperTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_WINGULL
 
 #if P_FAMILY_RALTS
-static const u16 sRaltsTeachableLearnset[] = {
+static const u16 sRaltsTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xCE28, 0x7625, 0x1BE0, 0x5744, 0x6C7F, 0x0003),
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
     MOVE_DOUBLE_TEAM,
@@ -13474,8 +14292,10 @@ static const u16 sRaltsTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sRaltsTeachableLearnset (sRaltsTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sKirliaTeachableLearnset[] = {
+static const u16 sKirliaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xEE28, 0x7625, 0x1BE0, 0x5744, 0x6C7F, 0x0003),
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
     MOVE_DOUBLE_TEAM,
@@ -13521,8 +14341,10 @@ static const u16 sKirliaTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sKirliaTeachableLearnset (sKirliaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sGardevoirTeachableLearnset[] = {
+static const u16 sGardevoirTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xEE28, 0x7625, 0x1BE0, 0x5744, 0x6C7F, 0x0003),
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
     MOVE_DOUBLE_TEAM,
@@ -13568,9 +14390,11 @@ static const u16 sGardevoirTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sGardevoirTeachableLearnset (sGardevoirTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
 #if P_GEN_4_CROSS_EVOS
-static const u16 sGalladeTeachableLearnset[] = {
+static const u16 sGalladeTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xEEA9, 0x7EA5, 0x5BF8, 0xD44E, 0xECFF, 0x0003),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -13626,11 +14450,13 @@ static const u16 sGalladeTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sGalladeTeachableLearnset (sGalladeTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_GEN_4_CROSS_EVOS
 #endif //P_FAMILY_RALTS
 
 #if P_FAMILY_SURSKIT
-static const u16 sSurskitTeachableLearnset[] = {
+static const u16 sSurskitTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9A24, 0x140B, 0x03C0, 0x1215, 0x6C62, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_DOUBLE_TEAM,
@@ -13660,8 +14486,10 @@ static const u16 sSurskitTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sSurskitTeachableLearnset (sSurskitTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sMasquerainTeachableLearnset[] = {
+static const u16 sMasquerainTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xBA24, 0x140B, 0x03D0, 0x1215, 0x6C62, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
@@ -13693,10 +14521,12 @@ static const u16 sMasquerainTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sMasquerainTeachableLearnset (sMasquerainTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_SURSKIT
 
 #if P_FAMILY_SHROOMISH
-static const u16 sShroomishTeachableLearnset[] = {
+static const u16 sShroomishTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8321, 0x100F, 0x11C1, 0x1244, 0xEC00, 0x0000),
     MOVE_ATTRACT,
     MOVE_BULLET_SEED,
     MOVE_DOUBLE_TEAM,
@@ -13723,8 +14553,10 @@ static const u16 sShroomishTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sShroomishTeachableLearnset (sShroomishTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sBreloomTeachableLearnset[] = {
+static const u16 sBreloomTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA3A1, 0x191F, 0x51D9, 0x9ACE, 0xEEAC, 0x0001),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -13770,10 +14602,12 @@ static const u16 sBreloomTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sBreloomTeachableLearnset (sBreloomTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_SHROOMISH
 
 #if P_FAMILY_SLAKOTH
-static const u16 sSlakothTeachableLearnset[] = {
+static const u16 sSlakothTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9AA5, 0xDC69, 0x43DC, 0xDACA, 0x2EBF, 0x0001),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
@@ -13822,8 +14656,10 @@ static const u16 sSlakothTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sSlakothTeachableLearnset (sSlakothTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sVigorothTeachableLearnset[] = {
+static const u16 sVigorothTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9EB5, 0xDDE9, 0x43DC, 0xDACA, 0x2EBF, 0x0003),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
@@ -13877,8 +14713,10 @@ static const u16 sVigorothTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sVigorothTeachableLearnset (sVigorothTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sSlakingTeachableLearnset[] = {
+static const u16 sSlakingTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xBEB5, 0xDDE9, 0x43DC, 0xDACA, 0x2EBF, 0x0003),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
@@ -13933,10 +14771,12 @@ static const u16 sSlakingTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sSlakingTeachableLearnset (sSlakingTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_SLAKOTH
 
 #if P_FAMILY_NINCADA
-static const u16 sNincadaTeachableLearnset[] = {
+static const u16 sNincadaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8220, 0x150A, 0x40D2, 0x9204, 0x2C20, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_CUT,
     MOVE_DIG,
@@ -13960,8 +14800,10 @@ static const u16 sNincadaTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sNincadaTeachableLearnset (sNincadaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sNinjaskTeachableLearnset[] = {
+static const u16 sNinjaskTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA220, 0x150A, 0x43D2, 0x9204, 0xEC20, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_CUT,
@@ -13990,8 +14832,10 @@ static const u16 sNinjaskTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sNinjaskTeachableLearnset (sNinjaskTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sShedinjaTeachableLearnset[] = {
+static const u16 sShedinjaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA220, 0x150A, 0x42D2, 0x9604, 0x2C20, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_CUT,
     MOVE_DIG,
@@ -14018,10 +14862,12 @@ static const u16 sShedinjaTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sShedinjaTeachableLearnset (sShedinjaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_NINCADA
 
 #if P_FAMILY_WHISMUR
-static const u16 sWhismurTeachableLearnset[] = {
+static const u16 sWhismurTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9A34, 0xD409, 0x01C4, 0x5BC0, 0x2F6F, 0x0001),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_DOUBLE_TEAM,
@@ -14060,8 +14906,10 @@ static const u16 sWhismurTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sWhismurTeachableLearnset (sWhismurTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sLoudredTeachableLearnset[] = {
+static const u16 sLoudredTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9E34, 0xDC89, 0x21EC, 0x5BCA, 0x2FEF, 0x0001),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_BRICK_BREAK,
@@ -14109,8 +14957,10 @@ static const u16 sLoudredTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sLoudredTeachableLearnset (sLoudredTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sExploudTeachableLearnset[] = {
+static const u16 sExploudTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xBE34, 0xDC89, 0x21EC, 0x5BCB, 0x2FEF, 0x0001),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_BRICK_BREAK,
@@ -14160,10 +15010,12 @@ static const u16 sExploudTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sExploudTeachableLearnset (sExploudTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_WHISMUR
 
 #if P_FAMILY_MAKUHITA
-static const u16 sMakuhitaTeachableLearnset[] = {
+static const u16 sMakuhitaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x86A1, 0x1981, 0x03C8, 0x5ACB, 0x6EBD, 0x0001),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_BULK_UP,
@@ -14203,8 +15055,10 @@ static const u16 sMakuhitaTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sMakuhitaTeachableLearnset (sMakuhitaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sHariyamaTeachableLearnset[] = {
+static const u16 sHariyamaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA6A1, 0x1981, 0x03C8, 0x5ACB, 0x6EBD, 0x0001),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_BULK_UP,
@@ -14245,10 +15099,12 @@ static const u16 sHariyamaTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sHariyamaTeachableLearnset (sHariyamaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_MAKUHITA
 
 #if P_FAMILY_NOSEPASS
-static const u16 sNosepassTeachableLearnset[] = {
+static const u16 sNosepassTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8620, 0x50E0, 0x01EA, 0x7B4A, 0x2DA1, 0x0003),
     MOVE_ATTRACT,
     MOVE_DOUBLE_TEAM,
     MOVE_EARTHQUAKE,
@@ -14284,9 +15140,11 @@ static const u16 sNosepassTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sNosepassTeachableLearnset (sNosepassTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
 #if P_GEN_4_CROSS_EVOS
-static const u16 sProbopassTeachableLearnset[] = {
+static const u16 sProbopassTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA620, 0x50E0, 0x01EA, 0x724A, 0x2DA1, 0x0003),
     MOVE_ATTRACT,
     MOVE_DOUBLE_TEAM,
     MOVE_EARTHQUAKE,
@@ -14321,11 +15179,13 @@ static const u16 sProbopassTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sProbopassTeachableLearnset (sProbopassTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_GEN_4_CROSS_EVOS
 #endif //P_FAMILY_NOSEPASS
 
 #if P_FAMILY_SKITTY
-static const u16 sSkittyTeachableLearnset[] = {
+static const u16 sSkittyTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9A2C, 0x557D, 0x01C0, 0x1744, 0x6D62, 0x0002),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_CALM_MIND,
@@ -14363,8 +15223,10 @@ static const u16 sSkittyTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sSkittyTeachableLearnset (sSkittyTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sDelcattyTeachableLearnset[] = {
+static const u16 sDelcattyTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xBA2C, 0x557D, 0x01C0, 0x174E, 0x6D62, 0x0002),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_CALM_MIND,
@@ -14405,10 +15267,12 @@ static const u16 sDelcattyTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sDelcattyTeachableLearnset (sDelcattyTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_SKITTY
 
 #if P_FAMILY_SABLEYE
-static const u16 sSableyeTeachableLearnset[] = {
+static const u16 sSableyeTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE6AD, 0x7F03, 0x5BF8, 0xDECC, 0x2E7F, 0x0003),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -14463,10 +15327,12 @@ static const u16 sSableyeTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sSableyeTeachableLearnset (sSableyeTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_SABLEYE
 
 #if P_FAMILY_MAWILE
-static const u16 sMawileTeachableLearnset[] = {
+static const u16 sMawileTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xAE21, 0x9C09, 0x11EF, 0x1ACA, 0xAEEF, 0x0001),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_DOUBLE_TEAM,
@@ -14511,10 +15377,12 @@ static const u16 sMawileTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sMawileTeachableLearnset (sMawileTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_MAWILE
 
 #if P_FAMILY_ARON
-static const u16 sAronTeachableLearnset[] = {
+static const u16 sAronTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8234, 0x5191, 0x41DA, 0x934A, 0x2DA0, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_CUT,
@@ -14548,8 +15416,10 @@ static const u16 sAronTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sAronTeachableLearnset (sAronTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sLaironTeachableLearnset[] = {
+static const u16 sLaironTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8234, 0x5191, 0x41DA, 0x934A, 0x2DA0, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_CUT,
@@ -14583,8 +15453,10 @@ static const u16 sLaironTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sLaironTeachableLearnset (sLaironTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sAggronTeachableLearnset[] = {
+static const u16 sAggronTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xBE37, 0xD9F9, 0x41DE, 0xDBCB, 0x2FAF, 0x0003),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
@@ -14641,10 +15513,12 @@ static const u16 sAggronTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sAggronTeachableLearnset (sAggronTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_ARON
 
 #if P_FAMILY_MEDITITE
-static const u16 sMedititeTeachableLearnset[] = {
+static const u16 sMedititeTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC6A9, 0x3E01, 0x0BD8, 0x5ECE, 0x6EFD, 0x0001),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -14691,8 +15565,10 @@ static const u16 sMedititeTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sMedititeTeachableLearnset (sMedititeTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sMedichamTeachableLearnset[] = {
+static const u16 sMedichamTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE6A9, 0x3E01, 0x0BD8, 0x5ECE, 0x6EFD, 0x0001),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -14740,10 +15616,12 @@ static const u16 sMedichamTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sMedichamTeachableLearnset (sMedichamTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_MEDITITE
 
 #if P_FAMILY_ELECTRIKE
-static const u16 sElectrikeTeachableLearnset[] = {
+static const u16 sElectrikeTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC030, 0xD071, 0x03C0, 0x1246, 0x6C20, 0x0002),
     MOVE_ATTRACT,
     MOVE_DOUBLE_TEAM,
     MOVE_FACADE,
@@ -14772,8 +15650,10 @@ static const u16 sElectrikeTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sElectrikeTeachableLearnset (sElectrikeTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sManectricTeachableLearnset[] = {
+static const u16 sManectricTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE030, 0xD071, 0x23C0, 0x1246, 0x6C20, 0x0002),
     MOVE_ATTRACT,
     MOVE_DOUBLE_TEAM,
     MOVE_FACADE,
@@ -14804,10 +15684,12 @@ static const u16 sManectricTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sManectricTeachableLearnset (sManectricTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_ELECTRIKE
 
 #if P_FAMILY_PLUSLE
-static const u16 sPlusleTeachableLearnset[] = {
+static const u16 sPlusleTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC020, 0x5071, 0x09C0, 0x1BC4, 0x6F3C, 0x0003),
     MOVE_ATTRACT,
     MOVE_DOUBLE_TEAM,
     MOVE_FACADE,
@@ -14842,10 +15724,12 @@ static const u16 sPlusleTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sPlusleTeachableLearnset (sPlusleTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_PLUSLE
 
 #if P_FAMILY_MINUN
-static const u16 sMinunTeachableLearnset[] = {
+static const u16 sMinunTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC020, 0x5071, 0x01C0, 0x1BC4, 0x6F3C, 0x0003),
     MOVE_ATTRACT,
     MOVE_DOUBLE_TEAM,
     MOVE_FACADE,
@@ -14879,10 +15763,12 @@ static const u16 sMinunTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sMinunTeachableLearnset (sMinunTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_MINUN
 
 #if P_FAMILY_VOLBEAT_ILLUMISE
-static const u16 sVolbeatTeachableLearnset[] = {
+static const u16 sVolbeatTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC625, 0x5C6B, 0x03D0, 0x1AC4, 0x6E7D, 0x0003),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -14925,8 +15811,10 @@ static const u16 sVolbeatTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sVolbeatTeachableLearnset (sVolbeatTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sIllumiseTeachableLearnset[] = {
+static const u16 sIllumiseTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC225, 0x5C6B, 0x03D0, 0x1AC4, 0x6E7D, 0x0003),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -14968,11 +15856,13 @@ static const u16 sIllumiseTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sIllumiseTeachableLearnset (sIllumiseTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_VOLBEAT_ILLUMISE
 
 #if P_FAMILY_ROSELIA
 #if P_GEN_4_CROSS_EVOS
-static const u16 sBudewTeachableLearnset[] = {
+static const u16 sBudewTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8320, 0x140B, 0x41C1, 0x1004, 0xEC60, 0x0000),
     MOVE_ATTRACT,
     MOVE_BULLET_SEED,
     MOVE_CUT,
@@ -14998,9 +15888,11 @@ static const u16 sBudewTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sBudewTeachableLearnset (sBudewTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_GEN_4_CROSS_EVOS
 
-static const u16 sRoseliaTeachableLearnset[] = {
+static const u16 sRoseliaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8320, 0x140B, 0x41C1, 0x9244, 0xEC60, 0x0000),
     MOVE_ATTRACT,
     MOVE_BULLET_SEED,
     MOVE_CUT,
@@ -15029,9 +15921,11 @@ static const u16 sRoseliaTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sRoseliaTeachableLearnset (sRoseliaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
 #if P_GEN_4_CROSS_EVOS
-static const u16 sRoseradeTeachableLearnset[] = {
+static const u16 sRoseradeTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA320, 0x140B, 0x41C1, 0x9044, 0xEC60, 0x0000),
     MOVE_ATTRACT,
     MOVE_BULLET_SEED,
     MOVE_CUT,
@@ -15060,11 +15954,13 @@ static const u16 sRoseradeTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sRoseradeTeachableLearnset (sRoseradeTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_GEN_4_CROSS_EVOS
 #endif //P_FAMILY_ROSELIA
 
 #if P_FAMILY_GULPIN
-static const u16 sGulpinTeachableLearnset[] = {
+static const u16 sGulpinTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8B24, 0x540B, 0x13C1, 0x7FCA, 0xAD21, 0x0003),
     MOVE_ATTRACT,
     MOVE_BULLET_SEED,
     MOVE_DOUBLE_TEAM,
@@ -15105,8 +16001,10 @@ static const u16 sGulpinTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sGulpinTeachableLearnset (sGulpinTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sSwalotTeachableLearnset[] = {
+static const u16 sSwalotTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xAB24, 0x5C8B, 0x13C1, 0x7FCA, 0xAD31, 0x0003),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_BULLET_SEED,
@@ -15151,10 +16049,12 @@ static const u16 sSwalotTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sSwalotTeachableLearnset (sSwalotTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_GULPIN
 
 #if P_FAMILY_CARVANHA
-static const u16 sCarvanhaTeachableLearnset[] = {
+static const u16 sCarvanhaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9C64, 0x1001, 0x03E0, 0x9231, 0x6C22, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_DIVE,
@@ -15183,8 +16083,10 @@ static const u16 sCarvanhaTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sCarvanhaTeachableLearnset (sCarvanhaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sSharpedoTeachableLearnset[] = {
+static const u16 sSharpedoTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xBC74, 0x1081, 0x03E8, 0x923B, 0x6C22, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_DIVE,
@@ -15219,10 +16121,12 @@ static const u16 sSharpedoTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sSharpedoTeachableLearnset (sSharpedoTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_CARVANHA
 
 #if P_FAMILY_WAILMER
-static const u16 sWailmerTeachableLearnset[] = {
+static const u16 sWailmerTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9874, 0x1081, 0x01C8, 0x137B, 0x2D02, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_DIVE,
@@ -15253,8 +16157,10 @@ static const u16 sWailmerTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sWailmerTeachableLearnset (sWailmerTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sWailordTeachableLearnset[] = {
+static const u16 sWailordTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xB874, 0x1081, 0x01C8, 0x137B, 0x2D02, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_DIVE,
@@ -15286,10 +16192,12 @@ static const u16 sWailordTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sWailordTeachableLearnset (sWailordTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_WAILMER
 
 #if P_FAMILY_NUMEL
-static const u16 sNumelTeachableLearnset[] = {
+static const u16 sNumelTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8230, 0x9181, 0x21CE, 0x134A, 0x2DA0, 0x0000),
     MOVE_ATTRACT,
     MOVE_DIG,
     MOVE_DOUBLE_TEAM,
@@ -15320,8 +16228,10 @@ static const u16 sNumelTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sNumelTeachableLearnset (sNumelTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sCameruptTeachableLearnset[] = {
+static const u16 sCameruptTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA230, 0x9189, 0x21CE, 0x334A, 0x2DA0, 0x0000),
     MOVE_ATTRACT,
     MOVE_DIG,
     MOVE_DOUBLE_TEAM,
@@ -15355,10 +16265,12 @@ static const u16 sCameruptTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sCameruptTeachableLearnset (sCameruptTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_NUMEL
 
 #if P_FAMILY_TORKOAL
-static const u16 sTorkoalTeachableLearnset[] = {
+static const u16 sTorkoalTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA220, 0x9098, 0x21CF, 0x324A, 0x2DA0, 0x0000),
     MOVE_ATTRACT,
     MOVE_DOUBLE_TEAM,
     MOVE_EARTHQUAKE,
@@ -15390,10 +16302,12 @@ static const u16 sTorkoalTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sTorkoalTeachableLearnset (sTorkoalTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_TORKOAL
 
 #if P_FAMILY_SPOINK
-static const u16 sSpoinkTeachableLearnset[] = {
+static const u16 sSpoinkTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC628, 0x7611, 0x1BE0, 0x1644, 0x6C42, 0x0002),
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
     MOVE_DOUBLE_TEAM,
@@ -15428,8 +16342,10 @@ static const u16 sSpoinkTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sSpoinkTeachableLearnset (sSpoinkTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sGrumpigTeachableLearnset[] = {
+static const u16 sGrumpigTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE629, 0x7F11, 0x1BE0, 0x5EC4, 0x6E7F, 0x0003),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_CALM_MIND,
@@ -15478,10 +16394,12 @@ static const u16 sGrumpigTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sGrumpigTeachableLearnset (sGrumpigTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_SPOINK
 
 #if P_FAMILY_SPINDA
-static const u16 sSpindaTeachableLearnset[] = {
+static const u16 sSpindaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x822D, 0x5F05, 0x1BC8, 0x5FCE, 0x6FFF, 0x0001),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_CALM_MIND,
@@ -15531,10 +16449,12 @@ static const u16 sSpindaTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sSpindaTeachableLearnset (sSpindaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_SPINDA
 
 #if P_FAMILY_TRAPINCH
-static const u16 sTrapinchTeachableLearnset[] = {
+static const u16 sTrapinchTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA220, 0x118A, 0x01CA, 0x924A, 0x2CA0, 0x0000),
     MOVE_ATTRACT,
     MOVE_DIG,
     MOVE_DOUBLE_TEAM,
@@ -15562,8 +16482,10 @@ static const u16 sTrapinchTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sTrapinchTeachableLearnset (sTrapinchTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sVibravaTeachableLearnset[] = {
+static const u16 sVibravaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA222, 0x118A, 0x85DA, 0x924A, 0x6CA0, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_DIG,
@@ -15596,8 +16518,10 @@ static const u16 sVibravaTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sVibravaTeachableLearnset (sVibravaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sFlygonTeachableLearnset[] = {
+static const u16 sFlygonTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA222, 0x919A, 0x85DE, 0xD24A, 0x6CAC, 0x0001),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_DIG,
@@ -15637,10 +16561,12 @@ static const u16 sFlygonTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sFlygonTeachableLearnset (sFlygonTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_TRAPINCH
 
 #if P_FAMILY_CACNEA
-static const u16 sCacneaTeachableLearnset[] = {
+static const u16 sCacneaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8321, 0x190B, 0x43C2, 0x9AC4, 0xEE28, 0x0001),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_BULLET_SEED,
@@ -15676,8 +16602,10 @@ static const u16 sCacneaTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sCacneaTeachableLearnset (sCacneaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sCacturneTeachableLearnset[] = {
+static const u16 sCacturneTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA721, 0x1D0B, 0x43C2, 0x9AC6, 0xEE2C, 0x0001),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_BULLET_SEED,
@@ -15718,10 +16646,12 @@ static const u16 sCacturneTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sCacturneTeachableLearnset (sCacturneTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_CACNEA
 
 #if P_FAMILY_SWABLU
-static const u16 sSwabluTeachableLearnset[] = {
+static const u16 sSwabluTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8A20, 0x100D, 0x87D0, 0x1640, 0x6C60, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_DOUBLE_TEAM,
@@ -15749,8 +16679,10 @@ static const u16 sSwabluTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sSwabluTeachableLearnset (sSwabluTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sAltariaTeachableLearnset[] = {
+static const u16 sAltariaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xAA32, 0x909D, 0x87D4, 0x1648, 0x6C60, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_DOUBLE_TEAM,
@@ -15786,10 +16718,12 @@ static const u16 sAltariaTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sAltariaTeachableLearnset (sAltariaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_SWABLU
 
 #if P_FAMILY_ZANGOOSE
-static const u16 sZangooseTeachableLearnset[] = {
+static const u16 sZangooseTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xBE35, 0xDD7B, 0x03DC, 0xDBCB, 0xEFAF, 0x0003),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
@@ -15847,10 +16781,12 @@ static const u16 sZangooseTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sZangooseTeachableLearnset (sZangooseTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_ZANGOOSE
 
 #if P_FAMILY_SEVIPER
-static const u16 sSeviperTeachableLearnset[] = {
+static const u16 sSeviperTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA620, 0x9993, 0x13C1, 0x924A, 0xEC20, 0x0000),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_DIG,
@@ -15884,10 +16820,12 @@ static const u16 sSeviperTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sSeviperTeachableLearnset (sSeviperTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_SEVIPER
 
 #if P_FAMILY_LUNATONE
-static const u16 sLunatoneTeachableLearnset[] = {
+static const u16 sLunatoneTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xF868, 0x3685, 0x08CA, 0x3744, 0x6DC2, 0x0000),
     MOVE_BLIZZARD,
     MOVE_CALM_MIND,
     MOVE_DOUBLE_TEAM,
@@ -15925,10 +16863,12 @@ static const u16 sLunatoneTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sLunatoneTeachableLearnset (sLunatoneTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_LUNATONE
 
 #if P_FAMILY_SOLROCK
-static const u16 sSolrockTeachableLearnset[] = {
+static const u16 sSolrockTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE228, 0xB68D, 0x28CE, 0x3744, 0xEDC0, 0x0000),
     MOVE_CALM_MIND,
     MOVE_DOUBLE_TEAM,
     MOVE_EARTHQUAKE,
@@ -15968,10 +16908,12 @@ static const u16 sSolrockTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sSolrockTeachableLearnset (sSolrockTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_SOLROCK
 
 #if P_FAMILY_BARBOACH
-static const u16 sBarboachTeachableLearnset[] = {
+static const u16 sBarboachTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9A64, 0x1081, 0x01CA, 0x1231, 0x6CA2, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_DIVE,
@@ -16001,8 +16943,10 @@ static const u16 sBarboachTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sBarboachTeachableLearnset (sBarboachTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sWhiscashTeachableLearnset[] = {
+static const u16 sWhiscashTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xBA64, 0x1081, 0x01DA, 0x127B, 0x6CA2, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
@@ -16037,10 +16981,12 @@ static const u16 sWhiscashTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sWhiscashTeachableLearnset (sWhiscashTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_BARBOACH
 
 #if P_FAMILY_CORPHISH
-static const u16 sCorphishTeachableLearnset[] = {
+static const u16 sCorphishTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9C64, 0x1901, 0x43D9, 0x92DB, 0xACA2, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
@@ -16078,8 +17024,10 @@ static const u16 sCorphishTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sCorphishTeachableLearnset (sCorphishTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sCrawdauntTeachableLearnset[] = {
+static const u16 sCrawdauntTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xBC64, 0x1901, 0x43D9, 0x92FB, 0xECA2, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
@@ -16120,10 +17068,12 @@ static const u16 sCrawdauntTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sCrawdauntTeachableLearnset (sCrawdauntTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_CORPHISH
 
 #if P_FAMILY_BALTOY
-static const u16 sBaltoyTeachableLearnset[] = {
+static const u16 sBaltoyTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xCA28, 0x378D, 0x08CA, 0x3604, 0x2CE0, 0x0000),
     MOVE_CALM_MIND,
     MOVE_DIG,
     MOVE_DOUBLE_TEAM,
@@ -16157,8 +17107,10 @@ static const u16 sBaltoyTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sBaltoyTeachableLearnset (sBaltoyTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sClaydolTeachableLearnset[] = {
+static const u16 sClaydolTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xEA28, 0x378D, 0x08CA, 0x360E, 0x2CE0, 0x0000),
     MOVE_CALM_MIND,
     MOVE_DIG,
     MOVE_DOUBLE_TEAM,
@@ -16195,10 +17147,12 @@ static const u16 sClaydolTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sClaydolTeachableLearnset (sClaydolTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_BALTOY
 
 #if P_FAMILY_LILEEP
-static const u16 sLileepTeachableLearnset[] = {
+static const u16 sLileepTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8320, 0x100A, 0x01CB, 0x1244, 0xACE0, 0x0000),
     MOVE_ATTRACT,
     MOVE_BULLET_SEED,
     MOVE_DOUBLE_TEAM,
@@ -16225,8 +17179,10 @@ static const u16 sLileepTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sLileepTeachableLearnset (sLileepTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sCradilyTeachableLearnset[] = {
+static const u16 sCradilyTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA320, 0x118A, 0x01CB, 0x124E, 0xACE0, 0x0000),
     MOVE_ATTRACT,
     MOVE_BULLET_SEED,
     MOVE_DIG,
@@ -16258,10 +17214,12 @@ static const u16 sCradilyTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sCradilyTeachableLearnset (sCradilyTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_LILEEP
 
 #if P_FAMILY_ANORITH
-static const u16 sAnorithTeachableLearnset[] = {
+static const u16 sAnorithTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8224, 0x1900, 0x41DA, 0x9248, 0xACA0, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -16289,8 +17247,10 @@ static const u16 sAnorithTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sAnorithTeachableLearnset (sAnorithTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sArmaldoTeachableLearnset[] = {
+static const u16 sArmaldoTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA224, 0x1990, 0x41DA, 0x924A, 0xAEA0, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -16323,10 +17283,12 @@ static const u16 sArmaldoTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sArmaldoTeachableLearnset (sArmaldoTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_ANORITH
 
 #if P_FAMILY_FEEBAS
-static const u16 sFeebasTeachableLearnset[] = {
+static const u16 sFeebasTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xD864, 0x1011, 0x01C0, 0x1231, 0x6C02, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_DIVE,
@@ -16352,8 +17314,10 @@ static const u16 sFeebasTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sFeebasTeachableLearnset (sFeebasTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sMiloticTeachableLearnset[] = {
+static const u16 sMiloticTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xF864, 0x1015, 0x01C0, 0x1271, 0x6C62, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_DIVE,
@@ -16384,10 +17348,12 @@ static const u16 sMiloticTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sMiloticTeachableLearnset (sMiloticTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_FEEBAS
 
 #if P_FAMILY_CASTFORM
-static const u16 sCastformTeachableLearnset[] = {
+static const u16 sCastformTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9A64, 0xD469, 0x03C6, 0x1344, 0x6C42, 0x0002),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_DOUBLE_TEAM,
@@ -16423,10 +17389,12 @@ static const u16 sCastformTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sCastformTeachableLearnset (sCastformTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_CASTFORM
 
 #if P_FAMILY_KECLEON
-static const u16 sKecleonTeachableLearnset[] = {
+static const u16 sKecleonTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9A25, 0xDD79, 0x5BDC, 0xDBCE, 0x6FFF, 0x0003),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
@@ -16484,10 +17452,12 @@ static const u16 sKecleonTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sKecleonTeachableLearnset (sKecleonTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_KECLEON
 
 #if P_FAMILY_SHUPPET
-static const u16 sShuppetTeachableLearnset[] = {
+static const u16 sShuppetTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8628, 0x5661, 0x1BE0, 0x1644, 0x2C52, 0x0002),
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
     MOVE_DOUBLE_TEAM,
@@ -16521,8 +17491,10 @@ static const u16 sShuppetTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sShuppetTeachableLearnset (sShuppetTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sBanetteTeachableLearnset[] = {
+static const u16 sBanetteTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA628, 0x5661, 0x1BE0, 0x1644, 0xAC72, 0x0002),
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
     MOVE_DOUBLE_TEAM,
@@ -16559,10 +17531,12 @@ static const u16 sBanetteTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sBanetteTeachableLearnset (sBanetteTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_SHUPPET
 
 #if P_FAMILY_DUSKULL
-static const u16 sDuskullTeachableLearnset[] = {
+static const u16 sDuskullTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9E28, 0x1601, 0x1BE0, 0x1644, 0x2C42, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_CALM_MIND,
@@ -16593,8 +17567,10 @@ static const u16 sDuskullTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sDuskullTeachableLearnset (sDuskullTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sDusclopsTeachableLearnset[] = {
+static const u16 sDusclopsTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xBE29, 0x1E81, 0x1BE8, 0x5ECE, 0x2EFF, 0x0001),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_BRICK_BREAK,
@@ -16643,9 +17619,11 @@ static const u16 sDusclopsTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sDusclopsTeachableLearnset (sDusclopsTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
 #if P_GEN_4_CROSS_EVOS
-static const u16 sDusknoirTeachableLearnset[] = {
+static const u16 sDusknoirTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xBE29, 0x1E81, 0x1BE8, 0x544E, 0x6CFF, 0x0001),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_BRICK_BREAK,
@@ -16691,11 +17669,13 @@ static const u16 sDusknoirTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sDusknoirTeachableLearnset (sDusknoirTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_GEN_4_CROSS_EVOS
 #endif //P_FAMILY_DUSKULL
 
 #if P_FAMILY_TROPIUS
-static const u16 sTropiusTeachableLearnset[] = {
+static const u16 sTropiusTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA338, 0x108F, 0xC5D0, 0x924E, 0xAC20, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BULLET_SEED,
@@ -16730,11 +17710,13 @@ static const u16 sTropiusTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sTropiusTeachableLearnset (sTropiusTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_TROPIUS
 
 #if P_FAMILY_CHIMECHO
 #if P_GEN_4_CROSS_EVOS
-static const u16 sChinglingTeachableLearnset[] = {
+static const u16 sChinglingTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC628, 0x7605, 0x19E0, 0x1604, 0x6D42, 0x0002),
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
     MOVE_DOUBLE_TEAM,
@@ -16768,9 +17750,11 @@ static const u16 sChinglingTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sChinglingTeachableLearnset (sChinglingTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_GEN_4_CROSS_EVOS
 
-static const u16 sChimechoTeachableLearnset[] = {
+static const u16 sChimechoTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC628, 0x7605, 0x19E0, 0x1704, 0x6D42, 0x0002),
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
     MOVE_DOUBLE_TEAM,
@@ -16805,10 +17789,12 @@ static const u16 sChimechoTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sChimechoTeachableLearnset (sChimechoTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_CHIMECHO
 
 #if P_FAMILY_ABSOL
-static const u16 sAbsolTeachableLearnset[] = {
+static const u16 sAbsolTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xBE6C, 0xD471, 0x53FE, 0x96CE, 0xECE2, 0x0002),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
@@ -16859,10 +17845,12 @@ static const u16 sAbsolTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sAbsolTeachableLearnset (sAbsolTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_ABSOL
 
 #if P_FAMILY_SNORUNT
-static const u16 sSnoruntTeachableLearnset[] = {
+static const u16 sSnoruntTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xD864, 0x1405, 0x01C0, 0x1244, 0x2D02, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_DOUBLE_TEAM,
@@ -16888,8 +17876,10 @@ static const u16 sSnoruntTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sSnoruntTeachableLearnset (sSnoruntTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sGlalieTeachableLearnset[] = {
+static const u16 sGlalieTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xFC64, 0x1485, 0x01E0, 0x3344, 0x2D02, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_DOUBLE_TEAM,
@@ -16921,9 +17911,11 @@ static const u16 sGlalieTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sGlalieTeachableLearnset (sGlalieTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
 #if P_GEN_4_CROSS_EVOS
-static const u16 sFroslassTeachableLearnset[] = {
+static const u16 sFroslassTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xFC64, 0x7665, 0x11E0, 0x1444, 0x2D63, 0x0002),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_DOUBLE_TEAM,
@@ -16962,11 +17954,13 @@ static const u16 sFroslassTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sFroslassTeachableLearnset (sFroslassTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_GEN_4_CROSS_EVOS
 #endif //P_FAMILY_SNORUNT
 
 #if P_FAMILY_SPHEAL
-static const u16 sSphealTeachableLearnset[] = {
+static const u16 sSphealTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9864, 0x1091, 0x01C8, 0x137B, 0x2DA2, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_DIVE,
@@ -16999,8 +17993,10 @@ static const u16 sSphealTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sSphealTeachableLearnset (sSphealTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sSealeoTeachableLearnset[] = {
+static const u16 sSealeoTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9874, 0x1091, 0x01C8, 0x137B, 0x2DA2, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_DIVE,
@@ -17034,8 +18030,10 @@ static const u16 sSealeoTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sSealeoTeachableLearnset (sSealeoTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sWalreinTeachableLearnset[] = {
+static const u16 sWalreinTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xB874, 0x1091, 0x01C8, 0x937B, 0xADA2, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_DIVE,
@@ -17072,10 +18070,12 @@ static const u16 sWalreinTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sWalreinTeachableLearnset (sWalreinTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_SPHEAL
 
 #if P_FAMILY_CLAMPERL
-static const u16 sClamperlTeachableLearnset[] = {
+static const u16 sClamperlTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9864, 0x1001, 0x01C0, 0x1271, 0x2C02, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_DIVE,
@@ -17099,8 +18099,10 @@ static const u16 sClamperlTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sClamperlTeachableLearnset (sClamperlTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sHuntailTeachableLearnset[] = {
+static const u16 sHuntailTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xB864, 0x1001, 0x11C8, 0x1271, 0x6C22, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_DIVE,
@@ -17129,8 +18131,10 @@ static const u16 sHuntailTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sHuntailTeachableLearnset (sHuntailTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sGorebyssTeachableLearnset[] = {
+static const u16 sGorebyssTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xB864, 0x1605, 0x01C0, 0x1271, 0x6C62, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_DIVE,
@@ -17161,10 +18165,12 @@ static const u16 sGorebyssTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sGorebyssTeachableLearnset (sGorebyssTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_CLAMPERL
 
 #if P_FAMILY_RELICANTH
-static const u16 sRelicanthTeachableLearnset[] = {
+static const u16 sRelicanthTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xB86C, 0x1085, 0x01CA, 0x1279, 0x2CE2, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_CALM_MIND,
@@ -17198,10 +18204,12 @@ static const u16 sRelicanthTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sRelicanthTeachableLearnset (sRelicanthTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_RELICANTH
 
 #if P_FAMILY_LUVDISC
-static const u16 sLuvdiscTeachableLearnset[] = {
+static const u16 sLuvdiscTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9864, 0x1005, 0x01C0, 0x1231, 0x6C42, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_DIVE,
@@ -17227,10 +18235,12 @@ static const u16 sLuvdiscTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sLuvdiscTeachableLearnset (sLuvdiscTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_LUVDISC
 
 #if P_FAMILY_BAGON
-static const u16 sBagonTeachableLearnset[] = {
+static const u16 sBagonTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8232, 0x9801, 0x41DC, 0x934A, 0x2CA0, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -17261,8 +18271,10 @@ static const u16 sBagonTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sBagonTeachableLearnset (sBagonTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sShelgonTeachableLearnset[] = {
+static const u16 sShelgonTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8232, 0x9801, 0x41DC, 0x934A, 0x2DA0, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -17294,8 +18306,10 @@ static const u16 sShelgonTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sShelgonTeachableLearnset (sShelgonTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sSalamenceTeachableLearnset[] = {
+static const u16 sSalamenceTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA232, 0x9891, 0xC5DC, 0x934A, 0x6DA0, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -17333,14 +18347,18 @@ static const u16 sSalamenceTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sSalamenceTeachableLearnset (sSalamenceTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_BAGON
 
 #if P_FAMILY_BELDUM
-static const u16 sBeldumTeachableLearnset[] = {
+static const u16 sBeldumTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000),
     MOVE_UNAVAILABLE,
 };
+#define sBeldumTeachableLearnset (sBeldumTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sMetangTeachableLearnset[] = {
+static const u16 sMetangTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE221, 0x3E81, 0x40DB, 0xBB4E, 0x6DE3, 0x0001),
     MOVE_AERIAL_ACE,
     MOVE_BRICK_BREAK,
     MOVE_CUT,
@@ -17384,8 +18402,10 @@ static const u16 sMetangTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sMetangTeachableLearnset (sMetangTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sMetagrossTeachableLearnset[] = {
+static const u16 sMetagrossTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE221, 0x3E81, 0x40DB, 0xBB4E, 0x6DE3, 0x0001),
     MOVE_AERIAL_ACE,
     MOVE_BRICK_BREAK,
     MOVE_CUT,
@@ -17429,10 +18449,12 @@ static const u16 sMetagrossTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sMetagrossTeachableLearnset (sMetagrossTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_BELDUM
 
 #if P_FAMILY_REGIROCK
-static const u16 sRegirockTeachableLearnset[] = {
+static const u16 sRegirockTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA221, 0x59E4, 0x00CA, 0x7BCA, 0x2FED, 0x0003),
     MOVE_BRICK_BREAK,
     MOVE_DIG,
     MOVE_DOUBLE_TEAM,
@@ -17475,10 +18497,12 @@ static const u16 sRegirockTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sRegirockTeachableLearnset (sRegirockTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_REGIROCK
 
 #if P_FAMILY_REGICE
-static const u16 sRegiceTeachableLearnset[] = {
+static const u16 sRegiceTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xB861, 0x58E5, 0x00C8, 0x3BCA, 0x2FEF, 0x0003),
     MOVE_BLIZZARD,
     MOVE_BRICK_BREAK,
     MOVE_DOUBLE_TEAM,
@@ -17522,10 +18546,12 @@ static const u16 sRegiceTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sRegiceTeachableLearnset (sRegiceTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_REGICE
 
 #if P_FAMILY_REGISTEEL
-static const u16 sRegisteelTeachableLearnset[] = {
+static const u16 sRegisteelTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA221, 0x58E5, 0x00DA, 0x3BCA, 0x2FED, 0x0003),
     MOVE_AERIAL_ACE,
     MOVE_BRICK_BREAK,
     MOVE_DOUBLE_TEAM,
@@ -17568,10 +18594,12 @@ static const u16 sRegisteelTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sRegisteelTeachableLearnset (sRegisteelTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_REGISTEEL
 
 #if P_FAMILY_LATIAS
-static const u16 sLatiasTeachableLearnset[] = {
+static const u16 sLatiasTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xEA3E, 0x76ED, 0xC5D2, 0x9675, 0x6C62, 0x0002),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
@@ -17620,10 +18648,12 @@ static const u16 sLatiasTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sLatiasTeachableLearnset (sLatiasTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_LATIAS
 
 #if P_FAMILY_LATIOS
-static const u16 sLatiosTeachableLearnset[] = {
+static const u16 sLatiosTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xEA3E, 0x76ED, 0xC5D2, 0x9675, 0x6C62, 0x0002),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
@@ -17672,10 +18702,12 @@ static const u16 sLatiosTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sLatiosTeachableLearnset (sLatiosTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_LATIOS
 
 #if P_FAMILY_KYOGRE
-static const u16 sKyogreTeachableLearnset[] = {
+static const u16 sKyogreTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xB87C, 0x58E5, 0x00C8, 0x137B, 0x6CE2, 0x0002),
     MOVE_BLIZZARD,
     MOVE_BRICK_BREAK,
     MOVE_CALM_MIND,
@@ -17716,10 +18748,12 @@ static const u16 sKyogreTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sKyogreTeachableLearnset (sKyogreTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_KYOGRE
 
 #if P_FAMILY_GROUDON
-static const u16 sGroudonTeachableLearnset[] = {
+static const u16 sGroudonTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA2B3, 0xD9FC, 0x60DE, 0xDBCA, 0xEFEC, 0x0003),
     MOVE_AERIAL_ACE,
     MOVE_BRICK_BREAK,
     MOVE_BULK_UP,
@@ -17773,10 +18807,12 @@ static const u16 sGroudonTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sGroudonTeachableLearnset (sGroudonTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_GROUDON
 
 #if P_FAMILY_RAYQUAZA
-static const u16 sRayquazaTeachableLearnset[] = {
+static const u16 sRayquazaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xBAB6, 0xD8F9, 0xA0DE, 0x927B, 0xECE2, 0x0002),
     MOVE_AERIAL_ACE,
     MOVE_BLIZZARD,
     MOVE_BRICK_BREAK,
@@ -17826,10 +18862,12 @@ static const u16 sRayquazaTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sRayquazaTeachableLearnset (sRayquazaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_RAYQUAZA
 
 #if P_FAMILY_JIRACHI
-static const u16 sJirachiTeachableLearnset[] = {
+static const u16 sJirachiTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE22C, 0x7665, 0x08D2, 0x5F44, 0x6C7F, 0x0003),
     MOVE_AERIAL_ACE,
     MOVE_CALM_MIND,
     MOVE_DOUBLE_TEAM,
@@ -17874,10 +18912,12 @@ static const u16 sJirachiTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sJirachiTeachableLearnset (sJirachiTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_JIRACHI
 
 #if P_FAMILY_DEOXYS
-static const u16 sDeoxysNormalTeachableLearnset[] = {
+static const u16 sDeoxysNormalTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xEE2D, 0x7E6D, 0x58F8, 0x564E, 0x6EE3, 0x0003),
     MOVE_AERIAL_ACE,
     MOVE_BRICK_BREAK,
     MOVE_CALM_MIND,
@@ -17929,8 +18969,10 @@ static const u16 sDeoxysNormalTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sDeoxysNormalTeachableLearnset (sDeoxysNormalTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sDeoxysAttackTeachableLearnset[] = {
+static const u16 sDeoxysAttackTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xEE2D, 0x7E6D, 0x58F8, 0x56CE, 0x6EEF, 0x0003),
     MOVE_AERIAL_ACE,
     MOVE_BRICK_BREAK,
     MOVE_CALM_MIND,
@@ -17985,8 +19027,10 @@ static const u16 sDeoxysAttackTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sDeoxysAttackTeachableLearnset (sDeoxysAttackTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sDeoxysDefenseTeachableLearnset[] = {
+static const u16 sDeoxysDefenseTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xEE2D, 0x7E6D, 0x58F8, 0x56CE, 0x6EEF, 0x0003),
     MOVE_AERIAL_ACE,
     MOVE_BRICK_BREAK,
     MOVE_CALM_MIND,
@@ -18041,8 +19085,10 @@ static const u16 sDeoxysDefenseTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sDeoxysDefenseTeachableLearnset (sDeoxysDefenseTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sDeoxysSpeedTeachableLearnset[] = {
+static const u16 sDeoxysSpeedTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xEE2D, 0x7E6D, 0x58F8, 0x5ECE, 0x6EEF, 0x0003),
     MOVE_AERIAL_ACE,
     MOVE_BRICK_BREAK,
     MOVE_CALM_MIND,
@@ -18098,10 +19144,12 @@ static const u16 sDeoxysSpeedTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sDeoxysSpeedTeachableLearnset (sDeoxysSpeedTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_DEOXYS
 
 #if P_FAMILY_TURTWIG
-static const u16 sTurtwigTeachableLearnset[] = {
+static const u16 sTurtwigTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC330, 0x301E, 0x41C0, 0x124E, 0xAC20, 0x0000),
     MOVE_ATTRACT,
     MOVE_BULLET_SEED,
     MOVE_CUT,
@@ -18131,8 +19179,10 @@ static const u16 sTurtwigTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sTurtwigTeachableLearnset (sTurtwigTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sGrotleTeachableLearnset[] = {
+static const u16 sGrotleTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC330, 0x301E, 0x41C0, 0x124E, 0xAC20, 0x0000),
     MOVE_ATTRACT,
     MOVE_BULLET_SEED,
     MOVE_CUT,
@@ -18162,8 +19212,10 @@ static const u16 sGrotleTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sGrotleTeachableLearnset (sGrotleTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sTorterraTeachableLearnset[] = {
+static const u16 sTorterraTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE330, 0x309E, 0x41CA, 0x124E, 0xACA0, 0x0000),
     MOVE_ATTRACT,
     MOVE_BULLET_SEED,
     MOVE_CUT,
@@ -18198,10 +19250,12 @@ static const u16 sTorterraTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sTorterraTeachableLearnset (sTorterraTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_TURTWIG
 
 #if P_FAMILY_CHIMCHAR
-static const u16 sChimcharTeachableLearnset[] = {
+static const u16 sChimcharTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x86A1, 0x9910, 0x63FC, 0x528A, 0xEDF0, 0x0001),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -18242,8 +19296,10 @@ static const u16 sChimcharTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sChimcharTeachableLearnset (sChimcharTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sMonfernoTeachableLearnset[] = {
+static const u16 sMonfernoTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x86A1, 0x9910, 0x63FC, 0x528A, 0xEDF0, 0x0001),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -18284,8 +19340,10 @@ static const u16 sMonfernoTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sMonfernoTeachableLearnset (sMonfernoTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sInfernapeTeachableLearnset[] = {
+static const u16 sInfernapeTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA6B9, 0x9998, 0x63FC, 0x52CA, 0xEDF0, 0x0001),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -18332,10 +19390,12 @@ static const u16 sInfernapeTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sInfernapeTeachableLearnset (sInfernapeTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_CHIMCHAR
 
 #if P_FAMILY_PIPLUP
-static const u16 sPiplupTeachableLearnset[] = {
+static const u16 sPiplupTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9864, 0x1901, 0x41D8, 0x1239, 0x6C62, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
@@ -18367,8 +19427,10 @@ static const u16 sPiplupTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sPiplupTeachableLearnset (sPiplupTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sPrinplupTeachableLearnset[] = {
+static const u16 sPrinplupTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9864, 0x1901, 0x41D8, 0x123B, 0x6C62, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
@@ -18401,8 +19463,10 @@ static const u16 sPrinplupTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sPrinplupTeachableLearnset (sPrinplupTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sEmpoleonTeachableLearnset[] = {
+static const u16 sEmpoleonTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xB874, 0x1981, 0x45D8, 0x927B, 0xECE2, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
@@ -18443,10 +19507,12 @@ static const u16 sEmpoleonTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sEmpoleonTeachableLearnset (sEmpoleonTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_PIPLUP
 
 #if P_FAMILY_STARLY
-static const u16 sStarlyTeachableLearnset[] = {
+static const u16 sStarlyTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8220, 0x1001, 0x87D0, 0x1200, 0x6C20, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_DOUBLE_TEAM,
@@ -18468,8 +19534,10 @@ static const u16 sStarlyTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sStarlyTeachableLearnset (sStarlyTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sStaraviaTeachableLearnset[] = {
+static const u16 sStaraviaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8220, 0x1001, 0x87D0, 0x1200, 0x6C20, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_DOUBLE_TEAM,
@@ -18491,8 +19559,10 @@ static const u16 sStaraviaTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sStaraviaTeachableLearnset (sStaraviaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sStaraptorTeachableLearnset[] = {
+static const u16 sStaraptorTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA220, 0x1001, 0x87D0, 0x1200, 0x6C20, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_DOUBLE_TEAM,
@@ -18515,10 +19585,12 @@ static const u16 sStaraptorTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sStaraptorTeachableLearnset (sStaraptorTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_STARLY
 
 #if P_FAMILY_BIDOOF
-static const u16 sBidoofTeachableLearnset[] = {
+static const u16 sBidoofTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9E20, 0x5571, 0x43C0, 0x9308, 0xED22, 0x0002),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_CUT,
@@ -18554,8 +19626,10 @@ static const u16 sBidoofTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sBidoofTeachableLearnset (sBidoofTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sBibarelTeachableLearnset[] = {
+static const u16 sBibarelTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xBE25, 0x5571, 0x43C0, 0x933B, 0xED22, 0x0002),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_CUT,
@@ -18598,16 +19672,20 @@ static const u16 sBibarelTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sBibarelTeachableLearnset (sBibarelTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_BIDOOF
 
 #if P_FAMILY_KRICKETOT
-static const u16 sKricketotTeachableLearnset[] = {
+static const u16 sKricketotTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0000),
     MOVE_MUD_SLAP,
     MOVE_SNORE,
     MOVE_UNAVAILABLE,
 };
+#define sKricketotTeachableLearnset (sKricketotTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sKricketuneTeachableLearnset[] = {
+static const u16 sKricketuneTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA620, 0x1803, 0x41D0, 0x900E, 0xAC20, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -18634,10 +19712,12 @@ static const u16 sKricketuneTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sKricketuneTeachableLearnset (sKricketuneTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_KRICKETOT
 
 #if P_FAMILY_SHINX
-static const u16 sShinxTeachableLearnset[] = {
+static const u16 sShinxTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC230, 0x5071, 0x03C0, 0x9206, 0x6C20, 0x0002),
     MOVE_ATTRACT,
     MOVE_DOUBLE_TEAM,
     MOVE_FACADE,
@@ -18666,8 +19746,10 @@ static const u16 sShinxTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sShinxTeachableLearnset (sShinxTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sLuxioTeachableLearnset[] = {
+static const u16 sLuxioTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC230, 0x5071, 0x03C0, 0x9206, 0x6C20, 0x0002),
     MOVE_ATTRACT,
     MOVE_DOUBLE_TEAM,
     MOVE_FACADE,
@@ -18696,8 +19778,10 @@ static const u16 sLuxioTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sLuxioTeachableLearnset (sLuxioTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sLuxrayTeachableLearnset[] = {
+static const u16 sLuxrayTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE230, 0x5071, 0x03C0, 0x9246, 0x6C20, 0x0002),
     MOVE_ATTRACT,
     MOVE_DOUBLE_TEAM,
     MOVE_FACADE,
@@ -18728,10 +19812,12 @@ static const u16 sLuxrayTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sLuxrayTeachableLearnset (sLuxrayTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_SHINX
 
 #if P_FAMILY_CRANIDOS
-static const u16 sCranidosTeachableLearnset[] = {
+static const u16 sCranidosTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9A30, 0xD1F1, 0x03CE, 0x524A, 0xACA0, 0x0001),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_DIG,
@@ -18769,8 +19855,10 @@ static const u16 sCranidosTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sCranidosTeachableLearnset (sCranidosTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sRampardosTeachableLearnset[] = {
+static const u16 sRampardosTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xBA33, 0xD9F1, 0x43CE, 0x524B, 0xACA0, 0x0001),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_BRICK_BREAK,
@@ -18814,10 +19902,12 @@ static const u16 sRampardosTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sRampardosTeachableLearnset (sRampardosTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_CRANIDOS
 
 #if P_FAMILY_SHIELDON
-static const u16 sShieldonTeachableLearnset[] = {
+static const u16 sShieldonTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9E30, 0xD1F1, 0x01EE, 0x12CA, 0x2CA0, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_DIG,
@@ -18854,8 +19944,10 @@ static const u16 sShieldonTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sShieldonTeachableLearnset (sShieldonTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sBastiodonTeachableLearnset[] = {
+static const u16 sBastiodonTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xBE30, 0xF1F1, 0x01EE, 0x12CA, 0x2CA0, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_DIG,
@@ -18894,16 +19986,20 @@ static const u16 sBastiodonTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sBastiodonTeachableLearnset (sBastiodonTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_SHIELDON
 
 #if P_FAMILY_BURMY
-static const u16 sBurmyTeachableLearnset[] = {
+static const u16 sBurmyTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0000),
     MOVE_PROTECT,
     MOVE_SNORE,
     MOVE_UNAVAILABLE,
 };
+#define sBurmyTeachableLearnset (sBurmyTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sWormadamPlantTeachableLearnset[] = {
+static const u16 sWormadamPlantTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA320, 0x170F, 0x0BC0, 0x1404, 0x2C40, 0x0000),
     MOVE_ATTRACT,
     MOVE_BULLET_SEED,
     MOVE_DIG,
@@ -18931,8 +20027,10 @@ static const u16 sWormadamPlantTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sWormadamPlantTeachableLearnset (sWormadamPlantTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sWormadamSandyTeachableLearnset[] = {
+static const u16 sWormadamSandyTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA220, 0x178F, 0x0BCA, 0x1404, 0x2D60, 0x0000),
     MOVE_ATTRACT,
     MOVE_DIG,
     MOVE_DOUBLE_TEAM,
@@ -18964,8 +20062,10 @@ static const u16 sWormadamSandyTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sWormadamSandyTeachableLearnset (sWormadamSandyTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sWormadamTrashTeachableLearnset[] = {
+static const u16 sWormadamTrashTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA220, 0x170F, 0x0BC0, 0x1404, 0x2C40, 0x0000),
     MOVE_ATTRACT,
     MOVE_DIG,
     MOVE_DOUBLE_TEAM,
@@ -18992,8 +20092,10 @@ static const u16 sWormadamTrashTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sWormadamTrashTeachableLearnset (sWormadamTrashTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sMothimTeachableLearnset[] = {
+static const u16 sMothimTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA220, 0x160F, 0x0BD0, 0x1404, 0x6C60, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_DOUBLE_TEAM,
@@ -19022,18 +20124,22 @@ static const u16 sMothimTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sMothimTeachableLearnset (sMothimTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_BURMY
 
 #if P_FAMILY_COMBEE
-static const u16 sCombeeTeachableLearnset[] = {
+static const u16 sCombeeTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x0000, 0x0000, 0x0000, 0x0000, 0x4C20, 0x0000),
     MOVE_MUD_SLAP,
     MOVE_SLEEP_TALK,
     MOVE_SNORE,
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sCombeeTeachableLearnset (sCombeeTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sVespiquenTeachableLearnset[] = {
+static const u16 sVespiquenTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA620, 0x1001, 0x43D1, 0x9004, 0x6C20, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_CUT,
@@ -19058,10 +20164,12 @@ static const u16 sVespiquenTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sVespiquenTeachableLearnset (sVespiquenTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_COMBEE
 
 #if P_FAMILY_PACHIRISU
-static const u16 sPachirisuTeachableLearnset[] = {
+static const u16 sPachirisuTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE220, 0x5171, 0x43D0, 0x1104, 0x6D20, 0x0003),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_CUT,
@@ -19093,10 +20201,12 @@ static const u16 sPachirisuTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sPachirisuTeachableLearnset (sPachirisuTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_PACHIRISU
 
 #if P_FAMILY_BUIZEL
-static const u16 sBuizelTeachableLearnset[] = {
+static const u16 sBuizelTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9CF5, 0x1911, 0x03C8, 0x903B, 0x6C23, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_BRICK_BREAK,
@@ -19133,8 +20243,10 @@ static const u16 sBuizelTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sBuizelTeachableLearnset (sBuizelTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sFloatzelTeachableLearnset[] = {
+static const u16 sFloatzelTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xBCF5, 0x1911, 0x03E8, 0x927B, 0x6C33, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_BRICK_BREAK,
@@ -19176,10 +20288,12 @@ static const u16 sFloatzelTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sFloatzelTeachableLearnset (sFloatzelTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_BUIZEL
 
 #if P_FAMILY_CHERUBI
-static const u16 sCherubiTeachableLearnset[] = {
+static const u16 sCherubiTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8320, 0x100E, 0x01C0, 0x1304, 0xAD00, 0x0000),
     MOVE_ATTRACT,
     MOVE_BULLET_SEED,
     MOVE_DOUBLE_TEAM,
@@ -19202,8 +20316,10 @@ static const u16 sCherubiTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sCherubiTeachableLearnset (sCherubiTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sCherrimTeachableLearnset[] = {
+static const u16 sCherrimTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA320, 0x100E, 0x01C0, 0x1304, 0xAD00, 0x0000),
     MOVE_ATTRACT,
     MOVE_BULLET_SEED,
     MOVE_DOUBLE_TEAM,
@@ -19227,10 +20343,12 @@ static const u16 sCherrimTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sCherrimTeachableLearnset (sCherrimTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_CHERUBI
 
 #if P_FAMILY_SHELLOS
-static const u16 sShellosTeachableLearnset[] = {
+static const u16 sShellosTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9864, 0x1001, 0x01CA, 0x10F1, 0x2CA2, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_DIVE,
@@ -19258,8 +20376,10 @@ static const u16 sShellosTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sShellosTeachableLearnset (sShellosTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sGastrodonTeachableLearnset[] = {
+static const u16 sGastrodonTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xB864, 0x1181, 0x01CB, 0x10FF, 0x2CA2, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_DIG,
@@ -19294,10 +20414,12 @@ static const u16 sGastrodonTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sGastrodonTeachableLearnset (sGastrodonTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_SHELLOS
 
 #if P_FAMILY_DRIFLOON
-static const u16 sDrifloonTeachableLearnset[] = {
+static const u16 sDrifloonTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8228, 0x5661, 0xCBD0, 0x3444, 0x6D62, 0x0002),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
@@ -19333,8 +20455,10 @@ static const u16 sDrifloonTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sDrifloonTeachableLearnset (sDrifloonTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sDrifblimTeachableLearnset[] = {
+static const u16 sDrifblimTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA228, 0x5661, 0xCBD0, 0x3444, 0x6D62, 0x0002),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
@@ -19371,10 +20495,12 @@ static const u16 sDrifblimTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sDrifblimTeachableLearnset (sDrifblimTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_DRIFLOON
 
 #if P_FAMILY_BUNEARY
-static const u16 sBunearyTeachableLearnset[] = {
+static const u16 sBunearyTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8A25, 0x5539, 0x41C0, 0x5308, 0x6C2D, 0x0003),
     MOVE_ATTRACT,
     MOVE_CUT,
     MOVE_DIG,
@@ -19410,8 +20536,10 @@ static const u16 sBunearyTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sBunearyTeachableLearnset (sBunearyTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sLopunnyTeachableLearnset[] = {
+static const u16 sLopunnyTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xBA25, 0x5579, 0x41C0, 0xD30A, 0x6C2D, 0x0003),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_CUT,
@@ -19452,10 +20580,12 @@ static const u16 sLopunnyTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sLopunnyTeachableLearnset (sLopunnyTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_BUNEARY
 
 #if P_FAMILY_GLAMEOW
-static const u16 sGlameowTeachableLearnset[] = {
+static const u16 sGlameowTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8624, 0x5571, 0x53F0, 0x9604, 0x6C60, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_CUT,
@@ -19490,8 +20620,10 @@ static const u16 sGlameowTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sGlameowTeachableLearnset (sGlameowTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sPuruglyTeachableLearnset[] = {
+static const u16 sPuruglyTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA634, 0x5571, 0x53F0, 0x9644, 0x6D60, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_CUT,
@@ -19530,10 +20662,12 @@ static const u16 sPuruglyTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sPuruglyTeachableLearnset (sPuruglyTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_GLAMEOW
 
 #if P_FAMILY_STUNKY
-static const u16 sStunkyTeachableLearnset[] = {
+static const u16 sStunkyTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8630, 0x9511, 0x53E5, 0xB248, 0x6C20, 0x0000),
     MOVE_ATTRACT,
     MOVE_CUT,
     MOVE_DIG,
@@ -19567,8 +20701,10 @@ static const u16 sStunkyTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sStunkyTeachableLearnset (sStunkyTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sSkuntankTeachableLearnset[] = {
+static const u16 sSkuntankTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA630, 0x9511, 0x53E5, 0xB24A, 0x6C20, 0x0000),
     MOVE_ATTRACT,
     MOVE_CUT,
     MOVE_DIG,
@@ -19604,10 +20740,12 @@ static const u16 sSkuntankTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sSkuntankTeachableLearnset (sSkuntankTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_STUNKY
 
 #if P_FAMILY_BRONZOR
-static const u16 sBronzorTeachableLearnset[] = {
+static const u16 sBronzorTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC228, 0x368D, 0x08CA, 0x1444, 0x2DC0, 0x0000),
     MOVE_CALM_MIND,
     MOVE_DOUBLE_TEAM,
     MOVE_EARTHQUAKE,
@@ -19638,8 +20776,10 @@ static const u16 sBronzorTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sBronzorTeachableLearnset (sBronzorTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sBronzongTeachableLearnset[] = {
+static const u16 sBronzongTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE228, 0x368D, 0x08CA, 0x344E, 0x2DC0, 0x0000),
     MOVE_CALM_MIND,
     MOVE_DOUBLE_TEAM,
     MOVE_EARTHQUAKE,
@@ -19674,10 +20814,12 @@ static const u16 sBronzongTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sBronzongTeachableLearnset (sBronzongTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_BRONZOR
 
 #if P_FAMILY_CHATOT
-static const u16 sChatotTeachableLearnset[] = {
+static const u16 sChatotTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8620, 0x1001, 0x87F0, 0x1000, 0x6C20, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_DOUBLE_TEAM,
@@ -19700,10 +20842,12 @@ static const u16 sChatotTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sChatotTeachableLearnset (sChatotTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_CHATOT
 
 #if P_FAMILY_SPIRITOMB
-static const u16 sSpiritombTeachableLearnset[] = {
+static const u16 sSpiritombTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA62C, 0x5601, 0x1BE8, 0x1444, 0x2C42, 0x0000),
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
     MOVE_DOUBLE_TEAM,
@@ -19735,10 +20879,12 @@ static const u16 sSpiritombTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sSpiritombTeachableLearnset (sSpiritombTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_SPIRITOMB
 
 #if P_FAMILY_GIBLE
-static const u16 sGibleTeachableLearnset[] = {
+static const u16 sGibleTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8232, 0x9191, 0x41DE, 0x924A, 0xECA0, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_CUT,
@@ -19773,8 +20919,10 @@ static const u16 sGibleTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sGibleTeachableLearnset (sGibleTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sGabiteTeachableLearnset[] = {
+static const u16 sGabiteTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8232, 0x9191, 0x41DE, 0x924A, 0xECA0, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_CUT,
@@ -19809,8 +20957,10 @@ static const u16 sGabiteTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sGabiteTeachableLearnset (sGabiteTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sGarchompTeachableLearnset[] = {
+static const u16 sGarchompTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA232, 0x9991, 0x41DE, 0x924B, 0xECA0, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -19848,10 +20998,12 @@ static const u16 sGarchompTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sGarchompTeachableLearnset (sGarchompTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_GIBLE
 
 #if P_FAMILY_RIOLU
-static const u16 sRioluTeachableLearnset[] = {
+static const u16 sRioluTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x82B1, 0x1991, 0x01D8, 0x908A, 0xECED, 0x0001),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -19888,8 +21040,10 @@ static const u16 sRioluTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sRioluTeachableLearnset (sRioluTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sLucarioTeachableLearnset[] = {
+static const u16 sLucarioTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA2BD, 0x1F91, 0x01D8, 0x90CA, 0xECFD, 0x0001),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -19933,10 +21087,12 @@ static const u16 sLucarioTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sLucarioTeachableLearnset (sLucarioTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_RIOLU
 
 #if P_FAMILY_HIPPOPOTAS
-static const u16 sHippopotasTeachableLearnset[] = {
+static const u16 sHippopotasTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8234, 0x1190, 0x01CA, 0x124A, 0x2CA0, 0x0000),
     MOVE_ATTRACT,
     MOVE_DIG,
     MOVE_DOUBLE_TEAM,
@@ -19963,8 +21119,10 @@ static const u16 sHippopotasTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sHippopotasTeachableLearnset (sHippopotasTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sHippowdonTeachableLearnset[] = {
+static const u16 sHippowdonTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA234, 0x1190, 0x01CA, 0x124A, 0x2CA0, 0x0000),
     MOVE_ATTRACT,
     MOVE_DIG,
     MOVE_DOUBLE_TEAM,
@@ -19992,10 +21150,12 @@ static const u16 sHippowdonTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sHippowdonTeachableLearnset (sHippowdonTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_HIPPOPOTAS
 
 #if P_FAMILY_SKORUPI
-static const u16 sSkorupiTeachableLearnset[] = {
+static const u16 sSkorupiTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8620, 0x1D11, 0x43F9, 0x900E, 0xAC20, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -20027,8 +21187,10 @@ static const u16 sSkorupiTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sSkorupiTeachableLearnset (sSkorupiTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sDrapionTeachableLearnset[] = {
+static const u16 sDrapionTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA630, 0x1D91, 0x43F9, 0x900E, 0xACA0, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -20064,10 +21226,12 @@ static const u16 sDrapionTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sDrapionTeachableLearnset (sDrapionTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_SKORUPI
 
 #if P_FAMILY_CROAGUNK
-static const u16 sCroagunkTeachableLearnset[] = {
+static const u16 sCroagunkTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x86A1, 0x1D81, 0x13F9, 0x988A, 0x2CAF, 0x0001),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -20107,8 +21271,10 @@ static const u16 sCroagunkTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sCroagunkTeachableLearnset (sCroagunkTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sToxicroakTeachableLearnset[] = {
+static const u16 sToxicroakTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA6A1, 0x1D81, 0x53F9, 0x988A, 0xACAF, 0x0001),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -20151,10 +21317,12 @@ static const u16 sToxicroakTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sToxicroakTeachableLearnset (sToxicroakTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_CROAGUNK
 
 #if P_FAMILY_CARNIVINE
-static const u16 sCarnivineTeachableLearnset[] = {
+static const u16 sCarnivineTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA320, 0x100A, 0x43C1, 0x9004, 0xAC20, 0x0000),
     MOVE_ATTRACT,
     MOVE_BULLET_SEED,
     MOVE_CUT,
@@ -20179,10 +21347,12 @@ static const u16 sCarnivineTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sCarnivineTeachableLearnset (sCarnivineTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_CARNIVINE
 
 #if P_FAMILY_FINNEON
-static const u16 sFinneonTeachableLearnset[] = {
+static const u16 sFinneonTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9864, 0x1005, 0x03C0, 0x1035, 0x6C42, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_DIVE,
@@ -20209,8 +21379,10 @@ static const u16 sFinneonTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sFinneonTeachableLearnset (sFinneonTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sLumineonTeachableLearnset[] = {
+static const u16 sLumineonTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xB864, 0x1005, 0x03D0, 0x1035, 0x6C42, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
@@ -20239,10 +21411,12 @@ static const u16 sLumineonTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sLumineonTeachableLearnset (sLumineonTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_FINNEON
 
 #if P_FAMILY_SNOVER
-static const u16 sSnoverTeachableLearnset[] = {
+static const u16 sSnoverTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xD964, 0x141F, 0x01C0, 0x1244, 0xAC2B, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_BULLET_SEED,
@@ -20275,8 +21449,10 @@ static const u16 sSnoverTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sSnoverTeachableLearnset (sSnoverTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sAbomasnowTeachableLearnset[] = {
+static const u16 sAbomasnowTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xF965, 0x1C9F, 0x01C8, 0x124E, 0xACAF, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_BRICK_BREAK,
@@ -20318,10 +21494,12 @@ static const u16 sAbomasnowTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sAbomasnowTeachableLearnset (sAbomasnowTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_SNOVER
 
 #if P_FAMILY_ROTOM
-static const u16 sRotomTeachableLearnset[] = {
+static const u16 sRotomTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC220, 0x7461, 0x12C0, 0x1404, 0x6C60, 0x0002),
     MOVE_DOUBLE_TEAM,
     MOVE_FACADE,
     MOVE_FLASH,
@@ -20349,10 +21527,12 @@ static const u16 sRotomTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sRotomTeachableLearnset (sRotomTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_ROTOM
 
 #if P_FAMILY_UXIE
-static const u16 sUxieTeachableLearnset[] = {
+static const u16 sUxieTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE22C, 0x767F, 0x08C2, 0x5404, 0x6C71, 0x0003),
     MOVE_CALM_MIND,
     MOVE_DOUBLE_TEAM,
     MOVE_FACADE,
@@ -20392,10 +21572,12 @@ static const u16 sUxieTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sUxieTeachableLearnset (sUxieTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_UXIE
 
 #if P_FAMILY_MESPRIT
-static const u16 sMespritTeachableLearnset[] = {
+static const u16 sMespritTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xFA2C, 0x7675, 0x08C2, 0x5604, 0x6C71, 0x0003),
     MOVE_BLIZZARD,
     MOVE_CALM_MIND,
     MOVE_DOUBLE_TEAM,
@@ -20436,10 +21618,12 @@ static const u16 sMespritTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sMespritTeachableLearnset (sMespritTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_MESPRIT
 
 #if P_FAMILY_AZELF
-static const u16 sAzelfTeachableLearnset[] = {
+static const u16 sAzelfTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE62C, 0xF675, 0x08E6, 0x7604, 0x6C71, 0x0003),
     MOVE_CALM_MIND,
     MOVE_DOUBLE_TEAM,
     MOVE_FACADE,
@@ -20483,10 +21667,12 @@ static const u16 sAzelfTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sAzelfTeachableLearnset (sAzelfTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_AZELF
 
 #if P_FAMILY_DIALGA
-static const u16 sDialgaTeachableLearnset[] = {
+static const u16 sDialgaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xBAB2, 0xD8F5, 0x60DE, 0x904E, 0x6CE0, 0x0002),
     MOVE_AERIAL_ACE,
     MOVE_BLIZZARD,
     MOVE_BRICK_BREAK,
@@ -20530,10 +21716,12 @@ static const u16 sDialgaTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sDialgaTeachableLearnset (sDialgaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_DIALGA
 
 #if P_FAMILY_PALKIA
-static const u16 sPalkiaTeachableLearnset[] = {
+static const u16 sPalkiaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xBAF7, 0xD8E5, 0x40DE, 0x907B, 0x6CE2, 0x0002),
     MOVE_AERIAL_ACE,
     MOVE_BLIZZARD,
     MOVE_BRICK_BREAK,
@@ -20581,10 +21769,12 @@ static const u16 sPalkiaTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sPalkiaTeachableLearnset (sPalkiaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_PALKIA
 
 #if P_FAMILY_HEATRAN
-static const u16 sHeatranTeachableLearnset[] = {
+static const u16 sHeatranTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA630, 0x9188, 0x21EE, 0x304A, 0x2CA0, 0x0000),
     MOVE_ATTRACT,
     MOVE_DIG,
     MOVE_DOUBLE_TEAM,
@@ -20616,10 +21806,12 @@ static const u16 sHeatranTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sHeatranTeachableLearnset (sHeatranTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_HEATRAN
 
 #if P_FAMILY_REGIGIGAS
-static const u16 sRegigigasTeachableLearnset[] = {
+static const u16 sRegigigasTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA221, 0x58E5, 0x00D8, 0x524A, 0x2CEF, 0x0003),
     MOVE_AERIAL_ACE,
     MOVE_BRICK_BREAK,
     MOVE_DOUBLE_TEAM,
@@ -20657,10 +21849,12 @@ static const u16 sRegigigasTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sRegigigasTeachableLearnset (sRegigigasTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_REGIGIGAS
 
 #if P_FAMILY_GIRATINA
-static const u16 sGiratinaTeachableLearnset[] = {
+static const u16 sGiratinaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA23A, 0x56F5, 0xC4D0, 0x944A, 0x6C62, 0x0002),
     MOVE_AERIAL_ACE,
     MOVE_CALM_MIND,
     MOVE_CUT,
@@ -20700,10 +21894,12 @@ static const u16 sGiratinaTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sGiratinaTeachableLearnset (sGiratinaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_GIRATINA
 
 #if P_FAMILY_CRESSELIA
-static const u16 sCresseliaTeachableLearnset[] = {
+static const u16 sCresseliaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xEA28, 0x366D, 0x09C0, 0x9444, 0x6C62, 0x0002),
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
     MOVE_DOUBLE_TEAM,
@@ -20739,10 +21935,12 @@ static const u16 sCresseliaTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sCresseliaTeachableLearnset (sCresseliaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_CRESSELIA
 
 #if P_FAMILY_MANAPHY
-static const u16 sPhioneTeachableLearnset[] = {
+static const u16 sPhioneTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x986C, 0x1005, 0x00C0, 0x1031, 0x6C62, 0x0000),
     MOVE_BLIZZARD,
     MOVE_CALM_MIND,
     MOVE_DIVE,
@@ -20768,8 +21966,10 @@ static const u16 sPhioneTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sPhioneTeachableLearnset (sPhioneTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sManaphyTeachableLearnset[] = {
+static const u16 sManaphyTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xF86C, 0x3605, 0x08C0, 0x1035, 0x6C62, 0x0000),
     MOVE_BLIZZARD,
     MOVE_CALM_MIND,
     MOVE_DIVE,
@@ -20802,10 +22002,12 @@ static const u16 sManaphyTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sManaphyTeachableLearnset (sManaphyTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_MANAPHY
 
 #if P_FAMILY_DARKRAI
-static const u16 sDarkraiTeachableLearnset[] = {
+static const u16 sDarkraiTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xBE29, 0x5E61, 0x52F9, 0x140E, 0xECE2, 0x0002),
     MOVE_AERIAL_ACE,
     MOVE_BLIZZARD,
     MOVE_BRICK_BREAK,
@@ -20849,10 +22051,12 @@ static const u16 sDarkraiTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sDarkraiTeachableLearnset (sDarkraiTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_DARKRAI
 
 #if P_FAMILY_SHAYMIN
-static const u16 sShayminLandTeachableLearnset[] = {
+static const u16 sShayminLandTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA320, 0x120E, 0x00D0, 0x1304, 0xEC60, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_BULLET_SEED,
     MOVE_DOUBLE_TEAM,
@@ -20879,8 +22083,10 @@ static const u16 sShayminLandTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sShayminLandTeachableLearnset (sShayminLandTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sShayminSkyTeachableLearnset[] = {
+static const u16 sShayminSkyTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA320, 0x120E, 0x00D0, 0x1204, 0xEC60, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_BULLET_SEED,
     MOVE_DOUBLE_TEAM,
@@ -20906,10 +22112,12 @@ static const u16 sShayminSkyTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sShayminSkyTeachableLearnset (sShayminSkyTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_SHAYMIN
 
 #if P_FAMILY_ARCEUS
-static const u16 sArceusTeachableLearnset[] = {
+static const u16 sArceusTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xFFFE, 0xFEFF, 0xE0DF, 0x967F, 0xEEE2, 0x0002),
     MOVE_AERIAL_ACE,
     MOVE_BLIZZARD,
     MOVE_BRICK_BREAK,
@@ -20974,10 +22182,12 @@ static const u16 sArceusTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sArceusTeachableLearnset (sArceusTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_ARCEUS
 
 #if P_FAMILY_VICTINI
-static const u16 sVictiniTeachableLearnset[] = {
+static const u16 sVictiniTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE620, 0xDE6C, 0x28C4, 0x520C, 0x6C4C, 0x0003),
     MOVE_BRICK_BREAK,
     MOVE_DOUBLE_TEAM,
     MOVE_FACADE,
@@ -21015,10 +22225,12 @@ static const u16 sVictiniTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sVictiniTeachableLearnset (sVictiniTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_VICTINI
 
 #if P_FAMILY_SNIVY
-static const u16 sSnivyTeachableLearnset[] = {
+static const u16 sSnivyTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC728, 0x301E, 0x51F0, 0x1204, 0xEC00, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BULLET_SEED,
@@ -21049,8 +22261,10 @@ static const u16 sSnivyTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sSnivyTeachableLearnset (sSnivyTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sServineTeachableLearnset[] = {
+static const u16 sServineTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC728, 0x301E, 0x51F0, 0x1204, 0xEC00, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BULLET_SEED,
@@ -21081,8 +22295,10 @@ static const u16 sServineTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sServineTeachableLearnset (sServineTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sSerperiorTeachableLearnset[] = {
+static const u16 sSerperiorTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE728, 0x301E, 0x51F0, 0x124E, 0xEC00, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BULLET_SEED,
@@ -21117,10 +22333,12 @@ static const u16 sSerperiorTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sSerperiorTeachableLearnset (sSerperiorTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_SNIVY
 
 #if P_FAMILY_TEPIG
-static const u16 sTepigTeachableLearnset[] = {
+static const u16 sTepigTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8630, 0x9118, 0x21CC, 0x534A, 0x2D20, 0x0000),
     MOVE_ATTRACT,
     MOVE_DIG,
     MOVE_DOUBLE_TEAM,
@@ -21151,8 +22369,10 @@ static const u16 sTepigTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sTepigTeachableLearnset (sTepigTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sPigniteTeachableLearnset[] = {
+static const u16 sPigniteTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x86B1, 0x9918, 0x21CC, 0x534A, 0x2DA0, 0x0001),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_BULK_UP,
@@ -21188,8 +22408,10 @@ static const u16 sPigniteTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sPigniteTeachableLearnset (sPigniteTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sEmboarTeachableLearnset[] = {
+static const u16 sEmboarTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA6B1, 0x9998, 0x21CC, 0x534A, 0x2DA0, 0x0001),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_BULK_UP,
@@ -21227,10 +22449,12 @@ static const u16 sEmboarTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sEmboarTeachableLearnset (sEmboarTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_TEPIG
 
 #if P_FAMILY_OSHAWOTT
-static const u16 sOshawottTeachableLearnset[] = {
+static const u16 sOshawottTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9C64, 0x1111, 0x43D0, 0x9039, 0xEC02, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
@@ -21262,8 +22486,10 @@ static const u16 sOshawottTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sOshawottTeachableLearnset (sOshawottTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sDewottTeachableLearnset[] = {
+static const u16 sDewottTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9C64, 0x1911, 0x43D0, 0x9039, 0xEC02, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
@@ -21296,8 +22522,10 @@ static const u16 sDewottTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sDewottTeachableLearnset (sDewottTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sSamurottTeachableLearnset[] = {
+static const u16 sSamurottTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xBC64, 0x1911, 0x43D0, 0x907B, 0xEC02, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
@@ -21333,9 +22561,11 @@ static const u16 sSamurottTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sSamurottTeachableLearnset (sSamurottTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
 #if P_HISUIAN_FORMS
-static const u16 sSamurottHisuiTeachableLearnset[] = {
+static const u16 sSamurottHisuiTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xBC04, 0x0911, 0x02D0, 0x9059, 0xC402, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_BLIZZARD,
     MOVE_BRICK_BREAK,
@@ -21362,11 +22592,13 @@ static const u16 sSamurottHisuiTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sSamurottHisuiTeachableLearnset (sSamurottHisuiTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_HISUIAN_FORMS
 #endif //P_FAMILY_OSHAWOTT
 
 #if P_FAMILY_PATRAT
-static const u16 sPatratTeachableLearnset[] = {
+static const u16 sPatratTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8320, 0x5531, 0x41C0, 0x0000, 0xAC00, 0x0000),
     MOVE_ATTRACT,
     MOVE_BULLET_SEED,
     MOVE_CUT,
@@ -21388,8 +22620,10 @@ static const u16 sPatratTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sPatratTeachableLearnset (sPatratTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sWatchogTeachableLearnset[] = {
+static const u16 sWatchogTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE321, 0xD571, 0x41C0, 0x440E, 0xAC41, 0x0003),
     MOVE_ATTRACT,
     MOVE_BULLET_SEED,
     MOVE_CUT,
@@ -21425,10 +22659,12 @@ static const u16 sWatchogTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sWatchogTeachableLearnset (sWatchogTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_PATRAT
 
 #if P_FAMILY_LILLIPUP
-static const u16 sLillipupTeachableLearnset[] = {
+static const u16 sLillipupTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8230, 0x5521, 0x01D8, 0x1008, 0x2C20, 0x0002),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_DIG,
@@ -21453,8 +22689,10 @@ static const u16 sLillipupTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sLillipupTeachableLearnset (sLillipupTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sHerdierTeachableLearnset[] = {
+static const u16 sHerdierTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8230, 0x5521, 0x01D8, 0x100B, 0x2C20, 0x0002),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_DIG,
@@ -21481,8 +22719,10 @@ static const u16 sHerdierTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sHerdierTeachableLearnset (sHerdierTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sStoutlandTeachableLearnset[] = {
+static const u16 sStoutlandTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA230, 0x5561, 0x01D8, 0x100B, 0x2C20, 0x0002),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_DIG,
@@ -21511,10 +22751,12 @@ static const u16 sStoutlandTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sStoutlandTeachableLearnset (sStoutlandTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_LILLIPUP
 
 #if P_FAMILY_PURRLOIN
-static const u16 sPurrloinTeachableLearnset[] = {
+static const u16 sPurrloinTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8620, 0x1411, 0x53F0, 0x1400, 0x6C40, 0x0002),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_CUT,
@@ -21541,8 +22783,10 @@ static const u16 sPurrloinTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sPurrloinTeachableLearnset (sPurrloinTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sLiepardTeachableLearnset[] = {
+static const u16 sLiepardTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA620, 0x1411, 0x53F0, 0x1408, 0x6C40, 0x0002),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_CUT,
@@ -21571,10 +22815,12 @@ static const u16 sLiepardTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sLiepardTeachableLearnset (sLiepardTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_PURRLOIN
 
 #if P_FAMILY_PANSAGE
-static const u16 sPansageTeachableLearnset[] = {
+static const u16 sPansageTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8721, 0x111A, 0x43E8, 0x000C, 0x2C00, 0x0000),
     MOVE_ATTRACT,
     MOVE_BULLET_SEED,
     MOVE_CUT,
@@ -21600,8 +22846,10 @@ static const u16 sPansageTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sPansageTeachableLearnset (sPansageTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sSimisageTeachableLearnset[] = {
+static const u16 sSimisageTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA721, 0x191A, 0x43E8, 0x000C, 0x2C80, 0x0000),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_BULLET_SEED,
@@ -21630,10 +22878,12 @@ static const u16 sSimisageTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sSimisageTeachableLearnset (sSimisageTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_PANSAGE
 
 #if P_FAMILY_PANSEAR
-static const u16 sPansearTeachableLearnset[] = {
+static const u16 sPansearTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8621, 0x9118, 0x63EC, 0x4008, 0x2C00, 0x0000),
     MOVE_ATTRACT,
     MOVE_CUT,
     MOVE_DIG,
@@ -21660,8 +22910,10 @@ static const u16 sPansearTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sPansearTeachableLearnset (sPansearTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sSimisearTeachableLearnset[] = {
+static const u16 sSimisearTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA621, 0x9918, 0x63EC, 0x4008, 0x2C80, 0x0000),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_CUT,
@@ -21691,10 +22943,12 @@ static const u16 sSimisearTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sSimisearTeachableLearnset (sSimisearTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_PANSEAR
 
 #if P_FAMILY_PANPOUR
-static const u16 sPanpourTeachableLearnset[] = {
+static const u16 sPanpourTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9C65, 0x1111, 0x43E8, 0x0039, 0x2C03, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_CUT,
@@ -21725,8 +22979,10 @@ static const u16 sPanpourTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sPanpourTeachableLearnset (sPanpourTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sSimipourTeachableLearnset[] = {
+static const u16 sSimipourTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xBC65, 0x1911, 0x43E8, 0x0039, 0x2C83, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_BRICK_BREAK,
@@ -21760,10 +23016,12 @@ static const u16 sSimipourTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sSimipourTeachableLearnset (sSimipourTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_PANPOUR
 
 #if P_FAMILY_MUNNA
-static const u16 sMunnaTeachableLearnset[] = {
+static const u16 sMunnaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC028, 0x7605, 0x09E8, 0x1504, 0x6CC0, 0x0002),
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
     MOVE_DOUBLE_TEAM,
@@ -21794,8 +23052,10 @@ static const u16 sMunnaTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sMunnaTeachableLearnset (sMunnaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sMusharnaTeachableLearnset[] = {
+static const u16 sMusharnaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE028, 0x7605, 0x09E8, 0x1504, 0x6CC0, 0x0002),
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
     MOVE_DOUBLE_TEAM,
@@ -21827,10 +23087,12 @@ static const u16 sMusharnaTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sMusharnaTeachableLearnset (sMusharnaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_MUNNA
 
 #if P_FAMILY_PIDOVE
-static const u16 sPidoveTeachableLearnset[] = {
+static const u16 sPidoveTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8620, 0x1001, 0x85D0, 0x1000, 0x6C00, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_DOUBLE_TEAM,
@@ -21850,8 +23112,10 @@ static const u16 sPidoveTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sPidoveTeachableLearnset (sPidoveTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sTranquillTeachableLearnset[] = {
+static const u16 sTranquillTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8620, 0x1001, 0x85D0, 0x1000, 0x6C00, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_DOUBLE_TEAM,
@@ -21871,8 +23135,10 @@ static const u16 sTranquillTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sTranquillTeachableLearnset (sTranquillTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sUnfezantTeachableLearnset[] = {
+static const u16 sUnfezantTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA620, 0x1001, 0x85D0, 0x1000, 0x6C40, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_DOUBLE_TEAM,
@@ -21894,10 +23160,12 @@ static const u16 sUnfezantTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sUnfezantTeachableLearnset (sUnfezantTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_PIDOVE
 
 #if P_FAMILY_BLITZLE
-static const u16 sBlitzleTeachableLearnset[] = {
+static const u16 sBlitzleTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC220, 0x5061, 0x11C0, 0x1244, 0x6C00, 0x0002),
     MOVE_ATTRACT,
     MOVE_DOUBLE_TEAM,
     MOVE_FACADE,
@@ -21922,8 +23190,10 @@ static const u16 sBlitzleTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sBlitzleTeachableLearnset (sBlitzleTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sZebstrikaTeachableLearnset[] = {
+static const u16 sZebstrikaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE630, 0x5061, 0x31C0, 0x124C, 0x6C00, 0x0002),
     MOVE_ATTRACT,
     MOVE_DOUBLE_TEAM,
     MOVE_FACADE,
@@ -21953,10 +23223,12 @@ static const u16 sZebstrikaTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sZebstrikaTeachableLearnset (sZebstrikaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_BLITZLE
 
 #if P_FAMILY_ROGGENROLA
-static const u16 sRoggenrolaTeachableLearnset[] = {
+static const u16 sRoggenrolaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8020, 0x1080, 0x01CA, 0x300A, 0x2CA0, 0x0000),
     MOVE_ATTRACT,
     MOVE_DOUBLE_TEAM,
     MOVE_EARTHQUAKE,
@@ -21977,8 +23249,10 @@ static const u16 sRoggenrolaTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sRoggenrolaTeachableLearnset (sRoggenrolaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sBoldoreTeachableLearnset[] = {
+static const u16 sBoldoreTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8020, 0x1080, 0x01CA, 0x300A, 0x2CA0, 0x0000),
     MOVE_ATTRACT,
     MOVE_DOUBLE_TEAM,
     MOVE_EARTHQUAKE,
@@ -21999,8 +23273,10 @@ static const u16 sBoldoreTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sBoldoreTeachableLearnset (sBoldoreTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sGigalithTeachableLearnset[] = {
+static const u16 sGigalithTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA020, 0x1088, 0x01CA, 0x300A, 0x2CA0, 0x0000),
     MOVE_ATTRACT,
     MOVE_DOUBLE_TEAM,
     MOVE_EARTHQUAKE,
@@ -22023,10 +23299,12 @@ static const u16 sGigalithTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sGigalithTeachableLearnset (sGigalithTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_ROGGENROLA
 
 #if P_FAMILY_WOOBAT
-static const u16 sWoobatTeachableLearnset[] = {
+static const u16 sWoobatTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC428, 0x7607, 0x8FF0, 0x1404, 0x6C40, 0x0002),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
@@ -22060,8 +23338,10 @@ static const u16 sWoobatTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sWoobatTeachableLearnset (sWoobatTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sSwoobatTeachableLearnset[] = {
+static const u16 sSwoobatTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE428, 0x7607, 0x8FF0, 0x1404, 0x6C40, 0x0002),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
@@ -22096,10 +23376,12 @@ static const u16 sSwoobatTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sSwoobatTeachableLearnset (sSwoobatTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_WOOBAT
 
 #if P_FAMILY_DRILBUR
-static const u16 sDrilburTeachableLearnset[] = {
+static const u16 sDrilburTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8220, 0x1980, 0x41DB, 0x120A, 0xACA0, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -22127,8 +23409,10 @@ static const u16 sDrilburTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sDrilburTeachableLearnset (sDrilburTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sExcadrillTeachableLearnset[] = {
+static const u16 sExcadrillTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA220, 0x1980, 0x41DB, 0x124A, 0xACA0, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -22158,10 +23442,12 @@ static const u16 sExcadrillTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sExcadrillTeachableLearnset (sExcadrillTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_DRILBUR
 
 #if P_FAMILY_AUDINO
-static const u16 sAudinoTeachableLearnset[] = {
+static const u16 sAudinoTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xFA29, 0xB77D, 0x19C4, 0x5645, 0x2C4F, 0x0003),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_CALM_MIND,
@@ -22208,10 +23494,12 @@ static const u16 sAudinoTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sAudinoTeachableLearnset (sAudinoTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_AUDINO
 
 #if P_FAMILY_TIMBURR
-static const u16 sTimburrTeachableLearnset[] = {
+static const u16 sTimburrTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x86A1, 0x1901, 0x03C8, 0x5A8A, 0x2C8D, 0x0001),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_BULK_UP,
@@ -22244,8 +23532,10 @@ static const u16 sTimburrTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sTimburrTeachableLearnset (sTimburrTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sGurdurrTeachableLearnset[] = {
+static const u16 sGurdurrTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x86A1, 0x1901, 0x03C8, 0x5A8A, 0x2C8D, 0x0001),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_BULK_UP,
@@ -22278,8 +23568,10 @@ static const u16 sGurdurrTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sGurdurrTeachableLearnset (sGurdurrTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sConkeldurrTeachableLearnset[] = {
+static const u16 sConkeldurrTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA6A1, 0x1981, 0x03C8, 0x5ACA, 0x2C8D, 0x0001),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_BULK_UP,
@@ -22315,10 +23607,12 @@ static const u16 sConkeldurrTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sConkeldurrTeachableLearnset (sConkeldurrTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_TIMBURR
 
 #if P_FAMILY_TYMPOLE
-static const u16 sTympoleTeachableLearnset[] = {
+static const u16 sTympoleTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8064, 0x1001, 0x01C1, 0x1001, 0x2C22, 0x0000),
     MOVE_ATTRACT,
     MOVE_DOUBLE_TEAM,
     MOVE_FACADE,
@@ -22338,8 +23632,10 @@ static const u16 sTympoleTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sTympoleTeachableLearnset (sTympoleTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sPalpitoadTeachableLearnset[] = {
+static const u16 sPalpitoadTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8065, 0x1001, 0x01C1, 0x1009, 0x2C22, 0x0000),
     MOVE_ATTRACT,
     MOVE_DOUBLE_TEAM,
     MOVE_FACADE,
@@ -22361,8 +23657,10 @@ static const u16 sPalpitoadTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sPalpitoadTeachableLearnset (sPalpitoadTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sSeismitoadTeachableLearnset[] = {
+static const u16 sSeismitoadTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA065, 0x1981, 0x01C9, 0x102B, 0x2CAF, 0x0000),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_DIG,
@@ -22395,10 +23693,12 @@ static const u16 sSeismitoadTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sSeismitoadTeachableLearnset (sSeismitoadTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_TYMPOLE
 
 #if P_FAMILY_THROH
-static const u16 sThrohTeachableLearnset[] = {
+static const u16 sThrohTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x86A1, 0x1981, 0x01C8, 0x504A, 0x2E8D, 0x0001),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_BULK_UP,
@@ -22430,10 +23730,12 @@ static const u16 sThrohTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sThrohTeachableLearnset (sThrohTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_THROH
 
 #if P_FAMILY_SAWK
-static const u16 sSawkTeachableLearnset[] = {
+static const u16 sSawkTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x86A1, 0x1981, 0x01C8, 0x508A, 0x2C8D, 0x0001),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_BULK_UP,
@@ -22464,10 +23766,12 @@ static const u16 sSawkTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sSawkTeachableLearnset (sSawkTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_SAWK
 
 #if P_FAMILY_SEWADDLE
-static const u16 sSewaddleTeachableLearnset[] = {
+static const u16 sSewaddleTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC228, 0x100F, 0x41C0, 0x1404, 0x2C00, 0x0000),
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
     MOVE_CUT,
@@ -22490,8 +23794,10 @@ static const u16 sSewaddleTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sSewaddleTeachableLearnset (sSewaddleTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sSwadloonTeachableLearnset[] = {
+static const u16 sSwadloonTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC228, 0x100F, 0x41C0, 0x1404, 0x2C00, 0x0000),
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
     MOVE_CUT,
@@ -22514,8 +23820,10 @@ static const u16 sSwadloonTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sSwadloonTeachableLearnset (sSwadloonTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sLeavannyTeachableLearnset[] = {
+static const u16 sLeavannyTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE328, 0x300F, 0x45D0, 0x1404, 0xAC00, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BULLET_SEED,
@@ -22544,10 +23852,12 @@ static const u16 sLeavannyTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sLeavannyTeachableLearnset (sLeavannyTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_SEWADDLE
 
 #if P_FAMILY_VENIPEDE
-static const u16 sVenipedeTeachableLearnset[] = {
+static const u16 sVenipedeTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8220, 0x1008, 0x01C1, 0x9308, 0x2D00, 0x0000),
     MOVE_ATTRACT,
     MOVE_DOUBLE_TEAM,
     MOVE_FACADE,
@@ -22568,8 +23878,10 @@ static const u16 sVenipedeTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sVenipedeTeachableLearnset (sVenipedeTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sWhirlipedeTeachableLearnset[] = {
+static const u16 sWhirlipedeTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8220, 0x1008, 0x01C1, 0x9308, 0x2D00, 0x0000),
     MOVE_ATTRACT,
     MOVE_DOUBLE_TEAM,
     MOVE_FACADE,
@@ -22590,8 +23902,10 @@ static const u16 sWhirlipedeTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sWhirlipedeTeachableLearnset (sWhirlipedeTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sScolipedeTeachableLearnset[] = {
+static const u16 sScolipedeTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA220, 0x1198, 0x51C9, 0x930A, 0xAD80, 0x0000),
     MOVE_ATTRACT,
     MOVE_CUT,
     MOVE_DIG,
@@ -22622,10 +23936,12 @@ static const u16 sScolipedeTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sScolipedeTeachableLearnset (sScolipedeTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_VENIPEDE
 
 #if P_FAMILY_COTTONEE
-static const u16 sCottoneeTeachableLearnset[] = {
+static const u16 sCottoneeTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8620, 0x100E, 0x01C0, 0x1404, 0x6C00, 0x0000),
     MOVE_ATTRACT,
     MOVE_DOUBLE_TEAM,
     MOVE_FACADE,
@@ -22646,8 +23962,10 @@ static const u16 sCottoneeTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sCottoneeTeachableLearnset (sCottoneeTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sWhimsicottTeachableLearnset[] = {
+static const u16 sWhimsicottTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE620, 0x160E, 0x03C0, 0x1404, 0x6C00, 0x0000),
     MOVE_ATTRACT,
     MOVE_DOUBLE_TEAM,
     MOVE_FACADE,
@@ -22673,10 +23991,12 @@ static const u16 sWhimsicottTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sWhimsicottTeachableLearnset (sWhimsicottTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_COTTONEE
 
 #if P_FAMILY_PETILIL
-static const u16 sPetililTeachableLearnset[] = {
+static const u16 sPetililTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8320, 0x100E, 0x41C0, 0x1404, 0x2C00, 0x0000),
     MOVE_ATTRACT,
     MOVE_BULLET_SEED,
     MOVE_CUT,
@@ -22697,8 +24017,10 @@ static const u16 sPetililTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sPetililTeachableLearnset (sPetililTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sLilligantTeachableLearnset[] = {
+static const u16 sLilligantTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE320, 0x100E, 0x41C0, 0x1404, 0xAC40, 0x0000),
     MOVE_ATTRACT,
     MOVE_BULLET_SEED,
     MOVE_CUT,
@@ -22723,9 +24045,11 @@ static const u16 sLilligantTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sLilligantTeachableLearnset (sLilligantTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
 #if P_HISUIAN_FORMS
-static const u16 sLilligantHisuiTeachableLearnset[] = {
+static const u16 sLilligantHisuiTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA300, 0x080B, 0x00D0, 0x1008, 0x8454, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_BRICK_BREAK,
     MOVE_BULLET_SEED,
@@ -22746,11 +24070,13 @@ static const u16 sLilligantHisuiTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sLilligantHisuiTeachableLearnset (sLilligantHisuiTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_HISUIAN_FORMS
 #endif //P_FAMILY_PETILIL
 
 #if P_FAMILY_BASCULIN
-static const u16 sBasculinTeachableLearnset[] = {
+static const u16 sBasculinTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xBC64, 0x1001, 0x41C0, 0x1231, 0x6C02, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_CUT,
@@ -22777,9 +24103,11 @@ static const u16 sBasculinTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sBasculinTeachableLearnset (sBasculinTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
 #if P_HISUIAN_FORMS
-static const u16 sBasculinWhiteStripedTeachableLearnset[] = {
+static const u16 sBasculinWhiteStripedTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9804, 0x0001, 0x00C0, 0x1211, 0x4402, 0x0000),
     MOVE_BLIZZARD,
     MOVE_FACADE,
     MOVE_ICE_BEAM,
@@ -22796,8 +24124,10 @@ static const u16 sBasculinWhiteStripedTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sBasculinWhiteStripedTeachableLearnset (sBasculinWhiteStripedTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sBasculegionTeachableLearnset[] = {
+static const u16 sBasculegionTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xB80C, 0x0601, 0x00C0, 0x1211, 0x4402, 0x0000),
     MOVE_BLIZZARD,
     MOVE_CALM_MIND,
     MOVE_FACADE,
@@ -22818,11 +24148,13 @@ static const u16 sBasculegionTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sBasculegionTeachableLearnset (sBasculegionTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_HISUIAN_FORMS
 #endif //P_FAMILY_BASCULIN
 
 #if P_FAMILY_SANDILE
-static const u16 sSandileTeachableLearnset[] = {
+static const u16 sSandileTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8430, 0x1990, 0x53EB, 0x12C0, 0x2CA0, 0x0000),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_CUT,
@@ -22853,8 +24185,10 @@ static const u16 sSandileTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sSandileTeachableLearnset (sSandileTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sKrokorokTeachableLearnset[] = {
+static const u16 sKrokorokTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8433, 0x1990, 0x53FB, 0x12CA, 0x2CAC, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -22892,8 +24226,10 @@ static const u16 sKrokorokTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sKrokorokTeachableLearnset (sKrokorokTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sKrookodileTeachableLearnset[] = {
+static const u16 sKrookodileTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA4B3, 0x1990, 0x53FB, 0x12CA, 0x2CAC, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -22933,10 +24269,12 @@ static const u16 sKrookodileTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sKrookodileTeachableLearnset (sKrookodileTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_SANDILE
 
 #if P_FAMILY_DARUMAKA
-static const u16 sDarumakaTeachableLearnset[] = {
+static const u16 sDarumakaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8631, 0x9908, 0x33CC, 0x500A, 0x2D8C, 0x0000),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_DIG,
@@ -22969,8 +24307,10 @@ static const u16 sDarumakaTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sDarumakaTeachableLearnset (sDarumakaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sDarmanitanTeachableLearnset[] = {
+static const u16 sDarmanitanTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA6B1, 0x9B88, 0x33EC, 0x504A, 0x2D8C, 0x0000),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_BULK_UP,
@@ -23009,9 +24349,11 @@ static const u16 sDarmanitanTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sDarmanitanTeachableLearnset (sDarmanitanTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
 #if P_GALARIAN_FORMS
-static const u16 sDarumakaGalarTeachableLearnset[] = {
+static const u16 sDarumakaGalarTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9E01, 0x8908, 0x23CC, 0x5000, 0x0C8D, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_BRICK_BREAK,
@@ -23039,8 +24381,10 @@ static const u16 sDarumakaGalarTeachableLearnset[] = {
     MOVE_SNORE,
     MOVE_UNAVAILABLE,
 };
+#define sDarumakaGalarTeachableLearnset (sDarumakaGalarTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sDarmanitanGalarTeachableLearnset[] = {
+static const u16 sDarmanitanGalarTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xBE81, 0x8B88, 0x23CC, 0x5040, 0x0C8D, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_BRICK_BREAK,
@@ -23073,11 +24417,13 @@ static const u16 sDarmanitanGalarTeachableLearnset[] = {
     MOVE_SNORE,
     MOVE_UNAVAILABLE,
 };
+#define sDarmanitanGalarTeachableLearnset (sDarmanitanGalarTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_GALARIAN_FORMS
 #endif //P_FAMILY_DARUMAKA
 
 #if P_FAMILY_MARACTUS
-static const u16 sMaractusTeachableLearnset[] = {
+static const u16 sMaractusTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8320, 0x100F, 0x01D0, 0x1000, 0x2C00, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BULLET_SEED,
@@ -23097,10 +24443,12 @@ static const u16 sMaractusTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sMaractusTeachableLearnset (sMaractusTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_MARACTUS
 
 #if P_FAMILY_DWEBBLE
-static const u16 sDwebbleTeachableLearnset[] = {
+static const u16 sDwebbleTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8020, 0x1188, 0x41DA, 0x908A, 0xAC80, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_CUT,
@@ -23126,8 +24474,10 @@ static const u16 sDwebbleTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sDwebbleTeachableLearnset (sDwebbleTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sCrustleTeachableLearnset[] = {
+static const u16 sCrustleTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA020, 0x1188, 0x41DA, 0x908A, 0xAC80, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_CUT,
@@ -23154,10 +24504,12 @@ static const u16 sCrustleTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sCrustleTeachableLearnset (sCrustleTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_DWEBBLE
 
 #if P_FAMILY_SCRAGGY
-static const u16 sScraggyTeachableLearnset[] = {
+static const u16 sScraggyTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x86B3, 0x1911, 0x13E9, 0x528A, 0x2C8D, 0x0001),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_BULK_UP,
@@ -23195,8 +24547,10 @@ static const u16 sScraggyTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sScraggyTeachableLearnset (sScraggyTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sScraftyTeachableLearnset[] = {
+static const u16 sScraftyTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA6B3, 0x1911, 0x13E9, 0x52CA, 0xAC9D, 0x0001),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_BULK_UP,
@@ -23238,10 +24592,12 @@ static const u16 sScraftyTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sScraftyTeachableLearnset (sScraftyTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_SCRAGGY
 
 #if P_FAMILY_SIGILYPH
-static const u16 sSigilyphTeachableLearnset[] = {
+static const u16 sSigilyphTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE828, 0x760D, 0x8FD0, 0x1404, 0x6C42, 0x0002),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
@@ -23276,10 +24632,12 @@ static const u16 sSigilyphTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sSigilyphTeachableLearnset (sSigilyphTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_SIGILYPH
 
 #if P_FAMILY_YAMASK
-static const u16 sYamaskTeachableLearnset[] = {
+static const u16 sYamaskTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8028, 0x5605, 0x1BC0, 0x1404, 0x2C40, 0x0000),
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
     MOVE_DOUBLE_TEAM,
@@ -23304,8 +24662,10 @@ static const u16 sYamaskTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sYamaskTeachableLearnset (sYamaskTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sCofagrigusTeachableLearnset[] = {
+static const u16 sCofagrigusTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA028, 0x5605, 0x1BC0, 0x1404, 0x2C40, 0x0000),
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
     MOVE_DOUBLE_TEAM,
@@ -23331,9 +24691,11 @@ static const u16 sCofagrigusTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sCofagrigusTeachableLearnset (sCofagrigusTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
 #if P_GALARIAN_FORMS
-static const u16 sYamaskGalarTeachableLearnset[] = {
+static const u16 sYamaskGalarTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8008, 0x0685, 0x0BCA, 0x1000, 0x0C80, 0x0000),
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
     MOVE_EARTHQUAKE,
@@ -23354,8 +24716,10 @@ static const u16 sYamaskGalarTeachableLearnset[] = {
     MOVE_SNORE,
     MOVE_UNAVAILABLE,
 };
+#define sYamaskGalarTeachableLearnset (sYamaskGalarTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sRunerigusTeachableLearnset[] = {
+static const u16 sRunerigusTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA408, 0x0685, 0x0BCA, 0x1000, 0x0C80, 0x0000),
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
     MOVE_EARTHQUAKE,
@@ -23378,11 +24742,13 @@ static const u16 sRunerigusTeachableLearnset[] = {
     MOVE_SNORE,
     MOVE_UNAVAILABLE,
 };
+#define sRunerigusTeachableLearnset (sRunerigusTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_GALARIAN_FORMS
 #endif //P_FAMILY_YAMASK
 
 #if P_FAMILY_TIRTOUGA
-static const u16 sTirtougaTeachableLearnset[] = {
+static const u16 sTirtougaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9824, 0x1191, 0x01CA, 0x107B, 0x2D82, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_DIG,
@@ -23413,8 +24779,10 @@ static const u16 sTirtougaTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sTirtougaTeachableLearnset (sTirtougaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sCarracostaTeachableLearnset[] = {
+static const u16 sCarracostaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xB824, 0x1191, 0x01CA, 0x107B, 0x2D82, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_DIG,
@@ -23446,10 +24814,12 @@ static const u16 sCarracostaTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sCarracostaTeachableLearnset (sCarracostaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_TIRTOUGA
 
 #if P_FAMILY_ARCHEN
-static const u16 sArchenTeachableLearnset[] = {
+static const u16 sArchenTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8432, 0x1190, 0x45FA, 0x1008, 0x6C80, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_CUT,
@@ -23477,8 +24847,10 @@ static const u16 sArchenTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sArchenTeachableLearnset (sArchenTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sArcheopsTeachableLearnset[] = {
+static const u16 sArcheopsTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA432, 0x1190, 0xC5FA, 0x1008, 0x6C80, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_CUT,
@@ -23508,10 +24880,12 @@ static const u16 sArcheopsTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sArcheopsTeachableLearnset (sArcheopsTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_ARCHEN
 
 #if P_FAMILY_TRUBBISH
-static const u16 sTrubbishTeachableLearnset[] = {
+static const u16 sTrubbishTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8220, 0x1003, 0x03C1, 0x3000, 0x2D00, 0x0000),
     MOVE_ATTRACT,
     MOVE_DOUBLE_TEAM,
     MOVE_FACADE,
@@ -23531,8 +24905,10 @@ static const u16 sTrubbishTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sTrubbishTeachableLearnset (sTrubbishTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sGarbodorTeachableLearnset[] = {
+static const u16 sGarbodorTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA220, 0x122B, 0x03C1, 0x3040, 0x2D00, 0x0000),
     MOVE_ATTRACT,
     MOVE_DOUBLE_TEAM,
     MOVE_FACADE,
@@ -23557,10 +24933,12 @@ static const u16 sGarbodorTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sGarbodorTeachableLearnset (sGarbodorTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_TRUBBISH
 
 #if P_FAMILY_ZORUA
-static const u16 sZoruaTeachableLearnset[] = {
+static const u16 sZoruaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8638, 0x1501, 0x53F1, 0x1080, 0xEC40, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
@@ -23590,8 +24968,10 @@ static const u16 sZoruaTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sZoruaTeachableLearnset (sZoruaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sZoroarkTeachableLearnset[] = {
+static const u16 sZoroarkTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA638, 0x9F01, 0x53F1, 0x10C8, 0xEC4C, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -23629,9 +25009,11 @@ static const u16 sZoroarkTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sZoroarkTeachableLearnset (sZoroarkTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
 #if P_HISUIAN_FORMS
-static const u16 sZoruaHisuiTeachableLearnset[] = {
+static const u16 sZoruaHisuiTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA419, 0x0501, 0x02F1, 0x1000, 0x4442, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_CALM_MIND,
     MOVE_DIG,
@@ -23654,8 +25036,10 @@ static const u16 sZoruaHisuiTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sZoruaHisuiTeachableLearnset (sZoruaHisuiTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sZoroarkHisuiTeachableLearnset[] = {
+static const u16 sZoroarkHisuiTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA419, 0x8F01, 0x02F1, 0x1048, 0xC442, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_BRICK_BREAK,
     MOVE_CALM_MIND,
@@ -23684,11 +25068,13 @@ static const u16 sZoroarkHisuiTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sZoroarkHisuiTeachableLearnset (sZoroarkHisuiTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_HISUIAN_FORMS
 #endif //P_FAMILY_ZORUA
 
 #if P_FAMILY_MINCCINO
-static const u16 sMinccinoTeachableLearnset[] = {
+static const u16 sMinccinoTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8328, 0x5135, 0x03C0, 0x1000, 0x6C20, 0x0002),
     MOVE_ATTRACT,
     MOVE_BULLET_SEED,
     MOVE_CALM_MIND,
@@ -23714,8 +25100,10 @@ static const u16 sMinccinoTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sMinccinoTeachableLearnset (sMinccinoTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sCinccinoTeachableLearnset[] = {
+static const u16 sCinccinoTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE328, 0x5175, 0x03C0, 0x1200, 0x6C20, 0x0002),
     MOVE_ATTRACT,
     MOVE_BULLET_SEED,
     MOVE_CALM_MIND,
@@ -23745,10 +25133,12 @@ static const u16 sCinccinoTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sCinccinoTeachableLearnset (sCinccinoTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_MINCCINO
 
 #if P_FAMILY_GOTHITA
-static const u16 sGothitaTeachableLearnset[] = {
+static const u16 sGothitaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC428, 0x7625, 0x1BE8, 0x1404, 0x6CC0, 0x0002),
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
     MOVE_DOUBLE_TEAM,
@@ -23782,8 +25172,10 @@ static const u16 sGothitaTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sGothitaTeachableLearnset (sGothitaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sGothoritaTeachableLearnset[] = {
+static const u16 sGothoritaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC428, 0x7625, 0x1BE8, 0x1404, 0x6CD0, 0x0002),
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
     MOVE_DOUBLE_TEAM,
@@ -23818,8 +25210,10 @@ static const u16 sGothoritaTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sGothoritaTeachableLearnset (sGothoritaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sGothitelleTeachableLearnset[] = {
+static const u16 sGothitelleTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE428, 0x7E25, 0x1BE8, 0x1444, 0x6CD0, 0x0002),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_CALM_MIND,
@@ -23857,10 +25251,12 @@ static const u16 sGothitelleTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sGothitelleTeachableLearnset (sGothitelleTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_GOTHITA
 
 #if P_FAMILY_SOLOSIS
-static const u16 sSolosisTeachableLearnset[] = {
+static const u16 sSolosisTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC228, 0x7645, 0x19C8, 0x3404, 0x6DC0, 0x0002),
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
     MOVE_DOUBLE_TEAM,
@@ -23894,8 +25290,10 @@ static const u16 sSolosisTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sSolosisTeachableLearnset (sSolosisTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sDuosionTeachableLearnset[] = {
+static const u16 sDuosionTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC228, 0x7645, 0x19C8, 0x3404, 0x6DC0, 0x0002),
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
     MOVE_DOUBLE_TEAM,
@@ -23929,8 +25327,10 @@ static const u16 sDuosionTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sDuosionTeachableLearnset (sDuosionTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sReuniclusTeachableLearnset[] = {
+static const u16 sReuniclusTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE229, 0x7645, 0x19C8, 0x744E, 0x6DC9, 0x0003),
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
     MOVE_DOUBLE_TEAM,
@@ -23973,10 +25373,12 @@ static const u16 sReuniclusTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sReuniclusTeachableLearnset (sReuniclusTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_SOLOSIS
 
 #if P_FAMILY_DUCKLETT
-static const u16 sDucklettTeachableLearnset[] = {
+static const u16 sDucklettTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8864, 0x1001, 0x85D0, 0x1221, 0x6C02, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_DIVE,
@@ -24001,8 +25403,10 @@ static const u16 sDucklettTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sDucklettTeachableLearnset (sDucklettTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sSwannaTeachableLearnset[] = {
+static const u16 sSwannaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA864, 0x1001, 0x85D0, 0x1221, 0x6C02, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_DIVE,
@@ -24028,10 +25432,12 @@ static const u16 sSwannaTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sSwannaTeachableLearnset (sSwannaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_DUCKLETT
 
 #if P_FAMILY_VANILLITE
-static const u16 sVanilliteTeachableLearnset[] = {
+static const u16 sVanilliteTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xDC64, 0x1001, 0x01C0, 0x3000, 0x2C02, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_DOUBLE_TEAM,
@@ -24053,8 +25459,10 @@ static const u16 sVanilliteTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sVanilliteTeachableLearnset (sVanilliteTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sVanillishTeachableLearnset[] = {
+static const u16 sVanillishTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xDC64, 0x1001, 0x01C0, 0x3000, 0x2C02, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_DOUBLE_TEAM,
@@ -24076,8 +25484,10 @@ static const u16 sVanillishTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sVanillishTeachableLearnset (sVanillishTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sVanilluxeTeachableLearnset[] = {
+static const u16 sVanilluxeTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xFC64, 0x1001, 0x01C0, 0x3000, 0x2C02, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_DOUBLE_TEAM,
@@ -24100,10 +25510,12 @@ static const u16 sVanilluxeTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sVanilluxeTeachableLearnset (sVanilluxeTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_VANILLITE
 
 #if P_FAMILY_DEERLING
-static const u16 sDeerlingTeachableLearnset[] = {
+static const u16 sDeerlingTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC320, 0x150F, 0x01C0, 0x1244, 0x2C00, 0x0002),
     MOVE_ATTRACT,
     MOVE_BULLET_SEED,
     MOVE_DIG,
@@ -24129,8 +25541,10 @@ static const u16 sDeerlingTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sDeerlingTeachableLearnset (sDeerlingTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sSawsbuckTeachableLearnset[] = {
+static const u16 sSawsbuckTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE320, 0x150F, 0x41C0, 0x124C, 0xAC00, 0x0002),
     MOVE_ATTRACT,
     MOVE_BULLET_SEED,
     MOVE_CUT,
@@ -24160,10 +25574,12 @@ static const u16 sSawsbuckTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sSawsbuckTeachableLearnset (sSawsbuckTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_DEERLING
 
 #if P_FAMILY_EMOLGA
-static const u16 sEmolgaTeachableLearnset[] = {
+static const u16 sEmolgaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC420, 0x5079, 0x41D0, 0x1004, 0x6C00, 0x0002),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_CUT,
@@ -24189,10 +25605,12 @@ static const u16 sEmolgaTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sEmolgaTeachableLearnset (sEmolgaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_EMOLGA
 
 #if P_FAMILY_KARRABLAST
-static const u16 sKarrablastTeachableLearnset[] = {
+static const u16 sKarrablastTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8020, 0x1003, 0x41D0, 0x9280, 0xAC00, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_CUT,
@@ -24213,8 +25631,10 @@ static const u16 sKarrablastTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sKarrablastTeachableLearnset (sKarrablastTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sEscavalierTeachableLearnset[] = {
+static const u16 sEscavalierTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA420, 0x1003, 0x41D0, 0x9288, 0xAC00, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_CUT,
@@ -24238,10 +25658,12 @@ static const u16 sEscavalierTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sEscavalierTeachableLearnset (sEscavalierTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_KARRABLAST
 
 #if P_FAMILY_FOONGUS
-static const u16 sFoongusTeachableLearnset[] = {
+static const u16 sFoongusTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8320, 0x100B, 0x01C1, 0x1144, 0x2D00, 0x0000),
     MOVE_ATTRACT,
     MOVE_BULLET_SEED,
     MOVE_DOUBLE_TEAM,
@@ -24264,8 +25686,10 @@ static const u16 sFoongusTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sFoongusTeachableLearnset (sFoongusTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sAmoongussTeachableLearnset[] = {
+static const u16 sAmoongussTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA320, 0x100B, 0x01C1, 0x1144, 0x2D00, 0x0000),
     MOVE_ATTRACT,
     MOVE_BULLET_SEED,
     MOVE_DOUBLE_TEAM,
@@ -24289,10 +25713,12 @@ static const u16 sAmoongussTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sAmoongussTeachableLearnset (sAmoongussTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_FOONGUS
 
 #if P_FAMILY_FRILLISH
-static const u16 sFrillishTeachableLearnset[] = {
+static const u16 sFrillishTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9C64, 0x5607, 0x01C1, 0x1435, 0x2C42, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_DIVE,
@@ -24324,8 +25750,10 @@ static const u16 sFrillishTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sFrillishTeachableLearnset (sFrillishTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sJellicentTeachableLearnset[] = {
+static const u16 sJellicentTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xBC64, 0x5607, 0x01C1, 0x1435, 0x2C42, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_DIVE,
@@ -24358,10 +25786,12 @@ static const u16 sJellicentTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sJellicentTeachableLearnset (sJellicentTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_FRILLISH
 
 #if P_FAMILY_ALOMOMOLA
-static const u16 sAlomomolaTeachableLearnset[] = {
+static const u16 sAlomomolaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xF86C, 0x1605, 0x09C0, 0x1071, 0x2C42, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_CALM_MIND,
@@ -24392,10 +25822,12 @@ static const u16 sAlomomolaTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sAlomomolaTeachableLearnset (sAlomomolaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_ALOMOMOLA
 
 #if P_FAMILY_JOLTIK
-static const u16 sJoltikTeachableLearnset[] = {
+static const u16 sJoltikTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC020, 0x5063, 0x43C0, 0x9004, 0x6C00, 0x0002),
     MOVE_ATTRACT,
     MOVE_CUT,
     MOVE_DOUBLE_TEAM,
@@ -24420,8 +25852,10 @@ static const u16 sJoltikTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sJoltikTeachableLearnset (sJoltikTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sGalvantulaTeachableLearnset[] = {
+static const u16 sGalvantulaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE020, 0x5063, 0x43C0, 0x9004, 0x6C00, 0x0002),
     MOVE_ATTRACT,
     MOVE_CUT,
     MOVE_DOUBLE_TEAM,
@@ -24447,10 +25881,12 @@ static const u16 sGalvantulaTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sGalvantulaTeachableLearnset (sGalvantulaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_JOLTIK
 
 #if P_FAMILY_FERROSEED
-static const u16 sFerroseedTeachableLearnset[] = {
+static const u16 sFerroseedTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8320, 0x102A, 0x01C0, 0x300C, 0x2D00, 0x0002),
     MOVE_ATTRACT,
     MOVE_BULLET_SEED,
     MOVE_DOUBLE_TEAM,
@@ -24473,8 +25909,10 @@ static const u16 sFerroseedTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sFerroseedTeachableLearnset (sFerroseedTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sFerrothornTeachableLearnset[] = {
+static const u16 sFerrothornTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA320, 0x106A, 0x41D2, 0x300E, 0xAD00, 0x0002),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BULLET_SEED,
@@ -24504,10 +25942,12 @@ static const u16 sFerrothornTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sFerrothornTeachableLearnset (sFerrothornTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_FERROSEED
 
 #if P_FAMILY_KLINK
-static const u16 sKlinkTeachableLearnset[] = {
+static const u16 sKlinkTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA020, 0x5020, 0x00C2, 0x1008, 0x2C00, 0x0002),
     MOVE_DOUBLE_TEAM,
     MOVE_FACADE,
     MOVE_HYPER_BEAM,
@@ -24525,8 +25965,10 @@ static const u16 sKlinkTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sKlinkTeachableLearnset (sKlinkTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sKlangTeachableLearnset[] = {
+static const u16 sKlangTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA020, 0x5020, 0x00C2, 0x1008, 0x2C00, 0x0002),
     MOVE_DOUBLE_TEAM,
     MOVE_FACADE,
     MOVE_HYPER_BEAM,
@@ -24544,8 +25986,10 @@ static const u16 sKlangTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sKlangTeachableLearnset (sKlangTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sKlinklangTeachableLearnset[] = {
+static const u16 sKlinklangTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA020, 0x5060, 0x00C2, 0x1008, 0x2C00, 0x0002),
     MOVE_DOUBLE_TEAM,
     MOVE_FACADE,
     MOVE_HYPER_BEAM,
@@ -24564,15 +26008,19 @@ static const u16 sKlinklangTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sKlinklangTeachableLearnset (sKlinklangTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_KLINK
 
 #if P_FAMILY_TYNAMO
-static const u16 sTynamoTeachableLearnset[] = {
+static const u16 sTynamoTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002),
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sTynamoTeachableLearnset (sTynamoTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sEelektrikTeachableLearnset[] = {
+static const u16 sEelektrikTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC020, 0x5073, 0x01C0, 0x1044, 0x2C00, 0x0002),
     MOVE_ATTRACT,
     MOVE_DOUBLE_TEAM,
     MOVE_FACADE,
@@ -24595,8 +26043,10 @@ static const u16 sEelektrikTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sEelektrikTeachableLearnset (sEelektrikTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sEelektrossTeachableLearnset[] = {
+static const u16 sEelektrossTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE2B3, 0xD873, 0x41C8, 0x504E, 0x6C80, 0x0003),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_BULK_UP,
@@ -24635,10 +26085,12 @@ static const u16 sEelektrossTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sEelektrossTeachableLearnset (sEelektrossTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_TYNAMO
 
 #if P_FAMILY_ELGYEM
-static const u16 sElgyemTeachableLearnset[] = {
+static const u16 sElgyemTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC028, 0x7625, 0x1FC8, 0x1404, 0x2CC0, 0x0002),
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
     MOVE_DOUBLE_TEAM,
@@ -24670,8 +26122,10 @@ static const u16 sElgyemTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sElgyemTeachableLearnset (sElgyemTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sBeheeyemTeachableLearnset[] = {
+static const u16 sBeheeyemTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE028, 0x7625, 0x1FC8, 0x1404, 0x2CC0, 0x0002),
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
     MOVE_DOUBLE_TEAM,
@@ -24704,10 +26158,12 @@ static const u16 sBeheeyemTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sBeheeyemTeachableLearnset (sBeheeyemTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_ELGYEM
 
 #if P_FAMILY_LITWICK
-static const u16 sLitwickTeachableLearnset[] = {
+static const u16 sLitwickTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8628, 0xD60C, 0x23C4, 0x1404, 0x2C40, 0x0000),
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
     MOVE_DOUBLE_TEAM,
@@ -24735,8 +26191,10 @@ static const u16 sLitwickTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sLitwickTeachableLearnset (sLitwickTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sLampentTeachableLearnset[] = {
+static const u16 sLampentTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8628, 0xD60C, 0x23C4, 0x1404, 0x2C40, 0x0000),
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
     MOVE_DOUBLE_TEAM,
@@ -24764,8 +26222,10 @@ static const u16 sLampentTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sLampentTeachableLearnset (sLampentTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sChandelureTeachableLearnset[] = {
+static const u16 sChandelureTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA628, 0xD60C, 0x23C4, 0x1404, 0x2C40, 0x0000),
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
     MOVE_DOUBLE_TEAM,
@@ -24794,10 +26254,12 @@ static const u16 sChandelureTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sChandelureTeachableLearnset (sChandelureTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_LITWICK
 
 #if P_FAMILY_AXEW
-static const u16 sAxewTeachableLearnset[] = {
+static const u16 sAxewTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8632, 0x5911, 0x41D8, 0x128B, 0xEC00, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -24829,8 +26291,10 @@ static const u16 sAxewTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sAxewTeachableLearnset (sAxewTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sFraxureTeachableLearnset[] = {
+static const u16 sFraxureTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8632, 0x5911, 0x41D8, 0x128B, 0xEC00, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -24862,8 +26326,10 @@ static const u16 sFraxureTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sFraxureTeachableLearnset (sFraxureTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sHaxorusTeachableLearnset[] = {
+static const u16 sHaxorusTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA632, 0x5991, 0x41D8, 0x12CB, 0xEC80, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -24899,10 +26365,12 @@ static const u16 sHaxorusTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sHaxorusTeachableLearnset (sHaxorusTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_AXEW
 
 #if P_FAMILY_CUBCHOO
-static const u16 sCubchooTeachableLearnset[] = {
+static const u16 sCubchooTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9C65, 0x1101, 0x43D8, 0x104B, 0x2CAF, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
@@ -24937,8 +26405,10 @@ static const u16 sCubchooTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sCubchooTeachableLearnset (sCubchooTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sBearticTeachableLearnset[] = {
+static const u16 sBearticTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xBCF5, 0x1981, 0x43D8, 0x126B, 0xACAF, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
@@ -24981,10 +26451,12 @@ static const u16 sBearticTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sBearticTeachableLearnset (sBearticTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_CUBCHOO
 
 #if P_FAMILY_CRYOGONAL
-static const u16 sCryogonalTeachableLearnset[] = {
+static const u16 sCryogonalTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xF864, 0x3009, 0x01C0, 0x3040, 0x2C02, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_DOUBLE_TEAM,
@@ -25009,10 +26481,12 @@ static const u16 sCryogonalTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sCryogonalTeachableLearnset (sCryogonalTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_CRYOGONAL
 
 #if P_FAMILY_SHELMET
-static const u16 sShelmetTeachableLearnset[] = {
+static const u16 sShelmetTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8020, 0x1003, 0x01C1, 0x1240, 0x2C20, 0x0000),
     MOVE_ATTRACT,
     MOVE_DOUBLE_TEAM,
     MOVE_FACADE,
@@ -25031,8 +26505,10 @@ static const u16 sShelmetTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sShelmetTeachableLearnset (sShelmetTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sAccelgorTeachableLearnset[] = {
+static const u16 sAccelgorTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA020, 0x1003, 0x01C3, 0x1240, 0x6C20, 0x0000),
     MOVE_ATTRACT,
     MOVE_DOUBLE_TEAM,
     MOVE_FACADE,
@@ -25054,10 +26530,12 @@ static const u16 sAccelgorTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sAccelgorTeachableLearnset (sAccelgorTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_SHELMET
 
 #if P_FAMILY_STUNFISK
-static const u16 sStunfiskTeachableLearnset[] = {
+static const u16 sStunfiskTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8024, 0x51E1, 0x01CB, 0x1005, 0x2CA0, 0x0002),
     MOVE_ATTRACT,
     MOVE_DIG,
     MOVE_DOUBLE_TEAM,
@@ -25085,9 +26563,11 @@ static const u16 sStunfiskTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sStunfiskTeachableLearnset (sStunfiskTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
 #if P_GALARIAN_FORMS
-static const u16 sStunfiskGalarTeachableLearnset[] = {
+static const u16 sStunfiskGalarTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8000, 0x0181, 0x01CB, 0x1081, 0x0CA0, 0x0002),
     MOVE_ATTRACT,
     MOVE_DIG,
     MOVE_EARTHQUAKE,
@@ -25108,11 +26588,13 @@ static const u16 sStunfiskGalarTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sStunfiskGalarTeachableLearnset (sStunfiskGalarTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_GALARIAN_FORMS
 #endif //P_FAMILY_STUNFISK
 
 #if P_FAMILY_MIENFOO
-static const u16 sMienfooTeachableLearnset[] = {
+static const u16 sMienfooTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x86A9, 0x3901, 0x01D8, 0x100A, 0xECCC, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -25144,8 +26626,10 @@ static const u16 sMienfooTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sMienfooTeachableLearnset (sMienfooTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sMienshaoTeachableLearnset[] = {
+static const u16 sMienshaoTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA6A9, 0x3901, 0x01D8, 0x120A, 0xECCC, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -25179,10 +26663,12 @@ static const u16 sMienshaoTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sMienshaoTeachableLearnset (sMienshaoTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_MIENFOO
 
 #if P_FAMILY_DRUDDIGON
-static const u16 sDruddigonTeachableLearnset[] = {
+static const u16 sDruddigonTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA632, 0xD191, 0x51F9, 0x504B, 0x2C88, 0x0001),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_CUT,
@@ -25220,10 +26706,12 @@ static const u16 sDruddigonTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sDruddigonTeachableLearnset (sDruddigonTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_DRUDDIGON
 
 #if P_FAMILY_GOLETT
-static const u16 sGolettTeachableLearnset[] = {
+static const u16 sGolettTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8A21, 0x7F85, 0x02CA, 0x5B4E, 0x2DEF, 0x0001),
     MOVE_BRICK_BREAK,
     MOVE_DIG,
     MOVE_DOUBLE_TEAM,
@@ -25267,8 +26755,10 @@ static const u16 sGolettTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sGolettTeachableLearnset (sGolettTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sGolurkTeachableLearnset[] = {
+static const u16 sGolurkTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xAA21, 0x7FAD, 0x82CA, 0x5B4E, 0x2DEF, 0x0001),
     MOVE_BRICK_BREAK,
     MOVE_DIG,
     MOVE_DOUBLE_TEAM,
@@ -25316,10 +26806,12 @@ static const u16 sGolurkTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sGolurkTeachableLearnset (sGolurkTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_GOLETT
 
 #if P_FAMILY_PAWNIARD
-static const u16 sPawniardTeachableLearnset[] = {
+static const u16 sPawniardTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8420, 0x1901, 0x53FA, 0x9008, 0xAC00, 0x0002),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -25347,8 +26839,10 @@ static const u16 sPawniardTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sPawniardTeachableLearnset (sPawniardTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sBisharpTeachableLearnset[] = {
+static const u16 sBisharpTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA420, 0x1901, 0x53FA, 0x9008, 0xAC00, 0x0002),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -25377,9 +26871,11 @@ static const u16 sBisharpTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sBisharpTeachableLearnset (sBisharpTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
 #if P_GEN_9_CROSS_EVOS
-static const u16 sKingambitTeachableLearnset[] = {
+static const u16 sKingambitTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA400, 0x0901, 0x02FA, 0x9000, 0x8400, 0x0002),
     MOVE_AERIAL_ACE,
     MOVE_BRICK_BREAK,
     MOVE_DIG,
@@ -25400,11 +26896,13 @@ static const u16 sKingambitTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sKingambitTeachableLearnset (sKingambitTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_GEN_9_CROSS_EVOS
 #endif //P_FAMILY_PAWNIARD
 
 #if P_FAMILY_BOUFFALANT
-static const u16 sBouffalantTeachableLearnset[] = {
+static const u16 sBouffalantTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8620, 0x1081, 0x41D8, 0x104B, 0xACA0, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_CUT,
@@ -25431,10 +26929,12 @@ static const u16 sBouffalantTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sBouffalantTeachableLearnset (sBouffalantTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_BOUFFALANT
 
 #if P_FAMILY_RUFFLET
-static const u16 sRuffletTeachableLearnset[] = {
+static const u16 sRuffletTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x82A0, 0x1001, 0xC5D8, 0x124A, 0x6C80, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BULK_UP,
@@ -25461,8 +26961,10 @@ static const u16 sRuffletTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sRuffletTeachableLearnset (sRuffletTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sBraviaryTeachableLearnset[] = {
+static const u16 sBraviaryTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA2A0, 0x1001, 0xC5D8, 0x124A, 0x6C80, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BULK_UP,
@@ -25490,9 +26992,11 @@ static const u16 sBraviaryTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sBraviaryTeachableLearnset (sBraviaryTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
 #if P_HISUIAN_FORMS
-static const u16 sBraviaryHisuiTeachableLearnset[] = {
+static const u16 sBraviaryHisuiTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA288, 0x0601, 0x80D8, 0x1248, 0x44C2, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_BULK_UP,
     MOVE_CALM_MIND,
@@ -25517,11 +27021,13 @@ static const u16 sBraviaryHisuiTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sBraviaryHisuiTeachableLearnset (sBraviaryHisuiTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_HISUIAN_FORMS
 #endif //P_FAMILY_RUFFLET
 
 #if P_FAMILY_VULLABY
-static const u16 sVullabyTeachableLearnset[] = {
+static const u16 sVullabyTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8620, 0x1401, 0xD7F8, 0x1208, 0x6C40, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_CUT,
@@ -25550,8 +27056,10 @@ static const u16 sVullabyTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sVullabyTeachableLearnset (sVullabyTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sMandibuzzTeachableLearnset[] = {
+static const u16 sMandibuzzTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA620, 0x1401, 0xD7FA, 0x1208, 0x6C40, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_CUT,
@@ -25582,10 +27090,12 @@ static const u16 sMandibuzzTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sMandibuzzTeachableLearnset (sMandibuzzTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_VULLABY
 
 #if P_FAMILY_HEATMOR
-static const u16 sHeatmorTeachableLearnset[] = {
+static const u16 sHeatmorTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8621, 0x910B, 0x73DC, 0x5048, 0x2C00, 0x0001),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_CUT,
@@ -25617,10 +27127,12 @@ static const u16 sHeatmorTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sHeatmorTeachableLearnset (sHeatmorTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_HEATMOR
 
 #if P_FAMILY_DURANT
-static const u16 sDurantTeachableLearnset[] = {
+static const u16 sDurantTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8020, 0x1100, 0x41DA, 0x900A, 0x2C80, 0x0002),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_CUT,
@@ -25643,10 +27155,12 @@ static const u16 sDurantTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sDurantTeachableLearnset (sDurantTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_DURANT
 
 #if P_FAMILY_DEINO
-static const u16 sDeinoTeachableLearnset[] = {
+static const u16 sDeinoTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8630, 0x5001, 0x03E0, 0x104A, 0x2C40, 0x0002),
     MOVE_ATTRACT,
     MOVE_DOUBLE_TEAM,
     MOVE_FACADE,
@@ -25671,8 +27185,10 @@ static const u16 sDeinoTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sDeinoTeachableLearnset (sDeinoTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sZweilousTeachableLearnset[] = {
+static const u16 sZweilousTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8630, 0x5001, 0x03E0, 0x104A, 0x2C40, 0x0002),
     MOVE_ATTRACT,
     MOVE_DOUBLE_TEAM,
     MOVE_FACADE,
@@ -25697,8 +27213,10 @@ static const u16 sZweilousTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sZweilousTeachableLearnset (sZweilousTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sHydreigonTeachableLearnset[] = {
+static const u16 sHydreigonTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA630, 0xF091, 0x87EC, 0x104B, 0x2CC0, 0x0002),
     MOVE_ATTRACT,
     MOVE_DOUBLE_TEAM,
     MOVE_EARTHQUAKE,
@@ -25734,10 +27252,12 @@ static const u16 sHydreigonTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sHydreigonTeachableLearnset (sHydreigonTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_DEINO
 
 #if P_FAMILY_LARVESTA
-static const u16 sLarvestaTeachableLearnset[] = {
+static const u16 sLarvestaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC228, 0x920E, 0x21C4, 0x1240, 0x2C00, 0x0000),
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
     MOVE_DOUBLE_TEAM,
@@ -25762,8 +27282,10 @@ static const u16 sLarvestaTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sLarvestaTeachableLearnset (sLarvestaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sVolcaronaTeachableLearnset[] = {
+static const u16 sVolcaronaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE228, 0x920F, 0xA1D4, 0x1240, 0x2C00, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
@@ -25792,10 +27314,12 @@ static const u16 sVolcaronaTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sVolcaronaTeachableLearnset (sVolcaronaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_LARVESTA
 
 #if P_FAMILY_COBALION
-static const u16 sCobalionTeachableLearnset[] = {
+static const u16 sCobalionTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA638, 0x3805, 0x40D2, 0x124A, 0xEC40, 0x0002),
     MOVE_AERIAL_ACE,
     MOVE_BRICK_BREAK,
     MOVE_CALM_MIND,
@@ -25827,10 +27351,12 @@ static const u16 sCobalionTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sCobalionTeachableLearnset (sCobalionTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_COBALION
 
 #if P_FAMILY_TERRAKION
-static const u16 sTerrakionTeachableLearnset[] = {
+static const u16 sTerrakionTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA438, 0x3884, 0x40DA, 0x124A, 0xECC0, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_BRICK_BREAK,
     MOVE_CALM_MIND,
@@ -25862,10 +27388,12 @@ static const u16 sTerrakionTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sTerrakionTeachableLearnset (sTerrakionTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_TERRAKION
 
 #if P_FAMILY_VIRIZION
-static const u16 sVirizionTeachableLearnset[] = {
+static const u16 sVirizionTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE738, 0x380E, 0x40D0, 0x124E, 0xEC40, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_BRICK_BREAK,
     MOVE_BULLET_SEED,
@@ -25899,10 +27427,12 @@ static const u16 sVirizionTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sVirizionTeachableLearnset (sVirizionTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_VIRIZION
 
 #if P_FAMILY_TORNADUS
-static const u16 sTornadusTeachableLearnset[] = {
+static const u16 sTornadusTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA6A0, 0x1A11, 0x83F3, 0x104A, 0x2C12, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -25934,10 +27464,12 @@ static const u16 sTornadusTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sTornadusTeachableLearnset (sTornadusTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_TORNADUS
 
 #if P_FAMILY_THUNDURUS
-static const u16 sThundurusTeachableLearnset[] = {
+static const u16 sThundurusTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA6A0, 0x5A71, 0x83E1, 0x104A, 0x2C00, 0x0003),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_BULK_UP,
@@ -25970,10 +27502,12 @@ static const u16 sThundurusTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sThundurusTeachableLearnset (sThundurusTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_THUNDURUS
 
 #if P_FAMILY_RESHIRAM
-static const u16 sReshiramTeachableLearnset[] = {
+static const u16 sReshiramTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE232, 0xB60D, 0xE4CC, 0x124A, 0x6C80, 0x0000),
     MOVE_CUT,
     MOVE_DOUBLE_TEAM,
     MOVE_DRAGON_CLAW,
@@ -26009,10 +27543,12 @@ static const u16 sReshiramTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sReshiramTeachableLearnset (sReshiramTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_RESHIRAM
 
 #if P_FAMILY_ZEKROM
-static const u16 sZekromTeachableLearnset[] = {
+static const u16 sZekromTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE233, 0x7E65, 0xC4C8, 0x124E, 0x6C80, 0x0003),
     MOVE_BRICK_BREAK,
     MOVE_CUT,
     MOVE_DOUBLE_TEAM,
@@ -26052,10 +27588,12 @@ static const u16 sZekromTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sZekromTeachableLearnset (sZekromTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_ZEKROM
 
 #if P_FAMILY_LANDORUS
-static const u16 sLandorusTeachableLearnset[] = {
+static const u16 sLandorusTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA6A8, 0x1B91, 0x81CB, 0x304A, 0xACA0, 0x0000),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_BULK_UP,
@@ -26090,10 +27628,12 @@ static const u16 sLandorusTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sLandorusTeachableLearnset (sLandorusTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_LANDORUS
 
 #if P_FAMILY_KYUREM
-static const u16 sKyuremTeachableLearnset[] = {
+static const u16 sKyuremTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xFA72, 0x3605, 0xC4D8, 0x104A, 0x6C82, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_BLIZZARD,
     MOVE_CUT,
@@ -26129,10 +27669,12 @@ static const u16 sKyuremTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sKyuremTeachableLearnset (sKyuremTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_KYUREM
 
 #if P_FAMILY_KELDEO
-static const u16 sKeldeoTeachableLearnset[] = {
+static const u16 sKeldeoTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA67C, 0x3805, 0x40D0, 0x120B, 0xEC42, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_BRICK_BREAK,
     MOVE_CALM_MIND,
@@ -26165,10 +27707,12 @@ static const u16 sKeldeoTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sKeldeoTeachableLearnset (sKeldeoTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_KELDEO
 
 #if P_FAMILY_MELOETTA
-static const u16 sMeloettaTeachableLearnset[] = {
+static const u16 sMeloettaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE229, 0x5E65, 0x18C0, 0x540E, 0xEC51, 0x0003),
     MOVE_BRICK_BREAK,
     MOVE_CALM_MIND,
     MOVE_DOUBLE_TEAM,
@@ -26207,10 +27751,12 @@ static const u16 sMeloettaTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sMeloettaTeachableLearnset (sMeloettaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_MELOETTA
 
 #if P_FAMILY_GENESECT
-static const u16 sGenesectTeachableLearnset[] = {
+static const u16 sGenesectTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xF820, 0xF26A, 0x80D0, 0xB004, 0x6C00, 0x0002),
     MOVE_AERIAL_ACE,
     MOVE_BLIZZARD,
     MOVE_DOUBLE_TEAM,
@@ -26241,10 +27787,12 @@ static const u16 sGenesectTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sGenesectTeachableLearnset (sGenesectTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_GENESECT
 
 #if P_FAMILY_CHESPIN
-static const u16 sChespinTeachableLearnset[] = {
+static const u16 sChespinTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x87B1, 0x391B, 0x41D9, 0x114E, 0xED80, 0x0001),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -26284,8 +27832,10 @@ static const u16 sChespinTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sChespinTeachableLearnset (sChespinTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sQuilladinTeachableLearnset[] = {
+static const u16 sQuilladinTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x87B1, 0x391B, 0x41D9, 0x114E, 0xED80, 0x0001),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -26325,8 +27875,10 @@ static const u16 sQuilladinTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sQuilladinTeachableLearnset (sQuilladinTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sChesnaughtTeachableLearnset[] = {
+static const u16 sChesnaughtTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA7B3, 0x399B, 0x41D9, 0x134E, 0xEDA0, 0x0001),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -26371,10 +27923,12 @@ static const u16 sChesnaughtTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sChesnaughtTeachableLearnset (sChesnaughtTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_CHESPIN
 
 #if P_FAMILY_FENNEKIN
-static const u16 sFennekinTeachableLearnset[] = {
+static const u16 sFennekinTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC228, 0x921D, 0x6BC4, 0x1400, 0x6C60, 0x0000),
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
     MOVE_CUT,
@@ -26405,8 +27959,10 @@ static const u16 sFennekinTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sFennekinTeachableLearnset (sFennekinTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sBraixenTeachableLearnset[] = {
+static const u16 sBraixenTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC228, 0xD21D, 0x7BC4, 0x5400, 0x6C60, 0x0001),
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
     MOVE_CUT,
@@ -26441,8 +27997,10 @@ static const u16 sBraixenTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sBraixenTeachableLearnset (sBraixenTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sDelphoxTeachableLearnset[] = {
+static const u16 sDelphoxTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE228, 0xF61D, 0x7BC4, 0x5400, 0x6C70, 0x0001),
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
     MOVE_CUT,
@@ -26481,10 +28039,12 @@ static const u16 sDelphoxTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sDelphoxTeachableLearnset (sDelphoxTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_FENNEKIN
 
 #if P_FAMILY_FROAKIE
-static const u16 sFroakieTeachableLearnset[] = {
+static const u16 sFroakieTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9C24, 0x1101, 0x53D8, 0x10BB, 0x6CA2, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
@@ -26518,8 +28078,10 @@ static const u16 sFroakieTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sFroakieTeachableLearnset (sFroakieTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sFrogadierTeachableLearnset[] = {
+static const u16 sFrogadierTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9C24, 0x1101, 0x53D8, 0x10BB, 0xECA3, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
@@ -26555,8 +28117,10 @@ static const u16 sFrogadierTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sFrogadierTeachableLearnset (sFrogadierTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sGreninjaTeachableLearnset[] = {
+static const u16 sGreninjaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xBC24, 0x1901, 0x53D8, 0x10BB, 0xECA3, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
@@ -26594,10 +28158,12 @@ static const u16 sGreninjaTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sGreninjaTeachableLearnset (sGreninjaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_FROAKIE
 
 #if P_FAMILY_BUNNELBY
-static const u16 sBunnelbyTeachableLearnset[] = {
+static const u16 sBunnelbyTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x80A0, 0x1990, 0x43EB, 0x110B, 0xADA0, 0x0000),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_BULK_UP,
@@ -26629,8 +28195,10 @@ static const u16 sBunnelbyTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sBunnelbyTeachableLearnset (sBunnelbyTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sDiggersbyTeachableLearnset[] = {
+static const u16 sDiggersbyTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA0A1, 0x1990, 0x53EB, 0x514B, 0xADAD, 0x0001),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_BULK_UP,
@@ -26671,10 +28239,12 @@ static const u16 sDiggersbyTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sDiggersbyTeachableLearnset (sDiggersbyTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_BUNNELBY
 
 #if P_FAMILY_FLETCHLING
-static const u16 sFletchlingTeachableLearnset[] = {
+static const u16 sFletchlingTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8620, 0x1001, 0xB7D0, 0x1200, 0xEC00, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_DOUBLE_TEAM,
@@ -26699,8 +28269,10 @@ static const u16 sFletchlingTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sFletchlingTeachableLearnset (sFletchlingTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sFletchinderTeachableLearnset[] = {
+static const u16 sFletchinderTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8620, 0x9001, 0xB7D4, 0x1200, 0xEC00, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_DOUBLE_TEAM,
@@ -26727,8 +28299,10 @@ static const u16 sFletchinderTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sFletchinderTeachableLearnset (sFletchinderTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sTalonflameTeachableLearnset[] = {
+static const u16 sTalonflameTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA6A0, 0x9009, 0xB7D4, 0x1200, 0xEC00, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BULK_UP,
@@ -26758,19 +28332,25 @@ static const u16 sTalonflameTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sTalonflameTeachableLearnset (sTalonflameTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_FLETCHLING
 
 #if P_FAMILY_SCATTERBUG
-static const u16 sScatterbugTeachableLearnset[] = {
+static const u16 sScatterbugTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000),
     MOVE_UNAVAILABLE,
 };
+#define sScatterbugTeachableLearnset (sScatterbugTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sSpewpaTeachableLearnset[] = {
+static const u16 sSpewpaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000),
     MOVE_PROTECT,
     MOVE_UNAVAILABLE,
 };
+#define sSpewpaTeachableLearnset (sSpewpaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sVivillonTeachableLearnset[] = {
+static const u16 sVivillonTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE228, 0x120F, 0x03D0, 0x1404, 0x6C40, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
@@ -26798,10 +28378,12 @@ static const u16 sVivillonTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sVivillonTeachableLearnset (sVivillonTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_SCATTERBUG
 
 #if P_FAMILY_LITLEO
-static const u16 sLitleoTeachableLearnset[] = {
+static const u16 sLitleoTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8630, 0x9119, 0x33C4, 0x124A, 0x6C20, 0x0000),
     MOVE_ATTRACT,
     MOVE_DIG,
     MOVE_DOUBLE_TEAM,
@@ -26832,8 +28414,10 @@ static const u16 sLitleoTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sLitleoTeachableLearnset (sLitleoTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sPyroarTeachableLearnset[] = {
+static const u16 sPyroarTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA630, 0x9119, 0x33C4, 0x124A, 0x6C20, 0x0000),
     MOVE_ATTRACT,
     MOVE_DIG,
     MOVE_DOUBLE_TEAM,
@@ -26865,10 +28449,12 @@ static const u16 sPyroarTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sPyroarTeachableLearnset (sPyroarTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_LITLEO
 
 #if P_FAMILY_FLABEBE
-static const u16 sFlabebeTeachableLearnset[] = {
+static const u16 sFlabebeTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC228, 0x120F, 0x01C0, 0x1004, 0x6C00, 0x0000),
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
     MOVE_DOUBLE_TEAM,
@@ -26891,8 +28477,10 @@ static const u16 sFlabebeTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sFlabebeTeachableLearnset (sFlabebeTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sFloetteTeachableLearnset[] = {
+static const u16 sFloetteTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC228, 0x120F, 0x09C0, 0x1004, 0x6C10, 0x0000),
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
     MOVE_DOUBLE_TEAM,
@@ -26917,8 +28505,10 @@ static const u16 sFloetteTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sFloetteTeachableLearnset (sFloetteTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sFloetteEternalTeachableLearnset[] = {
+static const u16 sFloetteEternalTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC228, 0x120F, 0x09C0, 0x1004, 0x6C10, 0x0000),
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
     MOVE_DOUBLE_TEAM,
@@ -26943,8 +28533,10 @@ static const u16 sFloetteEternalTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sFloetteEternalTeachableLearnset (sFloetteEternalTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sFlorgesTeachableLearnset[] = {
+static const u16 sFlorgesTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE228, 0x120F, 0x09C0, 0x1004, 0x6C10, 0x0000),
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
     MOVE_DOUBLE_TEAM,
@@ -26970,10 +28562,12 @@ static const u16 sFlorgesTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sFlorgesTeachableLearnset (sFlorgesTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_FLABEBE
 
 #if P_FAMILY_SKIDDO
-static const u16 sSkiddoTeachableLearnset[] = {
+static const u16 sSkiddoTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x83B0, 0x191B, 0x01C0, 0x134B, 0x2DA0, 0x0000),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_BULK_UP,
@@ -27005,8 +28599,10 @@ static const u16 sSkiddoTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sSkiddoTeachableLearnset (sSkiddoTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sGogoatTeachableLearnset[] = {
+static const u16 sGogoatTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA3B0, 0x199B, 0x01D0, 0x134B, 0x2DA0, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -27041,10 +28637,12 @@ static const u16 sGogoatTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sGogoatTeachableLearnset (sGogoatTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_SKIDDO
 
 #if P_FAMILY_PANCHAM
-static const u16 sPanchamTeachableLearnset[] = {
+static const u16 sPanchamTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x86B1, 0x1901, 0x51F9, 0x504B, 0xAE8D, 0x0001),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -27083,8 +28681,10 @@ static const u16 sPanchamTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sPanchamTeachableLearnset (sPanchamTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sPangoroTeachableLearnset[] = {
+static const u16 sPangoroTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA6B3, 0x1981, 0x53F9, 0x504B, 0xAE8D, 0x0001),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -27127,10 +28727,12 @@ static const u16 sPangoroTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sPangoroTeachableLearnset (sPangoroTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_PANCHAM
 
 #if P_FAMILY_FURFROU
-static const u16 sFurfrouTeachableLearnset[] = {
+static const u16 sFurfrouTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8230, 0x1111, 0x01C0, 0x000D, 0x2C00, 0x0002),
     MOVE_ATTRACT,
     MOVE_DIG,
     MOVE_DOUBLE_TEAM,
@@ -27151,10 +28753,12 @@ static const u16 sFurfrouTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sFurfrouTeachableLearnset (sFurfrouTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_FURFROU
 
 #if P_FAMILY_ESPURR
-static const u16 sEspurrTeachableLearnset[] = {
+static const u16 sEspurrTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC228, 0x7635, 0x59E0, 0x1404, 0x6C40, 0x0002),
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
     MOVE_CUT,
@@ -27187,8 +28791,10 @@ static const u16 sEspurrTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sEspurrTeachableLearnset (sEspurrTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sMeowsticMTeachableLearnset[] = {
+static const u16 sMeowsticMTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE228, 0x7735, 0x59E0, 0x1404, 0x6C40, 0x0002),
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
     MOVE_CUT,
@@ -27223,8 +28829,10 @@ static const u16 sMeowsticMTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sMeowsticMTeachableLearnset (sMeowsticMTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sMeowsticFTeachableLearnset[] = {
+static const u16 sMeowsticFTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE228, 0x7735, 0x59E0, 0x1404, 0x6C40, 0x0002),
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
     MOVE_CUT,
@@ -27259,10 +28867,12 @@ static const u16 sMeowsticFTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sMeowsticFTeachableLearnset (sMeowsticFTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_ESPURR
 
 #if P_FAMILY_HONEDGE
-static const u16 sHonedgeTeachableLearnset[] = {
+static const u16 sHonedgeTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8020, 0x7801, 0x41D0, 0x9008, 0xAC80, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -27285,8 +28895,10 @@ static const u16 sHonedgeTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sHonedgeTeachableLearnset (sHonedgeTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sDoubladeTeachableLearnset[] = {
+static const u16 sDoubladeTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8020, 0x7801, 0x41D0, 0x9008, 0xAC80, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -27309,8 +28921,10 @@ static const u16 sDoubladeTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sDoubladeTeachableLearnset (sDoubladeTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sAegislashTeachableLearnset[] = {
+static const u16 sAegislashTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA220, 0x7C01, 0x41D0, 0x9008, 0xAC80, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -27336,10 +28950,12 @@ static const u16 sAegislashTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sAegislashTeachableLearnset (sAegislashTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_HONEDGE
 
 #if P_FAMILY_SPRITZEE
-static const u16 sSpritzeeTeachableLearnset[] = {
+static const u16 sSpritzeeTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC228, 0x3221, 0x09E0, 0x1404, 0x2C40, 0x0000),
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
     MOVE_DOUBLE_TEAM,
@@ -27364,8 +28980,10 @@ static const u16 sSpritzeeTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sSpritzeeTeachableLearnset (sSpritzeeTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sAromatisseTeachableLearnset[] = {
+static const u16 sAromatisseTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE228, 0x3261, 0x09E0, 0x1404, 0x2C50, 0x0000),
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
     MOVE_DOUBLE_TEAM,
@@ -27393,10 +29011,12 @@ static const u16 sAromatisseTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sAromatisseTeachableLearnset (sAromatisseTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_SPRITZEE
 
 #if P_FAMILY_SWIRLIX
-static const u16 sSwirlixTeachableLearnset[] = {
+static const u16 sSwirlixTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC228, 0x9225, 0x03C0, 0x1405, 0x2C40, 0x0000),
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
     MOVE_DOUBLE_TEAM,
@@ -27422,8 +29042,10 @@ static const u16 sSwirlixTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sSwirlixTeachableLearnset (sSwirlixTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sSlurpuffTeachableLearnset[] = {
+static const u16 sSlurpuffTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE228, 0x9265, 0x03C0, 0x1405, 0x2C50, 0x0000),
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
     MOVE_DOUBLE_TEAM,
@@ -27452,10 +29074,12 @@ static const u16 sSlurpuffTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sSlurpuffTeachableLearnset (sSlurpuffTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_SWIRLIX
 
 #if P_FAMILY_INKAY
-static const u16 sInkayTeachableLearnset[] = {
+static const u16 sInkayTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC628, 0xB221, 0x5BF0, 0x1004, 0x6CC0, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
@@ -27487,8 +29111,10 @@ static const u16 sInkayTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sInkayTeachableLearnset (sInkayTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sMalamarTeachableLearnset[] = {
+static const u16 sMalamarTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE628, 0xB221, 0x5BF0, 0x1004, 0x6CC0, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
@@ -27521,10 +29147,12 @@ static const u16 sMalamarTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sMalamarTeachableLearnset (sMalamarTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_INKAY
 
 #if P_FAMILY_BINACLE
-static const u16 sBinacleTeachableLearnset[] = {
+static const u16 sBinacleTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9C24, 0x1985, 0x43FB, 0x900B, 0xACA2, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
@@ -27561,8 +29189,10 @@ static const u16 sBinacleTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sBinacleTeachableLearnset (sBinacleTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sBarbaracleTeachableLearnset[] = {
+static const u16 sBarbaracleTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xBCA6, 0x1985, 0x43FB, 0x902B, 0xACA2, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
@@ -27603,10 +29233,12 @@ static const u16 sBarbaracleTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sBarbaracleTeachableLearnset (sBarbaracleTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_BINACLE
 
 #if P_FAMILY_SKRELP
-static const u16 sSkrelpTeachableLearnset[] = {
+static const u16 sSkrelpTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8064, 0x5431, 0x03C1, 0x1031, 0x2C22, 0x0000),
     MOVE_ATTRACT,
     MOVE_DIVE,
     MOVE_DOUBLE_TEAM,
@@ -27633,8 +29265,10 @@ static const u16 sSkrelpTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sSkrelpTeachableLearnset (sSkrelpTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sDragalgeTeachableLearnset[] = {
+static const u16 sDragalgeTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA064, 0x5471, 0x03C1, 0x1031, 0x2C22, 0x0000),
     MOVE_ATTRACT,
     MOVE_DIVE,
     MOVE_DOUBLE_TEAM,
@@ -27663,10 +29297,12 @@ static const u16 sDragalgeTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sDragalgeTeachableLearnset (sDragalgeTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_SKRELP
 
 #if P_FAMILY_CLAUNCHER
-static const u16 sClauncherTeachableLearnset[] = {
+static const u16 sClauncherTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9824, 0x1011, 0x43C1, 0x1031, 0xACA2, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_CUT,
@@ -27694,8 +29330,10 @@ static const u16 sClauncherTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sClauncherTeachableLearnset (sClauncherTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sClawitzerTeachableLearnset[] = {
+static const u16 sClawitzerTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xB824, 0x1411, 0x43C1, 0x1071, 0xACA2, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_CUT,
@@ -27726,10 +29364,12 @@ static const u16 sClawitzerTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sClawitzerTeachableLearnset (sClawitzerTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_CLAUNCHER
 
 #if P_FAMILY_HELIOPTILE
-static const u16 sHelioptileTeachableLearnset[] = {
+static const u16 sHelioptileTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC020, 0x5171, 0x41CA, 0x1005, 0x6CE0, 0x0002),
     MOVE_ATTRACT,
     MOVE_CUT,
     MOVE_DIG,
@@ -27759,8 +29399,10 @@ static const u16 sHelioptileTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sHelioptileTeachableLearnset (sHelioptileTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sHelioliskTeachableLearnset[] = {
+static const u16 sHelioliskTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE220, 0x5179, 0x41CA, 0x5005, 0x6CEC, 0x0003),
     MOVE_ATTRACT,
     MOVE_CUT,
     MOVE_DIG,
@@ -27797,10 +29439,12 @@ static const u16 sHelioliskTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sHelioliskTeachableLearnset (sHelioliskTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_HELIOPTILE
 
 #if P_FAMILY_TYRUNT
-static const u16 sTyruntTeachableLearnset[] = {
+static const u16 sTyruntTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8232, 0x1990, 0x01DA, 0x104A, 0x2C80, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -27827,8 +29471,10 @@ static const u16 sTyruntTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sTyruntTeachableLearnset (sTyruntTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sTyrantrumTeachableLearnset[] = {
+static const u16 sTyrantrumTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA232, 0x1990, 0x01DA, 0x104A, 0x2C80, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -27856,10 +29502,12 @@ static const u16 sTyrantrumTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sTyrantrumTeachableLearnset (sTyrantrumTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_TYRUNT
 
 #if P_FAMILY_AMAURA
-static const u16 sAmauraTeachableLearnset[] = {
+static const u16 sAmauraTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xF87C, 0x3035, 0x01CA, 0x144C, 0x2CC2, 0x0002),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_CALM_MIND,
@@ -27895,8 +29543,10 @@ static const u16 sAmauraTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sAmauraTeachableLearnset (sAmauraTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sAurorusTeachableLearnset[] = {
+static const u16 sAurorusTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xF87C, 0x32F5, 0x01CA, 0x144C, 0x2CC2, 0x0002),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_CALM_MIND,
@@ -27935,10 +29585,12 @@ static const u16 sAurorusTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sAurorusTeachableLearnset (sAurorusTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_AMAURA
 
 #if P_FAMILY_HAWLUCHA
-static const u16 sHawluchaTeachableLearnset[] = {
+static const u16 sHawluchaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA6A1, 0x1901, 0xC7F8, 0x504A, 0xEC8C, 0x0001),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -27976,10 +29628,12 @@ static const u16 sHawluchaTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sHawluchaTeachableLearnset (sHawluchaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_HAWLUCHA
 
 #if P_FAMILY_DEDENNE
-static const u16 sDedenneTeachableLearnset[] = {
+static const u16 sDedenneTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE220, 0x5171, 0x43D0, 0x1004, 0x6C00, 0x0003),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_CUT,
@@ -28008,10 +29662,12 @@ static const u16 sDedenneTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sDedenneTeachableLearnset (sDedenneTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_DEDENNE
 
 #if P_FAMILY_CARBINK
-static const u16 sCarbinkTeachableLearnset[] = {
+static const u16 sCarbinkTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE268, 0x3205, 0x08CA, 0x3244, 0x2CC0, 0x0000),
     MOVE_CALM_MIND,
     MOVE_DOUBLE_TEAM,
     MOVE_FACADE,
@@ -28041,10 +29697,12 @@ static const u16 sCarbinkTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sCarbinkTeachableLearnset (sCarbinkTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_CARBINK
 
 #if P_FAMILY_GOOMY
-static const u16 sGoomyTeachableLearnset[] = {
+static const u16 sGoomyTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8224, 0x5031, 0x01C1, 0x10C0, 0x2C80, 0x0000),
     MOVE_ATTRACT,
     MOVE_DOUBLE_TEAM,
     MOVE_FACADE,
@@ -28067,8 +29725,10 @@ static const u16 sGoomyTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sGoomyTeachableLearnset (sGoomyTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sSliggooTeachableLearnset[] = {
+static const u16 sSliggooTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9A24, 0x5071, 0x01C1, 0x10C0, 0x2C80, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_DOUBLE_TEAM,
@@ -28094,8 +29754,10 @@ static const u16 sSliggooTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sSliggooTeachableLearnset (sSliggooTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sGoodraTeachableLearnset[] = {
+static const u16 sGoodraTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xBA67, 0xD0F1, 0x01C5, 0x50CB, 0x2C8C, 0x0001),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_DOUBLE_TEAM,
@@ -28135,9 +29797,11 @@ static const u16 sGoodraTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sGoodraTeachableLearnset (sGoodraTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
 #if P_HISUIAN_FORMS
-static const u16 sSliggooHisuiTeachableLearnset[] = {
+static const u16 sSliggooHisuiTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9A04, 0x0071, 0x00CB, 0x10C0, 0x0480, 0x0000),
     MOVE_BLIZZARD,
     MOVE_FACADE,
     MOVE_ICE_BEAM,
@@ -28159,8 +29823,10 @@ static const u16 sSliggooHisuiTeachableLearnset[] = {
     MOVE_SLEEP_TALK,
     MOVE_UNAVAILABLE,
 };
+#define sSliggooHisuiTeachableLearnset (sSliggooHisuiTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sGoodraHisuiTeachableLearnset[] = {
+static const u16 sGoodraHisuiTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xBA06, 0x80F1, 0x00CF, 0x50C9, 0x0480, 0x0001),
     MOVE_BLIZZARD,
     MOVE_DRAGON_CLAW,
     MOVE_EARTHQUAKE,
@@ -28191,11 +29857,13 @@ static const u16 sGoodraHisuiTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sGoodraHisuiTeachableLearnset (sGoodraHisuiTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_HISUIAN_FORMS
 #endif //P_FAMILY_GOOMY
 
 #if P_FAMILY_KLEFKI
-static const u16 sKlefkiTeachableLearnset[] = {
+static const u16 sKlefkiTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE228, 0x3205, 0x43E2, 0x1000, 0x6C40, 0x0002),
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
     MOVE_CUT,
@@ -28223,10 +29891,12 @@ static const u16 sKlefkiTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sKlefkiTeachableLearnset (sKlefkiTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_KLEFKI
 
 #if P_FAMILY_PHANTUMP
-static const u16 sPhantumpTeachableLearnset[] = {
+static const u16 sPhantumpTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8220, 0x370F, 0x4BC0, 0x140A, 0x2CC0, 0x0000),
     MOVE_ATTRACT,
     MOVE_CUT,
     MOVE_DIG,
@@ -28256,8 +29926,10 @@ static const u16 sPhantumpTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sPhantumpTeachableLearnset (sPhantumpTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sTrevenantTeachableLearnset[] = {
+static const u16 sTrevenantTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA228, 0x378F, 0x4BC0, 0x140A, 0x2CC0, 0x0000),
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
     MOVE_CUT,
@@ -28290,10 +29962,12 @@ static const u16 sTrevenantTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sTrevenantTeachableLearnset (sTrevenantTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_PHANTUMP
 
 #if P_FAMILY_PUMPKABOO
-static const u16 sPumpkabooTeachableLearnset[] = {
+static const u16 sPumpkabooTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC320, 0x960E, 0x0BC5, 0x340C, 0x2C80, 0x0000),
     MOVE_ATTRACT,
     MOVE_BULLET_SEED,
     MOVE_DOUBLE_TEAM,
@@ -28324,8 +29998,10 @@ static const u16 sPumpkabooTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sPumpkabooTeachableLearnset (sPumpkabooTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sGourgeistTeachableLearnset[] = {
+static const u16 sGourgeistTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE320, 0x960E, 0x0BC5, 0x340C, 0x2C80, 0x0000),
     MOVE_ATTRACT,
     MOVE_BULLET_SEED,
     MOVE_DOUBLE_TEAM,
@@ -28357,10 +30033,12 @@ static const u16 sGourgeistTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sGourgeistTeachableLearnset (sGourgeistTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_PUMPKABOO
 
 #if P_FAMILY_BERGMITE
-static const u16 sBergmiteTeachableLearnset[] = {
+static const u16 sBergmiteTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9864, 0x1005, 0x01C8, 0x124F, 0x2C82, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_DOUBLE_TEAM,
@@ -28388,8 +30066,10 @@ static const u16 sBergmiteTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sBergmiteTeachableLearnset (sBergmiteTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sAvaluggTeachableLearnset[] = {
+static const u16 sAvaluggTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xB874, 0x1085, 0x01C8, 0x124F, 0x2C82, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_DOUBLE_TEAM,
@@ -28420,9 +30100,11 @@ static const u16 sAvaluggTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sAvaluggTeachableLearnset (sAvaluggTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
 #if P_HISUIAN_FORMS
-static const u16 sAvaluggHisuiTeachableLearnset[] = {
+static const u16 sAvaluggHisuiTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xB804, 0x0181, 0x00CA, 0x1248, 0x0482, 0x0000),
     MOVE_BLIZZARD,
     MOVE_DIG,
     MOVE_EARTHQUAKE,
@@ -28444,11 +30126,13 @@ static const u16 sAvaluggHisuiTeachableLearnset[] = {
     MOVE_SLEEP_TALK,
     MOVE_UNAVAILABLE,
 };
+#define sAvaluggHisuiTeachableLearnset (sAvaluggHisuiTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_HISUIAN_FORMS
 #endif //P_FAMILY_BERGMITE
 
 #if P_FAMILY_NOIBAT
-static const u16 sNoibatTeachableLearnset[] = {
+static const u16 sNoibatTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8626, 0x1E18, 0xD7F0, 0x1400, 0x6C00, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -28479,8 +30163,10 @@ static const u16 sNoibatTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sNoibatTeachableLearnset (sNoibatTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sNoivernTeachableLearnset[] = {
+static const u16 sNoivernTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA626, 0x9E18, 0xD7F0, 0x1640, 0x6C00, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -28515,10 +30201,12 @@ static const u16 sNoivernTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sNoivernTeachableLearnset (sNoivernTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_NOIBAT
 
 #if P_FAMILY_XERNEAS
-static const u16 sXerneasTeachableLearnset[] = {
+static const u16 sXerneasTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE278, 0x3261, 0x40C0, 0x1044, 0x6CC0, 0x0002),
     MOVE_CALM_MIND,
     MOVE_CUT,
     MOVE_DOUBLE_TEAM,
@@ -28548,10 +30236,12 @@ static const u16 sXerneasTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sXerneasTeachableLearnset (sXerneasTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_XERNEAS
 
 #if P_FAMILY_YVELTAL
-static const u16 sYveltalTeachableLearnset[] = {
+static const u16 sYveltalTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA622, 0x1601, 0xC6F0, 0x1440, 0x6C80, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_CUT,
     MOVE_DOUBLE_TEAM,
@@ -28580,10 +30270,12 @@ static const u16 sYveltalTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sYveltalTeachableLearnset (sYveltalTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_YVELTAL
 
 #if P_FAMILY_ZYGARDE
-static const u16 sZygardeTeachableLearnset[] = {
+static const u16 sZygardeTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA220, 0x5994, 0x00C2, 0x104A, 0x6C80, 0x0000),
     MOVE_BRICK_BREAK,
     MOVE_DIG,
     MOVE_DOUBLE_TEAM,
@@ -28609,10 +30301,12 @@ static const u16 sZygardeTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sZygardeTeachableLearnset (sZygardeTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_ZYGARDE
 
 #if P_FAMILY_DIANCIE
-static const u16 sDiancieTeachableLearnset[] = {
+static const u16 sDiancieTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE268, 0x3205, 0x08CA, 0x3044, 0x6CD0, 0x0000),
     MOVE_CALM_MIND,
     MOVE_DOUBLE_TEAM,
     MOVE_FACADE,
@@ -28643,10 +30337,12 @@ static const u16 sDiancieTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sDiancieTeachableLearnset (sDiancieTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_DIANCIE
 
 #if P_FAMILY_HOOPA
-static const u16 sHoopaConfinedTeachableLearnset[] = {
+static const u16 sHoopaConfinedTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE629, 0x7E25, 0x1AEA, 0x5404, 0x6C41, 0x0003),
     MOVE_BRICK_BREAK,
     MOVE_CALM_MIND,
     MOVE_DOUBLE_TEAM,
@@ -28686,8 +30382,10 @@ static const u16 sHoopaConfinedTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sHoopaConfinedTeachableLearnset (sHoopaConfinedTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sHoopaUnboundTeachableLearnset[] = {
+static const u16 sHoopaUnboundTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE629, 0x7E25, 0x1AEA, 0x5404, 0x6C41, 0x0003),
     MOVE_BRICK_BREAK,
     MOVE_CALM_MIND,
     MOVE_DOUBLE_TEAM,
@@ -28727,10 +30425,12 @@ static const u16 sHoopaUnboundTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sHoopaUnboundTeachableLearnset (sHoopaUnboundTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_HOOPA
 
 #if P_FAMILY_VOLCANION
-static const u16 sVolcanionTeachableLearnset[] = {
+static const u16 sVolcanionTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA634, 0x9989, 0x60CF, 0x324A, 0x2C80, 0x0000),
     MOVE_BRICK_BREAK,
     MOVE_CUT,
     MOVE_DIG,
@@ -28765,10 +30465,12 @@ static const u16 sVolcanionTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sVolcanionTeachableLearnset (sVolcanionTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_VOLCANION
 
 #if P_FAMILY_ROWLET
-static const u16 sRowletTeachableLearnset[] = {
+static const u16 sRowletTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC320, 0x100F, 0x05D0, 0x1000, 0xEC00, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BULLET_SEED,
@@ -28792,8 +30494,10 @@ static const u16 sRowletTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sRowletTeachableLearnset (sRowletTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sDartrixTeachableLearnset[] = {
+static const u16 sDartrixTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC320, 0x100F, 0x05D0, 0x1000, 0xEC00, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BULLET_SEED,
@@ -28817,8 +30521,10 @@ static const u16 sDartrixTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sDartrixTeachableLearnset (sDartrixTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sDecidueyeTeachableLearnset[] = {
+static const u16 sDecidueyeTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE320, 0x140F, 0x05D0, 0x1000, 0xEC00, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BULLET_SEED,
@@ -28844,9 +30550,11 @@ static const u16 sDecidueyeTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sDecidueyeTeachableLearnset (sDecidueyeTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
 #if P_HISUIAN_FORMS
-static const u16 sDecidueyeHisuiTeachableLearnset[] = {
+static const u16 sDecidueyeHisuiTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE781, 0x180B, 0x00D8, 0x1008, 0xC400, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_BRICK_BREAK,
     MOVE_BULK_UP,
@@ -28871,11 +30579,13 @@ static const u16 sDecidueyeHisuiTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sDecidueyeHisuiTeachableLearnset (sDecidueyeHisuiTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_HISUIAN_FORMS
 #endif //P_FAMILY_ROWLET
 
 #if P_FAMILY_LITTEN
-static const u16 sLittenTeachableLearnset[] = {
+static const u16 sLittenTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x86B0, 0x9000, 0x21E4, 0x1240, 0xAC00, 0x0000),
     MOVE_ATTRACT,
     MOVE_BULK_UP,
     MOVE_DOUBLE_TEAM,
@@ -28899,8 +30609,10 @@ static const u16 sLittenTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sLittenTeachableLearnset (sLittenTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sTorracatTeachableLearnset[] = {
+static const u16 sTorracatTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x86B0, 0x9000, 0x21E4, 0x1240, 0xAC00, 0x0000),
     MOVE_ATTRACT,
     MOVE_BULK_UP,
     MOVE_DOUBLE_TEAM,
@@ -28924,8 +30636,10 @@ static const u16 sTorracatTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sTorracatTeachableLearnset (sTorracatTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sIncineroarTeachableLearnset[] = {
+static const u16 sIncineroarTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA6B1, 0x9880, 0x33F4, 0x5240, 0xAC0C, 0x0001),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -28960,10 +30674,12 @@ static const u16 sIncineroarTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sIncineroarTeachableLearnset (sIncineroarTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_LITTEN
 
 #if P_FAMILY_POPPLIO
-static const u16 sPopplioTeachableLearnset[] = {
+static const u16 sPopplioTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9864, 0x1011, 0x01C0, 0x1031, 0x6C02, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_DIVE,
@@ -28987,8 +30703,10 @@ static const u16 sPopplioTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sPopplioTeachableLearnset (sPopplioTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sBrionneTeachableLearnset[] = {
+static const u16 sBrionneTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9864, 0x1011, 0x01C0, 0x1071, 0x6C02, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_DIVE,
@@ -29013,8 +30731,10 @@ static const u16 sBrionneTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sBrionneTeachableLearnset (sBrionneTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sPrimarinaTeachableLearnset[] = {
+static const u16 sPrimarinaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xF86C, 0x3611, 0x01C0, 0x1071, 0x6C42, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_CALM_MIND,
@@ -29046,10 +30766,12 @@ static const u16 sPrimarinaTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sPrimarinaTeachableLearnset (sPrimarinaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_POPPLIO
 
 #if P_FAMILY_PIKIPEK
-static const u16 sPikipekTeachableLearnset[] = {
+static const u16 sPikipekTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8320, 0x1800, 0x87D0, 0x1008, 0xAC00, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -29071,8 +30793,10 @@ static const u16 sPikipekTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sPikipekTeachableLearnset (sPikipekTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sTrumbeakTeachableLearnset[] = {
+static const u16 sTrumbeakTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8320, 0x1800, 0x87D0, 0x1008, 0xEC00, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -29095,8 +30819,10 @@ static const u16 sTrumbeakTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sTrumbeakTeachableLearnset (sTrumbeakTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sToucannonTeachableLearnset[] = {
+static const u16 sToucannonTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA320, 0x1800, 0xA7D0, 0x1008, 0xEC40, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -29122,10 +30848,12 @@ static const u16 sToucannonTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sToucannonTeachableLearnset (sToucannonTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_PIKIPEK
 
 #if P_FAMILY_YUNGOOS
-static const u16 sYungoosTeachableLearnset[] = {
+static const u16 sYungoosTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8620, 0x5191, 0x03EA, 0x1200, 0x2C20, 0x0000),
     MOVE_ATTRACT,
     MOVE_DIG,
     MOVE_DOUBLE_TEAM,
@@ -29151,8 +30879,10 @@ static const u16 sYungoosTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sYungoosTeachableLearnset (sYungoosTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sGumshoosTeachableLearnset[] = {
+static const u16 sGumshoosTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA631, 0x5191, 0x03EA, 0x5240, 0x2C21, 0x0001),
     MOVE_ATTRACT,
     MOVE_DIG,
     MOVE_DOUBLE_TEAM,
@@ -29185,10 +30915,12 @@ static const u16 sGumshoosTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sGumshoosTeachableLearnset (sGumshoosTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_YUNGOOS
 
 #if P_FAMILY_GRUBBIN
-static const u16 sGrubbinTeachableLearnset[] = {
+static const u16 sGrubbinTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC020, 0x5121, 0x01C0, 0x1000, 0x2C20, 0x0002),
     MOVE_ATTRACT,
     MOVE_DIG,
     MOVE_DOUBLE_TEAM,
@@ -29208,8 +30940,10 @@ static const u16 sGrubbinTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sGrubbinTeachableLearnset (sGrubbinTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sCharjabugTeachableLearnset[] = {
+static const u16 sCharjabugTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC020, 0x5161, 0x01C0, 0x1000, 0x2C20, 0x0002),
     MOVE_ATTRACT,
     MOVE_DIG,
     MOVE_DOUBLE_TEAM,
@@ -29230,8 +30964,10 @@ static const u16 sCharjabugTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sCharjabugTeachableLearnset (sCharjabugTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sVikavoltTeachableLearnset[] = {
+static const u16 sVikavoltTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE020, 0x5169, 0x81C0, 0x1000, 0x6C20, 0x0002),
     MOVE_ATTRACT,
     MOVE_DIG,
     MOVE_DOUBLE_TEAM,
@@ -29256,10 +30992,12 @@ static const u16 sVikavoltTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sVikavoltTeachableLearnset (sVikavoltTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_GRUBBIN
 
 #if P_FAMILY_CRABRAWLER
-static const u16 sCrabrawlerTeachableLearnset[] = {
+static const u16 sCrabrawlerTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x82A1, 0x1981, 0x03C8, 0x1848, 0x6CA1, 0x0001),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_BULK_UP,
@@ -29289,8 +31027,10 @@ static const u16 sCrabrawlerTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sCrabrawlerTeachableLearnset (sCrabrawlerTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sCrabominableTeachableLearnset[] = {
+static const u16 sCrabominableTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xBAE1, 0x1981, 0x03C8, 0x1848, 0x6CA3, 0x0001),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_BRICK_BREAK,
@@ -29325,10 +31065,12 @@ static const u16 sCrabominableTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sCrabominableTeachableLearnset (sCrabominableTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_CRABRAWLER
 
 #if P_FAMILY_ORICORIO
-static const u16 sOricorioTeachableLearnset[] = {
+static const u16 sOricorioTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8628, 0x1005, 0x85D2, 0x1000, 0xEC42, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
@@ -29354,10 +31096,12 @@ static const u16 sOricorioTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sOricorioTeachableLearnset (sOricorioTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_ORICORIO
 
 #if P_FAMILY_CUTIEFLY
-static const u16 sCutieflyTeachableLearnset[] = {
+static const u16 sCutieflyTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC228, 0x3204, 0x0BD0, 0x1400, 0x6C40, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
@@ -29382,8 +31126,10 @@ static const u16 sCutieflyTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sCutieflyTeachableLearnset (sCutieflyTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sRibombeeTeachableLearnset[] = {
+static const u16 sRibombeeTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE228, 0x320C, 0x0BD0, 0x1400, 0x6C40, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
@@ -29410,10 +31156,12 @@ static const u16 sRibombeeTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sRibombeeTeachableLearnset (sRibombeeTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_CUTIEFLY
 
 #if P_FAMILY_ROCKRUFF
-static const u16 sRockruffTeachableLearnset[] = {
+static const u16 sRockruffTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8430, 0x1110, 0x01CA, 0x1240, 0xACA0, 0x0000),
     MOVE_ATTRACT,
     MOVE_DIG,
     MOVE_DOUBLE_TEAM,
@@ -29437,8 +31185,10 @@ static const u16 sRockruffTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sRockruffTeachableLearnset (sRockruffTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sLycanrocMiddayTeachableLearnset[] = {
+static const u16 sLycanrocMiddayTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x86B0, 0x1910, 0x01CA, 0x1240, 0xECA0, 0x0000),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_BULK_UP,
@@ -29466,8 +31216,10 @@ static const u16 sLycanrocMiddayTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sLycanrocMiddayTeachableLearnset (sLycanrocMiddayTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sLycanrocMidnightTeachableLearnset[] = {
+static const u16 sLycanrocMidnightTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x86B1, 0x1910, 0x01CA, 0x52C0, 0xACAC, 0x0001),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_BULK_UP,
@@ -29500,8 +31252,10 @@ static const u16 sLycanrocMidnightTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sLycanrocMidnightTeachableLearnset (sLycanrocMidnightTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sLycanrocDuskTeachableLearnset[] = {
+static const u16 sLycanrocDuskTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x84B0, 0x1910, 0x01CA, 0x12C0, 0xACA0, 0x0000),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_BULK_UP,
@@ -29528,10 +31282,12 @@ static const u16 sLycanrocDuskTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sLycanrocDuskTeachableLearnset (sLycanrocDuskTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_ROCKRUFF
 
 #if P_FAMILY_WISHIWASHI
-static const u16 sWishiwashiTeachableLearnset[] = {
+static const u16 sWishiwashiTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8864, 0x1091, 0x01C0, 0x1231, 0x2C00, 0x0000),
     MOVE_ATTRACT,
     MOVE_DIVE,
     MOVE_DOUBLE_TEAM,
@@ -29554,10 +31310,12 @@ static const u16 sWishiwashiTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sWishiwashiTeachableLearnset (sWishiwashiTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_WISHIWASHI
 
 #if P_FAMILY_MAREANIE
-static const u16 sMareanieTeachableLearnset[] = {
+static const u16 sMareanieTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9864, 0x1005, 0x11C1, 0x1001, 0x2C02, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_DOUBLE_TEAM,
@@ -29580,8 +31338,10 @@ static const u16 sMareanieTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sMareanieTeachableLearnset (sMareanieTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sToxapexTeachableLearnset[] = {
+static const u16 sToxapexTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xF864, 0x1005, 0x11C1, 0x1041, 0x2C02, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_DOUBLE_TEAM,
@@ -29607,10 +31367,12 @@ static const u16 sToxapexTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sToxapexTeachableLearnset (sToxapexTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_MAREANIE
 
 #if P_FAMILY_MUDBRAY
-static const u16 sMudbrayTeachableLearnset[] = {
+static const u16 sMudbrayTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8230, 0x1080, 0x01CA, 0x12CA, 0x2CA4, 0x0000),
     MOVE_ATTRACT,
     MOVE_DOUBLE_TEAM,
     MOVE_EARTHQUAKE,
@@ -29636,8 +31398,10 @@ static const u16 sMudbrayTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sMudbrayTeachableLearnset (sMudbrayTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sMudsdaleTeachableLearnset[] = {
+static const u16 sMudsdaleTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA230, 0x1080, 0x01CA, 0x12CA, 0x2CA4, 0x0000),
     MOVE_ATTRACT,
     MOVE_DOUBLE_TEAM,
     MOVE_EARTHQUAKE,
@@ -29664,10 +31428,12 @@ static const u16 sMudsdaleTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sMudsdaleTeachableLearnset (sMudsdaleTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_MUDBRAY
 
 #if P_FAMILY_DEWPIDER
-static const u16 sDewpiderTeachableLearnset[] = {
+static const u16 sDewpiderTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9824, 0x1003, 0x01C0, 0x1011, 0x2C02, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_DOUBLE_TEAM,
@@ -29688,8 +31454,10 @@ static const u16 sDewpiderTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sDewpiderTeachableLearnset (sDewpiderTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sAraquanidTeachableLearnset[] = {
+static const u16 sAraquanidTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xB824, 0x3007, 0x01C0, 0x1071, 0x2C02, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_DIVE,
@@ -29715,10 +31483,12 @@ static const u16 sAraquanidTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sAraquanidTeachableLearnset (sAraquanidTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_DEWPIDER
 
 #if P_FAMILY_FOMANTIS
-static const u16 sFomantisTeachableLearnset[] = {
+static const u16 sFomantisTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8320, 0x100E, 0x01C0, 0x9000, 0xAC00, 0x0000),
     MOVE_ATTRACT,
     MOVE_BULLET_SEED,
     MOVE_DOUBLE_TEAM,
@@ -29738,8 +31508,10 @@ static const u16 sFomantisTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sFomantisTeachableLearnset (sFomantisTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sLurantisTeachableLearnset[] = {
+static const u16 sLurantisTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA320, 0x180F, 0x01D0, 0x9000, 0xAC00, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -29763,10 +31535,12 @@ static const u16 sLurantisTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sLurantisTeachableLearnset (sLurantisTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_FOMANTIS
 
 #if P_FAMILY_MORELULL
-static const u16 sMorelullTeachableLearnset[] = {
+static const u16 sMorelullTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC220, 0x100E, 0x01C1, 0x1404, 0x2C00, 0x0002),
     MOVE_ATTRACT,
     MOVE_DOUBLE_TEAM,
     MOVE_FACADE,
@@ -29788,8 +31562,10 @@ static const u16 sMorelullTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sMorelullTeachableLearnset (sMorelullTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sShiinoticTeachableLearnset[] = {
+static const u16 sShiinoticTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE220, 0x100F, 0x01C1, 0x1404, 0x2C00, 0x0002),
     MOVE_ATTRACT,
     MOVE_DOUBLE_TEAM,
     MOVE_FACADE,
@@ -29813,10 +31589,12 @@ static const u16 sShiinoticTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sShiinoticTeachableLearnset (sShiinoticTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_MORELULL
 
 #if P_FAMILY_SALANDIT
-static const u16 sSalanditTeachableLearnset[] = {
+static const u16 sSalanditTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8622, 0x9010, 0x33E5, 0x1000, 0x6C20, 0x0002),
     MOVE_ATTRACT,
     MOVE_DOUBLE_TEAM,
     MOVE_DRAGON_CLAW,
@@ -29843,8 +31621,10 @@ static const u16 sSalanditTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sSalanditTeachableLearnset (sSalanditTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sSalazzleTeachableLearnset[] = {
+static const u16 sSalazzleTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA622, 0x9010, 0x33E5, 0x1040, 0x6C20, 0x0002),
     MOVE_ATTRACT,
     MOVE_DOUBLE_TEAM,
     MOVE_DRAGON_CLAW,
@@ -29873,10 +31653,12 @@ static const u16 sSalazzleTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sSalazzleTeachableLearnset (sSalazzleTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_SALANDIT
 
 #if P_FAMILY_STUFFUL
-static const u16 sStuffulTeachableLearnset[] = {
+static const u16 sStuffulTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x84B1, 0x1880, 0x01D8, 0x1302, 0xAD8D, 0x0001),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -29907,8 +31689,10 @@ static const u16 sStuffulTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sStuffulTeachableLearnset (sStuffulTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sBewearTeachableLearnset[] = {
+static const u16 sBewearTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA4B3, 0x1880, 0x01D8, 0x1342, 0xAD8D, 0x0001),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -29942,10 +31726,12 @@ static const u16 sBewearTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sBewearTeachableLearnset (sBewearTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_STUFFUL
 
 #if P_FAMILY_BOUNSWEET
-static const u16 sBounsweetTeachableLearnset[] = {
+static const u16 sBounsweetTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC320, 0x300E, 0x01C0, 0x1000, 0x6C00, 0x0000),
     MOVE_ATTRACT,
     MOVE_BULLET_SEED,
     MOVE_DOUBLE_TEAM,
@@ -29966,8 +31752,10 @@ static const u16 sBounsweetTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sBounsweetTeachableLearnset (sBounsweetTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sSteeneeTeachableLearnset[] = {
+static const u16 sSteeneeTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC320, 0x300E, 0x01C0, 0x1000, 0x6C00, 0x0000),
     MOVE_ATTRACT,
     MOVE_BULLET_SEED,
     MOVE_DOUBLE_TEAM,
@@ -29988,8 +31776,10 @@ static const u16 sSteeneeTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sSteeneeTeachableLearnset (sSteeneeTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sTsareenaTeachableLearnset[] = {
+static const u16 sTsareenaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE720, 0x300E, 0x01C0, 0x1000, 0x6C04, 0x0000),
     MOVE_ATTRACT,
     MOVE_BULLET_SEED,
     MOVE_DOUBLE_TEAM,
@@ -30013,10 +31803,12 @@ static const u16 sTsareenaTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sTsareenaTeachableLearnset (sTsareenaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_BOUNSWEET
 
 #if P_FAMILY_COMFEY
-static const u16 sComfeyTeachableLearnset[] = {
+static const u16 sComfeyTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE728, 0x100E, 0x03C0, 0x1000, 0x6C40, 0x0000),
     MOVE_ATTRACT,
     MOVE_BULLET_SEED,
     MOVE_CALM_MIND,
@@ -30041,10 +31833,12 @@ static const u16 sComfeyTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sComfeyTeachableLearnset (sComfeyTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_COMFEY
 
 #if P_FAMILY_ORANGURU
-static const u16 sOranguruTeachableLearnset[] = {
+static const u16 sOranguruTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE628, 0x3EE5, 0x19C0, 0x1440, 0x6CCC, 0x0000),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_CALM_MIND,
@@ -30080,10 +31874,12 @@ static const u16 sOranguruTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sOranguruTeachableLearnset (sOranguruTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_ORANGURU
 
 #if P_FAMILY_PASSIMIAN
-static const u16 sPassimianTeachableLearnset[] = {
+static const u16 sPassimianTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA6A1, 0x5C91, 0x13D8, 0x12C8, 0x2E8C, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -30119,10 +31915,12 @@ static const u16 sPassimianTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sPassimianTeachableLearnset (sPassimianTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_PASSIMIAN
 
 #if P_FAMILY_WIMPOD
-static const u16 sWimpodTeachableLearnset[] = {
+static const u16 sWimpodTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8460, 0x1001, 0x01C0, 0x1111, 0x6D00, 0x0000),
     MOVE_ATTRACT,
     MOVE_DOUBLE_TEAM,
     MOVE_FACADE,
@@ -30143,8 +31941,10 @@ static const u16 sWimpodTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sWimpodTeachableLearnset (sWimpodTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sGolisopodTeachableLearnset[] = {
+static const u16 sGolisopodTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xBCE4, 0x1801, 0x01D9, 0x9139, 0xEDC2, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
@@ -30181,10 +31981,12 @@ static const u16 sGolisopodTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sGolisopodTeachableLearnset (sGolisopodTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_WIMPOD
 
 #if P_FAMILY_SANDYGAST
-static const u16 sSandygastTeachableLearnset[] = {
+static const u16 sSandygastTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8220, 0x1683, 0x09CB, 0x1000, 0x2CA0, 0x0000),
     MOVE_ATTRACT,
     MOVE_DOUBLE_TEAM,
     MOVE_EARTHQUAKE,
@@ -30209,8 +32011,10 @@ static const u16 sSandygastTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sSandygastTeachableLearnset (sSandygastTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sPalossandTeachableLearnset[] = {
+static const u16 sPalossandTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA220, 0x1683, 0x09CB, 0x1040, 0x2CA0, 0x0000),
     MOVE_ATTRACT,
     MOVE_DOUBLE_TEAM,
     MOVE_EARTHQUAKE,
@@ -30237,10 +32041,12 @@ static const u16 sPalossandTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sPalossandTeachableLearnset (sPalossandTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_SANDYGAST
 
 #if P_FAMILY_PYUKUMUKU
-static const u16 sPyukumukuTeachableLearnset[] = {
+static const u16 sPyukumukuTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC460, 0x3005, 0x0180, 0x1080, 0x2440, 0x0000),
     MOVE_ATTRACT,
     MOVE_DOUBLE_TEAM,
     MOVE_HAIL,
@@ -30259,10 +32065,12 @@ static const u16 sPyukumukuTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sPyukumukuTeachableLearnset (sPyukumukuTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_PYUKUMUKU
 
 #if P_FAMILY_TYPE_NULL
-static const u16 sTypeNullTeachableLearnset[] = {
+static const u16 sTypeNullTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA272, 0x1001, 0x00D2, 0x1200, 0xEC82, 0x0002),
     MOVE_AERIAL_ACE,
     MOVE_DOUBLE_TEAM,
     MOVE_DRAGON_CLAW,
@@ -30288,8 +32096,10 @@ static const u16 sTypeNullTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sTypeNullTeachableLearnset (sTypeNullTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sSilvallyTeachableLearnset[] = {
+static const u16 sSilvallyTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xAA72, 0x9421, 0x04D2, 0x3201, 0xEC82, 0x0002),
     MOVE_AERIAL_ACE,
     MOVE_DOUBLE_TEAM,
     MOVE_DRAGON_CLAW,
@@ -30322,10 +32132,12 @@ static const u16 sSilvallyTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sSilvallyTeachableLearnset (sSilvallyTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_TYPE_NULL
 
 #if P_FAMILY_MINIOR
-static const u16 sMiniorTeachableLearnset[] = {
+static const u16 sMiniorTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE028, 0x328C, 0x01CA, 0x3300, 0x6DC0, 0x0000),
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
     MOVE_DOUBLE_TEAM,
@@ -30355,10 +32167,12 @@ static const u16 sMiniorTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sMiniorTeachableLearnset (sMiniorTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_MINIOR
 
 #if P_FAMILY_KOMALA
-static const u16 sKomalaTeachableLearnset[] = {
+static const u16 sKomalaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA2A8, 0x1881, 0x0348, 0x1340, 0xADC0, 0x0000),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_BULK_UP,
@@ -30386,10 +32200,12 @@ static const u16 sKomalaTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sKomalaTeachableLearnset (sKomalaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_KOMALA
 
 #if P_FAMILY_TURTONATOR
-static const u16 sTurtonatorTeachableLearnset[] = {
+static const u16 sTurtonatorTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA6B2, 0xD098, 0x21CC, 0x3040, 0x2C0C, 0x0000),
     MOVE_ATTRACT,
     MOVE_BULK_UP,
     MOVE_DOUBLE_TEAM,
@@ -30420,10 +32236,12 @@ static const u16 sTurtonatorTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sTurtonatorTeachableLearnset (sTurtonatorTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_TURTONATOR
 
 #if P_FAMILY_TOGEDEMARU
-static const u16 sTogedemaruTeachableLearnset[] = {
+static const u16 sTogedemaruTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA020, 0x7070, 0x03C0, 0x1100, 0x6D00, 0x0002),
     MOVE_ATTRACT,
     MOVE_DOUBLE_TEAM,
     MOVE_FACADE,
@@ -30447,10 +32265,12 @@ static const u16 sTogedemaruTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sTogedemaruTeachableLearnset (sTogedemaruTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_TOGEDEMARU
 
 #if P_FAMILY_MIMIKYU
-static const u16 sMimikyuTeachableLearnset[] = {
+static const u16 sMimikyuTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE6A0, 0x1667, 0x13C0, 0x1400, 0xAC40, 0x0002),
     MOVE_ATTRACT,
     MOVE_BULK_UP,
     MOVE_DOUBLE_TEAM,
@@ -30481,10 +32301,12 @@ static const u16 sMimikyuTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sMimikyuTeachableLearnset (sMimikyuTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_MIMIKYU
 
 #if P_FAMILY_BRUXISH
-static const u16 sBruxishTeachableLearnset[] = {
+static const u16 sBruxishTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xFCAC, 0x3215, 0x11F0, 0x1411, 0xAC02, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
@@ -30518,10 +32340,12 @@ static const u16 sBruxishTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sBruxishTeachableLearnset (sBruxishTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_BRUXISH
 
 #if P_FAMILY_DRAMPA
-static const u16 sDrampaTeachableLearnset[] = {
+static const u16 sDrampaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xFA3E, 0xD4ED, 0x85C4, 0x1001, 0x4CC2, 0x0002),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_CALM_MIND,
@@ -30560,10 +32384,12 @@ static const u16 sDrampaTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sDrampaTeachableLearnset (sDrampaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_DRAMPA
 
 #if P_FAMILY_DHELMISE
-static const u16 sDhelmiseTeachableLearnset[] = {
+static const u16 sDhelmiseTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA220, 0x1C8B, 0x03D0, 0x1001, 0xAC80, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -30589,10 +32415,12 @@ static const u16 sDhelmiseTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sDhelmiseTeachableLearnset (sDhelmiseTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_DHELMISE
 
 #if P_FAMILY_JANGMO_O
-static const u16 sJangmoOTeachableLearnset[] = {
+static const u16 sJangmoOTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x84B3, 0x1894, 0x01DA, 0x10C0, 0xAC80, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -30621,8 +32449,10 @@ static const u16 sJangmoOTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sJangmoOTeachableLearnset (sJangmoOTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sHakamoOTeachableLearnset[] = {
+static const u16 sHakamoOTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x86B3, 0x1894, 0x01DA, 0x12C0, 0xAC8C, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -30655,8 +32485,10 @@ static const u16 sHakamoOTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sHakamoOTeachableLearnset (sHakamoOTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sKommoOTeachableLearnset[] = {
+static const u16 sKommoOTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA6B7, 0xD895, 0x01DA, 0x52C0, 0xAC8D, 0x0001),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -30697,10 +32529,12 @@ static const u16 sKommoOTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sKommoOTeachableLearnset (sKommoOTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_JANGMO_O
 
 #if P_FAMILY_TAPU_KOKO
-static const u16 sTapuKokoTeachableLearnset[] = {
+static const u16 sTapuKokoTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE438, 0x7065, 0x86F0, 0x1000, 0x6C40, 0x0003),
     MOVE_AERIAL_ACE,
     MOVE_CALM_MIND,
     MOVE_DOUBLE_TEAM,
@@ -30732,10 +32566,12 @@ static const u16 sTapuKokoTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sTapuKokoTeachableLearnset (sTapuKokoTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_TAPU_KOKO
 
 #if P_FAMILY_TAPU_LELE
-static const u16 sTapuLeleTeachableLearnset[] = {
+static const u16 sTapuLeleTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE628, 0x3664, 0x0AE0, 0x1000, 0x2C40, 0x0000),
     MOVE_CALM_MIND,
     MOVE_DOUBLE_TEAM,
     MOVE_FACADE,
@@ -30762,10 +32598,12 @@ static const u16 sTapuLeleTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sTapuLeleTeachableLearnset (sTapuLeleTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_TAPU_LELE
 
 #if P_FAMILY_TAPU_BULU
-static const u16 sTapuBuluTeachableLearnset[] = {
+static const u16 sTapuBuluTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE7B9, 0x280E, 0x00E8, 0x1008, 0xACC8, 0x0000),
     MOVE_BRICK_BREAK,
     MOVE_BULK_UP,
     MOVE_BULLET_SEED,
@@ -30797,10 +32635,12 @@ static const u16 sTapuBuluTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sTapuBuluTeachableLearnset (sTapuBuluTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_TAPU_BULU
 
 #if P_FAMILY_TAPU_FINI
-static const u16 sTapuFiniTeachableLearnset[] = {
+static const u16 sTapuFiniTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xFC2C, 0x3405, 0x00E0, 0x1031, 0x2C43, 0x0000),
     MOVE_BLIZZARD,
     MOVE_CALM_MIND,
     MOVE_DIVE,
@@ -30830,18 +32670,24 @@ static const u16 sTapuFiniTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sTapuFiniTeachableLearnset (sTapuFiniTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_TAPU_FINI
 
 #if P_FAMILY_COSMOG
-static const u16 sCosmogTeachableLearnset[] = {
+static const u16 sCosmogTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000),
     MOVE_UNAVAILABLE,
 };
+#define sCosmogTeachableLearnset (sCosmogTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sCosmoemTeachableLearnset[] = {
+static const u16 sCosmoemTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000),
     MOVE_UNAVAILABLE,
 };
+#define sCosmoemTeachableLearnset (sCosmoemTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sSolgaleoTeachableLearnset[] = {
+static const u16 sSolgaleoTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE238, 0xF2FC, 0x00CC, 0x1240, 0x6CC0, 0x0002),
     MOVE_CALM_MIND,
     MOVE_DOUBLE_TEAM,
     MOVE_EARTHQUAKE,
@@ -30876,8 +32722,10 @@ static const u16 sSolgaleoTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sSolgaleoTeachableLearnset (sSolgaleoTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sLunalaTeachableLearnset[] = {
+static const u16 sLunalaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xFA38, 0x766D, 0x80D0, 0x1400, 0x6C42, 0x0002),
     MOVE_AERIAL_ACE,
     MOVE_BLIZZARD,
     MOVE_CALM_MIND,
@@ -30912,10 +32760,12 @@ static const u16 sLunalaTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sLunalaTeachableLearnset (sLunalaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_COSMOG
 
 #if P_FAMILY_NIHILEGO
-static const u16 sNihilegoTeachableLearnset[] = {
+static const u16 sNihilegoTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC020, 0x3264, 0x00CB, 0x1040, 0x2C80, 0x0002),
     MOVE_DOUBLE_TEAM,
     MOVE_FACADE,
     MOVE_LIGHT_SCREEN,
@@ -30939,10 +32789,12 @@ static const u16 sNihilegoTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sNihilegoTeachableLearnset (sNihilegoTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_NIHILEGO
 
 #if P_FAMILY_BUZZWOLE
-static const u16 sBuzzwoleTeachableLearnset[] = {
+static const u16 sBuzzwoleTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x84A1, 0x1880, 0x00C8, 0x18C0, 0x2C89, 0x0001),
     MOVE_BRICK_BREAK,
     MOVE_BULK_UP,
     MOVE_DOUBLE_TEAM,
@@ -30967,10 +32819,12 @@ static const u16 sBuzzwoleTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sBuzzwoleTeachableLearnset (sBuzzwoleTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_BUZZWOLE
 
 #if P_FAMILY_PHEROMOSA
-static const u16 sPheromosaTeachableLearnset[] = {
+static const u16 sPheromosaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xBC20, 0x5800, 0x10E0, 0x1000, 0x6C02, 0x0000),
     MOVE_BLIZZARD,
     MOVE_BRICK_BREAK,
     MOVE_DOUBLE_TEAM,
@@ -30992,10 +32846,12 @@ static const u16 sPheromosaTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sPheromosaTeachableLearnset (sPheromosaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_PHEROMOSA
 
 #if P_FAMILY_XURKITREE
-static const u16 sXurkitreeTeachableLearnset[] = {
+static const u16 sXurkitreeTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE228, 0x7069, 0x00C0, 0x1000, 0x2C00, 0x0003),
     MOVE_CALM_MIND,
     MOVE_DOUBLE_TEAM,
     MOVE_FACADE,
@@ -31019,10 +32875,12 @@ static const u16 sXurkitreeTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sXurkitreeTeachableLearnset (sXurkitreeTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_XURKITREE
 
 #if P_FAMILY_CELESTEELA
-static const u16 sCelesteelaTeachableLearnset[] = {
+static const u16 sCelesteelaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA020, 0xD08A, 0x80C4, 0x3240, 0x2C80, 0x0000),
     MOVE_DOUBLE_TEAM,
     MOVE_EARTHQUAKE,
     MOVE_FACADE,
@@ -31046,10 +32904,12 @@ static const u16 sCelesteelaTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sCelesteelaTeachableLearnset (sCelesteelaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_CELESTEELA
 
 #if P_FAMILY_KARTANA
-static const u16 sKartanaTeachableLearnset[] = {
+static const u16 sKartanaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8028, 0x1802, 0x4090, 0x9000, 0xAC00, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_BRICK_BREAK,
     MOVE_CALM_MIND,
@@ -31067,10 +32927,12 @@ static const u16 sKartanaTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sKartanaTeachableLearnset (sKartanaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_KARTANA
 
 #if P_FAMILY_GUZZLORD
-static const u16 sGuzzlordTeachableLearnset[] = {
+static const u16 sGuzzlordTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA022, 0xD890, 0x02CD, 0x1040, 0x0C8C, 0x0000),
     MOVE_BRICK_BREAK,
     MOVE_DOUBLE_TEAM,
     MOVE_DRAGON_CLAW,
@@ -31096,10 +32958,12 @@ static const u16 sGuzzlordTeachableLearnset[] = {
     MOVE_SNORE,
     MOVE_UNAVAILABLE,
 };
+#define sGuzzlordTeachableLearnset (sGuzzlordTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_GUZZLORD
 
 #if P_FAMILY_NECROZMA
-static const u16 sNecrozmaTeachableLearnset[] = {
+static const u16 sNecrozmaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE228, 0x7A88, 0x02DA, 0x1040, 0xEC80, 0x0002),
     MOVE_AERIAL_ACE,
     MOVE_BRICK_BREAK,
     MOVE_CALM_MIND,
@@ -31130,10 +32994,12 @@ static const u16 sNecrozmaTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sNecrozmaTeachableLearnset (sNecrozmaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_NECROZMA
 
 #if P_FAMILY_MAGEARNA
-static const u16 sMagearnaTeachableLearnset[] = {
+static const u16 sMagearnaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xEA08, 0x7E28, 0x08C0, 0x3140, 0x6D00, 0x0002),
     MOVE_BRICK_BREAK,
     MOVE_CALM_MIND,
     MOVE_DOUBLE_TEAM,
@@ -31163,10 +33029,12 @@ static const u16 sMagearnaTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sMagearnaTeachableLearnset (sMagearnaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_MAGEARNA
 
 #if P_FAMILY_MARSHADOW
-static const u16 sMarshadowTeachableLearnset[] = {
+static const u16 sMarshadowTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA0A9, 0x1C00, 0x12C8, 0x5080, 0x6CCD, 0x0001),
     MOVE_BRICK_BREAK,
     MOVE_BULK_UP,
     MOVE_CALM_MIND,
@@ -31196,10 +33064,12 @@ static const u16 sMarshadowTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sMarshadowTeachableLearnset (sMarshadowTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_MARSHADOW
 
 #if P_FAMILY_POIPOLE
-static const u16 sPoipoleTeachableLearnset[] = {
+static const u16 sPoipoleTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8020, 0x0010, 0x10C1, 0x1000, 0x0C00, 0x0000),
     MOVE_FACADE,
     MOVE_IRON_TAIL,
     MOVE_PROTECT,
@@ -31212,8 +33082,10 @@ static const u16 sPoipoleTeachableLearnset[] = {
     MOVE_SNORE,
     MOVE_UNAVAILABLE,
 };
+#define sPoipoleTeachableLearnset (sPoipoleTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sNaganadelTeachableLearnset[] = {
+static const u16 sNaganadelTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA022, 0xD030, 0x92D5, 0x1000, 0x4C00, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_DOUBLE_TEAM,
     MOVE_DRAGON_CLAW,
@@ -31237,10 +33109,12 @@ static const u16 sNaganadelTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sNaganadelTeachableLearnset (sNaganadelTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_POIPOLE
 
 #if P_FAMILY_STAKATAKA
-static const u16 sStakatakaTeachableLearnset[] = {
+static const u16 sStakatakaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC020, 0x2084, 0x08CA, 0x1240, 0x0C84, 0x0000),
     MOVE_EARTHQUAKE,
     MOVE_FACADE,
     MOVE_LIGHT_SCREEN,
@@ -31261,10 +33135,12 @@ static const u16 sStakatakaTeachableLearnset[] = {
     MOVE_SNORE,
     MOVE_UNAVAILABLE,
 };
+#define sStakatakaTeachableLearnset (sStakatakaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_STAKATAKA
 
 #if P_FAMILY_BLACEPHALON
-static const u16 sBlacephalonTeachableLearnset[] = {
+static const u16 sBlacephalonTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE628, 0x9608, 0x22E4, 0x7000, 0x2C00, 0x0000),
     MOVE_CALM_MIND,
     MOVE_DOUBLE_TEAM,
     MOVE_FACADE,
@@ -31291,10 +33167,12 @@ static const u16 sBlacephalonTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sBlacephalonTeachableLearnset (sBlacephalonTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_BLACEPHALON
 
 #if P_FAMILY_ZERAORA
-static const u16 sZeraoraTeachableLearnset[] = {
+static const u16 sZeraoraTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA4A9, 0x5870, 0x10D0, 0x5000, 0x4C0C, 0x0003),
     MOVE_AERIAL_ACE,
     MOVE_BRICK_BREAK,
     MOVE_BULK_UP,
@@ -31323,10 +33201,12 @@ static const u16 sZeraoraTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sZeraoraTeachableLearnset (sZeraoraTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_ZERAORA
 
 #if P_FAMILY_MELTAN
-static const u16 sMeltanTeachableLearnset[] = {
+static const u16 sMeltanTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8020, 0x0020, 0x00C0, 0x1000, 0x0C00, 0x0002),
     MOVE_FACADE,
     MOVE_PROTECT,
     MOVE_REST,
@@ -31338,8 +33218,10 @@ static const u16 sMeltanTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sMeltanTeachableLearnset (sMeltanTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sMelmetalTeachableLearnset[] = {
+static const u16 sMelmetalTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA820, 0x08E8, 0x00C8, 0x1840, 0x0C8D, 0x0003),
     MOVE_BRICK_BREAK,
     MOVE_EARTHQUAKE,
     MOVE_FACADE,
@@ -31365,10 +33247,12 @@ static const u16 sMelmetalTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sMelmetalTeachableLearnset (sMelmetalTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_MELTAN
 
 #if P_FAMILY_GROOKEY
-static const u16 sGrookeyTeachableLearnset[] = {
+static const u16 sGrookeyTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8700, 0x000A, 0x03C0, 0x1042, 0xCC0C, 0x0000),
     MOVE_ATTRACT,
     MOVE_BULLET_SEED,
     MOVE_FACADE,
@@ -31390,8 +33274,10 @@ static const u16 sGrookeyTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sGrookeyTeachableLearnset (sGrookeyTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sThwackeyTeachableLearnset[] = {
+static const u16 sThwackeyTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8700, 0x000A, 0x03C0, 0x1242, 0xCC0C, 0x0000),
     MOVE_ATTRACT,
     MOVE_BULLET_SEED,
     MOVE_FACADE,
@@ -31414,8 +33300,10 @@ static const u16 sThwackeyTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sThwackeyTeachableLearnset (sThwackeyTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sRillaboomTeachableLearnset[] = {
+static const u16 sRillaboomTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA781, 0x088A, 0x03C0, 0x1242, 0xCC0C, 0x0000),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_BULK_UP,
@@ -31443,10 +33331,12 @@ static const u16 sRillaboomTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sRillaboomTeachableLearnset (sRillaboomTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_GROOKEY
 
 #if P_FAMILY_SCORBUNNY
-static const u16 sScorbunnyTeachableLearnset[] = {
+static const u16 sScorbunnyTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8600, 0x8000, 0x21C4, 0x1280, 0x4C04, 0x0000),
     MOVE_ATTRACT,
     MOVE_FACADE,
     MOVE_FIRE_BLAST,
@@ -31465,8 +33355,10 @@ static const u16 sScorbunnyTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sScorbunnyTeachableLearnset (sScorbunnyTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sRabootTeachableLearnset[] = {
+static const u16 sRabootTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8680, 0x8000, 0x21C4, 0x1280, 0xCC04, 0x0000),
     MOVE_ATTRACT,
     MOVE_BULK_UP,
     MOVE_FACADE,
@@ -31487,8 +33379,10 @@ static const u16 sRabootTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sRabootTeachableLearnset (sRabootTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sCinderaceTeachableLearnset[] = {
+static const u16 sCinderaceTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA680, 0x8400, 0x21C4, 0x5280, 0xCC24, 0x0000),
     MOVE_ATTRACT,
     MOVE_BULK_UP,
     MOVE_FACADE,
@@ -31513,10 +33407,12 @@ static const u16 sCinderaceTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sCinderaceTeachableLearnset (sCinderaceTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_SCORBUNNY
 
 #if P_FAMILY_SOBBLE
-static const u16 sSobbleTeachableLearnset[] = {
+static const u16 sSobbleTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC004, 0x3005, 0x01C0, 0x1031, 0x4C00, 0x0000),
     MOVE_ATTRACT,
     MOVE_DIVE,
     MOVE_DOUBLE_TEAM,
@@ -31536,8 +33432,10 @@ static const u16 sSobbleTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sSobbleTeachableLearnset (sSobbleTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sDrizzileTeachableLearnset[] = {
+static const u16 sDrizzileTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC004, 0x3005, 0x01C0, 0x1031, 0x4C00, 0x0000),
     MOVE_ATTRACT,
     MOVE_DIVE,
     MOVE_DOUBLE_TEAM,
@@ -31557,8 +33455,10 @@ static const u16 sDrizzileTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sDrizzileTeachableLearnset (sDrizzileTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sInteleonTeachableLearnset[] = {
+static const u16 sInteleonTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xFC04, 0x3405, 0x01C0, 0x1031, 0xCC52, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_DIVE,
@@ -31587,10 +33487,12 @@ static const u16 sInteleonTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sInteleonTeachableLearnset (sInteleonTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_SOBBLE
 
 #if P_FAMILY_SKWOVET
-static const u16 sSkwovetTeachableLearnset[] = {
+static const u16 sSkwovetTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8100, 0x0110, 0x03C0, 0x13C0, 0x0D20, 0x0000),
     MOVE_ATTRACT,
     MOVE_BULLET_SEED,
     MOVE_DIG,
@@ -31610,8 +33512,10 @@ static const u16 sSkwovetTeachableLearnset[] = {
     MOVE_SNORE,
     MOVE_UNAVAILABLE,
 };
+#define sSkwovetTeachableLearnset (sSkwovetTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sGreedentTeachableLearnset[] = {
+static const u16 sGreedentTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA300, 0x0191, 0x03C0, 0x13C0, 0x8D20, 0x0000),
     MOVE_ATTRACT,
     MOVE_BULLET_SEED,
     MOVE_DIG,
@@ -31636,10 +33540,12 @@ static const u16 sGreedentTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sGreedentTeachableLearnset (sGreedentTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_SKWOVET
 
 #if P_FAMILY_ROOKIDEE
-static const u16 sRookideeTeachableLearnset[] = {
+static const u16 sRookideeTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8400, 0x0000, 0x83D0, 0x1008, 0x6C00, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_FACADE,
@@ -31656,8 +33562,10 @@ static const u16 sRookideeTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sRookideeTeachableLearnset (sRookideeTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sCorvisquireTeachableLearnset[] = {
+static const u16 sCorvisquireTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8600, 0x0000, 0x83D0, 0x1008, 0x6C00, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_FACADE,
@@ -31675,8 +33583,10 @@ static const u16 sCorvisquireTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sCorvisquireTeachableLearnset (sCorvisquireTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sCorviknightTeachableLearnset[] = {
+static const u16 sCorviknightTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE680, 0x2001, 0x87D0, 0x1248, 0x6C00, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BULK_UP,
@@ -31702,14 +33612,18 @@ static const u16 sCorviknightTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sCorviknightTeachableLearnset (sCorviknightTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_ROOKIDEE
 
 #if P_FAMILY_BLIPBUG
-static const u16 sBlipbugTeachableLearnset[] = {
+static const u16 sBlipbugTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000),
     MOVE_UNAVAILABLE,
 };
+#define sBlipbugTeachableLearnset (sBlipbugTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sDottlerTeachableLearnset[] = {
+static const u16 sDottlerTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC008, 0x260C, 0x09C0, 0x1000, 0x0C00, 0x0000),
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
     MOVE_FACADE,
@@ -31727,8 +33641,10 @@ static const u16 sDottlerTeachableLearnset[] = {
     MOVE_SNORE,
     MOVE_UNAVAILABLE,
 };
+#define sDottlerTeachableLearnset (sDottlerTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sOrbeetleTeachableLearnset[] = {
+static const u16 sOrbeetleTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE008, 0x260E, 0x09C0, 0x1000, 0x0C00, 0x0000),
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
     MOVE_FACADE,
@@ -31748,10 +33664,12 @@ static const u16 sOrbeetleTeachableLearnset[] = {
     MOVE_SNORE,
     MOVE_UNAVAILABLE,
 };
+#define sOrbeetleTeachableLearnset (sOrbeetleTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_BLIPBUG
 
 #if P_FAMILY_NICKIT
-static const u16 sNickitTeachableLearnset[] = {
+static const u16 sNickitTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8400, 0x0100, 0x03E0, 0x1000, 0x4C00, 0x0000),
     MOVE_ATTRACT,
     MOVE_DIG,
     MOVE_FACADE,
@@ -31766,8 +33684,10 @@ static const u16 sNickitTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sNickitTeachableLearnset (sNickitTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sThievulTeachableLearnset[] = {
+static const u16 sThievulTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA400, 0x0700, 0x03E0, 0x1000, 0x4C00, 0x0000),
     MOVE_ATTRACT,
     MOVE_DIG,
     MOVE_FACADE,
@@ -31785,10 +33705,12 @@ static const u16 sThievulTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sThievulTeachableLearnset (sThievulTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_NICKIT
 
 #if P_FAMILY_GOSSIFLEUR
-static const u16 sGossifleurTeachableLearnset[] = {
+static const u16 sGossifleurTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC300, 0x000A, 0x01C0, 0x1000, 0x0C00, 0x0000),
     MOVE_ATTRACT,
     MOVE_BULLET_SEED,
     MOVE_FACADE,
@@ -31803,8 +33725,10 @@ static const u16 sGossifleurTeachableLearnset[] = {
     MOVE_SNORE,
     MOVE_UNAVAILABLE,
 };
+#define sGossifleurTeachableLearnset (sGossifleurTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sEldegossTeachableLearnset[] = {
+static const u16 sEldegossTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE300, 0x000A, 0x01C0, 0x1000, 0x0C00, 0x0000),
     MOVE_ATTRACT,
     MOVE_BULLET_SEED,
     MOVE_FACADE,
@@ -31820,10 +33744,12 @@ static const u16 sEldegossTeachableLearnset[] = {
     MOVE_SNORE,
     MOVE_UNAVAILABLE,
 };
+#define sEldegossTeachableLearnset (sEldegossTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_GOSSIFLEUR
 
 #if P_FAMILY_WOOLOO
-static const u16 sWoolooTeachableLearnset[] = {
+static const u16 sWoolooTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8000, 0x0000, 0x01C0, 0x1380, 0x2C00, 0x0002),
     MOVE_ATTRACT,
     MOVE_FACADE,
     MOVE_PROTECT,
@@ -31838,8 +33764,10 @@ static const u16 sWoolooTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sWoolooTeachableLearnset (sWoolooTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sDubwoolTeachableLearnset[] = {
+static const u16 sDubwoolTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA000, 0x0000, 0x01C0, 0x13C0, 0xAC04, 0x0002),
     MOVE_ATTRACT,
     MOVE_FACADE,
     MOVE_HYPER_BEAM,
@@ -31858,10 +33786,12 @@ static const u16 sDubwoolTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sDubwoolTeachableLearnset (sDubwoolTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_WOOLOO
 
 #if P_FAMILY_CHEWTLE
-static const u16 sChewtleTeachableLearnset[] = {
+static const u16 sChewtleTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8004, 0x0001, 0x01C0, 0x10F1, 0x0C00, 0x0000),
     MOVE_ATTRACT,
     MOVE_DIVE,
     MOVE_FACADE,
@@ -31878,8 +33808,10 @@ static const u16 sChewtleTeachableLearnset[] = {
     MOVE_SNORE,
     MOVE_UNAVAILABLE,
 };
+#define sChewtleTeachableLearnset (sChewtleTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sDrednawTeachableLearnset[] = {
+static const u16 sDrednawTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xB804, 0x0191, 0x01CA, 0x12F1, 0x8C80, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_DIG,
@@ -31907,10 +33839,12 @@ static const u16 sDrednawTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sDrednawTeachableLearnset (sDrednawTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_CHEWTLE
 
 #if P_FAMILY_YAMPER
-static const u16 sYamperTeachableLearnset[] = {
+static const u16 sYamperTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8010, 0x0160, 0x01C0, 0x1200, 0x4C00, 0x0002),
     MOVE_ATTRACT,
     MOVE_DIG,
     MOVE_FACADE,
@@ -31927,8 +33861,10 @@ static const u16 sYamperTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sYamperTeachableLearnset (sYamperTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sBoltundTeachableLearnset[] = {
+static const u16 sBoltundTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA090, 0x0160, 0x01C0, 0x1200, 0x4C00, 0x0002),
     MOVE_ATTRACT,
     MOVE_BULK_UP,
     MOVE_DIG,
@@ -31947,10 +33883,12 @@ static const u16 sBoltundTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sBoltundTeachableLearnset (sBoltundTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_YAMPER
 
 #if P_FAMILY_ROLYCOLY
-static const u16 sRolycolyTeachableLearnset[] = {
+static const u16 sRolycolyTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8000, 0x2100, 0x01CA, 0x3040, 0x0CA0, 0x0000),
     MOVE_ATTRACT,
     MOVE_DIG,
     MOVE_FACADE,
@@ -31968,8 +33906,10 @@ static const u16 sRolycolyTeachableLearnset[] = {
     MOVE_SNORE,
     MOVE_UNAVAILABLE,
 };
+#define sRolycolyTeachableLearnset (sRolycolyTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sCarkolTeachableLearnset[] = {
+static const u16 sCarkolTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8200, 0xA100, 0x21CE, 0x3040, 0x0CA0, 0x0000),
     MOVE_ATTRACT,
     MOVE_DIG,
     MOVE_FACADE,
@@ -31991,8 +33931,10 @@ static const u16 sCarkolTeachableLearnset[] = {
     MOVE_SNORE,
     MOVE_UNAVAILABLE,
 };
+#define sCarkolTeachableLearnset (sCarkolTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sCoalossalTeachableLearnset[] = {
+static const u16 sCoalossalTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA200, 0xA188, 0x21CE, 0x7040, 0x0CAC, 0x0000),
     MOVE_ATTRACT,
     MOVE_DIG,
     MOVE_EARTHQUAKE,
@@ -32020,17 +33962,21 @@ static const u16 sCoalossalTeachableLearnset[] = {
     MOVE_SNORE,
     MOVE_UNAVAILABLE,
 };
+#define sCoalossalTeachableLearnset (sCoalossalTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_ROLYCOLY
 
 #if P_FAMILY_APPLIN
-static const u16 sApplinTeachableLearnset[] = {
+static const u16 sApplinTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x0000, 0x0000, 0x0100, 0x0100, 0x0100, 0x0000),
     MOVE_ATTRACT,
     MOVE_DEFENSE_CURL,
     MOVE_ROLLOUT,
     MOVE_UNAVAILABLE,
 };
+#define sApplinTeachableLearnset (sApplinTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sFlappleTeachableLearnset[] = {
+static const u16 sFlappleTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA300, 0x000A, 0x81D0, 0x1100, 0x0D00, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BULLET_SEED,
@@ -32049,8 +33995,10 @@ static const u16 sFlappleTeachableLearnset[] = {
     MOVE_SNORE,
     MOVE_UNAVAILABLE,
 };
+#define sFlappleTeachableLearnset (sFlappleTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sAppletunTeachableLearnset[] = {
+static const u16 sAppletunTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE300, 0x208F, 0x01C0, 0x1140, 0x0D00, 0x0000),
     MOVE_ATTRACT,
     MOVE_BULLET_SEED,
     MOVE_EARTHQUAKE,
@@ -32073,9 +34021,11 @@ static const u16 sAppletunTeachableLearnset[] = {
     MOVE_SNORE,
     MOVE_UNAVAILABLE,
 };
+#define sAppletunTeachableLearnset (sAppletunTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
 #if P_GEN_9_CROSS_EVOS
-static const u16 sDipplinTeachableLearnset[] = {
+static const u16 sDipplinTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA300, 0x200A, 0x00C0, 0x1140, 0x0500, 0x0000),
     MOVE_BULLET_SEED,
     MOVE_FACADE,
     MOVE_GIGA_DRAIN,
@@ -32092,8 +34042,10 @@ static const u16 sDipplinTeachableLearnset[] = {
     MOVE_SLEEP_TALK,
     MOVE_UNAVAILABLE,
 };
+#define sDipplinTeachableLearnset (sDipplinTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sHydrappleTeachableLearnset[] = {
+static const u16 sHydrappleTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA300, 0x208B, 0x00C0, 0x1240, 0x0400, 0x0000),
     MOVE_BULLET_SEED,
     MOVE_EARTHQUAKE,
     MOVE_FACADE,
@@ -32111,11 +34063,13 @@ static const u16 sHydrappleTeachableLearnset[] = {
     MOVE_SLEEP_TALK,
     MOVE_UNAVAILABLE,
 };
+#define sHydrappleTeachableLearnset (sHydrappleTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_GEN_9_CROSS_EVOS
 #endif //P_FAMILY_APPLIN
 
 #if P_FAMILY_SILICOBRA
-static const u16 sSilicobraTeachableLearnset[] = {
+static const u16 sSilicobraTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8000, 0x0180, 0x01CA, 0x1040, 0x0CA0, 0x0000),
     MOVE_ATTRACT,
     MOVE_DIG,
     MOVE_EARTHQUAKE,
@@ -32132,8 +34086,10 @@ static const u16 sSilicobraTeachableLearnset[] = {
     MOVE_SNORE,
     MOVE_UNAVAILABLE,
 };
+#define sSilicobraTeachableLearnset (sSilicobraTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sSandacondaTeachableLearnset[] = {
+static const u16 sSandacondaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA000, 0x0180, 0x01CA, 0x1040, 0x0CA0, 0x0000),
     MOVE_ATTRACT,
     MOVE_DIG,
     MOVE_EARTHQUAKE,
@@ -32151,10 +34107,12 @@ static const u16 sSandacondaTeachableLearnset[] = {
     MOVE_SNORE,
     MOVE_UNAVAILABLE,
 };
+#define sSandacondaTeachableLearnset (sSandacondaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_SILICOBRA
 
 #if P_FAMILY_CRAMORANT
-static const u16 sCramorantTeachableLearnset[] = {
+static const u16 sCramorantTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xB804, 0x0001, 0x87D0, 0x1021, 0x0C02, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
@@ -32176,10 +34134,12 @@ static const u16 sCramorantTeachableLearnset[] = {
     MOVE_SNORE,
     MOVE_UNAVAILABLE,
 };
+#define sCramorantTeachableLearnset (sCramorantTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_CRAMORANT
 
 #if P_FAMILY_ARROKUDA
-static const u16 sArrokudaTeachableLearnset[] = {
+static const u16 sArrokudaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8004, 0x0801, 0x01C0, 0x1231, 0x4C00, 0x0000),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_DIVE,
@@ -32197,8 +34157,10 @@ static const u16 sArrokudaTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sArrokudaTeachableLearnset (sArrokudaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sBarraskewdaTeachableLearnset[] = {
+static const u16 sBarraskewdaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xB804, 0x0801, 0x01C0, 0x1231, 0x4C00, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_BRICK_BREAK,
@@ -32219,10 +34181,12 @@ static const u16 sBarraskewdaTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sBarraskewdaTeachableLearnset (sBarraskewdaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_ARROKUDA
 
 #if P_FAMILY_TOXEL
-static const u16 sToxelTeachableLearnset[] = {
+static const u16 sToxelTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8000, 0x0000, 0x01C0, 0x1000, 0x0C00, 0x0000),
     MOVE_ATTRACT,
     MOVE_FACADE,
     MOVE_PROTECT,
@@ -32232,8 +34196,10 @@ static const u16 sToxelTeachableLearnset[] = {
     MOVE_SNORE,
     MOVE_UNAVAILABLE,
 };
+#define sToxelTeachableLearnset (sToxelTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sToxtricityAmpedTeachableLearnset[] = {
+static const u16 sToxtricityAmpedTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA620, 0x4861, 0x03C1, 0x5000, 0x6C1C, 0x0003),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_FACADE,
@@ -32262,8 +34228,10 @@ static const u16 sToxtricityAmpedTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sToxtricityAmpedTeachableLearnset (sToxtricityAmpedTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sToxtricityLowKeyTeachableLearnset[] = {
+static const u16 sToxtricityLowKeyTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA620, 0x4861, 0x03C1, 0x5000, 0x6C1C, 0x0003),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_FACADE,
@@ -32292,10 +34260,12 @@ static const u16 sToxtricityLowKeyTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sToxtricityLowKeyTeachableLearnset (sToxtricityLowKeyTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_TOXEL
 
 #if P_FAMILY_SIZZLIPEDE
-static const u16 sSizzlipedeTeachableLearnset[] = {
+static const u16 sSizzlipedeTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8200, 0x0000, 0x01C0, 0x1100, 0x0D00, 0x0000),
     MOVE_ATTRACT,
     MOVE_FACADE,
     MOVE_PROTECT,
@@ -32308,8 +34278,10 @@ static const u16 sSizzlipedeTeachableLearnset[] = {
     MOVE_SNORE,
     MOVE_UNAVAILABLE,
 };
+#define sSizzlipedeTeachableLearnset (sSizzlipedeTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sCentiskorchTeachableLearnset[] = {
+static const u16 sCentiskorchTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA200, 0x8008, 0x21C4, 0x1100, 0x0D00, 0x0000),
     MOVE_ATTRACT,
     MOVE_FACADE,
     MOVE_FIRE_BLAST,
@@ -32327,10 +34299,12 @@ static const u16 sCentiskorchTeachableLearnset[] = {
     MOVE_SNORE,
     MOVE_UNAVAILABLE,
 };
+#define sCentiskorchTeachableLearnset (sCentiskorchTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_SIZZLIPEDE
 
 #if P_FAMILY_CLOBBOPUS
-static const u16 sClobbopusTeachableLearnset[] = {
+static const u16 sClobbopusTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8480, 0x0800, 0x01C0, 0x1078, 0x0E09, 0x0000),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_BULK_UP,
@@ -32350,8 +34324,10 @@ static const u16 sClobbopusTeachableLearnset[] = {
     MOVE_SNORE,
     MOVE_UNAVAILABLE,
 };
+#define sClobbopusTeachableLearnset (sClobbopusTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sGrapploctTeachableLearnset[] = {
+static const u16 sGrapploctTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA480, 0x0900, 0x01C0, 0x1079, 0x0E09, 0x0000),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_BULK_UP,
@@ -32374,10 +34350,12 @@ static const u16 sGrapploctTeachableLearnset[] = {
     MOVE_SNORE,
     MOVE_UNAVAILABLE,
 };
+#define sGrapploctTeachableLearnset (sGrapploctTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_CLOBBOPUS
 
 #if P_FAMILY_SINISTEA
-static const u16 sSinisteaTeachableLearnset[] = {
+static const u16 sSinisteaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8008, 0x0602, 0x08C0, 0x1000, 0x0C10, 0x0000),
     MOVE_CALM_MIND,
     MOVE_FACADE,
     MOVE_GIGA_DRAIN,
@@ -32392,8 +34370,10 @@ static const u16 sSinisteaTeachableLearnset[] = {
     MOVE_SNORE,
     MOVE_UNAVAILABLE,
 };
+#define sSinisteaTeachableLearnset (sSinisteaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sPolteageistTeachableLearnset[] = {
+static const u16 sPolteageistTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE008, 0x2602, 0x08C0, 0x1000, 0x0C10, 0x0000),
     MOVE_CALM_MIND,
     MOVE_FACADE,
     MOVE_GIGA_DRAIN,
@@ -32411,10 +34391,12 @@ static const u16 sPolteageistTeachableLearnset[] = {
     MOVE_SNORE,
     MOVE_UNAVAILABLE,
 };
+#define sPolteageistTeachableLearnset (sPolteageistTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_SINISTEA
 
 #if P_FAMILY_HATENNA
-static const u16 sHatennaTeachableLearnset[] = {
+static const u16 sHatennaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC008, 0x2206, 0x09C0, 0x1000, 0x4C50, 0x0002),
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
     MOVE_FACADE,
@@ -32435,8 +34417,10 @@ static const u16 sHatennaTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sHatennaTeachableLearnset (sHatennaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sHattremTeachableLearnset[] = {
+static const u16 sHattremTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC008, 0x2206, 0x09C0, 0x1000, 0x4C50, 0x0002),
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
     MOVE_FACADE,
@@ -32457,8 +34441,10 @@ static const u16 sHattremTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sHattremTeachableLearnset (sHattremTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sHattereneTeachableLearnset[] = {
+static const u16 sHattereneTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE008, 0x2606, 0x09C0, 0x1000, 0xCC50, 0x0002),
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
     MOVE_FACADE,
@@ -32482,10 +34468,12 @@ static const u16 sHattereneTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sHattereneTeachableLearnset (sHattereneTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_HATENNA
 
 #if P_FAMILY_IMPIDIMP
-static const u16 sImpidimpTeachableLearnset[] = {
+static const u16 sImpidimpTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC400, 0x2000, 0x03E0, 0x1000, 0x2C1C, 0x0002),
     MOVE_ATTRACT,
     MOVE_FACADE,
     MOVE_LIGHT_SCREEN,
@@ -32505,8 +34493,10 @@ static const u16 sImpidimpTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sImpidimpTeachableLearnset (sImpidimpTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sMorgremTeachableLearnset[] = {
+static const u16 sMorgremTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC400, 0x2000, 0x03E0, 0x1000, 0x2C1C, 0x0002),
     MOVE_ATTRACT,
     MOVE_FACADE,
     MOVE_LIGHT_SCREEN,
@@ -32526,8 +34516,10 @@ static const u16 sMorgremTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sMorgremTeachableLearnset (sMorgremTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sGrimmsnarlTeachableLearnset[] = {
+static const u16 sGrimmsnarlTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE481, 0x2800, 0x03E0, 0x5040, 0x2C1D, 0x0003),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_BULK_UP,
@@ -32555,10 +34547,12 @@ static const u16 sGrimmsnarlTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sGrimmsnarlTeachableLearnset (sGrimmsnarlTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_IMPIDIMP
 
 #if P_FAMILY_MILCERY
-static const u16 sMilceryTeachableLearnset[] = {
+static const u16 sMilceryTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8000, 0x0000, 0x01C0, 0x1000, 0x0C00, 0x0000),
     MOVE_ATTRACT,
     MOVE_FACADE,
     MOVE_PROTECT,
@@ -32568,8 +34562,10 @@ static const u16 sMilceryTeachableLearnset[] = {
     MOVE_SNORE,
     MOVE_UNAVAILABLE,
 };
+#define sMilceryTeachableLearnset (sMilceryTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sAlcremieTeachableLearnset[] = {
+static const u16 sAlcremieTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE008, 0x020E, 0x01C0, 0x1000, 0x0C50, 0x0000),
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
     MOVE_FACADE,
@@ -32588,10 +34584,12 @@ static const u16 sAlcremieTeachableLearnset[] = {
     MOVE_SNORE,
     MOVE_UNAVAILABLE,
 };
+#define sAlcremieTeachableLearnset (sAlcremieTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_MILCERY
 
 #if P_FAMILY_FALINKS
-static const u16 sFalinksTeachableLearnset[] = {
+static const u16 sFalinksTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA280, 0x0801, 0x00C8, 0x10C8, 0x8CC0, 0x0000),
     MOVE_BRICK_BREAK,
     MOVE_BULK_UP,
     MOVE_FACADE,
@@ -32612,10 +34610,12 @@ static const u16 sFalinksTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sFalinksTeachableLearnset (sFalinksTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_FALINKS
 
 #if P_FAMILY_PINCURCHIN
-static const u16 sPincurchinTeachableLearnset[] = {
+static const u16 sPincurchinTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA000, 0x0061, 0x01C0, 0x1041, 0x4C00, 0x0002),
     MOVE_ATTRACT,
     MOVE_FACADE,
     MOVE_HYPER_BEAM,
@@ -32633,10 +34633,12 @@ static const u16 sPincurchinTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sPincurchinTeachableLearnset (sPincurchinTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_PINCURCHIN
 
 #if P_FAMILY_SNOM
-static const u16 sSnomTeachableLearnset[] = {
+static const u16 sSnomTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8000, 0x0000, 0x01C0, 0x1000, 0x0C02, 0x0000),
     MOVE_ATTRACT,
     MOVE_FACADE,
     MOVE_PROTECT,
@@ -32647,8 +34649,10 @@ static const u16 sSnomTeachableLearnset[] = {
     MOVE_SNORE,
     MOVE_UNAVAILABLE,
 };
+#define sSnomTeachableLearnset (sSnomTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sFrosmothTeachableLearnset[] = {
+static const u16 sFrosmothTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xF848, 0x2006, 0x01C0, 0x1000, 0x4C02, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_CALM_MIND,
@@ -32669,10 +34673,12 @@ static const u16 sFrosmothTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sFrosmothTeachableLearnset (sFrosmothTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_SNOM
 
 #if P_FAMILY_STONJOURNER
-static const u16 sStonjournerTeachableLearnset[] = {
+static const u16 sStonjournerTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA200, 0x0084, 0x01CA, 0x1040, 0x0CC4, 0x0000),
     MOVE_ATTRACT,
     MOVE_EARTHQUAKE,
     MOVE_FACADE,
@@ -32692,10 +34698,12 @@ static const u16 sStonjournerTeachableLearnset[] = {
     MOVE_SNORE,
     MOVE_UNAVAILABLE,
 };
+#define sStonjournerTeachableLearnset (sStonjournerTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_STONJOURNER
 
 #if P_FAMILY_EISCUE
-static const u16 sEiscueTeachableLearnset[] = {
+static const u16 sEiscueTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xB844, 0x2001, 0x01C0, 0x1271, 0x0C03, 0x0000),
     MOVE_ATTRACT,
     MOVE_BLIZZARD,
     MOVE_DIVE,
@@ -32719,10 +34727,12 @@ static const u16 sEiscueTeachableLearnset[] = {
     MOVE_SNORE,
     MOVE_UNAVAILABLE,
 };
+#define sEiscueTeachableLearnset (sEiscueTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_EISCUE
 
 #if P_FAMILY_INDEEDEE
-static const u16 sIndeedeeMTeachableLearnset[] = {
+static const u16 sIndeedeeMTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8008, 0x0600, 0x09C0, 0x1040, 0x4C50, 0x0000),
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
     MOVE_FACADE,
@@ -32740,8 +34750,10 @@ static const u16 sIndeedeeMTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sIndeedeeMTeachableLearnset (sIndeedeeMTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sIndeedeeFTeachableLearnset[] = {
+static const u16 sIndeedeeFTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC008, 0x2604, 0x09C0, 0x1040, 0x4C50, 0x0000),
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
     MOVE_FACADE,
@@ -32762,10 +34774,12 @@ static const u16 sIndeedeeFTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sIndeedeeFTeachableLearnset (sIndeedeeFTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_INDEEDEE
 
 #if P_FAMILY_MORPEKO
-static const u16 sMorpekoTeachableLearnset[] = {
+static const u16 sMorpekoTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8500, 0x0860, 0x03E0, 0x1200, 0x6C00, 0x0003),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_BULLET_SEED,
@@ -32787,10 +34801,12 @@ static const u16 sMorpekoTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sMorpekoTeachableLearnset (sMorpekoTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_MORPEKO
 
 #if P_FAMILY_CUFANT
-static const u16 sCufantTeachableLearnset[] = {
+static const u16 sCufantTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8000, 0x0980, 0x01CA, 0x134A, 0x2D84, 0x0000),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_DIG,
@@ -32814,8 +34830,10 @@ static const u16 sCufantTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sCufantTeachableLearnset (sCufantTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sCopperajahTeachableLearnset[] = {
+static const u16 sCopperajahTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA400, 0x0980, 0x01CA, 0x134A, 0x2D84, 0x0000),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_DIG,
@@ -32841,10 +34859,12 @@ static const u16 sCopperajahTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sCopperajahTeachableLearnset (sCopperajahTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_CUFANT
 
 #if P_FAMILY_DRACOZOLT
-static const u16 sDracozoltTeachableLearnset[] = {
+static const u16 sDracozoltTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA602, 0x80F1, 0x00DC, 0x1040, 0x0C8C, 0x0003),
     MOVE_AERIAL_ACE,
     MOVE_DRAGON_CLAW,
     MOVE_EARTHQUAKE,
@@ -32872,10 +34892,12 @@ static const u16 sDracozoltTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sDracozoltTeachableLearnset (sDracozoltTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_DRACOZOLT
 
 #if P_FAMILY_ARCTOZOLT
-static const u16 sArctozoltTeachableLearnset[] = {
+static const u16 sArctozoltTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xBC40, 0x0071, 0x00C8, 0x1041, 0x0C8E, 0x0003),
     MOVE_BLIZZARD,
     MOVE_FACADE,
     MOVE_HAIL,
@@ -32902,10 +34924,12 @@ static const u16 sArctozoltTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sArctozoltTeachableLearnset (sArctozoltTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_ARCTOZOLT
 
 #if P_FAMILY_DRACOVISH
-static const u16 sDracovishTeachableLearnset[] = {
+static const u16 sDracovishTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA000, 0x0081, 0x00C8, 0x1071, 0x0C84, 0x0000),
     MOVE_DIVE,
     MOVE_EARTHQUAKE,
     MOVE_FACADE,
@@ -32924,10 +34948,12 @@ static const u16 sDracovishTeachableLearnset[] = {
     MOVE_SNORE,
     MOVE_UNAVAILABLE,
 };
+#define sDracovishTeachableLearnset (sDracovishTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_DRACOVISH
 
 #if P_FAMILY_ARCTOVISH
-static const u16 sArctovishTeachableLearnset[] = {
+static const u16 sArctovishTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xB840, 0x0001, 0x00C8, 0x1071, 0x0C82, 0x0000),
     MOVE_BLIZZARD,
     MOVE_DIVE,
     MOVE_FACADE,
@@ -32948,10 +34974,12 @@ static const u16 sArctovishTeachableLearnset[] = {
     MOVE_SNORE,
     MOVE_UNAVAILABLE,
 };
+#define sArctovishTeachableLearnset (sArctovishTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_ARCTOVISH
 
 #if P_FAMILY_DURALUDON
-static const u16 sDuraludonTeachableLearnset[] = {
+static const u16 sDuraludonTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE012, 0x2868, 0x01C8, 0x1248, 0x8C80, 0x0002),
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
     MOVE_DRAGON_CLAW,
@@ -32977,9 +35005,11 @@ static const u16 sDuraludonTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sDuraludonTeachableLearnset (sDuraludonTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
 #if P_GEN_9_CROSS_EVOS
-static const u16 sArchaludonTeachableLearnset[] = {
+static const u16 sArchaludonTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE012, 0x28E8, 0x00C8, 0x1248, 0x8480, 0x0002),
     MOVE_BRICK_BREAK,
     MOVE_DRAGON_CLAW,
     MOVE_EARTHQUAKE,
@@ -33004,11 +35034,13 @@ static const u16 sArchaludonTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sArchaludonTeachableLearnset (sArchaludonTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_GEN_9_CROSS_EVOS
 #endif //P_FAMILY_DURALUDON
 
 #if P_FAMILY_DREEPY
-static const u16 sDreepyTeachableLearnset[] = {
+static const u16 sDreepyTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8000, 0x1000, 0x01C0, 0x1000, 0x4C00, 0x0002),
     MOVE_ATTRACT,
     MOVE_DOUBLE_TEAM,
     MOVE_FACADE,
@@ -33021,8 +35053,10 @@ static const u16 sDreepyTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sDreepyTeachableLearnset (sDreepyTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sDrakloakTeachableLearnset[] = {
+static const u16 sDrakloakTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC200, 0xB460, 0x07C4, 0x1221, 0x4C00, 0x0002),
     MOVE_ATTRACT,
     MOVE_DIVE,
     MOVE_DOUBLE_TEAM,
@@ -33048,8 +35082,10 @@ static const u16 sDrakloakTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sDrakloakTeachableLearnset (sDrakloakTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sDragapultTeachableLearnset[] = {
+static const u16 sDragapultTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE202, 0xB468, 0x87C4, 0x1261, 0x4C00, 0x0002),
     MOVE_ATTRACT,
     MOVE_DIVE,
     MOVE_DOUBLE_TEAM,
@@ -33080,10 +35116,12 @@ static const u16 sDragapultTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sDragapultTeachableLearnset (sDragapultTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_DREEPY
 
 #if P_FAMILY_ZACIAN
-static const u16 sZacianTeachableLearnset[] = {
+static const u16 sZacianTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA000, 0x0910, 0x00C0, 0x1040, 0xCC00, 0x0000),
     MOVE_BRICK_BREAK,
     MOVE_DIG,
     MOVE_FACADE,
@@ -33099,10 +35137,12 @@ static const u16 sZacianTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sZacianTeachableLearnset (sZacianTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_ZACIAN
 
 #if P_FAMILY_ZAMAZENTA
-static const u16 sZamazentaTeachableLearnset[] = {
+static const u16 sZamazentaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE210, 0x291D, 0x00C2, 0x1040, 0x4C00, 0x0000),
     MOVE_BRICK_BREAK,
     MOVE_DIG,
     MOVE_FACADE,
@@ -33125,10 +35165,12 @@ static const u16 sZamazentaTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sZamazentaTeachableLearnset (sZamazentaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_ZAMAZENTA
 
 #if P_FAMILY_ETERNATUS
-static const u16 sEternatusTeachableLearnset[] = {
+static const u16 sEternatusTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE220, 0xA409, 0x80C5, 0x1040, 0x0C00, 0x0000),
     MOVE_FACADE,
     MOVE_FIRE_BLAST,
     MOVE_FLAMETHROWER,
@@ -33150,10 +35192,12 @@ static const u16 sEternatusTeachableLearnset[] = {
     MOVE_SNORE,
     MOVE_UNAVAILABLE,
 };
+#define sEternatusTeachableLearnset (sEternatusTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_ETERNATUS
 
 #if P_FAMILY_KUBFU
-static const u16 sKubfuTeachableLearnset[] = {
+static const u16 sKubfuTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8081, 0x0900, 0x01D0, 0x5AC8, 0x8C0D, 0x0001),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -33179,8 +35223,10 @@ static const u16 sKubfuTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sKubfuTeachableLearnset (sKubfuTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sUrshifuSingleStrikeTeachableLearnset[] = {
+static const u16 sUrshifuSingleStrikeTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8491, 0x0900, 0x01D8, 0x5AC8, 0xCC8D, 0x0001),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -33211,8 +35257,10 @@ static const u16 sUrshifuSingleStrikeTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sUrshifuSingleStrikeTeachableLearnset (sUrshifuSingleStrikeTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sUrshifuRapidStrikeTeachableLearnset[] = {
+static const u16 sUrshifuRapidStrikeTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8481, 0x0901, 0x01D8, 0x5AF8, 0xCC8D, 0x0001),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_BRICK_BREAK,
@@ -33245,10 +35293,12 @@ static const u16 sUrshifuRapidStrikeTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sUrshifuRapidStrikeTeachableLearnset (sUrshifuRapidStrikeTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_KUBFU
 
 #if P_FAMILY_ZARUDE
-static const u16 sZarudeTeachableLearnset[] = {
+static const u16 sZarudeTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA791, 0x091A, 0x02D8, 0x1240, 0xEC8C, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_BRICK_BREAK,
     MOVE_BULK_UP,
@@ -33280,10 +35330,12 @@ static const u16 sZarudeTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sZarudeTeachableLearnset (sZarudeTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_ZARUDE
 
 #if P_FAMILY_REGIELEKI
-static const u16 sRegielekiTeachableLearnset[] = {
+static const u16 sRegielekiTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE000, 0x6061, 0x00C0, 0x3040, 0x4C00, 0x0002),
     MOVE_FACADE,
     MOVE_HYPER_BEAM,
     MOVE_LIGHT_SCREEN,
@@ -33303,10 +35355,12 @@ static const u16 sRegielekiTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sRegielekiTeachableLearnset (sRegielekiTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_REGIELEKI
 
 #if P_FAMILY_REGIDRAGO
-static const u16 sRegidragoTeachableLearnset[] = {
+static const u16 sRegidragoTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE002, 0x2080, 0x00C0, 0x3040, 0x4C00, 0x0000),
     MOVE_DRAGON_CLAW,
     MOVE_EARTHQUAKE,
     MOVE_FACADE,
@@ -33323,10 +35377,12 @@ static const u16 sRegidragoTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sRegidragoTeachableLearnset (sRegidragoTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_REGIDRAGO
 
 #if P_FAMILY_GLASTRIER
-static const u16 sGlastrierTeachableLearnset[] = {
+static const u16 sGlastrierTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xBC50, 0x0000, 0x00E0, 0x1240, 0x8C02, 0x0000),
     MOVE_BLIZZARD,
     MOVE_FACADE,
     MOVE_HAIL,
@@ -33346,10 +35402,12 @@ static const u16 sGlastrierTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sGlastrierTeachableLearnset (sGlastrierTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_GLASTRIER
 
 #if P_FAMILY_SPECTRIER
-static const u16 sSpectrierTeachableLearnset[] = {
+static const u16 sSpectrierTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA408, 0x0600, 0x00C0, 0x1240, 0x4C00, 0x0000),
     MOVE_CALM_MIND,
     MOVE_FACADE,
     MOVE_HYPER_BEAM,
@@ -33366,10 +35424,12 @@ static const u16 sSpectrierTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sSpectrierTeachableLearnset (sSpectrierTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_SPECTRIER
 
 #if P_FAMILY_CALYREX
-static const u16 sCalyrexTeachableLearnset[] = {
+static const u16 sCalyrexTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE308, 0x220E, 0x08C0, 0x1000, 0x4C50, 0x0000),
     MOVE_BULLET_SEED,
     MOVE_CALM_MIND,
     MOVE_FACADE,
@@ -33392,9 +35452,11 @@ static const u16 sCalyrexTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sCalyrexTeachableLearnset (sCalyrexTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
 #if P_FUSION_FORMS
-static const u16 sCalyrexIceTeachableLearnset[] = {
+static const u16 sCalyrexIceTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xFF58, 0x220E, 0x08E0, 0x1240, 0xCC52, 0x0000),
     MOVE_BLIZZARD,
     MOVE_BULLET_SEED,
     MOVE_CALM_MIND,
@@ -33427,8 +35489,10 @@ static const u16 sCalyrexIceTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sCalyrexIceTeachableLearnset (sCalyrexIceTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sCalyrexShadowTeachableLearnset[] = {
+static const u16 sCalyrexShadowTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE708, 0x260E, 0x08C0, 0x1240, 0x4C50, 0x0000),
     MOVE_BULLET_SEED,
     MOVE_CALM_MIND,
     MOVE_FACADE,
@@ -33455,11 +35519,13 @@ static const u16 sCalyrexShadowTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sCalyrexShadowTeachableLearnset (sCalyrexShadowTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FUSION_FORMS
 #endif //P_FAMILY_CALYREX
 
 #if P_FAMILY_ENAMORUS
-static const u16 sEnamorusTeachableLearnset[] = {
+static const u16 sEnamorusTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA608, 0x0201, 0x80E1, 0x1048, 0x0440, 0x0000),
     MOVE_CALM_MIND,
     MOVE_FACADE,
     MOVE_FLY,
@@ -33479,10 +35545,12 @@ static const u16 sEnamorusTeachableLearnset[] = {
     MOVE_SLEEP_TALK,
     MOVE_UNAVAILABLE,
 };
+#define sEnamorusTeachableLearnset (sEnamorusTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_ENAMORUS
 
 #if P_FAMILY_SPRIGATITO
-static const u16 sSprigatitoTeachableLearnset[] = {
+static const u16 sSprigatitoTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8500, 0x000A, 0x00C0, 0x1000, 0x4420, 0x0000),
     MOVE_BULLET_SEED,
     MOVE_FACADE,
     MOVE_GIGA_DRAIN,
@@ -33496,8 +35564,10 @@ static const u16 sSprigatitoTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sSprigatitoTeachableLearnset (sSprigatitoTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sFloragatoTeachableLearnset[] = {
+static const u16 sFloragatoTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8500, 0x000A, 0x00D0, 0x1000, 0x4420, 0x0001),
     MOVE_AERIAL_ACE,
     MOVE_BULLET_SEED,
     MOVE_FACADE,
@@ -33513,8 +35583,10 @@ static const u16 sFloragatoTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sFloragatoTeachableLearnset (sFloragatoTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sMeowscaradaTeachableLearnset[] = {
+static const u16 sMeowscaradaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA500, 0x1C0A, 0x0AD0, 0x1000, 0x4460, 0x0001),
     MOVE_AERIAL_ACE,
     MOVE_BRICK_BREAK,
     MOVE_BULLET_SEED,
@@ -33537,10 +35609,12 @@ static const u16 sMeowscaradaTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sMeowscaradaTeachableLearnset (sMeowscaradaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_SPRIGATITO
 
 #if P_FAMILY_FUECOCO
-static const u16 sFuecocoTeachableLearnset[] = {
+static const u16 sFuecocoTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8210, 0x8100, 0x20C4, 0x1040, 0x0420, 0x0000),
     MOVE_DIG,
     MOVE_FACADE,
     MOVE_FIRE_BLAST,
@@ -33556,8 +35630,10 @@ static const u16 sFuecocoTeachableLearnset[] = {
     MOVE_SLEEP_TALK,
     MOVE_UNAVAILABLE,
 };
+#define sFuecocoTeachableLearnset (sFuecocoTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sCrocalorTeachableLearnset[] = {
+static const u16 sCrocalorTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8210, 0x8100, 0x20C4, 0x1040, 0x0420, 0x0000),
     MOVE_DIG,
     MOVE_FACADE,
     MOVE_FIRE_BLAST,
@@ -33573,8 +35649,10 @@ static const u16 sCrocalorTeachableLearnset[] = {
     MOVE_SLEEP_TALK,
     MOVE_UNAVAILABLE,
 };
+#define sCrocalorTeachableLearnset (sCrocalorTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sSkeledirgeTeachableLearnset[] = {
+static const u16 sSkeledirgeTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA210, 0x8588, 0x20C4, 0x1040, 0x0420, 0x0000),
     MOVE_DIG,
     MOVE_EARTHQUAKE,
     MOVE_FACADE,
@@ -33594,10 +35672,12 @@ static const u16 sSkeledirgeTeachableLearnset[] = {
     MOVE_SLEEP_TALK,
     MOVE_UNAVAILABLE,
 };
+#define sSkeledirgeTeachableLearnset (sSkeledirgeTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_FUECOCO
 
 #if P_FAMILY_QUAXLY
-static const u16 sQuaxlyTeachableLearnset[] = {
+static const u16 sQuaxlyTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8000, 0x0001, 0x00D0, 0x1001, 0x4440, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_FACADE,
     MOVE_PROTECT,
@@ -33610,8 +35690,10 @@ static const u16 sQuaxlyTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sQuaxlyTeachableLearnset (sQuaxlyTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sQuaxwellTeachableLearnset[] = {
+static const u16 sQuaxwellTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8004, 0x0001, 0x00D0, 0x1001, 0x4440, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_FACADE,
     MOVE_PROTECT,
@@ -33625,8 +35707,10 @@ static const u16 sQuaxwellTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sQuaxwellTeachableLearnset (sQuaxwellTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sQuaquavalTeachableLearnset[] = {
+static const u16 sQuaquavalTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA484, 0x0801, 0x00D0, 0x1081, 0xC446, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_BRICK_BREAK,
     MOVE_BULK_UP,
@@ -33648,10 +35732,12 @@ static const u16 sQuaquavalTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sQuaquavalTeachableLearnset (sQuaquavalTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_QUAXLY
 
 #if P_FAMILY_LECHONK
-static const u16 sLechonkTeachableLearnset[] = {
+static const u16 sLechonkTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8300, 0x0101, 0x02C0, 0x1240, 0x0420, 0x0000),
     MOVE_BULLET_SEED,
     MOVE_DIG,
     MOVE_FACADE,
@@ -33667,8 +35753,10 @@ static const u16 sLechonkTeachableLearnset[] = {
     MOVE_SLEEP_TALK,
     MOVE_UNAVAILABLE,
 };
+#define sLechonkTeachableLearnset (sLechonkTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sOinkologneTeachableLearnset[] = {
+static const u16 sOinkologneTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA300, 0x0101, 0x02C0, 0x1240, 0x0420, 0x0000),
     MOVE_BULLET_SEED,
     MOVE_DIG,
     MOVE_FACADE,
@@ -33685,10 +35773,12 @@ static const u16 sOinkologneTeachableLearnset[] = {
     MOVE_SLEEP_TALK,
     MOVE_UNAVAILABLE,
 };
+#define sOinkologneTeachableLearnset (sOinkologneTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_LECHONK
 
 #if P_FAMILY_TAROUNTULA
-static const u16 sTarountulaTeachableLearnset[] = {
+static const u16 sTarountulaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8300, 0x0003, 0x02C0, 0x10C0, 0x0400, 0x0000),
     MOVE_BULLET_SEED,
     MOVE_FACADE,
     MOVE_GIGA_DRAIN,
@@ -33703,8 +35793,10 @@ static const u16 sTarountulaTeachableLearnset[] = {
     MOVE_SLEEP_TALK,
     MOVE_UNAVAILABLE,
 };
+#define sTarountulaTeachableLearnset (sTarountulaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sSpidopsTeachableLearnset[] = {
+static const u16 sSpidopsTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8700, 0x0803, 0x02D8, 0x10C0, 0x0400, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_BRICK_BREAK,
     MOVE_BULLET_SEED,
@@ -33723,10 +35815,12 @@ static const u16 sSpidopsTeachableLearnset[] = {
     MOVE_SLEEP_TALK,
     MOVE_UNAVAILABLE,
 };
+#define sSpidopsTeachableLearnset (sSpidopsTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_TAROUNTULA
 
 #if P_FAMILY_NYMBLE
-static const u16 sNymbleTeachableLearnset[] = {
+static const u16 sNymbleTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8200, 0x0001, 0x02C0, 0x1080, 0x0400, 0x0000),
     MOVE_FACADE,
     MOVE_PROTECT,
     MOVE_RAIN_DANCE,
@@ -33738,8 +35832,10 @@ static const u16 sNymbleTeachableLearnset[] = {
     MOVE_SLEEP_TALK,
     MOVE_UNAVAILABLE,
 };
+#define sNymbleTeachableLearnset (sNymbleTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sLokixTeachableLearnset[] = {
+static const u16 sLokixTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8600, 0x0801, 0x02D0, 0x1280, 0x8400, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_BRICK_BREAK,
     MOVE_FACADE,
@@ -33756,10 +35852,12 @@ static const u16 sLokixTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sLokixTeachableLearnset (sLokixTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_NYMBLE
 
 #if P_FAMILY_PAWMI
-static const u16 sPawmiTeachableLearnset[] = {
+static const u16 sPawmiTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8200, 0x0161, 0x02C0, 0x1000, 0x4400, 0x0002),
     MOVE_DIG,
     MOVE_FACADE,
     MOVE_PROTECT,
@@ -33775,8 +35873,10 @@ static const u16 sPawmiTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sPawmiTeachableLearnset (sPawmiTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sPawmoTeachableLearnset[] = {
+static const u16 sPawmoTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8201, 0x0161, 0x02C0, 0x1000, 0x4400, 0x0003),
     MOVE_DIG,
     MOVE_FACADE,
     MOVE_FOCUS_PUNCH,
@@ -33794,8 +35894,10 @@ static const u16 sPawmoTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sPawmoTeachableLearnset (sPawmoTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sPawmotTeachableLearnset[] = {
+static const u16 sPawmotTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA281, 0x0961, 0x02C8, 0x5200, 0x4411, 0x0003),
     MOVE_BRICK_BREAK,
     MOVE_BULK_UP,
     MOVE_DIG,
@@ -33821,10 +35923,12 @@ static const u16 sPawmotTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sPawmotTeachableLearnset (sPawmotTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_PAWMI
 
 #if P_FAMILY_TANDEMAUS
-static const u16 sTandemausTeachableLearnset[] = {
+static const u16 sTandemausTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8704, 0x0101, 0x02D0, 0x1200, 0x4420, 0x0002),
     MOVE_AERIAL_ACE,
     MOVE_BULLET_SEED,
     MOVE_DIG,
@@ -33844,8 +35948,10 @@ static const u16 sTandemausTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sTandemausTeachableLearnset (sTandemausTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sMausholdTeachableLearnset[] = {
+static const u16 sMausholdTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA704, 0x0101, 0x02D0, 0x1200, 0x4420, 0x0002),
     MOVE_AERIAL_ACE,
     MOVE_BULLET_SEED,
     MOVE_DIG,
@@ -33866,10 +35972,12 @@ static const u16 sMausholdTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sMausholdTeachableLearnset (sMausholdTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_TANDEMAUS
 
 #if P_FAMILY_FIDOUGH
-static const u16 sFidoughTeachableLearnset[] = {
+static const u16 sFidoughTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8210, 0x0101, 0x00C0, 0x1240, 0x0460, 0x0000),
     MOVE_DIG,
     MOVE_FACADE,
     MOVE_PROTECT,
@@ -33885,8 +35993,10 @@ static const u16 sFidoughTeachableLearnset[] = {
     MOVE_SLEEP_TALK,
     MOVE_UNAVAILABLE,
 };
+#define sFidoughTeachableLearnset (sFidoughTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sDachsbunTeachableLearnset[] = {
+static const u16 sDachsbunTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA210, 0x0101, 0x00C0, 0x1240, 0x0460, 0x0000),
     MOVE_DIG,
     MOVE_FACADE,
     MOVE_HYPER_BEAM,
@@ -33903,10 +36013,12 @@ static const u16 sDachsbunTeachableLearnset[] = {
     MOVE_SLEEP_TALK,
     MOVE_UNAVAILABLE,
 };
+#define sDachsbunTeachableLearnset (sDachsbunTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_FIDOUGH
 
 #if P_FAMILY_SMOLIV
-static const u16 sSmolivTeachableLearnset[] = {
+static const u16 sSmolivTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8300, 0x000A, 0x00C0, 0x1000, 0x4400, 0x0000),
     MOVE_BULLET_SEED,
     MOVE_FACADE,
     MOVE_GIGA_DRAIN,
@@ -33919,8 +36031,10 @@ static const u16 sSmolivTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sSmolivTeachableLearnset (sSmolivTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sDollivTeachableLearnset[] = {
+static const u16 sDollivTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8300, 0x000A, 0x00C0, 0x1000, 0x4400, 0x0000),
     MOVE_BULLET_SEED,
     MOVE_FACADE,
     MOVE_GIGA_DRAIN,
@@ -33933,8 +36047,10 @@ static const u16 sDollivTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sDollivTeachableLearnset (sDollivTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sArbolivaTeachableLearnset[] = {
+static const u16 sArbolivaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE300, 0x200E, 0x00C0, 0x1000, 0x4450, 0x0000),
     MOVE_BULLET_SEED,
     MOVE_FACADE,
     MOVE_GIGA_DRAIN,
@@ -33953,10 +36069,12 @@ static const u16 sArbolivaTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sArbolivaTeachableLearnset (sArbolivaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_SMOLIV
 
 #if P_FAMILY_SQUAWKABILLY
-static const u16 sSquawkabillyTeachableLearnset[] = {
+static const u16 sSquawkabillyTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA600, 0x0000, 0x82F0, 0x1200, 0x2400, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_FACADE,
     MOVE_FLY,
@@ -33973,10 +36091,12 @@ static const u16 sSquawkabillyTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sSquawkabillyTeachableLearnset (sSquawkabillyTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_SQUAWKABILLY
 
 #if P_FAMILY_NACLI
-static const u16 sNacliTeachableLearnset[] = {
+static const u16 sNacliTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8200, 0x0181, 0x00C2, 0x1040, 0x0480, 0x0000),
     MOVE_DIG,
     MOVE_EARTHQUAKE,
     MOVE_FACADE,
@@ -33991,8 +36111,10 @@ static const u16 sNacliTeachableLearnset[] = {
     MOVE_SLEEP_TALK,
     MOVE_UNAVAILABLE,
 };
+#define sNacliTeachableLearnset (sNacliTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sNaclstackTeachableLearnset[] = {
+static const u16 sNaclstackTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA200, 0x0181, 0x00C2, 0x1240, 0x0480, 0x0000),
     MOVE_DIG,
     MOVE_EARTHQUAKE,
     MOVE_FACADE,
@@ -34009,8 +36131,10 @@ static const u16 sNaclstackTeachableLearnset[] = {
     MOVE_SLEEP_TALK,
     MOVE_UNAVAILABLE,
 };
+#define sNaclstackTeachableLearnset (sNaclstackTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sGarganaclTeachableLearnset[] = {
+static const u16 sGarganaclTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA201, 0x0981, 0x00CA, 0x7240, 0x0481, 0x0001),
     MOVE_BRICK_BREAK,
     MOVE_DIG,
     MOVE_EARTHQUAKE,
@@ -34034,10 +36158,12 @@ static const u16 sGarganaclTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sGarganaclTeachableLearnset (sGarganaclTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_NACLI
 
 #if P_FAMILY_CHARCADET
-static const u16 sCharcadetTeachableLearnset[] = {
+static const u16 sCharcadetTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8200, 0x8000, 0x20C4, 0x1000, 0x0400, 0x0000),
     MOVE_FACADE,
     MOVE_FIRE_BLAST,
     MOVE_FLAMETHROWER,
@@ -34049,8 +36175,10 @@ static const u16 sCharcadetTeachableLearnset[] = {
     MOVE_SLEEP_TALK,
     MOVE_UNAVAILABLE,
 };
+#define sCharcadetTeachableLearnset (sCharcadetTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sArmarougeTeachableLearnset[] = {
+static const u16 sArmarougeTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC608, 0xA608, 0x20C4, 0x1000, 0x0440, 0x0000),
     MOVE_CALM_MIND,
     MOVE_FACADE,
     MOVE_FIRE_BLAST,
@@ -34070,8 +36198,10 @@ static const u16 sArmarougeTeachableLearnset[] = {
     MOVE_SLEEP_TALK,
     MOVE_UNAVAILABLE,
 };
+#define sArmarougeTeachableLearnset (sArmarougeTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sCeruledgeTeachableLearnset[] = {
+static const u16 sCeruledgeTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC682, 0xAC00, 0x20C4, 0x1000, 0x8440, 0x0000),
     MOVE_BRICK_BREAK,
     MOVE_BULK_UP,
     MOVE_DRAGON_CLAW,
@@ -34092,10 +36222,12 @@ static const u16 sCeruledgeTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sCeruledgeTeachableLearnset (sCeruledgeTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_CHARCADET
 
 #if P_FAMILY_TADBULB
-static const u16 sTadbulbTeachableLearnset[] = {
+static const u16 sTadbulbTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC004, 0x2061, 0x0080, 0x1000, 0x4420, 0x0002),
     MOVE_LIGHT_SCREEN,
     MOVE_PROTECT,
     MOVE_RAIN_DANCE,
@@ -34111,8 +36243,10 @@ static const u16 sTadbulbTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sTadbulbTeachableLearnset (sTadbulbTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sBelliboltTeachableLearnset[] = {
+static const u16 sBelliboltTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE024, 0x2061, 0x0080, 0x1000, 0x4420, 0x0002),
     MOVE_HYPER_BEAM,
     MOVE_LIGHT_SCREEN,
     MOVE_PROTECT,
@@ -34130,10 +36264,12 @@ static const u16 sBelliboltTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sBelliboltTeachableLearnset (sBelliboltTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_TADBULB
 
 #if P_FAMILY_WATTREL
-static const u16 sWattrelTeachableLearnset[] = {
+static const u16 sWattrelTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8000, 0x0060, 0x80D0, 0x1000, 0x4400, 0x0002),
     MOVE_AERIAL_ACE,
     MOVE_FACADE,
     MOVE_FLY,
@@ -34147,8 +36283,10 @@ static const u16 sWattrelTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sWattrelTeachableLearnset (sWattrelTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sKilowattrelTeachableLearnset[] = {
+static const u16 sKilowattrelTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA000, 0x0060, 0x80D0, 0x1000, 0x4400, 0x0002),
     MOVE_AERIAL_ACE,
     MOVE_FACADE,
     MOVE_FLY,
@@ -34163,10 +36301,12 @@ static const u16 sKilowattrelTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sKilowattrelTeachableLearnset (sKilowattrelTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_WATTREL
 
 #if P_FAMILY_MASCHIFF
-static const u16 sMaschiffTeachableLearnset[] = {
+static const u16 sMaschiffTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8610, 0x0101, 0x02C0, 0x1240, 0x2400, 0x0000),
     MOVE_DIG,
     MOVE_FACADE,
     MOVE_PROTECT,
@@ -34183,8 +36323,10 @@ static const u16 sMaschiffTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sMaschiffTeachableLearnset (sMaschiffTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sMabosstiffTeachableLearnset[] = {
+static const u16 sMabosstiffTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA610, 0x0101, 0x02C0, 0x1240, 0x2400, 0x0000),
     MOVE_DIG,
     MOVE_FACADE,
     MOVE_HYPER_BEAM,
@@ -34202,10 +36344,12 @@ static const u16 sMabosstiffTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sMabosstiffTeachableLearnset (sMabosstiffTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_MASCHIFF
 
 #if P_FAMILY_SHROODLE
-static const u16 sShroodleTeachableLearnset[] = {
+static const u16 sShroodleTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8620, 0x0101, 0x02C1, 0x1200, 0xA470, 0x0000),
     MOVE_DIG,
     MOVE_FACADE,
     MOVE_PROTECT,
@@ -34226,8 +36370,10 @@ static const u16 sShroodleTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sShroodleTeachableLearnset (sShroodleTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sGrafaiaiTeachableLearnset[] = {
+static const u16 sGrafaiaiTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8620, 0x0101, 0x02C1, 0x1200, 0xA470, 0x0000),
     MOVE_DIG,
     MOVE_FACADE,
     MOVE_PROTECT,
@@ -34248,10 +36394,12 @@ static const u16 sGrafaiaiTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sGrafaiaiTeachableLearnset (sGrafaiaiTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_SHROODLE
 
 #if P_FAMILY_BRAMBLIN
-static const u16 sBramblinTeachableLearnset[] = {
+static const u16 sBramblinTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8100, 0x040A, 0x02C0, 0x1100, 0x0500, 0x0000),
     MOVE_BULLET_SEED,
     MOVE_FACADE,
     MOVE_GIGA_DRAIN,
@@ -34266,8 +36414,10 @@ static const u16 sBramblinTeachableLearnset[] = {
     MOVE_SLEEP_TALK,
     MOVE_UNAVAILABLE,
 };
+#define sBramblinTeachableLearnset (sBramblinTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sBrambleghastTeachableLearnset[] = {
+static const u16 sBrambleghastTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA100, 0x040A, 0x02C0, 0x1100, 0x0500, 0x0000),
     MOVE_BULLET_SEED,
     MOVE_FACADE,
     MOVE_GIGA_DRAIN,
@@ -34283,10 +36433,12 @@ static const u16 sBrambleghastTeachableLearnset[] = {
     MOVE_SLEEP_TALK,
     MOVE_UNAVAILABLE,
 };
+#define sBrambleghastTeachableLearnset (sBrambleghastTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_BRAMBLIN
 
 #if P_FAMILY_TOEDSCOOL
-static const u16 sToedscoolTeachableLearnset[] = {
+static const u16 sToedscoolTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC520, 0x200B, 0x0081, 0x1000, 0x4420, 0x0000),
     MOVE_BULLET_SEED,
     MOVE_GIGA_DRAIN,
     MOVE_LIGHT_SCREEN,
@@ -34304,8 +36456,10 @@ static const u16 sToedscoolTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sToedscoolTeachableLearnset (sToedscoolTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sToedscruelTeachableLearnset[] = {
+static const u16 sToedscruelTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE520, 0x200B, 0x0081, 0x1000, 0x4420, 0x0000),
     MOVE_BULLET_SEED,
     MOVE_GIGA_DRAIN,
     MOVE_HYPER_BEAM,
@@ -34324,10 +36478,12 @@ static const u16 sToedscruelTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sToedscruelTeachableLearnset (sToedscruelTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_TOEDSCOOL
 
 #if P_FAMILY_KLAWF
-static const u16 sKlawfTeachableLearnset[] = {
+static const u16 sKlawfTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA200, 0x0901, 0x02CA, 0x1048, 0x84A0, 0x0000),
     MOVE_BRICK_BREAK,
     MOVE_DIG,
     MOVE_FACADE,
@@ -34348,10 +36504,12 @@ static const u16 sKlawfTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sKlawfTeachableLearnset (sKlawfTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_KLAWF
 
 #if P_FAMILY_CAPSAKID
-static const u16 sCapsakidTeachableLearnset[] = {
+static const u16 sCapsakidTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8300, 0x000A, 0x02C2, 0x1000, 0x0500, 0x0000),
     MOVE_BULLET_SEED,
     MOVE_FACADE,
     MOVE_GIGA_DRAIN,
@@ -34366,8 +36524,10 @@ static const u16 sCapsakidTeachableLearnset[] = {
     MOVE_SLEEP_TALK,
     MOVE_UNAVAILABLE,
 };
+#define sCapsakidTeachableLearnset (sCapsakidTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sScovillainTeachableLearnset[] = {
+static const u16 sScovillainTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA300, 0x800A, 0x22C6, 0x1000, 0x0500, 0x0000),
     MOVE_BULLET_SEED,
     MOVE_FACADE,
     MOVE_FIRE_BLAST,
@@ -34386,10 +36546,12 @@ static const u16 sScovillainTeachableLearnset[] = {
     MOVE_SLEEP_TALK,
     MOVE_UNAVAILABLE,
 };
+#define sScovillainTeachableLearnset (sScovillainTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_CAPSAKID
 
 #if P_FAMILY_RELLOR
-static const u16 sRellorTeachableLearnset[] = {
+static const u16 sRellorTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8000, 0x0100, 0x02C9, 0x1100, 0x0520, 0x0000),
     MOVE_DIG,
     MOVE_FACADE,
     MOVE_PROTECT,
@@ -34404,8 +36566,10 @@ static const u16 sRellorTeachableLearnset[] = {
     MOVE_SLEEP_TALK,
     MOVE_UNAVAILABLE,
 };
+#define sRellorTeachableLearnset (sRellorTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sRabscaTeachableLearnset[] = {
+static const u16 sRabscaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE208, 0x2705, 0x0ACB, 0x1100, 0x0560, 0x0000),
     MOVE_CALM_MIND,
     MOVE_DIG,
     MOVE_FACADE,
@@ -34432,10 +36596,12 @@ static const u16 sRabscaTeachableLearnset[] = {
     MOVE_SLEEP_TALK,
     MOVE_UNAVAILABLE,
 };
+#define sRabscaTeachableLearnset (sRabscaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_RELLOR
 
 #if P_FAMILY_FLITTLE
-static const u16 sFlittleTeachableLearnset[] = {
+static const u16 sFlittleTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC208, 0x2201, 0x0AC2, 0x1000, 0x4420, 0x0000),
     MOVE_CALM_MIND,
     MOVE_FACADE,
     MOVE_LIGHT_SCREEN,
@@ -34454,8 +36620,10 @@ static const u16 sFlittleTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sFlittleTeachableLearnset (sFlittleTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sEspathraTeachableLearnset[] = {
+static const u16 sEspathraTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE208, 0x2601, 0x0AD2, 0x1240, 0x4460, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_CALM_MIND,
     MOVE_FACADE,
@@ -34480,10 +36648,12 @@ static const u16 sEspathraTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sEspathraTeachableLearnset (sEspathraTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_FLITTLE
 
 #if P_FAMILY_TINKATINK
-static const u16 sTinkatinkTeachableLearnset[] = {
+static const u16 sTinkatinkTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC000, 0x2000, 0x0AC8, 0x1008, 0x8490, 0x0002),
     MOVE_FACADE,
     MOVE_LIGHT_SCREEN,
     MOVE_PROTECT,
@@ -34501,8 +36671,10 @@ static const u16 sTinkatinkTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sTinkatinkTeachableLearnset (sTinkatinkTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sTinkatuffTeachableLearnset[] = {
+static const u16 sTinkatuffTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC000, 0x2800, 0x0AC8, 0x1008, 0x8490, 0x0002),
     MOVE_BRICK_BREAK,
     MOVE_FACADE,
     MOVE_LIGHT_SCREEN,
@@ -34521,8 +36693,10 @@ static const u16 sTinkatuffTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sTinkatuffTeachableLearnset (sTinkatuffTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sTinkatonTeachableLearnset[] = {
+static const u16 sTinkatonTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC000, 0x2800, 0x0AC8, 0x1008, 0x8490, 0x0002),
     MOVE_BRICK_BREAK,
     MOVE_FACADE,
     MOVE_LIGHT_SCREEN,
@@ -34541,10 +36715,12 @@ static const u16 sTinkatonTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sTinkatonTeachableLearnset (sTinkatonTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_TINKATINK
 
 #if P_FAMILY_WIGLETT
-static const u16 sWiglettTeachableLearnset[] = {
+static const u16 sWiglettTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9804, 0x0101, 0x00C2, 0x1001, 0x4420, 0x0000),
     MOVE_BLIZZARD,
     MOVE_DIG,
     MOVE_FACADE,
@@ -34561,8 +36737,10 @@ static const u16 sWiglettTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sWiglettTeachableLearnset (sWiglettTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sWugtrioTeachableLearnset[] = {
+static const u16 sWugtrioTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xB804, 0x0101, 0x00C2, 0x1001, 0x4420, 0x0000),
     MOVE_BLIZZARD,
     MOVE_DIG,
     MOVE_FACADE,
@@ -34580,10 +36758,12 @@ static const u16 sWugtrioTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sWugtrioTeachableLearnset (sWugtrioTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_WIGLETT
 
 #if P_FAMILY_BOMBIRDIER
-static const u16 sBombirdierTeachableLearnset[] = {
+static const u16 sBombirdierTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA600, 0x0001, 0x82FA, 0x1000, 0x04C2, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_FACADE,
     MOVE_FLY,
@@ -34604,10 +36784,12 @@ static const u16 sBombirdierTeachableLearnset[] = {
     MOVE_SLEEP_TALK,
     MOVE_UNAVAILABLE,
 };
+#define sBombirdierTeachableLearnset (sBombirdierTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_BOMBIRDIER
 
 #if P_FAMILY_FINIZEN
-static const u16 sFinizenTeachableLearnset[] = {
+static const u16 sFinizenTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9804, 0x0001, 0x00C0, 0x10F1, 0x4442, 0x0000),
     MOVE_BLIZZARD,
     MOVE_DIVE,
     MOVE_FACADE,
@@ -34627,8 +36809,10 @@ static const u16 sFinizenTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sFinizenTeachableLearnset (sFinizenTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sPalafinTeachableLearnset[] = {
+static const u16 sPalafinTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xBC85, 0x0001, 0x00C0, 0x10F1, 0x4443, 0x0000),
     MOVE_BLIZZARD,
     MOVE_BULK_UP,
     MOVE_DIVE,
@@ -34653,10 +36837,12 @@ static const u16 sPalafinTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sPalafinTeachableLearnset (sPalafinTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_FINIZEN
 
 #if P_FAMILY_VAROOM
-static const u16 sVaroomTeachableLearnset[] = {
+static const u16 sVaroomTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8620, 0x0001, 0x02E3, 0x1240, 0x2400, 0x0000),
     MOVE_FACADE,
     MOVE_PROTECT,
     MOVE_RAIN_DANCE,
@@ -34675,8 +36861,10 @@ static const u16 sVaroomTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sVaroomTeachableLearnset (sVaroomTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sRevavroomTeachableLearnset[] = {
+static const u16 sRevavroomTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA620, 0x0001, 0x22E3, 0x1240, 0x2400, 0x0000),
     MOVE_FACADE,
     MOVE_HYPER_BEAM,
     MOVE_OVERHEAT,
@@ -34697,10 +36885,12 @@ static const u16 sRevavroomTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sRevavroomTeachableLearnset (sRevavroomTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_VAROOM
 
 #if P_FAMILY_CYCLIZAR
-static const u16 sCyclizarTeachableLearnset[] = {
+static const u16 sCyclizarTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA602, 0x0031, 0x22D0, 0x1240, 0x0420, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_DRAGON_CLAW,
     MOVE_FACADE,
@@ -34721,10 +36911,12 @@ static const u16 sCyclizarTeachableLearnset[] = {
     MOVE_SLEEP_TALK,
     MOVE_UNAVAILABLE,
 };
+#define sCyclizarTeachableLearnset (sCyclizarTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_CYCLIZAR
 
 #if P_FAMILY_ORTHWORM
-static const u16 sOrthwormTeachableLearnset[] = {
+static const u16 sOrthwormTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA000, 0x0190, 0x00CA, 0x1240, 0x04A0, 0x0000),
     MOVE_DIG,
     MOVE_EARTHQUAKE,
     MOVE_FACADE,
@@ -34742,10 +36934,12 @@ static const u16 sOrthwormTeachableLearnset[] = {
     MOVE_SLEEP_TALK,
     MOVE_UNAVAILABLE,
 };
+#define sOrthwormTeachableLearnset (sOrthwormTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_ORTHWORM
 
 #if P_FAMILY_GLIMMET
-static const u16 sGlimmetTeachableLearnset[] = {
+static const u16 sGlimmetTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC220, 0x2001, 0x00CB, 0x3000, 0x0480, 0x0000),
     MOVE_FACADE,
     MOVE_LIGHT_SCREEN,
     MOVE_PROTECT,
@@ -34763,8 +36957,10 @@ static const u16 sGlimmetTeachableLearnset[] = {
     MOVE_SLEEP_TALK,
     MOVE_UNAVAILABLE,
 };
+#define sGlimmetTeachableLearnset (sGlimmetTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sGlimmoraTeachableLearnset[] = {
+static const u16 sGlimmoraTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE220, 0x2009, 0x00CB, 0x3000, 0x0480, 0x0000),
     MOVE_FACADE,
     MOVE_HYPER_BEAM,
     MOVE_LIGHT_SCREEN,
@@ -34784,10 +36980,12 @@ static const u16 sGlimmoraTeachableLearnset[] = {
     MOVE_SLEEP_TALK,
     MOVE_UNAVAILABLE,
 };
+#define sGlimmoraTeachableLearnset (sGlimmoraTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_GLIMMET
 
 #if P_FAMILY_GREAVARD
-static const u16 sGreavardTeachableLearnset[] = {
+static const u16 sGreavardTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8210, 0x0501, 0x02C2, 0x1200, 0x0420, 0x0000),
     MOVE_DIG,
     MOVE_FACADE,
     MOVE_PROTECT,
@@ -34804,8 +37002,10 @@ static const u16 sGreavardTeachableLearnset[] = {
     MOVE_SLEEP_TALK,
     MOVE_UNAVAILABLE,
 };
+#define sGreavardTeachableLearnset (sGreavardTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sHoundstoneTeachableLearnset[] = {
+static const u16 sHoundstoneTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA210, 0x0501, 0x02C2, 0x1200, 0x0420, 0x0000),
     MOVE_DIG,
     MOVE_FACADE,
     MOVE_HYPER_BEAM,
@@ -34823,10 +37023,12 @@ static const u16 sHoundstoneTeachableLearnset[] = {
     MOVE_SLEEP_TALK,
     MOVE_UNAVAILABLE,
 };
+#define sHoundstoneTeachableLearnset (sHoundstoneTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_GREAVARD
 
 #if P_FAMILY_FLAMIGO
-static const u16 sFlamigoTeachableLearnset[] = {
+static const u16 sFlamigoTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA484, 0x1000, 0x82D0, 0x1000, 0x8444, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_BULK_UP,
     MOVE_DOUBLE_TEAM,
@@ -34845,10 +37047,12 @@ static const u16 sFlamigoTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sFlamigoTeachableLearnset (sFlamigoTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_FLAMIGO
 
 #if P_FAMILY_CETODDLE
-static const u16 sCetoddleTeachableLearnset[] = {
+static const u16 sCetoddleTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xB804, 0x0081, 0x00C0, 0x1240, 0x0402, 0x0000),
     MOVE_BLIZZARD,
     MOVE_EARTHQUAKE,
     MOVE_FACADE,
@@ -34865,8 +37069,10 @@ static const u16 sCetoddleTeachableLearnset[] = {
     MOVE_SLEEP_TALK,
     MOVE_UNAVAILABLE,
 };
+#define sCetoddleTeachableLearnset (sCetoddleTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sCetitanTeachableLearnset[] = {
+static const u16 sCetitanTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xB804, 0x0081, 0x00C0, 0x1240, 0x0403, 0x0000),
     MOVE_BLIZZARD,
     MOVE_EARTHQUAKE,
     MOVE_FACADE,
@@ -34884,10 +37090,12 @@ static const u16 sCetitanTeachableLearnset[] = {
     MOVE_SLEEP_TALK,
     MOVE_UNAVAILABLE,
 };
+#define sCetitanTeachableLearnset (sCetitanTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_CETODDLE
 
 #if P_FAMILY_VELUZA
-static const u16 sVeluzaTeachableLearnset[] = {
+static const u16 sVeluzaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xB804, 0x0201, 0x0080, 0x1251, 0x0402, 0x0000),
     MOVE_BLIZZARD,
     MOVE_HYPER_BEAM,
     MOVE_ICE_BEAM,
@@ -34905,10 +37113,12 @@ static const u16 sVeluzaTeachableLearnset[] = {
     MOVE_SLEEP_TALK,
     MOVE_UNAVAILABLE,
 };
+#define sVeluzaTeachableLearnset (sVeluzaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_VELUZA
 
 #if P_FAMILY_DONDOZO
-static const u16 sDondozoTeachableLearnset[] = {
+static const u16 sDondozoTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA004, 0x0081, 0x00C0, 0x1271, 0x0480, 0x0000),
     MOVE_DIVE,
     MOVE_EARTHQUAKE,
     MOVE_FACADE,
@@ -34926,10 +37136,12 @@ static const u16 sDondozoTeachableLearnset[] = {
     MOVE_SLEEP_TALK,
     MOVE_UNAVAILABLE,
 };
+#define sDondozoTeachableLearnset (sDondozoTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_DONDOZO
 
 #if P_FAMILY_TATSUGIRI
-static const u16 sTatsugiriTeachableLearnset[] = {
+static const u16 sTatsugiriTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA404, 0x0001, 0x00C0, 0x1081, 0x0402, 0x0000),
     MOVE_FACADE,
     MOVE_HYPER_BEAM,
     MOVE_PROTECT,
@@ -34944,10 +37156,12 @@ static const u16 sTatsugiriTeachableLearnset[] = {
     MOVE_SLEEP_TALK,
     MOVE_UNAVAILABLE,
 };
+#define sTatsugiriTeachableLearnset (sTatsugiriTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_TATSUGIRI
 
 #if P_FAMILY_GREAT_TUSK
-static const u16 sGreatTuskTeachableLearnset[] = {
+static const u16 sGreatTuskTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA690, 0x0980, 0x00CA, 0x1340, 0x05A0, 0x0000),
     MOVE_BRICK_BREAK,
     MOVE_BULK_UP,
     MOVE_DIG,
@@ -34971,10 +37185,12 @@ static const u16 sGreatTuskTeachableLearnset[] = {
     MOVE_SLEEP_TALK,
     MOVE_UNAVAILABLE,
 };
+#define sGreatTuskTeachableLearnset (sGreatTuskTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_GREAT_TUSK
 
 #if P_FAMILY_SCREAM_TAIL
-static const u16 sScreamTailTeachableLearnset[] = {
+static const u16 sScreamTailTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xFA9C, 0xA361, 0x00CE, 0x5240, 0x0451, 0x0003),
     MOVE_BLIZZARD,
     MOVE_BULK_UP,
     MOVE_CALM_MIND,
@@ -35009,10 +37225,12 @@ static const u16 sScreamTailTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sScreamTailTeachableLearnset (sScreamTailTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_SCREAM_TAIL
 
 #if P_FAMILY_BRUTE_BONNET
-static const u16 sBruteBonnetTeachableLearnset[] = {
+static const u16 sBruteBonnetTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA700, 0x000A, 0x02C0, 0x1240, 0x0400, 0x0000),
     MOVE_BULLET_SEED,
     MOVE_FACADE,
     MOVE_GIGA_DRAIN,
@@ -35029,10 +37247,12 @@ static const u16 sBruteBonnetTeachableLearnset[] = {
     MOVE_SLEEP_TALK,
     MOVE_UNAVAILABLE,
 };
+#define sBruteBonnetTeachableLearnset (sBruteBonnetTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_BRUTE_BONNET
 
 #if P_FAMILY_FLUTTER_MANE
-static const u16 sFlutterManeTeachableLearnset[] = {
+static const u16 sFlutterManeTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA608, 0x0460, 0x0080, 0x1000, 0x4402, 0x0002),
     MOVE_CALM_MIND,
     MOVE_HYPER_BEAM,
     MOVE_PROTECT,
@@ -35049,10 +37269,12 @@ static const u16 sFlutterManeTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sFlutterManeTeachableLearnset (sFlutterManeTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_FLUTTER_MANE
 
 #if P_FAMILY_SLITHER_WING
-static const u16 sSlitherWingTeachableLearnset[] = {
+static const u16 sSlitherWingTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA280, 0x0883, 0x00D2, 0x1240, 0x0400, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_BRICK_BREAK,
     MOVE_BULK_UP,
@@ -35071,10 +37293,12 @@ static const u16 sSlitherWingTeachableLearnset[] = {
     MOVE_SLEEP_TALK,
     MOVE_UNAVAILABLE,
 };
+#define sSlitherWingTeachableLearnset (sSlitherWingTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_SLITHER_WING
 
 #if P_FAMILY_SANDY_SHOCKS
-static const u16 sSandyShocksTeachableLearnset[] = {
+static const u16 sSandyShocksTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE200, 0x20E0, 0x00C2, 0x1040, 0x4400, 0x0002),
     MOVE_EARTHQUAKE,
     MOVE_FACADE,
     MOVE_HYPER_BEAM,
@@ -35093,10 +37317,12 @@ static const u16 sSandyShocksTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sSandyShocksTeachableLearnset (sSandyShocksTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_SANDY_SHOCKS
 
 #if P_FAMILY_IRON_TREADS
-static const u16 sIronTreadsTeachableLearnset[] = {
+static const u16 sIronTreadsTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA000, 0x00C0, 0x00CA, 0x0340, 0x05A0, 0x0000),
     MOVE_EARTHQUAKE,
     MOVE_FACADE,
     MOVE_HYPER_BEAM,
@@ -35114,10 +37340,12 @@ static const u16 sIronTreadsTeachableLearnset[] = {
     MOVE_SLEEP_TALK,
     MOVE_UNAVAILABLE,
 };
+#define sIronTreadsTeachableLearnset (sIronTreadsTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_IRON_TREADS
 
 #if P_FAMILY_IRON_BUNDLE
-static const u16 sIronBundleTeachableLearnset[] = {
+static const u16 sIronBundleTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xBC04, 0x0001, 0x02C0, 0x1040, 0x4403, 0x0000),
     MOVE_BLIZZARD,
     MOVE_FACADE,
     MOVE_HYPER_BEAM,
@@ -35136,10 +37364,12 @@ static const u16 sIronBundleTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sIronBundleTeachableLearnset (sIronBundleTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_IRON_BUNDLE
 
 #if P_FAMILY_IRON_HANDS
-static const u16 sIronHandsTeachableLearnset[] = {
+static const u16 sIronHandsTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA001, 0x08E0, 0x00C8, 0x5240, 0x8691, 0x0001),
     MOVE_BRICK_BREAK,
     MOVE_EARTHQUAKE,
     MOVE_FACADE,
@@ -35163,10 +37393,12 @@ static const u16 sIronHandsTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sIronHandsTeachableLearnset (sIronHandsTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_IRON_HANDS
 
 #if P_FAMILY_IRON_JUGULIS
-static const u16 sIronJugulisTeachableLearnset[] = {
+static const u16 sIronJugulisTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA610, 0x8001, 0x80CC, 0x1240, 0x0400, 0x0000),
     MOVE_FACADE,
     MOVE_FIRE_BLAST,
     MOVE_FLAMETHROWER,
@@ -35185,10 +37417,12 @@ static const u16 sIronJugulisTeachableLearnset[] = {
     MOVE_SLEEP_TALK,
     MOVE_UNAVAILABLE,
 };
+#define sIronJugulisTeachableLearnset (sIronJugulisTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_IRON_JUGULIS
 
 #if P_FAMILY_IRON_MOTH
-static const u16 sIronMothTeachableLearnset[] = {
+static const u16 sIronMothTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE220, 0x8208, 0x20C4, 0x1000, 0x4400, 0x0000),
     MOVE_FACADE,
     MOVE_FIRE_BLAST,
     MOVE_FLAMETHROWER,
@@ -35206,10 +37440,12 @@ static const u16 sIronMothTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sIronMothTeachableLearnset (sIronMothTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_IRON_MOTH
 
 #if P_FAMILY_IRON_THORNS
-static const u16 sIronThornsTeachableLearnset[] = {
+static const u16 sIronThornsTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xBE02, 0x89E1, 0x00CE, 0x5240, 0x8481, 0x0003),
     MOVE_BLIZZARD,
     MOVE_BRICK_BREAK,
     MOVE_DIG,
@@ -35241,10 +37477,12 @@ static const u16 sIronThornsTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sIronThornsTeachableLearnset (sIronThornsTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_IRON_THORNS
 
 #if P_FAMILY_FRIGIBAX
-static const u16 sFrigibaxTeachableLearnset[] = {
+static const u16 sFrigibaxTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9802, 0x0101, 0x00C0, 0x1040, 0x8402, 0x0000),
     MOVE_BLIZZARD,
     MOVE_DIG,
     MOVE_DRAGON_CLAW,
@@ -35260,8 +37498,10 @@ static const u16 sFrigibaxTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sFrigibaxTeachableLearnset (sFrigibaxTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sArctibaxTeachableLearnset[] = {
+static const u16 sArctibaxTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x9802, 0x0901, 0x00D0, 0x1040, 0x8402, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_BLIZZARD,
     MOVE_BRICK_BREAK,
@@ -35279,8 +37519,10 @@ static const u16 sArctibaxTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sArctibaxTeachableLearnset (sArctibaxTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sBaxcaliburTeachableLearnset[] = {
+static const u16 sBaxcaliburTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xB802, 0x0981, 0x00D0, 0x1240, 0x8402, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_BLIZZARD,
     MOVE_BRICK_BREAK,
@@ -35301,10 +37543,12 @@ static const u16 sBaxcaliburTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sBaxcaliburTeachableLearnset (sBaxcaliburTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_FRIGIBAX
 
 #if P_FAMILY_GIMMIGHOUL
-static const u16 sGimmighoulTeachableLearnset[] = {
+static const u16 sGimmighoulTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xC000, 0x2400, 0x0280, 0x1000, 0x0400, 0x0000),
     MOVE_LIGHT_SCREEN,
     MOVE_PROTECT,
     MOVE_REFLECT,
@@ -35315,8 +37559,10 @@ static const u16 sGimmighoulTeachableLearnset[] = {
     MOVE_SLEEP_TALK,
     MOVE_UNAVAILABLE,
 };
+#define sGimmighoulTeachableLearnset (sGimmighoulTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sGholdengoTeachableLearnset[] = {
+static const u16 sGholdengoTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE001, 0x2660, 0x0282, 0x1000, 0x0400, 0x0003),
     MOVE_FOCUS_PUNCH,
     MOVE_HYPER_BEAM,
     MOVE_LIGHT_SCREEN,
@@ -35335,10 +37581,12 @@ static const u16 sGholdengoTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sGholdengoTeachableLearnset (sGholdengoTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_GIMMIGHOUL
 
 #if P_FAMILY_WO_CHIEN
-static const u16 sWoChienTeachableLearnset[] = {
+static const u16 sWoChienTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE700, 0x200B, 0x00C0, 0x1040, 0x0420, 0x0000),
     MOVE_BULLET_SEED,
     MOVE_FACADE,
     MOVE_GIGA_DRAIN,
@@ -35357,10 +37605,12 @@ static const u16 sWoChienTeachableLearnset[] = {
     MOVE_SLEEP_TALK,
     MOVE_UNAVAILABLE,
 };
+#define sWoChienTeachableLearnset (sWoChienTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_WO_CHIEN
 
 #if P_FAMILY_CHIEN_PAO
-static const u16 sChienPaoTeachableLearnset[] = {
+static const u16 sChienPaoTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xB400, 0x0801, 0x00D0, 0x1000, 0x8402, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_BLIZZARD,
     MOVE_BRICK_BREAK,
@@ -35376,10 +37626,12 @@ static const u16 sChienPaoTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sChienPaoTeachableLearnset (sChienPaoTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_CHIEN_PAO
 
 #if P_FAMILY_TING_LU
-static const u16 sTingLuTeachableLearnset[] = {
+static const u16 sTingLuTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA600, 0x0180, 0x00CA, 0x1240, 0x04A0, 0x0000),
     MOVE_DIG,
     MOVE_EARTHQUAKE,
     MOVE_FACADE,
@@ -35398,10 +37650,12 @@ static const u16 sTingLuTeachableLearnset[] = {
     MOVE_SLEEP_TALK,
     MOVE_UNAVAILABLE,
 };
+#define sTingLuTeachableLearnset (sTingLuTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_TING_LU
 
 #if P_FAMILY_CHI_YU
-static const u16 sChiYuTeachableLearnset[] = {
+static const u16 sChiYuTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE600, 0xA200, 0x20C4, 0x1000, 0x2400, 0x0000),
     MOVE_FACADE,
     MOVE_FIRE_BLAST,
     MOVE_FLAMETHROWER,
@@ -35419,10 +37673,12 @@ static const u16 sChiYuTeachableLearnset[] = {
     MOVE_SWAGGER,
     MOVE_UNAVAILABLE,
 };
+#define sChiYuTeachableLearnset (sChiYuTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_CHI_YU
 
 #if P_FAMILY_ROARING_MOON
-static const u16 sRoaringMoonTeachableLearnset[] = {
+static const u16 sRoaringMoonTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA612, 0x8980, 0x80D4, 0x1240, 0x0480, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_BRICK_BREAK,
     MOVE_DIG,
@@ -35445,10 +37701,12 @@ static const u16 sRoaringMoonTeachableLearnset[] = {
     MOVE_SLEEP_TALK,
     MOVE_UNAVAILABLE,
 };
+#define sRoaringMoonTeachableLearnset (sRoaringMoonTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_ROARING_MOON
 
 #if P_FAMILY_IRON_VALIANT
-static const u16 sIronValiantTeachableLearnset[] = {
+static const u16 sIronValiantTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE408, 0x3E20, 0x0890, 0xD000, 0xC453, 0x0003),
     MOVE_AERIAL_ACE,
     MOVE_BRICK_BREAK,
     MOVE_CALM_MIND,
@@ -35477,10 +37735,12 @@ static const u16 sIronValiantTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sIronValiantTeachableLearnset (sIronValiantTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_IRON_VALIANT
 
 #if P_FAMILY_KORAIDON
-static const u16 sKoraidonTeachableLearnset[] = {
+static const u16 sKoraidonTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA693, 0x8908, 0x20C4, 0x12C8, 0x8420, 0x0000),
     MOVE_BRICK_BREAK,
     MOVE_BULK_UP,
     MOVE_DIG,
@@ -35507,10 +37767,12 @@ static const u16 sKoraidonTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sKoraidonTeachableLearnset (sKoraidonTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_KORAIDON
 
 #if P_FAMILY_MIRAIDON
-static const u16 sMiraidonTeachableLearnset[] = {
+static const u16 sMiraidonTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE40A, 0x6068, 0x20C0, 0x1040, 0x8400, 0x0002),
     MOVE_CALM_MIND,
     MOVE_DRAGON_CLAW,
     MOVE_FACADE,
@@ -35532,10 +37794,12 @@ static const u16 sMiraidonTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sMiraidonTeachableLearnset (sMiraidonTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_MIRAIDON
 
 #if P_FAMILY_WALKING_WAKE
-static const u16 sWalkingWakeTeachableLearnset[] = {
+static const u16 sWalkingWakeTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA216, 0x8001, 0x00C0, 0x1251, 0x4400, 0x0000),
     MOVE_DRAGON_CLAW,
     MOVE_FACADE,
     MOVE_FLAMETHROWER,
@@ -35555,10 +37819,12 @@ static const u16 sWalkingWakeTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sWalkingWakeTeachableLearnset (sWalkingWakeTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_WALKING_WAKE
 
 #if P_FAMILY_IRON_LEAVES
-static const u16 sIronLeavesTeachableLearnset[] = {
+static const u16 sIronLeavesTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA408, 0x080A, 0x00D0, 0x1200, 0xC400, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_BRICK_BREAK,
     MOVE_CALM_MIND,
@@ -35576,10 +37842,12 @@ static const u16 sIronLeavesTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sIronLeavesTeachableLearnset (sIronLeavesTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_IRON_LEAVES
 
 #if P_FAMILY_POLTCHAGEIST
-static const u16 sPoltchageistTeachableLearnset[] = {
+static const u16 sPoltchageistTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8008, 0x240A, 0x0080, 0x1000, 0x0440, 0x0000),
     MOVE_CALM_MIND,
     MOVE_GIGA_DRAIN,
     MOVE_PROTECT,
@@ -35592,8 +37860,10 @@ static const u16 sPoltchageistTeachableLearnset[] = {
     MOVE_SLEEP_TALK,
     MOVE_UNAVAILABLE,
 };
+#define sPoltchageistTeachableLearnset (sPoltchageistTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 
-static const u16 sSinistchaTeachableLearnset[] = {
+static const u16 sSinistchaTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA008, 0x240A, 0x0080, 0x1000, 0x0440, 0x0000),
     MOVE_CALM_MIND,
     MOVE_GIGA_DRAIN,
     MOVE_HYPER_BEAM,
@@ -35607,10 +37877,12 @@ static const u16 sSinistchaTeachableLearnset[] = {
     MOVE_SLEEP_TALK,
     MOVE_UNAVAILABLE,
 };
+#define sSinistchaTeachableLearnset (sSinistchaTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_POLTCHAGEIST
 
 #if P_FAMILY_OKIDOGI
-static const u16 sOkidogiTeachableLearnset[] = {
+static const u16 sOkidogiTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA4B1, 0x0900, 0x02C9, 0x52C0, 0x0401, 0x0001),
     MOVE_BRICK_BREAK,
     MOVE_BULK_UP,
     MOVE_DIG,
@@ -35635,10 +37907,12 @@ static const u16 sOkidogiTeachableLearnset[] = {
     MOVE_THUNDER_PUNCH,
     MOVE_UNAVAILABLE,
 };
+#define sOkidogiTeachableLearnset (sOkidogiTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_OKIDOGI
 
 #if P_FAMILY_MUNKIDORI
-static const u16 sMunkidoriTeachableLearnset[] = {
+static const u16 sMunkidoriTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE428, 0x0600, 0x02C1, 0x1000, 0x4470, 0x0000),
     MOVE_CALM_MIND,
     MOVE_FACADE,
     MOVE_HYPER_BEAM,
@@ -35659,10 +37933,12 @@ static const u16 sMunkidoriTeachableLearnset[] = {
     MOVE_SWIFT,
     MOVE_UNAVAILABLE,
 };
+#define sMunkidoriTeachableLearnset (sMunkidoriTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_MUNKIDORI
 
 #if P_FAMILY_FEZANDIPITI
-static const u16 sFezandipitiTeachableLearnset[] = {
+static const u16 sFezandipitiTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xE428, 0x0400, 0x83D1, 0x1000, 0xE442, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_ATTRACT,
     MOVE_CALM_MIND,
@@ -35686,10 +37962,12 @@ static const u16 sFezandipitiTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sFezandipitiTeachableLearnset (sFezandipitiTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_FEZANDIPITI
 
 #if P_FAMILY_OGERPON
-static const u16 sOgerponTeachableLearnset[] = {
+static const u16 sOgerponTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8700, 0x080B, 0x00CA, 0x1080, 0x8400, 0x0000),
     MOVE_BRICK_BREAK,
     MOVE_BULLET_SEED,
     MOVE_FACADE,
@@ -35708,10 +37986,12 @@ static const u16 sOgerponTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sOgerponTeachableLearnset (sOgerponTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_OGERPON
 
 #if P_FAMILY_GOUGING_FIRE
-static const u16 sGougingFireTeachableLearnset[] = {
+static const u16 sGougingFireTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA212, 0x8080, 0x20C4, 0x1240, 0x0400, 0x0000),
     MOVE_DRAGON_CLAW,
     MOVE_EARTHQUAKE,
     MOVE_FACADE,
@@ -35729,10 +38009,12 @@ static const u16 sGougingFireTeachableLearnset[] = {
     MOVE_SLEEP_TALK,
     MOVE_UNAVAILABLE,
 };
+#define sGougingFireTeachableLearnset (sGougingFireTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_GOUGING_FIRE
 
 #if P_FAMILY_RAGING_BOLT
-static const u16 sRagingBoltTeachableLearnset[] = {
+static const u16 sRagingBoltTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA618, 0x40E8, 0x00C0, 0x1240, 0x0400, 0x0002),
     MOVE_CALM_MIND,
     MOVE_EARTHQUAKE,
     MOVE_FACADE,
@@ -35753,10 +38035,12 @@ static const u16 sRagingBoltTeachableLearnset[] = {
     MOVE_THUNDER_WAVE,
     MOVE_UNAVAILABLE,
 };
+#define sRagingBoltTeachableLearnset (sRagingBoltTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_RAGING_BOLT
 
 #if P_FAMILY_IRON_BOULDER
-static const u16 sIronBoulderTeachableLearnset[] = {
+static const u16 sIronBoulderTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA400, 0x0A80, 0x00DA, 0x12C0, 0x8400, 0x0000),
     MOVE_AERIAL_ACE,
     MOVE_BRICK_BREAK,
     MOVE_EARTHQUAKE,
@@ -35776,10 +38060,12 @@ static const u16 sIronBoulderTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sIronBoulderTeachableLearnset (sIronBoulderTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_IRON_BOULDER
 
 #if P_FAMILY_IRON_CROWN
-static const u16 sIronCrownTeachableLearnset[] = {
+static const u16 sIronCrownTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xA008, 0x0A00, 0x00C0, 0x1240, 0x8400, 0x0000),
     MOVE_BRICK_BREAK,
     MOVE_CALM_MIND,
     MOVE_FACADE,
@@ -35794,10 +38080,12 @@ static const u16 sIronCrownTeachableLearnset[] = {
     MOVE_SWORDS_DANCE,
     MOVE_UNAVAILABLE,
 };
+#define sIronCrownTeachableLearnset (sIronCrownTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_IRON_CROWN
 
 #if P_FAMILY_TERAPAGOS
-static const u16 sTerapagosTeachableLearnset[] = {
+static const u16 sTerapagosTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0xAA3C, 0x80E9, 0x00C0, 0x1241, 0x0480, 0x0000),
     MOVE_CALM_MIND,
     MOVE_EARTHQUAKE,
     MOVE_FACADE,
@@ -35822,10 +38110,12 @@ static const u16 sTerapagosTeachableLearnset[] = {
     MOVE_SLEEP_TALK,
     MOVE_UNAVAILABLE,
 };
+#define sTerapagosTeachableLearnset (sTerapagosTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_TERAPAGOS
 
 #if P_FAMILY_PECHARUNT
-static const u16 sPecharuntTeachableLearnset[] = {
+static const u16 sPecharuntTeachableLearnsetWithBitset[] = {
+    TEACHABLE_BITSET(0x8020, 0x0400, 0x0081, 0x1100, 0x0500, 0x0000),
     MOVE_PROTECT,
     MOVE_REST,
     MOVE_SHADOW_BALL,
@@ -35837,4 +38127,5 @@ static const u16 sPecharuntTeachableLearnset[] = {
     MOVE_SLEEP_TALK,
     MOVE_UNAVAILABLE,
 };
+#define sPecharuntTeachableLearnset (sPecharuntTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)
 #endif //P_FAMILY_PECHARUNT
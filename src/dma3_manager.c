@@ -3,6 +3,10 @@
 
 #define MAX_DMA_REQUESTS 128
 
+// Don't transfer more than this in one VBlank, the rest waits for the
+// next one.
+#define DMA_BYTES_PER_VBLANK (40 * 1024)
+
 #define DMA_REQUEST_COPY32 1
 #define DMA_REQUEST_FILL32 2
 #define DMA_REQUEST_COPY16 3
@@ -21,6 +25,8 @@ static struct Dma3Request sDma3Requests[MAX_DMA_REQUESTS];
 
 static vbool8 sDma3ManagerLocked;
 static u8 sDma3RequestCursor;
+static s16 sDma3LastRequest = -1;
+static struct Dma3Stats sDma3Stats;
 
 void ClearDma3Requests(void)
 {
@@ -28,6 +34,7 @@ void ClearDma3Requests(void)
 
     sDma3ManagerLocked = TRUE;
     sDma3RequestCursor = 0;
+    sDma3LastRequest = -1;
 
     for (i = 0; i < MAX_DMA_REQUESTS; i++)
     {
@@ -39,24 +46,47 @@ void ClearDma3Requests(void)
     sDma3ManagerLocked = FALSE;
 }
 
+static u32 CountPendingDma3Requests(void)
+{
+    u32 cursor = sDma3RequestCursor;
+    u32 count = 0;
+
+    while (count < MAX_DMA_REQUESTS && sDma3Requests[cursor].size != 0)
+    {
+        count++;
+        if (++cursor >= MAX_DMA_REQUESTS)
+            cursor = 0;
+    }
+    return count;
+}
+
 void ProcessDma3Requests(void)
 {
-    u16 bytesTransferred;
+    u32 bytesTransferred;
+    u32 startVCount;
 
     if (sDma3ManagerLocked)
         return;
 
     bytesTransferred = 0;
+    startVCount = *(u8 *)REG_ADDR_VCOUNT;
+    sDma3Stats.bytesTransferred = 0;
+    sDma3Stats.requestsProcessed = 0;
+    sDma3Stats.requestsDeferred = 0;
 
     // as long as there are DMA requests to process (unless size or vblank is an issue), do not exit
     while (sDma3Requests[sDma3RequestCursor].size != 0)
     {
         bytesTransferred += sDma3Requests[sDma3RequestCursor].size;
 
-        if (bytesTransferred > 40 * 1024)
-            return; // don't transfer more than 40 KiB
-        if (*(u8 *)REG_ADDR_VCOUNT > 224)
-            return; // we're about to leave vblank, stop
+        // Requests larger than the budget still go out, alone, so that
+        // they can't block the queue forever.
+        if ((bytesTransferred > DMA_BYTES_PER_VBLANK && sDma3Stats.requestsProcessed != 0)
+         || *(u8 *)REG_ADDR_VCOUNT > 224) // we're about to leave vblank, stop
+        {
+            sDma3Stats.requestsDeferred = CountPendingDma3Requests();
+            break;
+        }
 
         switch (sDma3Requests[sDma3RequestCursor].mode)
         {
@@ -92,7 +122,53 @@ void ProcessDma3Requests(void)
 
         if (sDma3RequestCursor >= MAX_DMA_REQUESTS) // loop back to the first DMA request
             sDma3RequestCursor = 0;
+
+        sDma3Stats.bytesTransferred = bytesTransferred;
+        sDma3Stats.requestsProcessed++;
     }
+
+    sDma3Stats.scanlinesUsed = (*(u8 *)REG_ADDR_VCOUNT + DISPLAY_HEIGHT + 68 - startVCount) % (DISPLAY_HEIGHT + 68);
+}
+
+// Extends the most recent request instead of queueing a new one when the
+// new one continues it, so that e.g. consecutive tiles go out as one DMA.
+// Merged requests are kept within the VBlank budget, otherwise they would
+// have to go out alone and could overrun VBlank.
+static s16 TryMergeDma3Request(const void *src, void *dest, u16 size, u16 mode, u32 value)
+{
+    struct Dma3Request *last;
+
+    if (sDma3LastRequest < 0)
+        return -1;
+
+    last = &sDma3Requests[sDma3LastRequest];
+    if (last->size == 0 || last->mode != mode
+     || last->dest + last->size != dest
+     || last->size + size > DMA_BYTES_PER_VBLANK)
+        return -1;
+
+    switch (mode)
+    {
+    case DMA_REQUEST_COPY32:
+    case DMA_REQUEST_COPY16:
+        if (last->src + last->size != src)
+            return -1;
+        break;
+    case DMA_REQUEST_FILL32:
+    case DMA_REQUEST_FILL16:
+        if (last->value != value)
+            return -1;
+        break;
+    }
+
+    last->size += size;
+    sDma3Stats.requestsMerged++;
+    return sDma3LastRequest;
+}
+
+void GetDma3Stats(struct Dma3Stats *stats)
+{
+    *stats = sDma3Stats;
 }
 
 s16 RequestDma3Copy(const void *src, void *dest, u16 size, u32 mode)
@@ -101,6 +177,12 @@ s16 RequestDma3Copy(const void *src, void *dest, u16 size, u32 mode)
     int i = 0;
 
     sDma3ManagerLocked = TRUE;
+    cursor = TryMergeDma3Request(src, dest, size, mode == 1 ? DMA_REQUEST_COPY32 : DMA_REQUEST_COPY16, 0);
+    if (cursor != -1)
+    {
+        sDma3ManagerLocked = FALSE;
+        return cursor;
+    }
     cursor = sDma3RequestCursor;
 
     while (i < MAX_DMA_REQUESTS)
@@ -116,6 +198,7 @@ s16 RequestDma3Copy(const void *src, void *dest, u16 size, u32 mode)
             else
                 sDma3Requests[cursor].mode = DMA_REQUEST_COPY16;
 
+            sDma3LastRequest = cursor;
             sDma3ManagerLocked = FALSE;
             return cursor;
         }
@@ -132,8 +215,14 @@ s16 RequestDma3Fill(s32 value, void *dest, u16 size, u32 mode)
     int cursor;
     int i = 0;
 
-    cursor = sDma3RequestCursor;
     sDma3ManagerLocked = TRUE;
+    cursor = TryMergeDma3Request(NULL, dest, size, mode == 1 ? DMA_REQUEST_FILL32 : DMA_REQUEST_FILL16, value);
+    if (cursor != -1)
+    {
+        sDma3ManagerLocked = FALSE;
+        return cursor;
+    }
+    cursor = sDma3RequestCursor;
 
     while (i < MAX_DMA_REQUESTS)
     {
@@ -149,6 +238,7 @@ s16 RequestDma3Fill(s32 value, void *dest, u16 size, u32 mode)
             else
                 sDma3Requests[cursor].mode = DMA_REQUEST_FILL16;
 
+            sDma3LastRequest = cursor;
             sDma3ManagerLocked = FALSE;
             return cursor;
         }
@@ -3330,7 +3330,7 @@ u8 CopySprite(struct Sprite *sprite, s16 x, s16 y, u8 subpriority)
     {
         if (!gSprites[i].inUse)
         {
-            gSprites[i] = *sprite;
+            CloneSpriteAt(i, sprite);
             gSprites[i].x = x;
             gSprites[i].y = y;
             gSprites[i].subpriority = subpriority;
@@ -3348,7 +3348,7 @@ u8 CreateCopySpriteAt(struct Sprite *sprite, s16 x, s16 y, u8 subpriority)
     {
         if (!gSprites[i].inUse)
         {
-            gSprites[i] = *sprite;
+            CloneSpriteAt(i, sprite);
             gSprites[i].x = x;
             gSprites[i].y = y;
             gSprites[i].subpriority = subpriority;
@@ -77,11 +77,13 @@ static const struct ScanlineEffectParams sFlashEffectParams =
 static void FillPalBufferWhite(void)
 {
     CpuFastFill16(RGB_WHITE, gPlttBufferFaded, PLTT_SIZE);
+    MarkPalettesDirty(PALETTES_ALL);
 }
 
 static void FillPalBufferBlack(void)
 {
     CpuFastFill16(RGB_BLACK, gPlttBufferFaded, PLTT_SIZE);
+    MarkPalettesDirty(PALETTES_ALL);
 }
 
 void WarpFadeInScreen(void)
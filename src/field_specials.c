@@ -3333,6 +3333,7 @@ void SetDeoxysRockPalette(void)
     LoadPalette(&sDeoxysRockPalettes[(u8)VarGet(VAR_DEOXYS_ROCK_LEVEL)], OBJ_PLTT_ID(paletteNum), PLTT_SIZEOF(4));
     // Set faded to all black, weather blending handled during fade-in
     CpuFill16(0, &gPlttBufferFaded[OBJ_PLTT_ID(paletteNum)], 32);
+    MarkPlttBufferDirty(OBJ_PLTT_ID(paletteNum), 16);
 }
 
 void SetPCBoxToSendMon(u8 boxId)
@@ -456,6 +456,7 @@ static void ApplyColorMap(u8 startPalIndex, u8 numPalettes, s8 colorMapIndex)
     const u8 *colorMap;
     u32 i;
 
+    MarkPlttBufferDirty(PLTT_ID(startPalIndex), PLTT_ID(numPalettes));
     if (colorMapIndex > 0)
     {
         colorMapIndex--;
@@ -474,22 +475,25 @@ static void ApplyColorMap(u8 startPalIndex, u8 numPalettes, s8 colorMapIndex)
             }
             else
             {
-                u8 r, g, b;
-
                 if (sPaletteColorMapTypes[curPalIndex] == COLOR_MAP_CONTRAST || curPalIndex - 16 == gWeatherPtr->contrastColorMapSpritePalIndex)
                     colorMap = sContrastColorMaps[colorMapIndex];
                 else
                     colorMap = sDarkenedContrastColorMaps[colorMapIndex];
 
+#if FAST_PALETTE_BLEND
+                ApplyColorMapToColors(&gPlttBufferUnfaded[palOffset], &gPlttBufferFaded[palOffset], 16, colorMap);
+                palOffset += 16;
+#else
                 for (i = 0; i < 16; i++)
                 {
                     // Apply color map to the original color.
                     struct RGBColor baseColor = *(struct RGBColor *)&gPlttBufferUnfaded[palOffset];
-                    r = colorMap[baseColor.r];
-                    g = colorMap[baseColor.g];
-                    b = colorMap[baseColor.b];
+                    u8 r = colorMap[baseColor.r];
+                    u8 g = colorMap[baseColor.g];
+                    u8 b = colorMap[baseColor.b];
                     gPlttBufferFaded[palOffset++] = RGB2(r, g, b);
                 }
+#endif
             }
 
             curPalIndex++;
@@ -534,12 +538,15 @@ static void ApplyColorMapWithBlend(u8 startPalIndex, u8 numPalettes, s8 colorMap
 {
     u16 palOffset;
     u16 curPalIndex;
+#if !FAST_PALETTE_BLEND
     u32 i;
     struct RGBColor color = *(struct RGBColor *)&blendColor;
     u8 rBlend = color.r;
     u8 gBlend = color.g;
     u8 bBlend = color.b;
+#endif
 
+    MarkPlttBufferDirty(PLTT_ID(startPalIndex), PLTT_ID(numPalettes));
     palOffset = PLTT_ID(startPalIndex);
     numPalettes += startPalIndex;
     colorMapIndex--;
@@ -562,6 +569,12 @@ static void ApplyColorMapWithBlend(u8 startPalIndex, u8 numPalettes, s8 colorMap
             else
                 colorMap = sContrastColorMaps[colorMapIndex];
 
+#if FAST_PALETTE_BLEND
+            // Apply color map to the original color, then blend the result toward the target color.
+            ApplyColorMapToColors(&gPlttBufferUnfaded[palOffset], &gPlttBufferFaded[palOffset], 16, colorMap);
+            BlendColors(&gPlttBufferFaded[palOffset], &gPlttBufferFaded[palOffset], 16, blendCoeff, blendColor);
+            palOffset += 16;
+#else
             for (i = 0; i < 16; i++)
             {
                 struct RGBColor baseColor = *(struct RGBColor *)&gPlttBufferUnfaded[palOffset];
@@ -575,6 +588,7 @@ static void ApplyColorMapWithBlend(u8 startPalIndex, u8 numPalettes, s8 colorMap
                 b += ((bBlend - b) * blendCoeff) >> 4;
                 gPlttBufferFaded[palOffset++] = RGB2(r, g, b);
             }
+#endif
         }
 
         curPalIndex++;
@@ -591,6 +605,7 @@ static void ApplyDroughtColorMapWithBlend(s8 colorMapIndex, u8 blendCoeff, u32 b
     u16 palOffset;
     u16 i;
 
+    MarkPalettesDirty(PALETTES_ALL);
     colorMapIndex = -colorMapIndex - 1;
     color = *(struct RGBColor *)&blendColor;
     rBlend = color.r;
@@ -645,6 +660,7 @@ static void ApplyFogBlend(u8 blendCoeff, u32 blendColor)
     u16 curPalIndex;
 
     BlendPalette(BG_PLTT_ID(0), 16 * 16, blendCoeff, blendColor);
+    MarkPalettesDirty(PALETTES_OBJECTS);
     color = *(struct RGBColor *)&blendColor;
     rBlend = color.r;
     gBlend = color.g;
@@ -814,6 +830,7 @@ void UpdateSpritePaletteWithWeather(u8 spritePaletteIndex)
             paletteIndex = PLTT_ID(paletteIndex);
             for (i = 0; i < 16; i++)
                 gPlttBufferFaded[paletteIndex + i] = gWeatherPtr->fadeDestColor;
+            MarkPlttBufferDirty(paletteIndex, 16);
         }
         break;
     case WEATHER_PAL_STATE_SCREEN_FADING_OUT:
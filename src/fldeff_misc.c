@@ -425,6 +425,7 @@ static void Task_ComputerScreenCloseEffect(u8 taskId)
     {
     case 0:
         gPlttBufferFaded[0] = 0;
+        MarkPalettesDirty(1 << 0);
         break;
     case 1:
         task->tWinLeft = 0;
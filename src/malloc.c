@@ -9,6 +9,119 @@ static u32 sHeapSize;
 
 ALIGNED(4) EWRAM_DATA u8 gHeap[HEAP_SIZE] = {0};
 
+// Free blocks are also kept in segregated free lists, so that allocating
+// only looks at blocks of about the right size instead of walking every
+// block in the heap. Sizes below SMALL_BIN_LIMIT get a bin per 8 bytes,
+// larger ones a bin per power of two. sNonEmptyBins has a bit set for each
+// bin with blocks in it.
+#define SMALL_BIN_LIMIT 128
+#define NUM_SMALL_BINS (SMALL_BIN_LIMIT / 8)
+#define NUM_BINS (NUM_SMALL_BINS + 18 - 7)
+
+STATIC_ASSERT(NUM_BINS <= 32, TooManyMallocBins);
+
+static struct MemBlock *sBins[NUM_BINS];
+static u32 sNonEmptyBins;
+
+// A free block's list links live in the last bytes of its data, so that
+// the header stays the same size. They go at the end rather than the start
+// because some code reads the start of an allocation after freeing it (see
+// the sprite->template note in sprite.h), and a merge never moves where a
+// block begins.
+struct FreeLinks
+{
+    struct MemBlock *prev;
+    struct MemBlock *next;
+};
+
+#define MIN_BLOCK_SIZE sizeof(struct FreeLinks)
+
+STATIC_ASSERT(sizeof(struct MemBlock) == 16, MemBlockHeaderSize);
+
+static struct FreeLinks *GetFreeLinks(struct MemBlock *block)
+{
+    return (struct FreeLinks *)(block->data + block->size) - 1;
+}
+
+static u32 BinIndex(u32 size)
+{
+    u32 i;
+
+    if (size < SMALL_BIN_LIMIT)
+        return size / 8;
+
+    for (i = NUM_SMALL_BINS; size >= 2 * SMALL_BIN_LIMIT && i < NUM_BINS - 1; i++)
+        size >>= 1;
+    return i;
+}
+
+// Blocks go on the front of their list, so that Free takes the same time
+// however many blocks are free, and the next allocation of that size gets
+// the block that was freed most recently.
+static void InsertFreeBlock(struct MemBlock *block)
+{
+    u32 bin = BinIndex(block->size);
+    struct MemBlock *next = sBins[bin];
+
+    GetFreeLinks(block)->prev = NULL;
+    GetFreeLinks(block)->next = next;
+    if (next != NULL)
+        GetFreeLinks(next)->prev = block;
+    sBins[bin] = block;
+    sNonEmptyBins |= 1 << bin;
+}
+
+// Must be called before the block's size changes, as that moves its links.
+static void RemoveFreeBlock(struct MemBlock *block)
+{
+    struct FreeLinks *links = GetFreeLinks(block);
+
+    if (links->prev != NULL)
+    {
+        GetFreeLinks(links->prev)->next = links->next;
+    }
+    else
+    {
+        u32 bin = BinIndex(block->size);
+        sBins[bin] = links->next;
+        if (sBins[bin] == NULL)
+            sNonEmptyBins &= ~(1 << bin);
+    }
+
+    if (links->next != NULL)
+        GetFreeLinks(links->next)->prev = links->prev;
+}
+
+// Returns the first free block in the first bin that can hold size bytes.
+// Blocks in the bin for size itself may still be too small, but any block
+// in a later bin is big enough.
+static struct MemBlock *FindFreeBlock(u32 size)
+{
+    u32 bin = BinIndex(size);
+    u32 laterBins;
+    struct MemBlock *block;
+
+    for (block = sBins[bin]; block != NULL; block = GetFreeLinks(block)->next)
+    {
+        if (block->size >= size)
+            return block;
+    }
+
+    laterBins = sNonEmptyBins & ~((2 << bin) - 1);
+    if (laterBins == 0)
+        return NULL;
+    return sBins[__builtin_ctz(laterBins)];
+}
+
+static void ResetBins(void)
+{
+    u32 i;
+
+    for (i = 0; i < NUM_BINS; i++)
+        sBins[i] = NULL;
+    sNonEmptyBins = 0;
+}
+
 void PutMemBlockHeader(void *block, struct MemBlock *prev, struct MemBlock *next, u32 size)
 {
     struct MemBlock *header = (struct MemBlock *)block;
@@ -25,12 +138,14 @@ void PutMemBlockHeader(void *block, struct MemBlock *prev, struct MemBlock *next
 void PutFirstMemBlockHeader(void *block, u32 size)
 {
     PutMemBlockHeader(block, (struct MemBlock *)block, (struct MemBlock *)block, size - sizeof(struct MemBlock));
+    ResetBins();
+    InsertFreeBlock((struct MemBlock *)block);
 }
 
 void *AllocInternal(void *heapStart, u32 size, const char *location)
 {
-    struct MemBlock *pos = (struct MemBlock *)heapStart;
-    struct MemBlock *head = pos;
+    struct MemBlock *head = (struct MemBlock *)heapStart;
+    struct MemBlock *pos;
     struct MemBlock *splitBlock;
     u32 foundBlockSize;
 
@@ -38,74 +153,70 @@ void *AllocInternal(void *heapStart, u32 size, const char *location)
     if (size & 3)
         size = 4 * ((size / 4) + 1);
 
-    for (;;)
-    {
-        // Loop through the blocks looking for unused block that's big enough.
+    // Room for the free list links once this is freed.
+    if (size < MIN_BLOCK_SIZE)
+        size = MIN_BLOCK_SIZE;
 
-        if (!pos->allocated)
-        {
-            foundBlockSize = pos->size;
+    pos = FindFreeBlock(size);
 
-            if (foundBlockSize >= size)
+    if (pos == NULL)
+    {
+#if TESTING
+        const struct MemBlock *head = HeapHead();
+        const struct MemBlock *block = head;
+        do
+        {
+            if (block->allocated)
             {
-                if (foundBlockSize - size < 2 * sizeof(struct MemBlock))
-                {
-                    // The block isn't much bigger than the requested size,
-                    // so just use it.
-                    pos->allocated = TRUE;
-                }
+                const char *location = MemBlockLocation(block);
+                if (location)
+                    Test_MgbaPrintf("%s: %d bytes allocated", location, block->size);
                 else
-                {
-                    // The block is significantly bigger than the requested
-                    // size, so split the rest into a separate block.
-                    foundBlockSize -= sizeof(struct MemBlock);
-                    foundBlockSize -= size;
-
-                    splitBlock = (struct MemBlock *)(pos->data + size);
+                    Test_MgbaPrintf("<unknown>: %d bytes allocated", block->size);
+            }
+            block = block->next;
+        }
+        while (block != head);
+        Test_ExitWithResult(TEST_RESULT_ERROR, SourceLine(0), ":L%s:%d, %s: OOM allocating %d bytes", gTestRunnerState.test->filename, SourceLine(0), location, size);
+#endif
+        return NULL;
+    }
 
-                    pos->allocated = TRUE;
-                    pos->size = size;
+    RemoveFreeBlock(pos);
+    foundBlockSize = pos->size;
 
-                    PutMemBlockHeader(splitBlock, pos, pos->next, foundBlockSize);
+    if (foundBlockSize - size < 2 * sizeof(struct MemBlock))
+    {
+        // The block isn't much bigger than the requested size,
+        // so just use it.
+        pos->allocated = TRUE;
+    }
+    else
+    {
+        // The block is significantly bigger than the requested
+        // size, so split the rest into a separate block.
+        foundBlockSize -= sizeof(struct MemBlock);
+        foundBlockSize -= size;
 
-                    pos->next = splitBlock;
+        splitBlock = (struct MemBlock *)(pos->data + size);
 
-                    if (splitBlock->next != head)
-                        splitBlock->next->prev = splitBlock;
-                }
+        pos->allocated = TRUE;
+        pos->size = size;
 
-                pos->locationHi = ((uintptr_t)location) >> 14;
-                pos->locationLo = (uintptr_t)location;
+        PutMemBlockHeader(splitBlock, pos, pos->next, foundBlockSize);
 
-                return pos->data;
-            }
-        }
+        pos->next = splitBlock;
 
-        if (pos->next == head)
-        {
-#if TESTING
-            const struct MemBlock *head = HeapHead();
-            const struct MemBlock *block = head;
-            do
-            {
-                if (block->allocated)
-                {
-                    const char *location = MemBlockLocation(block);
-                    if (location)
-                        Test_MgbaPrintf("%s: %d bytes allocated", location, block->size);
-                    else
-                        Test_MgbaPrintf("<unknown>: %d bytes allocated", block->size);
-                }
-                block = block->next;
-            }
-            while (block != head);
-            Test_ExitWithResult(TEST_RESULT_ERROR, SourceLine(0), ":L%s:%d, %s: OOM allocating %d bytes", gTestRunnerState.test->filename, SourceLine(0), location, size);
-#endif
-            return NULL;
-        }
+        if (splitBlock->next != head)
+            splitBlock->next->prev = splitBlock;
 
-        pos = pos->next;
+        InsertFreeBlock(splitBlock);
     }
+
+    pos->locationHi = ((uintptr_t)location) >> 14;
+    pos->locationLo = (uintptr_t)location;
+
+    return pos->data;
 }
 
 void FreeInternal(void *heapStart, void *pointer)
@@ -122,6 +233,7 @@ void FreeInternal(void *heapStart, void *pointer)
         {
             if (!block->next->allocated)
             {
+                RemoveFreeBlock(block->next);
                 block->size += sizeof(struct MemBlock) + block->next->size;
                 block->next->magic = 0;
                 block->next = block->next->next;
@@ -136,6 +248,7 @@ void FreeInternal(void *heapStart, void *pointer)
         {
             if (!block->prev->allocated)
             {
+                RemoveFreeBlock(block->prev);
                 block->prev->next = block->next;
 
                 if (block->next != head)
@@ -143,8 +256,11 @@ void FreeInternal(void *heapStart, void *pointer)
 
                 block->magic = 0;
                 block->prev->size += sizeof(struct MemBlock) + block->size;
+                block = block->prev;
             }
         }
+
+        InsertFreeBlock(block);
     }
 }
 
@@ -216,17 +332,76 @@ bool32 CheckMemBlock(void *pointer)
     return CheckMemBlockInternal(sHeapStart, pointer);
 }
 
-bool32 CheckHeap()
+bool32 CheckHeap(void)
 {
     struct MemBlock *pos = (struct MemBlock *)sHeapStart;
+    u32 i, freeBlocks = 0;
 
     do {
         if (!CheckMemBlockInternal(sHeapStart, pos->data))
             return FALSE;
+        if (!pos->allocated)
+            freeBlocks++;
         pos = pos->next;
     } while (pos != (struct MemBlock *)sHeapStart);
 
-    return TRUE;
+    // Every free block must be in the bin for its size, and nothing else.
+    for (i = 0; i < NUM_BINS; i++)
+    {
+        if ((sBins[i] != NULL) != ((sNonEmptyBins >> i) & 1))
+            return FALSE;
+
+        for (pos = sBins[i]; pos != NULL; pos = GetFreeLinks(pos)->next)
+        {
+            struct MemBlock *next = GetFreeLinks(pos)->next;
+
+            if (pos->magic != MALLOC_SYSTEM_ID || pos->allocated || BinIndex(pos->size) != i)
+                return FALSE;
+            if (next != NULL && GetFreeLinks(next)->prev != pos)
+                return FALSE;
+            if (freeBlocks-- == 0)
+                return FALSE;
+        }
+    }
+
+    return freeBlocks == 0;
+}
+
+bool32 InitHeapArena_(struct HeapArena *arena, u32 size, const char *location)
+{
+    arena->data = Alloc_(size, location);
+    arena->size = arena->data != NULL ? size : 0;
+    arena->used = 0;
+    return arena->data != NULL;
+}
+
+void *AllocFromHeapArena(struct HeapArena *arena, u32 size)
+{
+    void *mem;
+
+    // Alignment
+    if (size & 3)
+        size = 4 * ((size / 4) + 1);
+
+    if (arena->size - arena->used < size)
+        return NULL;
+
+    mem = arena->data + arena->used;
+    arena->used += size;
+    return mem;
+}
+
+void ResetHeapArena(struct HeapArena *arena)
+{
+    arena->used = 0;
+}
+
+void FreeHeapArena(struct HeapArena *arena)
+{
+    Free(arena->data);
+    arena->data = NULL;
+    arena->size = 0;
+    arena->used = 0;
 }
 
 const struct MemBlock *HeapHead(void)
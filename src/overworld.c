@@ -1856,6 +1856,8 @@ static void FieldClearVBlankHBlankCallbacks(void)
 
 static void SetFieldVBlankCallback(void)
 {
+    // The scene before may have left PLTT out of step with the buffer.
+    MarkPalettesDirty(PALETTES_ALL);
     SetVBlankCallback(VBlankCB_Field);
 }
 
@@ -1865,7 +1867,7 @@ static void VBlankCB_Field(void)
     ProcessSpriteCopyRequests();
     ScanlineEffect_InitHBlankDmaTransfer();
     FieldUpdateBgTilemapScroll();
-    TransferPlttBuffer();
+    TransferDirtyPlttBuffer();
     TransferTilesetAnimsBuffer();
 }
 
@@ -2163,6 +2165,7 @@ static void ResetScreenForMapLoad(void)
     ScanlineEffect_Stop();
 
     DmaClear16(3, PLTT + 2, PLTT_SIZE - 2);
+    MarkPalettesDirty(PALETTES_ALL);
     DmaFillLarge16(3, 0, (void *)VRAM, VRAM_SIZE, 0x1000);
     ResetOamRange(0, 128);
     LoadOam();
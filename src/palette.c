@@ -29,6 +29,7 @@ ALIGNED(4) EWRAM_DATA u16 gPlttBufferUnfaded[PLTT_BUFFER_SIZE] = {0};
 ALIGNED(4) EWRAM_DATA u16 gPlttBufferFaded[PLTT_BUFFER_SIZE] = {0};
 EWRAM_DATA struct PaletteFadeControl gPaletteFade = {0};
 static EWRAM_DATA u32 sPlttBufferTransferPending = 0;
+static EWRAM_DATA u32 sDirtyPalettes = 0;
 
 static const u8 sRoundedDownGrayscaleMap[] = {
      0,  0,  0,  0,  0,
@@ -51,12 +52,35 @@ void LoadPalette(const void *src, u32 offset, u32 size)
 {
     CpuCopy16(src, &gPlttBufferUnfaded[offset], size);
     CpuCopy16(src, &gPlttBufferFaded[offset], size);
+    MarkPlttBufferDirty(offset, size / 2);
 }
 
 void FillPalette(u32 value, u32 offset, u32 size)
 {
     CpuFill16(value, &gPlttBufferUnfaded[offset], size);
     CpuFill16(value, &gPlttBufferFaded[offset], size);
+    MarkPlttBufferDirty(offset, size / 2);
+}
+
+void MarkPalettesDirty(u32 selectedPalettes)
+{
+    sDirtyPalettes |= selectedPalettes;
+}
+
+// Marks every palette that has a color in [offset, offset + count).
+void MarkPlttBufferDirty(u32 offset, u32 count)
+{
+    u32 first, last;
+
+    if (count == 0 || offset >= PLTT_BUFFER_SIZE)
+        return;
+
+    first = offset / 16;
+    last = (offset + count - 1) / 16;
+    if (last > 31)
+        last = 31;
+    // 2u << 31 wraps to 0, which still gives every bit up to 31.
+    sDirtyPalettes |= ((2u << last) - 1) & ~((1u << first) - 1);
 }
 
 void TransferPlttBuffer(void)
@@ -66,6 +90,42 @@ void TransferPlttBuffer(void)
         void *src = gPlttBufferFaded;
         void *dest = (void *)PLTT;
         DmaCopy16(3, src, dest, PLTT_SIZE);
+        sDirtyPalettes = 0;
+        sPlttBufferTransferPending = FALSE;
+        if (gPaletteFade.mode == HARDWARE_FADE && gPaletteFade.active)
+            UpdateBlendRegisters();
+    }
+}
+
+// Like TransferPlttBuffer, but only copies the palettes marked dirty since
+// the last transfer, a run of neighbouring palettes at a time. Only for
+// scenes where everything that writes gPlttBufferFaded, or PLTT itself,
+// marks what it changed.
+void TransferDirtyPlttBuffer(void)
+{
+    if (!gPaletteFade.bufferTransferDisabled)
+    {
+        u32 dirty = sDirtyPalettes;
+        u32 paletteNum = 0;
+
+        while (dirty != 0)
+        {
+            u32 count = 0;
+
+            while (!(dirty & 1))
+            {
+                dirty >>= 1;
+                paletteNum++;
+            }
+            while (dirty & 1)
+            {
+                dirty >>= 1;
+                count++;
+            }
+            DmaCopy16(3, &gPlttBufferFaded[PLTT_ID(paletteNum)], (void *)(PLTT + PLTT_OFFSET_4BPP(paletteNum)), count * PLTT_SIZE_4BPP);
+            paletteNum += count;
+        }
+        sDirtyPalettes = 0;
         sPlttBufferTransferPending = FALSE;
         if (gPaletteFade.mode == HARDWARE_FADE && gPaletteFade.active)
             UpdateBlendRegisters();
@@ -251,6 +311,7 @@ void InvertPlttBuffer(u32 selectedPalettes)
 {
     u16 paletteOffset = 0;
 
+    MarkPalettesDirty(selectedPalettes);
     while (selectedPalettes)
     {
         if (selectedPalettes & 1)
@@ -268,6 +329,7 @@ void TintPlttBuffer(u32 selectedPalettes, s8 r, s8 g, s8 b)
 {
     u16 paletteOffset = 0;
 
+    MarkPalettesDirty(selectedPalettes);
     while (selectedPalettes)
     {
         if (selectedPalettes & 1)
@@ -290,6 +352,7 @@ void UnfadePlttBuffer(u32 selectedPalettes)
 {
     u16 paletteOffset = 0;
 
+    MarkPalettesDirty(selectedPalettes);
     while (selectedPalettes)
     {
         if (selectedPalettes & 1)
@@ -315,6 +378,7 @@ static void BeginFastPaletteFadeInternal(u32 submode)
     gPaletteFade_submode = submode & 0x3F;
     gPaletteFade.active = TRUE;
     gPaletteFade.mode = FAST_FADE;
+    MarkPalettesDirty(PALETTES_ALL);
 
     if (submode == FAST_FADE_IN_FROM_BLACK)
         CpuFill16(RGB_BLACK, gPlttBufferFaded, PLTT_SIZE);
@@ -344,6 +408,8 @@ static u32 UpdateFastPaletteFade(void)
         return gPaletteFade.active ? PALETTE_FADE_STATUS_ACTIVE : PALETTE_FADE_STATUS_DONE;
 
 
+    MarkPalettesDirty(PALETTES_ALL);
+
     if (gPaletteFade.objPaletteToggle)
     {
         paletteOffsetStart = OBJ_PLTT_OFFSET;
@@ -602,11 +668,123 @@ void BlendPalettesUnfaded(u32 selectedPalettes, u8 coeff, u32 color)
     void *src = gPlttBufferUnfaded;
     void *dest = gPlttBufferFaded;
     DmaCopy32(3, src, dest, PLTT_SIZE);
+    MarkPalettesDirty(PALETTES_ALL);
     BlendPalettes(selectedPalettes, coeff, color);
 }
 
+#if FAST_PALETTE_BLEND
+// Every channel is 5 bits wide, so one channel of both colors in a word can
+// be masked out and worked on at once. None of the math below carries past
+// bit 15 of either half.
+#define CHANNEL_PAIR_MASK 0x001F001F
+
+// Runs pairFunc over the colors in src, writing the results to dest a word
+// at a time wherever both buffers line up. Any leftover color is done alone,
+// and the garbage pairFunc leaves in the unused upper half is cut off when
+// it is stored.
+#define PROCESS_COLOR_PAIRS(src, dest, count, pairFunc, ...)            \
+{                                                                       \
+    if ((((u32)(src) ^ (u32)(dest)) & 2) == 0)                          \
+    {                                                                   \
+        if (((u32)(src) & 2) && count != 0)                             \
+        {                                                               \
+            *dest++ = pairFunc(*src++, ##__VA_ARGS__);                  \
+            count--;                                                    \
+        }                                                               \
+        for (; count >= 2; count -= 2, src += 2, dest += 2)             \
+            *(u32 *)dest = pairFunc(*(const u32 *)src, ##__VA_ARGS__);  \
+    }                                                                   \
+    while (count-- != 0)                                                \
+        *dest++ = pairFunc(*src++, ##__VA_ARGS__);                      \
+}
+
+static inline ARM_FUNC u32 BlendColorPair(u32 colors, u32 inverse, u32 rBlend, u32 gBlend, u32 bBlend)
+{
+    u32 r = (((colors & CHANNEL_PAIR_MASK) * inverse + rBlend) >> 4) & CHANNEL_PAIR_MASK;
+    u32 g = ((((colors >> 5) & CHANNEL_PAIR_MASK) * inverse + gBlend) >> 4) & CHANNEL_PAIR_MASK;
+    u32 b = ((((colors >> 10) & CHANNEL_PAIR_MASK) * inverse + bBlend) >> 4) & CHANNEL_PAIR_MASK;
+
+    return r | (g << 5) | (b << 10);
+}
+
+static inline ARM_FUNC u32 ApplyColorMapToColorPair(u32 colors, const u8 *colorMap)
+{
+    u32 lo = colorMap[GET_R(colors)] | (colorMap[GET_G(colors)] << 5) | (colorMap[GET_B(colors)] << 10);
+    u32 hi = colorMap[GET_R(colors >> 16)] | (colorMap[GET_G(colors >> 16)] << 5) | (colorMap[GET_B(colors >> 16)] << 10);
+
+    return lo | (hi << 16);
+}
+
+// Same weights as TintPalette_GrayScale. Both results fit in 5 bits.
+static inline ARM_FUNC u32 GetGrayPair(u32 colors)
+{
+    u32 r = colors & CHANNEL_PAIR_MASK;
+    u32 g = (colors >> 5) & CHANNEL_PAIR_MASK;
+    u32 b = (colors >> 10) & CHANNEL_PAIR_MASK;
+
+    return ((r * Q_8_8(0.3) + g * Q_8_8(0.59) + b * Q_8_8(0.1133)) >> 8) & 0x00FF00FF;
+}
+
+static inline ARM_FUNC u32 GrayScaleColorPair(u32 colors, bool32 roundDown)
+{
+    u32 gray = GetGrayPair(colors);
+
+    if (roundDown)
+        gray = sRoundedDownGrayscaleMap[gray & 0xFF] | (sRoundedDownGrayscaleMap[gray >> 16] << 16);
+    return gray * RGB2(1, 1, 1);
+}
+
+static inline ARM_FUNC u32 SepiaToneColorPair(u32 colors)
+{
+    u32 gray = GetGrayPair(colors);
+    u32 r = ((gray * Q_8_8(1.2)) >> 8) & 0x00FF00FF;
+    u32 b = ((gray * Q_8_8(0.94)) >> 8) & 0x00FF00FF;
+
+    if ((r & 0xFF) > 31)
+        r = (r & ~0xFF) | 31;
+    if ((r >> 16) > 31)
+        r = (r & 0xFFFF) | (31 << 16);
+    return r | (gray << 5) | (b << 10);
+}
+
+// Same result as BlendPalette for coeff 0 to 16. src and dest may be the same buffer.
+ARM_FUNC IWRAM_CODE void BlendColors(const u16 *src, u16 *dest, u32 count, u32 coeff, u32 blendColor)
+{
+    u32 inverse = 16 - coeff;
+    u32 rBlend = GET_R(blendColor) * coeff * 0x10001;
+    u32 gBlend = GET_G(blendColor) * coeff * 0x10001;
+    u32 bBlend = GET_B(blendColor) * coeff * 0x10001;
+
+    PROCESS_COLOR_PAIRS(src, dest, count, BlendColorPair, inverse, rBlend, gBlend, bBlend);
+}
+
+ARM_FUNC IWRAM_CODE void ApplyColorMapToColors(const u16 *src, u16 *dest, u32 count, const u8 *colorMap)
+{
+    PROCESS_COLOR_PAIRS(src, dest, count, ApplyColorMapToColorPair, colorMap);
+}
+
+ARM_FUNC IWRAM_CODE void GrayScaleColors(u16 *palette, u32 count, bool32 roundDown)
+{
+    const u16 *src = palette;
+
+    PROCESS_COLOR_PAIRS(src, palette, count, GrayScaleColorPair, roundDown);
+}
+
+ARM_FUNC IWRAM_CODE void SepiaToneColors(u16 *palette, u32 count)
+{
+    const u16 *src = palette;
+
+    PROCESS_COLOR_PAIRS(src, palette, count, SepiaToneColorPair);
+}
+
+#undef PROCESS_COLOR_PAIRS
+#endif // FAST_PALETTE_BLEND
+
 void TintPalette_GrayScale(u16 *palette, u32 count)
 {
+#if FAST_PALETTE_BLEND
+    GrayScaleColors(palette, count, FALSE);
+#else
     s32 r, g, b;
     u32 i, gray;
 
@@ -620,10 +798,14 @@ void TintPalette_GrayScale(u16 *palette, u32 count)
 
         *palette++ = RGB2(gray, gray, gray);
     }
+#endif
 }
 
 void TintPalette_GrayScale2(u16 *palette, u32 count)
 {
+#if FAST_PALETTE_BLEND
+    GrayScaleColors(palette, count, TRUE);
+#else
     s32 r, g, b;
     u32 i, gray;
 
@@ -642,10 +824,14 @@ void TintPalette_GrayScale2(u16 *palette, u32 count)
 
         *palette++ = RGB2(gray, gray, gray);
     }
+#endif
 }
 
 void TintPalette_SepiaTone(u16 *palette, u32 count)
 {
+#if FAST_PALETTE_BLEND
+    SepiaToneColors(palette, count);
+#else
     s32 r, g, b;
     u32 i, gray;
 
@@ -666,6 +852,7 @@ void TintPalette_SepiaTone(u16 *palette, u32 count)
 
         *palette++ = RGB2(r, g, b);
     }
+#endif
 }
 
 void TintPalette_CustomTone(u16 *palette, u32 count, u16 rTone, u16 gTone, u16 bTone)
@@ -116,10 +116,25 @@ enum {
 #define MON_PAGE_X 48
 #define MON_PAGE_Y 56
 
+#define DEX_FLAG_WORDS ((NUM_DEX_FLAG_BYTES + 3) / 4)
+
+enum
+{
+    DEX_COUNT_NATIONAL,
+    DEX_COUNT_HOENN,
+    DEX_COUNT_KANTO,
+    DEX_COUNT_REGIONS,
+};
+
 static EWRAM_DATA struct PokedexView *sPokedexView = NULL;
 static EWRAM_DATA u16 sLastSelectedPokemon = 0;
 static EWRAM_DATA u8 sPokeBallRotation = 0;
 static EWRAM_DATA struct PokedexListItem *sPokedexListItem = NULL;
+static EWRAM_DATA u16 sPokedexCounts[DEX_COUNT_REGIONS][FLAG_GET_CAUGHT + 1] = {0};
+static EWRAM_DATA bool8 sPokedexCountsValid = FALSE;
+static EWRAM_DATA u32 sHoennDexFlagsMask[DEX_FLAG_WORDS] = {0};
+static EWRAM_DATA bool8 sHoennDexFlagsMaskBuilt = FALSE;
+static EWRAM_DATA u16 sPokedexFlagsVersion = 0;
 
 // This is written to, but never read.
 COMMON_DATA u8 gUnusedPokedexU8 = 0;
@@ -165,6 +180,24 @@ struct PokedexListItem
     u16 owned:1;
 };
 
+// The sorted orders filtered by the seen or caught flags, in national
+// order. Hoenn lists and reversed orders are derived while copying.
+enum
+{
+    DEX_LIST_ALPHABETICAL,
+    DEX_LIST_WEIGHT,
+    DEX_LIST_HEIGHT,
+    DEX_LIST_COUNT,
+};
+
+struct PokedexListCache
+{
+    u16 dexNums[DEX_LIST_COUNT][NATIONAL_DEX_COUNT];
+    u16 count[DEX_LIST_COUNT];
+    u16 flagsVersion[DEX_LIST_COUNT];
+    bool8 built[DEX_LIST_COUNT];
+};
+
 struct PokedexView
 {
     struct PokedexListItem pokedexList[NATIONAL_DEX_COUNT + 1];
@@ -202,6 +235,7 @@ struct PokedexView
     s16 menuY;     //Menu Y position (inverted because we use REG_BG0VOFS for this)
     u8 unkArr2[8]; // Cleared, never read
     u8 unkArr3[8]; // Cleared, never read
+    struct PokedexListCache listCache;
 };
 
 // this file's functions
@@ -226,6 +260,7 @@ static bool8 LoadPokedexListPage(u8);
 static void LoadPokedexBgPalette(bool8);
 static void FreeWindowAndBgBuffers(void);
 static void CreatePokedexList(u8, u8);
+static bool32 IsHoennDexNum(u32);
 static void CreateMonDexNum(u16, u8, u8, u16);
 static void CreateCaughtBall(u16, u8, u8, u16);
 static u8 CreateMonName(u16, u8, u8);
@@ -1533,6 +1568,7 @@ void ResetPokedex(void)
         gSaveBlock1Ptr->dexCaught[i] = 0;
         gSaveBlock1Ptr->dexSeen[i] = 0;
     }
+    InvalidatePokedexCounts();
 }
 
 void ResetPokedexScrollPositions(void)
@@ -2191,6 +2227,72 @@ static void FreeWindowAndBgBuffers(void)
         Free(tilemapBuffer);
 }
 
+static const u16 *GetSortedPokedexList(u32 list, u32 *count)
+{
+    struct PokedexListCache *cache = &sPokedexView->listCache;
+    const u16 *order;
+    u32 i, orderCount, caseID, dexNum;
+
+    if (!cache->built[list] || cache->flagsVersion[list] != sPokedexFlagsVersion)
+    {
+        switch (list)
+        {
+        case DEX_LIST_ALPHABETICAL:
+        default:
+            order = gPokedexOrder_Alphabetical;
+            orderCount = ARRAY_COUNT(gPokedexOrder_Alphabetical);
+            caseID = FLAG_GET_SEEN;
+            break;
+        case DEX_LIST_WEIGHT:
+            order = gPokedexOrder_Weight;
+            orderCount = ARRAY_COUNT(gPokedexOrder_Weight);
+            caseID = FLAG_GET_CAUGHT;
+            break;
+        case DEX_LIST_HEIGHT:
+            order = gPokedexOrder_Height;
+            orderCount = ARRAY_COUNT(gPokedexOrder_Height);
+            caseID = FLAG_GET_CAUGHT;
+            break;
+        }
+
+        cache->count[list] = 0;
+        for (i = 0; i < orderCount; i++)
+        {
+            dexNum = order[i];
+            if (dexNum <= NATIONAL_DEX_COUNT && GetSetPokedexFlag(dexNum, caseID))
+                cache->dexNums[list][cache->count[list]++] = dexNum;
+        }
+        cache->flagsVersion[list] = sPokedexFlagsVersion;
+        cache->built[list] = TRUE;
+    }
+
+    *count = cache->count[list];
+    return cache->dexNums[list];
+}
+
+static void AddSortedMonsToPokedexList(u32 list, bool32 isHoennDex, bool32 reverse)
+{
+    struct PokedexListItem *item;
+    const u16 *dexNums;
+    u32 i, count, dexNum;
+
+    dexNums = GetSortedPokedexList(list, &count);
+    for (i = 0; i < count; i++)
+    {
+        dexNum = dexNums[reverse ? count - 1 - i : i];
+        if (isHoennDex && !IsHoennDexNum(dexNum))
+            continue;
+
+        item = &sPokedexView->pokedexList[sPokedexView->pokemonListCount++];
+        item->dexNum = dexNum;
+        item->seen = TRUE;
+        if (list == DEX_LIST_ALPHABETICAL)
+            item->owned = GetSetPokedexFlag(dexNum, FLAG_GET_CAUGHT);
+        else
+            item->owned = TRUE;
+    }
+}
+
 static void CreatePokedexList(u8 dexMode, u8 order)
 {
     u32 vars[3]; //I have no idea why three regular variables are stored in an array, but whatever.
@@ -2258,74 +2360,19 @@ static void CreatePokedexList(u8 dexMode, u8 order)
         }
         break;
     case ORDER_ALPHABETICAL:
-        for (i = 0; i < ARRAY_COUNT(gPokedexOrder_Alphabetical); i++)
-        {
-            temp_dexNum = gPokedexOrder_Alphabetical[i];
-
-            if (temp_dexNum <= NATIONAL_DEX_COUNT && (!temp_isHoennDex || NationalToHoennOrder(temp_dexNum) != 0) && GetSetPokedexFlag(temp_dexNum, FLAG_GET_SEEN))
-            {
-                sPokedexView->pokedexList[sPokedexView->pokemonListCount].dexNum = temp_dexNum;
-                sPokedexView->pokedexList[sPokedexView->pokemonListCount].seen = TRUE;
-                sPokedexView->pokedexList[sPokedexView->pokemonListCount].owned = GetSetPokedexFlag(temp_dexNum, FLAG_GET_CAUGHT);
-                sPokedexView->pokemonListCount++;
-            }
-        }
+        AddSortedMonsToPokedexList(DEX_LIST_ALPHABETICAL, temp_isHoennDex, FALSE);
         break;
     case ORDER_HEAVIEST:
-        for (i = ARRAY_COUNT(gPokedexOrder_Weight) - 1; i >= 0; i--)
-        {
-            temp_dexNum = gPokedexOrder_Weight[i];
-
-            if (temp_dexNum <= NATIONAL_DEX_COUNT && (!temp_isHoennDex || NationalToHoennOrder(temp_dexNum) != 0) && GetSetPokedexFlag(temp_dexNum, FLAG_GET_CAUGHT))
-            {
-                sPokedexView->pokedexList[sPokedexView->pokemonListCount].dexNum = temp_dexNum;
-                sPokedexView->pokedexList[sPokedexView->pokemonListCount].seen = TRUE;
-                sPokedexView->pokedexList[sPokedexView->pokemonListCount].owned = TRUE;
-                sPokedexView->pokemonListCount++;
-            }
-        }
+        AddSortedMonsToPokedexList(DEX_LIST_WEIGHT, temp_isHoennDex, TRUE);
         break;
     case ORDER_LIGHTEST:
-        for (i = 0; i < ARRAY_COUNT(gPokedexOrder_Weight); i++)
-        {
-            temp_dexNum = gPokedexOrder_Weight[i];
-
-            if (temp_dexNum <= NATIONAL_DEX_COUNT && (!temp_isHoennDex || NationalToHoennOrder(temp_dexNum) != 0) && GetSetPokedexFlag(temp_dexNum, FLAG_GET_CAUGHT))
-            {
-                sPokedexView->pokedexList[sPokedexView->pokemonListCount].dexNum = temp_dexNum;
-                sPokedexView->pokedexList[sPokedexView->pokemonListCount].seen = TRUE;
-                sPokedexView->pokedexList[sPokedexView->pokemonListCount].owned = TRUE;
-                sPokedexView->pokemonListCount++;
-            }
-        }
+        AddSortedMonsToPokedexList(DEX_LIST_WEIGHT, temp_isHoennDex, FALSE);
         break;
     case ORDER_TALLEST:
-        for (i = ARRAY_COUNT(gPokedexOrder_Height) - 1; i >= 0; i--)
-        {
-            temp_dexNum = gPokedexOrder_Height[i];
-
-            if (temp_dexNum <= NATIONAL_DEX_COUNT && (!temp_isHoennDex || NationalToHoennOrder(temp_dexNum) != 0) && GetSetPokedexFlag(temp_dexNum, FLAG_GET_CAUGHT))
-            {
-                sPokedexView->pokedexList[sPokedexView->pokemonListCount].dexNum = temp_dexNum;
-                sPokedexView->pokedexList[sPokedexView->pokemonListCount].seen = TRUE;
-                sPokedexView->pokedexList[sPokedexView->pokemonListCount].owned = TRUE;
-                sPokedexView->pokemonListCount++;
-            }
-        }
+        AddSortedMonsToPokedexList(DEX_LIST_HEIGHT, temp_isHoennDex, TRUE);
         break;
     case ORDER_SMALLEST:
-        for (i = 0; i < ARRAY_COUNT(gPokedexOrder_Height); i++)
-        {
-            temp_dexNum = gPokedexOrder_Height[i];
-
-            if (temp_dexNum <= NATIONAL_DEX_COUNT && (!temp_isHoennDex || NationalToHoennOrder(temp_dexNum) != 0) && GetSetPokedexFlag(temp_dexNum, FLAG_GET_CAUGHT))
-            {
-                sPokedexView->pokedexList[sPokedexView->pokemonListCount].dexNum = temp_dexNum;
-                sPokedexView->pokedexList[sPokedexView->pokemonListCount].seen = TRUE;
-                sPokedexView->pokedexList[sPokedexView->pokemonListCount].owned = TRUE;
-                sPokedexView->pokemonListCount++;
-            }
-        }
+        AddSortedMonsToPokedexList(DEX_LIST_HEIGHT, temp_isHoennDex, FALSE);
         break;
     }
 
@@ -4483,6 +4530,118 @@ static u8* ConvertMeasurementToMetricString(u32 num, u32* index)
     return string;
 }
 
+static u32 CountBits(u32 value)
+{
+    value = value - ((value >> 1) & 0x55555555);
+    value = (value & 0x33333333) + ((value >> 2) & 0x33333333);
+    value = (value + (value >> 4)) & 0x0F0F0F0F;
+    return (value * 0x01010101) >> 24;
+}
+
+static u32 GetDexFlagsWord(const u8 *flags, u32 word)
+{
+    u32 i, value = 0;
+
+    for (i = 0; i < 4 && word * 4 + i < NUM_DEX_FLAG_BYTES; i++)
+        value |= flags[word * 4 + i] << (i * 8);
+    return value;
+}
+
+// Mask of the flags below dexCount, for the regions numbered in national order.
+static u32 GetDexCountMaskWord(u32 dexCount, u32 word)
+{
+    if (word < dexCount / 32)
+        return 0xFFFFFFFF;
+    if (word == dexCount / 32)
+        return (1u << (dexCount % 32)) - 1;
+    return 0;
+}
+
+static void BuildHoennDexFlagsMask(void)
+{
+    u32 i, nationalNum;
+
+    for (i = 0; i < HOENN_DEX_COUNT - 1; i++)
+    {
+        nationalNum = HoennToNationalOrder(i + 1) - 1;
+        sHoennDexFlagsMask[nationalNum / 32] |= 1u << (nationalNum % 32);
+    }
+    sHoennDexFlagsMaskBuilt = TRUE;
+}
+
+static bool32 IsHoennDexNum(u32 nationalNum)
+{
+    if (!sHoennDexFlagsMaskBuilt)
+        BuildHoennDexFlagsMask();
+
+    nationalNum--;
+    return (sHoennDexFlagsMask[nationalNum / 32] >> (nationalNum % 32)) & 1;
+}
+
+static void CountPokedexFlags(void)
+{
+    u32 i, region, seen, caught, mask;
+
+    if (!sHoennDexFlagsMaskBuilt)
+        BuildHoennDexFlagsMask();
+
+    memset(sPokedexCounts, 0, sizeof(sPokedexCounts));
+    for (i = 0; i < DEX_FLAG_WORDS; i++)
+    {
+        seen = GetDexFlagsWord(gSaveBlock1Ptr->dexSeen, i);
+        caught = GetDexFlagsWord(gSaveBlock1Ptr->dexCaught, i);
+        for (region = 0; region < DEX_COUNT_REGIONS; region++)
+        {
+            switch (region)
+            {
+            case DEX_COUNT_NATIONAL:
+                mask = GetDexCountMaskWord(NATIONAL_DEX_COUNT, i);
+                break;
+            case DEX_COUNT_HOENN:
+                mask = sHoennDexFlagsMask[i];
+                break;
+            case DEX_COUNT_KANTO:
+            default:
+                mask = GetDexCountMaskWord(KANTO_DEX_COUNT, i);
+                break;
+            }
+            sPokedexCounts[region][FLAG_GET_SEEN] += CountBits(seen & mask);
+            sPokedexCounts[region][FLAG_GET_CAUGHT] += CountBits(caught & mask);
+        }
+    }
+    sPokedexCountsValid = TRUE;
+}
+
+// Must be called whenever the dex flags are written other than by GetSetPokedexFlag.
+void InvalidatePokedexCounts(void)
+{
+    sPokedexFlagsVersion++;
+    sPokedexCountsValid = FALSE;
+}
+
+static u16 GetPokedexCount(u32 region, u8 caseID)
+{
+    if (caseID != FLAG_GET_SEEN && caseID != FLAG_GET_CAUGHT)
+        return 0;
+    if (!sPokedexCountsValid)
+        CountPokedexFlags();
+    return sPokedexCounts[region][caseID];
+}
+
+static void IncrementPokedexCounts(u32 index, u32 caseID)
+{
+    sPokedexFlagsVersion++;
+    if (!sPokedexCountsValid)
+        return;
+
+    if (index < NATIONAL_DEX_COUNT)
+        sPokedexCounts[DEX_COUNT_NATIONAL][caseID]++;
+    if (sHoennDexFlagsMask[index / 32] & (1u << (index % 32)))
+        sPokedexCounts[DEX_COUNT_HOENN][caseID]++;
+    if (index < KANTO_DEX_COUNT)
+        sPokedexCounts[DEX_COUNT_KANTO][caseID]++;
+}
+
 s8 GetSetPokedexFlag(u16 nationalDexNo, u8 caseID)
 {
     u32 index, bit, mask;
@@ -4502,9 +4661,13 @@ s8 GetSetPokedexFlag(u16 nationalDexNo, u8 caseID)
          retVal = ((gSaveBlock1Ptr->dexCaught[index] & mask) != 0);
         break;
     case FLAG_SET_SEEN:
+        if (!(gSaveBlock1Ptr->dexSeen[index] & mask))
+            IncrementPokedexCounts(nationalDexNo, FLAG_GET_SEEN);
         gSaveBlock1Ptr->dexSeen[index] |= mask;
         break;
     case FLAG_SET_CAUGHT:
+        if (!(gSaveBlock1Ptr->dexCaught[index] & mask))
+            IncrementPokedexCounts(nationalDexNo, FLAG_GET_CAUGHT);
         gSaveBlock1Ptr->dexCaught[index] |= mask;
         break;
     }
@@ -4514,68 +4677,17 @@ s8 GetSetPokedexFlag(u16 nationalDexNo, u8 caseID)
 
 u16 GetNationalPokedexCount(u8 caseID)
 {
-    u16 count = 0;
-    u16 i;
-
-    for (i = 0; i < NATIONAL_DEX_COUNT; i++)
-    {
-        switch (caseID)
-        {
-        case FLAG_GET_SEEN:
-            if (GetSetPokedexFlag(i + 1, FLAG_GET_SEEN))
-                count++;
-            break;
-        case FLAG_GET_CAUGHT:
-            if (GetSetPokedexFlag(i + 1, FLAG_GET_CAUGHT))
-                count++;
-            break;
-        }
-    }
-    return count;
+    return GetPokedexCount(DEX_COUNT_NATIONAL, caseID);
 }
 
 u16 GetHoennPokedexCount(u8 caseID)
 {
-    u16 count = 0;
-    u16 i;
-
-    for (i = 0; i < HOENN_DEX_COUNT - 1; i++)
-    {
-        switch (caseID)
-        {
-        case FLAG_GET_SEEN:
-            if (GetSetPokedexFlag(HoennToNationalOrder(i + 1), FLAG_GET_SEEN))
-                count++;
-            break;
-        case FLAG_GET_CAUGHT:
-            if (GetSetPokedexFlag(HoennToNationalOrder(i + 1), FLAG_GET_CAUGHT))
-                count++;
-            break;
-        }
-    }
-    return count;
+    return GetPokedexCount(DEX_COUNT_HOENN, caseID);
 }
 
 u16 GetKantoPokedexCount(u8 caseID)
 {
-    u16 count = 0;
-    u16 i;
-
-    for (i = 0; i < KANTO_DEX_COUNT; i++)
-    {
-        switch (caseID)
-        {
-        case FLAG_GET_SEEN:
-            if (GetSetPokedexFlag(i + 1, FLAG_GET_SEEN))
-                count++;
-            break;
-        case FLAG_GET_CAUGHT:
-            if (GetSetPokedexFlag(i + 1, FLAG_GET_CAUGHT))
-                count++;
-            break;
-        }
-    }
-    return count;
+    return GetPokedexCount(DEX_COUNT_KANTO, caseID);
 }
 
 bool16 HasAllHoennMons(void)
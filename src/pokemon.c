@@ -5589,12 +5589,20 @@ u8 CanLearnTeachableMove(u16 species, u16 move)
                 }
             }
         }
+#if P_LEARNSET_HELPER_TEACHABLE == TRUE
+        // The generated learnsets are preceded by a bitset of their moves.
+        if (move >= ARRAY_COUNT(sTeachableMoveBitIndexes) || sTeachableMoveBitIndexes[move] == 0)
+            return FALSE;
+        i = sTeachableMoveBitIndexes[move] - 1;
+        return ((teachableLearnset - TEACHABLE_BITSET_SIZE)[i / 16] >> (i % 16)) & 1;
+#else
         for (i = 0; teachableLearnset[i] != MOVE_UNAVAILABLE; i++)
         {
             if (teachableLearnset[i] == move)
                 return TRUE;
         }
         return FALSE;
+#endif
     }
 }
 
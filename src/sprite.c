@@ -5,6 +5,9 @@
 
 #define MAX_SPRITE_COPY_REQUESTS 64
 
+#define LIVE_SPRITE_WORDS (MAX_SPRITES / 32)
+STATIC_ASSERT(MAX_SPRITES % 32 == 0, MaxSpritesMustBeAMultipleOf32);
+
 #define sAnchorX data[6]
 #define sAnchorY data[7]
 
@@ -261,6 +264,10 @@ COMMON_DATA u8 gReservedSpritePaletteCount = 0;
 
 EWRAM_DATA struct Sprite gSprites[MAX_SPRITES + 1] = {0};
 EWRAM_DATA static u8 sSpriteOrder[MAX_SPRITES] = {0};
+EWRAM_DATA static u8 sSpriteOrderCount = 0;
+// Sprites created by CreateSpriteAt or CloneSpriteAt and not yet
+// destroyed. Sprites whose inUse has been cleared directly stay listed.
+EWRAM_DATA static u32 sLiveSprites[LIVE_SPRITE_WORDS] = {0};
 EWRAM_DATA static bool8 sShouldProcessSpriteCopyRequests = 0;
 EWRAM_DATA static u8 sSpriteCopyRequestCount = 0;
 EWRAM_DATA static struct SpriteCopyRequest sSpriteCopyRequests[MAX_SPRITES] = {0};
@@ -290,10 +297,22 @@ void ResetSpriteData(void)
 
 void AnimateSprites(void)
 {
-    u32 i;
+    u32 i, live;
+
+    // The list is reread after every callback, so sprites are updated in
+    // index order even when callbacks create or destroy others.
     for (i = 0; i < MAX_SPRITES; i++)
     {
-        struct Sprite *sprite = &gSprites[i];
+        struct Sprite *sprite;
+
+        live = sLiveSprites[i / 32] >> (i % 32);
+        if (live == 0)
+        {
+            i |= 31;
+            continue;
+        }
+        i += __builtin_ctz(live);
+        sprite = &gSprites[i];
 
         if (sprite->inUse)
         {
@@ -305,6 +324,41 @@ void AnimateSprites(void)
     }
 }
 
+static inline bool32 IsSpriteLive(u32 index)
+{
+    return (sLiveSprites[index / 32] >> (index % 32)) & 1;
+}
+
+// Drops destroyed sprites from sSpriteOrder and appends new ones.
+static u32 UpdateSpriteOrder(void)
+{
+    u32 i, index, live, count = 0;
+    u32 listed[LIVE_SPRITE_WORDS] = {0};
+
+    for (i = 0; i < sSpriteOrderCount; i++)
+    {
+        index = sSpriteOrder[i];
+        if (IsSpriteLive(index) && !(listed[index / 32] & (1u << (index % 32))))
+        {
+            listed[index / 32] |= 1u << (index % 32);
+            sSpriteOrder[count++] = index;
+        }
+    }
+
+    for (i = 0; i < LIVE_SPRITE_WORDS; i++)
+    {
+        live = sLiveSprites[i] & ~listed[i];
+        while (live != 0)
+        {
+            sSpriteOrder[count++] = i * 32 + __builtin_ctz(live);
+            live &= live - 1;
+        }
+    }
+
+    sSpriteOrderCount = count;
+    return count;
+}
+
 void BuildOamBuffer(void)
 {
     bool32 oamLoadDisabled;
@@ -321,8 +375,9 @@ void BuildOamBuffer(void)
     u8 skippedSprites[MAX_SPRITES];
     u32 skippedSpritesN = 0;
     u32 matrices = 0;
+    u32 count = UpdateSpriteOrder();
 
-    for (i = 0; i < MAX_SPRITES; i++)
+    for (i = 0; i < count; i++)
     {
         // Reuse existing sSpriteOrder because we expect the order to be
         // relatively stable between frames.
@@ -476,6 +531,7 @@ u32 CreateSpriteAt(u32 index, const struct SpriteTemplate *template, s16 x, s16
     ResetSprite(sprite);
 
     sprite->inUse = TRUE;
+    sLiveSprites[index / 32] |= 1u << (index % 32);
     sprite->animBeginning = TRUE;
     sprite->affineAnimBeginning = TRUE;
     sprite->usingSheet = TRUE;
@@ -499,6 +555,7 @@ u32 CreateSpriteAt(u32 index, const struct SpriteTemplate *template, s16 x, s16
         if (tileNum == -1)
         {
             ResetSprite(sprite);
+            sLiveSprites[index / 32] &= ~(1u << (index % 32));
             return MAX_SPRITES;
         }
         sprite->oam.tileNum = tileNum;
@@ -560,6 +617,20 @@ void DestroySprite(struct Sprite *sprite)
         }
         ResetSprite(sprite);
     }
+
+    if (sprite >= gSprites && sprite < &gSprites[MAX_SPRITES])
+    {
+        u32 index = sprite - gSprites;
+        sLiveSprites[index / 32] &= ~(1u << (index % 32));
+    }
+}
+
+// For code that duplicates an existing sprite into a free slot.
+void CloneSpriteAt(u32 index, const struct Sprite *sprite)
+{
+    gSprites[index] = *sprite;
+    if (index < MAX_SPRITES && gSprites[index].inUse)
+        sLiveSprites[index / 32] |= 1u << (index % 32);
 }
 
 void ResetOamRange(u32 start, u32 end)
@@ -783,6 +854,13 @@ void CopyToSprites(u8 *src)
         src++;
         dest++;
     }
+
+    memset(sLiveSprites, 0, sizeof(sLiveSprites));
+    for (i = 0; i < MAX_SPRITES; i++)
+    {
+        if (gSprites[i].inUse)
+            sLiveSprites[i / 32] |= 1u << (i % 32);
+    }
 }
 
 void ResetAllSprites(void)
@@ -796,6 +874,8 @@ void ResetAllSprites(void)
     }
 
     ResetSprite(&gSprites[i]);
+    sSpriteOrderCount = 0;
+    memset(sLiveSprites, 0, sizeof(sLiveSprites));
 }
 
 void FreeSpriteTiles(struct Sprite *sprite)
@@ -15,6 +15,7 @@
 
 static u16 RenderText(struct TextPrinter *);
 static u32 RenderFont(struct TextPrinter *);
+static void CopyGlyphPixelsToWindow(struct TextPrinter *, const u32 *, u32, u32, u32);
 static u16 FontFunc_Small(struct TextPrinter *);
 static u16 FontFunc_Normal(struct TextPrinter *);
 static u16 FontFunc_Short(struct TextPrinter *);
@@ -55,9 +56,37 @@ static u16 sLastTextBgColor;
 static u16 sLastTextFgColor;
 static u16 sLastTextShadowColor;
 
+// Glyphs that have already been expanded with a color triple, so that
+// RenderText can skip decompressing characters it has printed recently.
+// Each glyph maps to one set, and the least recently used way in that
+// set is replaced on a miss. Only glyphs up to 8 pixels wide, which is
+// nearly every Latin glyph, are cached, so an entry only needs the left
+// column of tiles and the whole cache fits in 2.25 KiB.
+#define GLYPH_CACHE_SETS 8
+#define GLYPH_CACHE_WAYS 4
+#define GLYPH_CACHE_MAX_WIDTH 8
+
+struct CachedGlyph
+{
+    u32 pixels[16]; // Top tile, then bottom tile.
+    u32 key;
+    u8 width;
+    u8 height;
+    u16 lastUsed;
+};
+
+static EWRAM_DATA struct CachedGlyph sGlyphCache[GLYPH_CACHE_SETS][GLYPH_CACHE_WAYS] = {0};
+static EWRAM_DATA u16 sGlyphCacheClock = 0;
+static EWRAM_DATA u32 sGlyphCacheHits = 0;
+static EWRAM_DATA u32 sGlyphCacheMisses = 0;
+
 COMMON_DATA const struct FontInfo *gFonts = NULL;
 COMMON_DATA bool8 gDisableTextPrinters = 0;
 COMMON_DATA struct TextGlyph gCurGlyph = {0};
+
+#if TESTING
+EWRAM_DATA bool8 gTestSkipGlyphCache = FALSE;
+#endif
 COMMON_DATA TextFlags gTextFlags = {0};
 
 static const u8 sFontHalfRowOffsets[] =
@@ -301,6 +330,74 @@ static void SetFontsPointer(const struct FontInfo *fonts)
     gFonts = fonts;
 }
 
+// Packs the glyph, font and current colors into a key which is never 0,
+// so that zeroed cache entries never match.
+static u32 GetGlyphCacheKey(u32 fontId, u32 glyphId, bool32 isJapanese)
+{
+    u32 colors = sLastTextFgColor | (sLastTextBgColor << 4) | (sLastTextShadowColor << 8);
+    return (1u << 31) | (colors << 16) | ((fontId & 0xF) << 11) | ((isJapanese != FALSE) << 10) | (glyphId & 0x3FF);
+}
+
+// Only the size of a cached glyph is copied to gCurGlyph, its pixels are
+// drawn straight from the cache.
+static const struct CachedGlyph *LoadCachedGlyph(u32 key)
+{
+    u32 i;
+    struct CachedGlyph *set = sGlyphCache[key % GLYPH_CACHE_SETS];
+
+    for (i = 0; i < GLYPH_CACHE_WAYS; i++)
+    {
+        if (set[i].key == key)
+        {
+            set[i].lastUsed = ++sGlyphCacheClock;
+            gCurGlyph.width = set[i].width;
+            gCurGlyph.height = set[i].height;
+            sGlyphCacheHits++;
+            return &set[i];
+        }
+    }
+    sGlyphCacheMisses++;
+    return NULL;
+}
+
+static void CacheCurGlyph(u32 key)
+{
+    u32 i, oldest = 0;
+    struct CachedGlyph *set = sGlyphCache[key % GLYPH_CACHE_SETS];
+
+    if (gCurGlyph.width > GLYPH_CACHE_MAX_WIDTH)
+        return;
+
+    for (i = 1; i < GLYPH_CACHE_WAYS; i++)
+    {
+        if ((u16)(sGlyphCacheClock - set[i].lastUsed) > (u16)(sGlyphCacheClock - set[oldest].lastUsed))
+            oldest = i;
+    }
+    for (i = 0; i < 8; i++)
+    {
+        set[oldest].pixels[i] = gCurGlyph.gfxBufferTop[i];
+        set[oldest].pixels[i + 8] = gCurGlyph.gfxBufferBottom[i];
+    }
+    set[oldest].width = gCurGlyph.width;
+    set[oldest].height = gCurGlyph.height;
+    set[oldest].key = key;
+    set[oldest].lastUsed = ++sGlyphCacheClock;
+}
+
+void ResetGlyphCache(void)
+{
+    memset(sGlyphCache, 0, sizeof(sGlyphCache));
+    sGlyphCacheClock = 0;
+    sGlyphCacheHits = 0;
+    sGlyphCacheMisses = 0;
+}
+
+void GetGlyphCacheStats(u32 *hits, u32 *misses)
+{
+    *hits = sGlyphCacheHits;
+    *misses = sGlyphCacheMisses;
+}
+
 void DeactivateAllTextPrinters(void)
 {
     int printer;
@@ -629,7 +726,7 @@ static u8 UNUSED GetLastTextColor(u8 colorType)
     }
 }
 
-inline static void GLYPH_COPY(u8 *windowTiles, u32 widthOffset, u32 j, u32 i, u32 *glyphPixels, s32 width, s32 height)
+inline static void GLYPH_COPY(u8 *windowTiles, u32 widthOffset, u32 j, u32 i, const u32 *glyphPixels, s32 width, s32 height)
 {
     u32 xAdd, yAdd, pixelData, bits, toOrr, dummyX;
     u8 *dst;
@@ -654,10 +751,15 @@ inline static void GLYPH_COPY(u8 *windowTiles, u32 widthOffset, u32 j, u32 i, u3
 }
 
 void CopyGlyphToWindow(struct TextPrinter *textPrinter)
+{
+    CopyGlyphPixelsToWindow(textPrinter, gCurGlyph.gfxBufferTop, 16, gCurGlyph.width, gCurGlyph.height);
+}
+
+// bottomOffset is how many rows into glyphPixels the bottom tiles start.
+static void CopyGlyphPixelsToWindow(struct TextPrinter *textPrinter, const u32 *glyphPixels, u32 bottomOffset, u32 width, u32 height)
 {
     struct Window *window;
     struct WindowTemplate *template;
-    u32 *glyphPixels;
     u32 currX, currY, widthOffset;
     s32 glyphWidth, glyphHeight;
     u8 *windowTiles;
@@ -665,15 +767,14 @@ void CopyGlyphToWindow(struct TextPrinter *textPrinter)
     window = &gWindows[textPrinter->printerTemplate.windowId];
     template = &window->window;
 
-    if ((glyphWidth = (template->width * 8) - textPrinter->printerTemplate.currentX) > gCurGlyph.width)
-        glyphWidth = gCurGlyph.width;
+    if ((glyphWidth = (template->width * 8) - textPrinter->printerTemplate.currentX) > (s32)width)
+        glyphWidth = width;
 
-    if ((glyphHeight = (template->height * 8) - textPrinter->printerTemplate.currentY) > gCurGlyph.height)
-        glyphHeight = gCurGlyph.height;
+    if ((glyphHeight = (template->height * 8) - textPrinter->printerTemplate.currentY) > (s32)height)
+        glyphHeight = height;
 
     currX = textPrinter->printerTemplate.currentX;
     currY = textPrinter->printerTemplate.currentY;
-    glyphPixels = gCurGlyph.gfxBufferTop;
     windowTiles = window->tileData;
     widthOffset = template->width * 32;
 
@@ -686,7 +787,7 @@ void CopyGlyphToWindow(struct TextPrinter *textPrinter)
         else
         {
             GLYPH_COPY(windowTiles, widthOffset, currX, currY, glyphPixels, glyphWidth, 8);
-            GLYPH_COPY(windowTiles, widthOffset, currX, currY + 8, glyphPixels + 16, glyphWidth, glyphHeight - 8);
+            GLYPH_COPY(windowTiles, widthOffset, currX, currY + 8, glyphPixels + bottomOffset, glyphWidth, glyphHeight - 8);
         }
     }
     else
@@ -700,8 +801,8 @@ void CopyGlyphToWindow(struct TextPrinter *textPrinter)
         {
             GLYPH_COPY(windowTiles, widthOffset, currX, currY, glyphPixels, 8, 8);
             GLYPH_COPY(windowTiles, widthOffset, currX + 8, currY, glyphPixels + 8, glyphWidth - 8, 8);
-            GLYPH_COPY(windowTiles, widthOffset, currX, currY + 8, glyphPixels + 16, 8, glyphHeight - 8);
-            GLYPH_COPY(windowTiles, widthOffset, currX + 8, currY + 8, glyphPixels + 24, glyphWidth - 8, glyphHeight - 8);
+            GLYPH_COPY(windowTiles, widthOffset, currX, currY + 8, glyphPixels + bottomOffset, 8, glyphHeight - 8);
+            GLYPH_COPY(windowTiles, widthOffset, currX + 8, currY + 8, glyphPixels + bottomOffset + 8, glyphWidth - 8, glyphHeight - 8);
         }
     }
 }
@@ -1053,6 +1154,8 @@ static u16 RenderText(struct TextPrinter *textPrinter)
     u16 currChar;
     s32 width;
     s32 widthHelper;
+    u32 key;
+    const struct CachedGlyph *cachedGlyph;
 
     switch (textPrinter->state)
     {
@@ -1236,43 +1339,63 @@ static u16 RenderText(struct TextPrinter *textPrinter)
             return RENDER_FINISH;
         }
 
-        switch (subStruct->fontId)
+        if (gTestSkipGlyphCache)
         {
-        case FONT_SMALL:
-            DecompressGlyph_Small(currChar, textPrinter->japanese);
-            break;
-        case FONT_NORMAL:
-            DecompressGlyph_Normal(currChar, textPrinter->japanese);
-            break;
-        case FONT_SHORT:
-        case FONT_SHORT_COPY_1:
-        case FONT_SHORT_COPY_2:
-        case FONT_SHORT_COPY_3:
-            DecompressGlyph_Short(currChar, textPrinter->japanese);
-            break;
-        case FONT_NARROW:
-            DecompressGlyph_Narrow(currChar, textPrinter->japanese);
-            break;
-        case FONT_SMALL_NARROW:
-            DecompressGlyph_SmallNarrow(currChar, textPrinter->japanese);
-            break;
-        case FONT_NARROWER:
-            DecompressGlyph_Narrower(currChar, textPrinter->japanese);
-            break;
-        case FONT_SMALL_NARROWER:
-            DecompressGlyph_SmallNarrower(currChar, textPrinter->japanese);
-            break;
-        case FONT_SHORT_NARROW:
-            DecompressGlyph_ShortNarrow(currChar, textPrinter->japanese);
-            break;
-        case FONT_SHORT_NARROWER:
-            DecompressGlyph_ShortNarrower(currChar, textPrinter->japanese);
-            break;
-        case FONT_BRAILLE:
-            break;
+            key = 0;
+            cachedGlyph = NULL;
+        }
+        else
+        {
+            key = GetGlyphCacheKey(subStruct->fontId, currChar, textPrinter->japanese);
+            cachedGlyph = LoadCachedGlyph(key);
+        }
+        if (cachedGlyph != NULL)
+        {
+            CopyGlyphPixelsToWindow(textPrinter, cachedGlyph->pixels, 8, cachedGlyph->width, cachedGlyph->height);
+        }
+        else
+        {
+            switch (subStruct->fontId)
+            {
+            case FONT_SMALL:
+                DecompressGlyph_Small(currChar, textPrinter->japanese);
+                break;
+            case FONT_NORMAL:
+                DecompressGlyph_Normal(currChar, textPrinter->japanese);
+                break;
+            case FONT_SHORT:
+            case FONT_SHORT_COPY_1:
+            case FONT_SHORT_COPY_2:
+            case FONT_SHORT_COPY_3:
+                DecompressGlyph_Short(currChar, textPrinter->japanese);
+                break;
+            case FONT_NARROW:
+                DecompressGlyph_Narrow(currChar, textPrinter->japanese);
+                break;
+            case FONT_SMALL_NARROW:
+                DecompressGlyph_SmallNarrow(currChar, textPrinter->japanese);
+                break;
+            case FONT_NARROWER:
+                DecompressGlyph_Narrower(currChar, textPrinter->japanese);
+                break;
+            case FONT_SMALL_NARROWER:
+                DecompressGlyph_SmallNarrower(currChar, textPrinter->japanese);
+                break;
+            case FONT_SHORT_NARROW:
+                DecompressGlyph_ShortNarrow(currChar, textPrinter->japanese);
+                break;
+            case FONT_SHORT_NARROWER:
+                DecompressGlyph_ShortNarrower(currChar, textPrinter->japanese);
+                break;
+            case FONT_BRAILLE:
+            default:
+                key = 0;
+                break;
+            }
+            if (key != 0)
+                CacheCurGlyph(key);
+            CopyGlyphToWindow(textPrinter);
         }
-
-        CopyGlyphToWindow(textPrinter);
 
         if (textPrinter->minLetterSpacing)
         {
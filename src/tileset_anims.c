@@ -1,4 +1,5 @@
 #include "global.h"
+#include "dma3.h"
 #include "graphics.h"
 #include "palette.h"
 #include "util.h"
@@ -7,11 +8,13 @@
 #include "battle_transition.h"
 #include "fieldmap.h"
 
+#define TILESET_ANIM_BUFFER_SIZE 20
+
 static EWRAM_DATA struct {
     const u16 *src;
     u16 *dest;
     u16 size;
-} sTilesetDMA3TransferBuffer[20] = {0};
+} sTilesetDMA3TransferBuffer[TILESET_ANIM_BUFFER_SIZE] = {0};
 
 static u8 sTilesetDMA3TransferBufferSize;
 static u16 sPrimaryTilesetAnimCounter;
@@ -552,7 +555,25 @@ static void ResetTilesetAnimBuffer(void)
 
 static void AppendTilesetAnimToBuffer(const u16 *src, u16 *dest, u16 size)
 {
-    if (sTilesetDMA3TransferBufferSize < 20)
+    if (sTilesetDMA3TransferBufferSize != 0)
+    {
+        // Extend the previous transfer if this one continues it.
+        u32 last = sTilesetDMA3TransferBufferSize - 1;
+        if ((const u8 *)sTilesetDMA3TransferBuffer[last].src + sTilesetDMA3TransferBuffer[last].size == (const u8 *)src
+         && (u8 *)sTilesetDMA3TransferBuffer[last].dest + sTilesetDMA3TransferBuffer[last].size == (u8 *)dest
+         && sTilesetDMA3TransferBuffer[last].size + size <= 0xFFFF)
+        {
+            sTilesetDMA3TransferBuffer[last].size += size;
+            return;
+        }
+    }
+
+    if (sTilesetDMA3TransferBufferSize >= TILESET_ANIM_BUFFER_SIZE)
+    {
+        // Let the DMA3 manager carry the overflow instead of dropping it.
+        RequestDma3Copy(src, dest, size, 0);
+    }
+    else
     {
         sTilesetDMA3TransferBuffer[sTilesetDMA3TransferBufferSize].src = src;
         sTilesetDMA3TransferBuffer[sTilesetDMA3TransferBufferSize].dest = dest;
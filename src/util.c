@@ -228,6 +228,16 @@ u32 CalcByteArraySum(const u8 *data, u32 length)
 void BlendPalette(u16 palOffset, u16 numEntries, u8 coeff, u32 blendColor)
 {
     u16 i;
+
+    MarkPlttBufferDirty(palOffset, numEntries);
+#if FAST_PALETTE_BLEND
+    if (coeff < 16)
+    {
+        BlendColors(&gPlttBufferUnfaded[palOffset], &gPlttBufferFaded[palOffset], numEntries, coeff, blendColor);
+        return;
+    }
+#endif
+
     for (i = 0; i < numEntries; i++)
     {
         u16 index = i + palOffset;
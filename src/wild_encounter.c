@@ -356,32 +356,28 @@ static u8 ChooseWildMonLevel(const struct WildPokemon *wildPokemon, u8 wildMonIn
 
 u16 GetCurrentMapWildMonHeaderId(void)
 {
-    u16 i;
+    u32 mapGroup = gSaveBlock1Ptr->location.mapGroup;
+    u32 mapNum = gSaveBlock1Ptr->location.mapNum;
+    u16 headerId;
 
-    for (i = 0; ; i++)
-    {
-        const struct WildPokemonHeader *wildHeader = &gWildMonHeaders[i];
-        if (wildHeader->mapGroup == MAP_GROUP(UNDEFINED))
-            break;
+    if (mapGroup >= ARRAY_COUNT(gWildMonHeaderIdsByMap) || mapNum >= ARRAY_COUNT(gWildMonHeaderIdsByMap[0]))
+        return HEADER_NONE;
 
-        if (gWildMonHeaders[i].mapGroup == gSaveBlock1Ptr->location.mapGroup &&
-            gWildMonHeaders[i].mapNum == gSaveBlock1Ptr->location.mapNum)
-        {
-            if (gSaveBlock1Ptr->location.mapGroup == MAP_GROUP(ALTERING_CAVE) &&
-                gSaveBlock1Ptr->location.mapNum == MAP_NUM(ALTERING_CAVE))
-            {
-                u16 alteringCaveId = VarGet(VAR_ALTERING_CAVE_WILD_SET);
-                if (alteringCaveId >= NUM_ALTERING_CAVE_TABLES)
-                    alteringCaveId = 0;
+    headerId = gWildMonHeaderIdsByMap[mapGroup][mapNum];
+    if (headerId == 0)
+        return HEADER_NONE;
+    headerId--;
 
-                i += alteringCaveId;
-            }
+    if (mapGroup == MAP_GROUP(ALTERING_CAVE) && mapNum == MAP_NUM(ALTERING_CAVE))
+    {
+        u16 alteringCaveId = VarGet(VAR_ALTERING_CAVE_WILD_SET);
+        if (alteringCaveId >= NUM_ALTERING_CAVE_TABLES)
+            alteringCaveId = 0;
 
-            return i;
-        }
+        headerId += alteringCaveId;
     }
 
-    return HEADER_NONE;
+    return headerId;
 }
 
 u8 PickWildMonNature(void)
@@ -0,0 +1,49 @@
+#include "global.h"
+#include "test/battle.h"
+
+// The ability-keyed AbilityBattleEffects cases the battle engine runs for
+// each battler on a turn where everybody attacks.
+static u32 RunTurnAbilityEffects(void)
+{
+    u32 battler, effect = 0;
+
+    for (battler = 0; battler < gBattlersCount; battler++)
+    {
+        effect |= AbilityBattleEffects(ABILITYEFFECT_MOVE_END_ATTACKER, battler, 0, 0, MOVE_TACKLE);
+        effect |= AbilityBattleEffects(ABILITYEFFECT_MOVE_END, battler, 0, 0, MOVE_TACKLE);
+        effect |= AbilityBattleEffects(ABILITYEFFECT_MOVE_END_OTHER, battler, 0, 0, MOVE_TACKLE);
+        effect |= AbilityBattleEffects(ABILITYEFFECT_ENDTURN, battler, 0, 0, 0);
+    }
+    return effect;
+}
+
+DOUBLE_BATTLE_TEST("AbilityBattleEffects skips abilities without a handler faster than running their cases")
+{
+    GIVEN {
+        PLAYER(SPECIES_WOBBUFFET) { Ability(ABILITY_TELEPATHY); }
+        PLAYER(SPECIES_WOBBUFFET) { Ability(ABILITY_TELEPATHY); }
+        OPPONENT(SPECIES_WOBBUFFET) { Ability(ABILITY_TELEPATHY); }
+        OPPONENT(SPECIES_WOBBUFFET) { Ability(ABILITY_TELEPATHY); }
+    } WHEN {
+        TURN { }
+    } THEN {
+        struct Benchmark withoutHooks, withHooks;
+        u32 effectWithoutHooks = 0, effect = 0;
+
+        gTestSkipAbilityEffectHooks = TRUE;
+        BENCHMARK(&withoutHooks)
+        {
+            effectWithoutHooks = RunTurnAbilityEffects();
+        }
+        gTestSkipAbilityEffectHooks = FALSE;
+        BENCHMARK(&withHooks)
+        {
+            effect = RunTurnAbilityEffects();
+        }
+
+        EXPECT_EQ(effectWithoutHooks, 0);
+        EXPECT_EQ(effect, 0);
+        REPORT_BENCHMARK(withHooks);
+        EXPECT_FASTER(withHooks, withoutHooks);
+    }
+}
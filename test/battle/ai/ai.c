@@ -1,6 +1,7 @@
 #include "global.h"
 #include "test/battle.h"
 #include "battle_ai_util.h"
+#include "battle_ai_main.h"
 
 AI_SINGLE_BATTLE_TEST("AI prefers Bubble over Water Gun if it's slower")
 {
@@ -831,3 +832,95 @@ AI_SINGLE_BATTLE_TEST("AI stays choice locked into moves in spite of the player'
         TURN { EXPECT_MOVE(opponent, aiMove); }
     }
 }
+
+AI_SINGLE_BATTLE_TEST("AI reuses moves data across turns when nothing the damage calc reads has changed")
+{
+    GIVEN {
+        AI_FLAGS(AI_FLAG_CHECK_BAD_MOVE | AI_FLAG_CHECK_VIABILITY | AI_FLAG_TRY_TO_FAINT);
+        PLAYER(SPECIES_WOBBUFFET) { Moves(MOVE_CELEBRATE); }
+        OPPONENT(SPECIES_WOBBUFFET) { Moves(MOVE_CELEBRATE, MOVE_SPLASH); }
+    } WHEN {
+        TURN { MOVE(player, MOVE_CELEBRATE); }
+        TURN { MOVE(player, MOVE_CELEBRATE); }
+        TURN { MOVE(player, MOVE_CELEBRATE); }
+    } THEN {
+        EXPECT_GT(AI_DATA->movesDataHits, 0);
+    }
+}
+
+AI_SINGLE_BATTLE_TEST("AI recalculates turn order dependent moves and moves of changed battlers")
+{
+    GIVEN {
+        AI_FLAGS(AI_FLAG_CHECK_BAD_MOVE | AI_FLAG_CHECK_VIABILITY | AI_FLAG_TRY_TO_FAINT);
+        PLAYER(SPECIES_WOBBUFFET) { Moves(MOVE_CELEBRATE); }
+        OPPONENT(SPECIES_WOBBUFFET) { Moves(MOVE_CELEBRATE, MOVE_PAYBACK); }
+    } WHEN {
+        TURN { MOVE(player, MOVE_CELEBRATE); }
+    } THEN {
+        u32 hits, misses;
+
+        SetAiLogicDataForTurn(AI_DATA);
+        hits = AI_DATA->movesDataHits;
+        misses = AI_DATA->movesDataMisses;
+
+        // Only Payback is recalculated.
+        SetAiLogicDataForTurn(AI_DATA);
+        EXPECT_EQ(AI_DATA->movesDataMisses - misses, 1);
+        EXPECT_EQ(AI_DATA->movesDataHits - hits, 2 * MAX_MON_MOVES - 1);
+
+        // Both directions involve the opponent.
+        misses = AI_DATA->movesDataMisses;
+        gBattleMons[B_POSITION_OPPONENT_LEFT].statStages[STAT_ATK]++;
+        SetAiLogicDataForTurn(AI_DATA);
+        EXPECT_EQ(AI_DATA->movesDataMisses - misses, 2 * MAX_MON_MOVES);
+        gBattleMons[B_POSITION_OPPONENT_LEFT].statStages[STAT_ATK]--;
+    }
+}
+
+AI_SINGLE_BATTLE_TEST("AI recalculates the damage of a Metronome holder as it keeps using the same move")
+{
+    GIVEN {
+        ASSUME(gItemsInfo[ITEM_METRONOME].holdEffect == HOLD_EFFECT_METRONOME);
+        AI_FLAGS(AI_FLAG_CHECK_BAD_MOVE | AI_FLAG_CHECK_VIABILITY | AI_FLAG_TRY_TO_FAINT);
+        PLAYER(SPECIES_WOBBUFFET) { Moves(MOVE_CELEBRATE); }
+        OPPONENT(SPECIES_WOBBUFFET) { Item(ITEM_METRONOME); Moves(MOVE_TACKLE); }
+    } WHEN {
+        TURN { MOVE(player, MOVE_CELEBRATE); }
+        TURN { MOVE(player, MOVE_CELEBRATE); }
+    } THEN {
+        u32 turn;
+        s32 dmg, lastDmg;
+
+        SetAiLogicDataForTurn(AI_DATA);
+        lastDmg = AI_DATA->simulatedDmg[B_POSITION_OPPONENT_LEFT][B_POSITION_PLAYER_LEFT][0].expected;
+        for (turn = 0; turn < 3; turn++)
+        {
+            gBattleStruct->sameMoveTurns[B_POSITION_OPPONENT_LEFT]++;
+            SetAiLogicDataForTurn(AI_DATA);
+            dmg = AI_DATA->simulatedDmg[B_POSITION_OPPONENT_LEFT][B_POSITION_PLAYER_LEFT][0].expected;
+            EXPECT_GT(dmg, lastDmg);
+            lastDmg = dmg;
+        }
+    }
+}
+
+AI_SINGLE_BATTLE_TEST("AI recalculates weight-based damage against a battler that used Autotomize")
+{
+    GIVEN {
+        ASSUME(GetMoveEffect(MOVE_LOW_KICK) == EFFECT_LOW_KICK);
+        AI_FLAGS(AI_FLAG_CHECK_BAD_MOVE | AI_FLAG_CHECK_VIABILITY | AI_FLAG_TRY_TO_FAINT);
+        PLAYER(SPECIES_WOBBUFFET) { Moves(MOVE_CELEBRATE); }
+        OPPONENT(SPECIES_WOBBUFFET) { Moves(MOVE_LOW_KICK); }
+    } WHEN {
+        TURN { MOVE(player, MOVE_CELEBRATE); }
+    } THEN {
+        s32 dmg;
+
+        SetAiLogicDataForTurn(AI_DATA);
+        dmg = AI_DATA->simulatedDmg[B_POSITION_OPPONENT_LEFT][B_POSITION_PLAYER_LEFT][0].expected;
+        gDisableStructs[B_POSITION_PLAYER_LEFT].autotomizeCount++;
+        SetAiLogicDataForTurn(AI_DATA);
+        EXPECT_LT(AI_DATA->simulatedDmg[B_POSITION_OPPONENT_LEFT][B_POSITION_PLAYER_LEFT][0].expected, dmg);
+        gDisableStructs[B_POSITION_PLAYER_LEFT].autotomizeCount--;
+    }
+}
@@ -281,3 +281,38 @@ DOUBLE_BATTLE_TEST("Transistor Damage calculation", s16 damage)
         EXPECT_EQ(damagePlayerRight, expectedDamageTransistorPhys);
     }
 }
+
+SINGLE_BATTLE_TEST("Damage calculation sees abilities, items and types that changed since the last calculation")
+{
+    GIVEN {
+        ASSUME(GetMoveType(MOVE_TACKLE) == TYPE_NORMAL);
+        ASSUME(gItemsInfo[ITEM_CHOICE_BAND].holdEffect == HOLD_EFFECT_CHOICE_BAND);
+        PLAYER(SPECIES_WOBBUFFET) { Ability(ABILITY_TELEPATHY); Item(ITEM_NONE); }
+        OPPONENT(SPECIES_WOBBUFFET);
+    } WHEN {
+        TURN {}
+    } THEN {
+        s32 dmg, changedDmg;
+        struct DamageCalculationData damageCalcData = {
+            .battlerAtk = B_POSITION_PLAYER_LEFT,
+            .battlerDef = B_POSITION_OPPONENT_LEFT,
+            .move = MOVE_TACKLE,
+            .moveType = TYPE_NORMAL,
+        };
+
+        dmg = CalculateMoveDamage(&damageCalcData, 0);
+        EXPECT_GT(dmg, 0);
+
+        player->ability = ABILITY_HUGE_POWER;
+        player->item = ITEM_CHOICE_BAND;
+        EXPECT_EQ(GetBattlerAbility(B_POSITION_PLAYER_LEFT), ABILITY_HUGE_POWER);
+        EXPECT_EQ(GetBattlerHoldEffect(B_POSITION_PLAYER_LEFT, TRUE), HOLD_EFFECT_CHOICE_BAND);
+        changedDmg = CalculateMoveDamage(&damageCalcData, 0);
+        EXPECT_GT(changedDmg, dmg);
+
+        opponent->types[0] = TYPE_GHOST;
+        opponent->types[1] = TYPE_GHOST;
+        EXPECT_EQ(GetBattlerType(B_POSITION_OPPONENT_LEFT, 0, FALSE), TYPE_GHOST);
+        EXPECT_EQ(CalculateMoveDamage(&damageCalcData, 0), 0);
+    }
+}
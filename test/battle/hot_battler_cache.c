@@ -0,0 +1,68 @@
+#include "global.h"
+#include "test/battle.h"
+
+// The IsAbilityOn* queries answer from a table of the battlers with each
+// ability while a hot battler cache is open, and from a scan otherwise.
+// Both must find the same battler, including which one wins a tie.
+static void ExpectAbilityQueriesMatchScans(u32 ability)
+{
+    u32 battler;
+    u32 onSide[MAX_BATTLERS_COUNT], onOpposingSide[MAX_BATTLERS_COUNT], onFieldExcept[MAX_BATTLERS_COUNT];
+    u32 onField;
+
+    for (battler = 0; battler < gBattlersCount; battler++)
+    {
+        onSide[battler] = IsAbilityOnSide(battler, ability);
+        onOpposingSide[battler] = IsAbilityOnOpposingSide(battler, ability);
+        onFieldExcept[battler] = IsAbilityOnFieldExcept(battler, ability);
+    }
+    onField = IsAbilityOnField(ability);
+
+    BeginHotBattlerCache();
+    for (battler = 0; battler < gBattlersCount; battler++)
+    {
+        EXPECT_EQ(IsAbilityOnSide(battler, ability), onSide[battler]);
+        EXPECT_EQ(IsAbilityOnOpposingSide(battler, ability), onOpposingSide[battler]);
+        EXPECT_EQ(IsAbilityOnFieldExcept(battler, ability), onFieldExcept[battler]);
+    }
+    EXPECT_EQ(IsAbilityOnField(ability), onField);
+    EndHotBattlerCache();
+}
+
+static void ExpectAllAbilityQueriesMatchScans(void)
+{
+    ExpectAbilityQueriesMatchScans(ABILITY_SHADOW_TAG);
+    ExpectAbilityQueriesMatchScans(ABILITY_TELEPATHY);
+    ExpectAbilityQueriesMatchScans(ABILITY_NEUTRALIZING_GAS);
+    ExpectAbilityQueriesMatchScans(ABILITY_LEVITATE);
+}
+
+DOUBLE_BATTLE_TEST("IsAbilityOn* give the same battlers with and without the hot battler cache")
+{
+    u32 species, ability;
+
+    PARAMETRIZE { species = SPECIES_WOBBUFFET; ability = ABILITY_SHADOW_TAG; }
+    PARAMETRIZE { species = SPECIES_WEEZING; ability = ABILITY_NEUTRALIZING_GAS; }
+    GIVEN {
+        PLAYER(SPECIES_WOBBUFFET) { Ability(ABILITY_SHADOW_TAG); }
+        PLAYER(SPECIES_WOBBUFFET) { Ability(ABILITY_TELEPATHY); }
+        OPPONENT(SPECIES_WOBBUFFET) { Ability(ABILITY_TELEPATHY); }
+        OPPONENT(species) { Ability(ability); }
+    } WHEN {
+        TURN {}
+    } THEN {
+        u32 battler, hp;
+
+        EXPECT_EQ(IsNeutralizingGasOnField(), ability == ABILITY_NEUTRALIZING_GAS);
+        ExpectAllAbilityQueriesMatchScans();
+
+        // Each battler fainted in turn, so that ties go to the other one.
+        for (battler = 0; battler < gBattlersCount; battler++)
+        {
+            hp = gBattleMons[battler].hp;
+            gBattleMons[battler].hp = 0;
+            ExpectAllAbilityQueriesMatchScans();
+            gBattleMons[battler].hp = hp;
+        }
+    }
+}
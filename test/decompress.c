@@ -0,0 +1,23 @@
+#include "global.h"
+#include "decompress.h"
+#include "malloc.h"
+#include "pokemon.h"
+#include "test/test.h"
+#include "constants/species.h"
+
+TEST("LZDecompressWram decompresses a front pic")
+{
+    struct Benchmark lzDecompressFrontPic;
+    const u32 *src = gSpeciesInfo[SPECIES_BULBASAUR].frontPic;
+    u32 size = GetDecompressedDataSize(src);
+    u8 *dest = Alloc(size);
+
+    EXPECT(IsLZ77Data(src, size, size));
+    BENCHMARK(&lzDecompressFrontPic)
+    {
+        LZDecompressWram(src, dest);
+    }
+    REPORT_BENCHMARK(lzDecompressFrontPic);
+
+    Free(dest);
+}
@@ -0,0 +1,101 @@
+#include "global.h"
+#include "dma3.h"
+#include "test/test.h"
+
+// None of the requests below are ever processed, so they can point at
+// memory that isn't ours.
+#define SRC ((const u8 *)ROM_START)
+#define DEST ((u8 *)VRAM)
+
+// Stops ProcessDma3Requests from running in VBlank while a test fills
+// the queue. The queue is emptied again before anything is checked, so
+// that a failing test leaves nothing behind.
+static u32 LockDma3Requests(void)
+{
+    u32 ime = REG_IME;
+    REG_IME = 0;
+    ClearDma3Requests();
+    return ime;
+}
+
+static void UnlockDma3Requests(u32 ime)
+{
+    ClearDma3Requests();
+    REG_IME = ime;
+}
+
+TEST("RequestDma3Copy merges a copy that continues the previous one")
+{
+    s16 first, adjacent, gap, otherMode;
+    s16 firstSpace, freeSpace, allSpace;
+    struct Dma3Stats before, after;
+    u32 ime = LockDma3Requests();
+
+    GetDma3Stats(&before);
+    first = RequestDma3Copy(SRC, DEST, 0x100, 1);
+    adjacent = RequestDma3Copy(SRC + 0x100, DEST + 0x100, 0x100, 1);
+    gap = RequestDma3Copy(SRC + 0x300, DEST + 0x300, 0x100, 1);
+    otherMode = RequestDma3Copy(SRC + 0x400, DEST + 0x400, 0x100, 0);
+    GetDma3Stats(&after);
+    firstSpace = CheckForSpaceForDma3Request(first);
+    freeSpace = CheckForSpaceForDma3Request(3);
+    allSpace = CheckForSpaceForDma3Request(-1);
+    UnlockDma3Requests(ime);
+
+    EXPECT_EQ(first, 0);
+    EXPECT_EQ(adjacent, first);
+    EXPECT_EQ(gap, 1);
+    EXPECT_EQ(otherMode, 2);
+    EXPECT_EQ(after.requestsMerged - before.requestsMerged, 1);
+    EXPECT_EQ(firstSpace, -1);
+    EXPECT_EQ(freeSpace, 0);
+    EXPECT_EQ(allSpace, -1);
+    EXPECT_EQ(CheckForSpaceForDma3Request(first), 0);
+    EXPECT_EQ(CheckForSpaceForDma3Request(-1), 0);
+}
+
+TEST("RequestDma3Copy does not merge a copy from somewhere else")
+{
+    s16 first, otherSrc;
+    u32 ime = LockDma3Requests();
+
+    first = RequestDma3Copy(SRC, DEST, 0x100, 1);
+    otherSrc = RequestDma3Copy(SRC + 0x200, DEST + 0x100, 0x100, 1);
+    UnlockDma3Requests(ime);
+
+    EXPECT_EQ(first, 0);
+    EXPECT_EQ(otherSrc, 1);
+}
+
+TEST("RequestDma3Fill merges a fill of the same value that continues the previous one")
+{
+    s16 first, adjacent, otherValue;
+    u32 ime = LockDma3Requests();
+
+    first = RequestDma3Fill(0x11111111, DEST, 0x100, 1);
+    adjacent = RequestDma3Fill(0x11111111, DEST + 0x100, 0x100, 1);
+    otherValue = RequestDma3Fill(0x22222222, DEST + 0x200, 0x100, 1);
+    UnlockDma3Requests(ime);
+
+    EXPECT_EQ(first, 0);
+    EXPECT_EQ(adjacent, first);
+    EXPECT_EQ(otherValue, 1);
+}
+
+TEST("Merged DMA3 requests stay within the VBlank budget")
+{
+    s16 first, adjacent, overBudget, overBudgetSpace;
+    u32 ime = LockDma3Requests();
+
+    // 0x6000 + 0x3000 fits in 40 KiB, another 0x3000 would not.
+    first = RequestDma3Copy(SRC, DEST, 0x6000, 1);
+    adjacent = RequestDma3Copy(SRC + 0x6000, DEST + 0x6000, 0x3000, 1);
+    overBudget = RequestDma3Copy(SRC + 0x9000, DEST + 0x9000, 0x3000, 1);
+    overBudgetSpace = CheckForSpaceForDma3Request(overBudget);
+    UnlockDma3Requests(ime);
+
+    EXPECT_EQ(first, 0);
+    EXPECT_EQ(adjacent, first);
+    EXPECT_EQ(overBudget, 1);
+    EXPECT_EQ(overBudgetSpace, -1);
+}
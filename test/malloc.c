@@ -0,0 +1,91 @@
+#include "global.h"
+#include "malloc.h"
+#include "test/test.h"
+
+TEST("Free returns a block that the next allocation of its size reuses")
+{
+    void *a = Alloc(64);
+    void *b = Alloc(64);
+    Free(a);
+    EXPECT_EQ(Alloc(64), a);
+    EXPECT(CheckHeap());
+    Free(a);
+    Free(b);
+}
+
+TEST("Freed neighbours merge into one block")
+{
+    u32 i;
+    void *small[32];
+    void *big;
+
+    for (i = 0; i < ARRAY_COUNT(small); i++)
+        small[i] = Alloc(32);
+    for (i = 0; i < ARRAY_COUNT(small); i += 2)
+        Free(small[i]);
+    EXPECT(CheckHeap());
+    for (i = 1; i < ARRAY_COUNT(small); i += 2)
+        Free(small[i]);
+    EXPECT(CheckHeap());
+
+    big = Alloc(ARRAY_COUNT(small) * 32);
+    EXPECT(big != NULL);
+    EXPECT(CheckHeap());
+    Free(big);
+}
+
+TEST("Alloc reuses the most recently freed block that fits")
+{
+    u32 i;
+    void *blocks[6];
+
+    for (i = 0; i < ARRAY_COUNT(blocks); i++)
+        blocks[i] = Alloc(64);
+    // Free every other block so that the freed ones can't merge.
+    Free(blocks[4]);
+    Free(blocks[0]);
+    Free(blocks[2]);
+    EXPECT_EQ(Alloc(64), blocks[2]);
+    EXPECT_EQ(Alloc(64), blocks[0]);
+    EXPECT(CheckHeap());
+
+    for (i = 0; i < ARRAY_COUNT(blocks); i++)
+        Free(blocks[i]);
+}
+
+TEST("Free leaves the start of the freed data alone")
+{
+    u32 i;
+    u16 *a = Alloc(24);
+    u16 *b = Alloc(24);
+    u16 *c = Alloc(24);
+
+    for (i = 0; i < 4; i++)
+        b[i] = 0x1234 + i;
+    Free(a);
+    Free(c);
+    // Merges with both neighbours.
+    Free(b);
+    for (i = 0; i < 4; i++)
+        EXPECT_EQ(b[i], 0x1234 + i);
+    EXPECT(CheckHeap());
+}
+
+TEST("Heap arenas hand out memory until they are full")
+{
+    struct HeapArena arena;
+    void *first;
+
+    EXPECT(InitHeapArena(&arena, 64));
+    first = AllocFromHeapArena(&arena, 10);
+    EXPECT(first != NULL);
+    EXPECT(AllocFromHeapArena(&arena, 52) != NULL);
+    EXPECT(AllocFromHeapArena(&arena, 1) == NULL);
+
+    ResetHeapArena(&arena);
+    EXPECT_EQ(AllocFromHeapArena(&arena, 1), first);
+
+    FreeHeapArena(&arena);
+    EXPECT(arena.data == NULL);
+    EXPECT(CheckHeap());
+}
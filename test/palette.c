@@ -0,0 +1,301 @@
+#include "global.h"
+#include "malloc.h"
+#include "palette.h"
+#include "util.h"
+#include "test/test.h"
+#include "constants/rgb.h"
+
+static void Old_BlendPalette(u16 palOffset, u16 numEntries, u8 coeff, u32 blendColor, u16 *dest);
+static void Old_TintPalette_GrayScale(u16 *palette, u32 count);
+static void Old_TintPalette_GrayScale2(u16 *palette, u32 count);
+static void Old_TintPalette_SepiaTone(u16 *palette, u32 count);
+
+static const u16 sBlendColors[] = { RGB_BLACK, RGB_WHITE, RGB(31, 0, 15), RGB(3, 29, 17), RGB_WHITE | 0x8000 };
+
+// Every color shows up at least once over the whole buffer, including the
+// unused top bit.
+static void FillUnfadedPalettes(void)
+{
+    u32 i;
+    for (i = 0; i < PLTT_BUFFER_SIZE; i++)
+        gPlttBufferUnfaded[i] = i * 0x9E3 + (i >> 3);
+}
+
+static void ExpectEqColors(const u16 *oldColors, const u16 *newColors, u32 count)
+{
+    u32 i;
+    for (i = 0; i < count; i++)
+        EXPECT_EQ(oldColors[i], newColors[i]);
+}
+
+TEST("BlendPalette matches the C blend for every coefficient")
+{
+    u32 coeff, i, offset;
+    u16 *oldColors = Alloc(PLTT_SIZE);
+
+    FillUnfadedPalettes();
+    for (i = 0; i < ARRAY_COUNT(sBlendColors); i++)
+    {
+        for (coeff = 0; coeff <= 16; coeff++)
+        {
+            // Odd offsets and lengths put single colors at both ends.
+            for (offset = 0; offset < 2; offset++)
+            {
+                Old_BlendPalette(offset, PLTT_BUFFER_SIZE - 3, coeff, sBlendColors[i], oldColors);
+                BlendPalette(offset, PLTT_BUFFER_SIZE - 3, coeff, sBlendColors[i]);
+                ExpectEqColors(&oldColors[offset], &gPlttBufferFaded[offset], PLTT_BUFFER_SIZE - 3);
+            }
+        }
+    }
+    Free(oldColors);
+}
+
+TEST("TintPalette_GrayScale, GrayScale2 and SepiaTone match the C tints")
+{
+    u16 *oldColors = Alloc(PLTT_SIZE);
+
+    FillUnfadedPalettes();
+
+    CpuCopy16(gPlttBufferUnfaded, oldColors, PLTT_SIZE);
+    CpuCopy16(gPlttBufferUnfaded, gPlttBufferFaded, PLTT_SIZE);
+    Old_TintPalette_GrayScale(&oldColors[1], PLTT_BUFFER_SIZE - 2);
+    TintPalette_GrayScale(&gPlttBufferFaded[1], PLTT_BUFFER_SIZE - 2);
+    ExpectEqColors(oldColors, gPlttBufferFaded, PLTT_BUFFER_SIZE);
+
+    CpuCopy16(gPlttBufferUnfaded, oldColors, PLTT_SIZE);
+    CpuCopy16(gPlttBufferUnfaded, gPlttBufferFaded, PLTT_SIZE);
+    Old_TintPalette_GrayScale2(&oldColors[1], PLTT_BUFFER_SIZE - 2);
+    TintPalette_GrayScale2(&gPlttBufferFaded[1], PLTT_BUFFER_SIZE - 2);
+    ExpectEqColors(oldColors, gPlttBufferFaded, PLTT_BUFFER_SIZE);
+
+    CpuCopy16(gPlttBufferUnfaded, oldColors, PLTT_SIZE);
+    CpuCopy16(gPlttBufferUnfaded, gPlttBufferFaded, PLTT_SIZE);
+    Old_TintPalette_SepiaTone(oldColors, PLTT_BUFFER_SIZE);
+    TintPalette_SepiaTone(gPlttBufferFaded, PLTT_BUFFER_SIZE);
+    ExpectEqColors(oldColors, gPlttBufferFaded, PLTT_BUFFER_SIZE);
+
+    Free(oldColors);
+}
+
+// Puts the same colors in the faded buffer and PLTT, with nothing dirty.
+static void SyncPlttBuffer(void)
+{
+    u32 i;
+
+    ResetPaletteFadeControl();
+    for (i = 0; i < PLTT_BUFFER_SIZE; i++)
+        gPlttBufferFaded[i] = gPlttBufferUnfaded[i] = i;
+    TransferPlttBuffer();
+}
+
+TEST("TransferDirtyPlttBuffer copies only the palettes that were marked")
+{
+    const u16 *pltt = (const u16 *)PLTT;
+
+    SyncPlttBuffer();
+    gPlttBufferFaded[BG_PLTT_ID(2)] = RGB_RED;
+    FillPalette(RGB_WHITE, OBJ_PLTT_ID(3) + 15, PLTT_SIZEOF(2));
+    BlendPalette(BG_PLTT_ID(5), 16, 8, RGB_BLACK);
+    TransferDirtyPlttBuffer();
+
+    // The write that didn't go through a palette function is left out...
+    EXPECT_EQ(pltt[BG_PLTT_ID(2)], BG_PLTT_ID(2));
+    ExpectEqColors(&gPlttBufferFaded[BG_PLTT_ID(5)], &pltt[BG_PLTT_ID(5)], 16);
+    ExpectEqColors(&gPlttBufferFaded[OBJ_PLTT_ID(3)], &pltt[OBJ_PLTT_ID(3)], 32);
+
+    // ...until its palette is marked.
+    MarkPalettesDirty(1 << 2);
+    TransferDirtyPlttBuffer();
+    ExpectEqColors(gPlttBufferFaded, pltt, PLTT_BUFFER_SIZE);
+}
+
+TEST("TransferDirtyPlttBuffer faster than TransferPlttBuffer for one changed palette")
+{
+    struct Benchmark fullTransfer, dirtyTransfer;
+
+    SyncPlttBuffer();
+    BENCHMARK(&fullTransfer)
+    {
+        BlendPalette(BG_PLTT_ID(5), 16, 8, RGB_BLACK);
+        TransferPlttBuffer();
+    }
+    BENCHMARK(&dirtyTransfer)
+    {
+        BlendPalette(BG_PLTT_ID(5), 16, 8, RGB_BLACK);
+        TransferDirtyPlttBuffer();
+    }
+
+    ExpectEqColors(gPlttBufferFaded, (const u16 *)PLTT, PLTT_BUFFER_SIZE);
+    REPORT_BENCHMARK(dirtyTransfer);
+    EXPECT_FASTER(dirtyTransfer, fullTransfer);
+}
+
+#if FAST_PALETTE_BLEND
+TEST("ApplyColorMapToColors looks up every channel")
+{
+    u32 i;
+    u8 colorMap[32];
+
+    FillUnfadedPalettes();
+    for (i = 0; i < ARRAY_COUNT(colorMap); i++)
+        colorMap[i] = (i * 7 + 3) % 32;
+
+    ApplyColorMapToColors(&gPlttBufferUnfaded[1], &gPlttBufferFaded[0], PLTT_BUFFER_SIZE - 1, colorMap);
+    for (i = 0; i < PLTT_BUFFER_SIZE - 1; i++)
+    {
+        u32 color = gPlttBufferUnfaded[i + 1];
+        EXPECT_EQ(gPlttBufferFaded[i], RGB2(colorMap[GET_R(color)], colorMap[GET_G(color)], colorMap[GET_B(color)]));
+    }
+}
+
+TEST("BlendPalette faster than the C blend")
+{
+    struct Benchmark oldBlendPalette, newBlendPalette;
+    u16 *oldColors = Alloc(PLTT_SIZE);
+
+    FillUnfadedPalettes();
+    BENCHMARK(&oldBlendPalette)
+    {
+        Old_BlendPalette(0, PLTT_BUFFER_SIZE, 7, RGB_WHITE, oldColors);
+    }
+    BENCHMARK(&newBlendPalette)
+    {
+        BlendPalette(0, PLTT_BUFFER_SIZE, 7, RGB_WHITE);
+    }
+
+    ExpectEqColors(oldColors, gPlttBufferFaded, PLTT_BUFFER_SIZE);
+    REPORT_BENCHMARK(newBlendPalette);
+    EXPECT_FASTER(newBlendPalette, oldBlendPalette);
+    Free(oldColors);
+}
+
+TEST("TintPalette_GrayScale faster than the C tint")
+{
+    struct Benchmark oldGrayScale, newGrayScale;
+
+    FillUnfadedPalettes();
+    BENCHMARK(&oldGrayScale)
+    {
+        Old_TintPalette_GrayScale(gPlttBufferUnfaded, PLTT_BUFFER_SIZE);
+    }
+    FillUnfadedPalettes();
+    BENCHMARK(&newGrayScale)
+    {
+        TintPalette_GrayScale(gPlttBufferUnfaded, PLTT_BUFFER_SIZE);
+    }
+
+    REPORT_BENCHMARK(newGrayScale);
+    EXPECT_FASTER(newGrayScale, oldGrayScale);
+}
+
+TEST("TintPalette_SepiaTone faster than the C tint")
+{
+    struct Benchmark oldSepiaTone, newSepiaTone;
+
+    FillUnfadedPalettes();
+    BENCHMARK(&oldSepiaTone)
+    {
+        Old_TintPalette_SepiaTone(gPlttBufferUnfaded, PLTT_BUFFER_SIZE);
+    }
+    FillUnfadedPalettes();
+    BENCHMARK(&newSepiaTone)
+    {
+        TintPalette_SepiaTone(gPlttBufferUnfaded, PLTT_BUFFER_SIZE);
+    }
+
+    REPORT_BENCHMARK(newSepiaTone);
+    EXPECT_FASTER(newSepiaTone, oldSepiaTone);
+}
+#endif // FAST_PALETTE_BLEND
+
+// Old implementations.
+
+static void Old_BlendPalette(u16 palOffset, u16 numEntries, u8 coeff, u32 blendColor, u16 *dest)
+{
+    u16 i;
+    for (i = 0; i < numEntries; i++)
+    {
+        u16 index = i + palOffset;
+        struct PlttData *data1 = (struct PlttData *)&gPlttBufferUnfaded[index];
+        s8 r = data1->r;
+        s8 g = data1->g;
+        s8 b = data1->b;
+        struct PlttData *data2 = (struct PlttData *)&blendColor;
+        dest[index] = RGB(r + (((data2->r - r) * coeff) >> 4),
+                          g + (((data2->g - g) * coeff) >> 4),
+                          b + (((data2->b - b) * coeff) >> 4));
+    }
+}
+
+static const u8 sRoundedDownGrayscaleMap[] = {
+     0,  0,  0,  0,  0,
+     5,  5,  5,  5,  5,
+    11, 11, 11, 11, 11,
+    16, 16, 16, 16, 16,
+    21, 21, 21, 21, 21,
+    27, 27, 27, 27, 27,
+    31, 31
+};
+
+static void Old_TintPalette_GrayScale(u16 *palette, u32 count)
+{
+    s32 r, g, b;
+    u32 i, gray;
+
+    for (i = 0; i < count; i++)
+    {
+        r = GET_R(*palette);
+        g = GET_G(*palette);
+        b = GET_B(*palette);
+
+        gray = (r * Q_8_8(0.3) + g * Q_8_8(0.59) + b * Q_8_8(0.1133)) >> 8;
+
+        *palette++ = RGB2(gray, gray, gray);
+    }
+}
+
+static void Old_TintPalette_GrayScale2(u16 *palette, u32 count)
+{
+    s32 r, g, b;
+    u32 i, gray;
+
+    for (i = 0; i < count; i++)
+    {
+        r = GET_R(*palette);
+        g = GET_G(*palette);
+        b = GET_B(*palette);
+
+        gray = (r * Q_8_8(0.3) + g * Q_8_8(0.59) + b * Q_8_8(0.1133)) >> 8;
+
+        if (gray > 31)
+            gray = 31;
+
+        gray = sRoundedDownGrayscaleMap[gray];
+
+        *palette++ = RGB2(gray, gray, gray);
+    }
+}
+
+static void Old_TintPalette_SepiaTone(u16 *palette, u32 count)
+{
+    s32 r, g, b;
+    u32 i, gray;
+
+    for (i = 0; i < count; i++)
+    {
+        r = GET_R(*palette);
+        g = GET_G(*palette);
+        b = GET_B(*palette);
+
+        gray = (r * Q_8_8(0.3) + g * Q_8_8(0.59) + b * Q_8_8(0.1133)) >> 8;
+
+        r = (u16)((Q_8_8(1.2) * gray)) >> 8;
+        g = (u16)((Q_8_8(1.0) * gray)) >> 8;
+        b = (u16)((Q_8_8(0.94) * gray)) >> 8;
+
+        if (r > 31)
+            r = 31;
+
+        *palette++ = RGB2(r, g, b);
+    }
+}
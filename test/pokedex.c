@@ -0,0 +1,53 @@
+#include "global.h"
+#include "pokedex.h"
+#include "pokemon.h"
+#include "test/test.h"
+#include "constants/pokedex.h"
+
+static u32 CountFlags(u32 caseID, bool32 hoenn)
+{
+    u32 i, count = 0;
+
+    if (hoenn)
+    {
+        for (i = 0; i < HOENN_DEX_COUNT - 1; i++)
+            count += GetSetPokedexFlag(HoennToNationalOrder(i + 1), caseID);
+    }
+    else
+    {
+        for (i = 0; i < NATIONAL_DEX_COUNT; i++)
+            count += GetSetPokedexFlag(i + 1, caseID);
+    }
+    return count;
+}
+
+TEST("Pokedex counts follow the flags as they are set")
+{
+    u32 i;
+
+    ResetPokedex();
+    EXPECT_EQ(GetNationalPokedexCount(FLAG_GET_SEEN), 0);
+    EXPECT_EQ(GetHoennPokedexCount(FLAG_GET_CAUGHT), 0);
+
+    for (i = 1; i <= NATIONAL_DEX_COUNT; i += 7)
+    {
+        GetSetPokedexFlag(i, FLAG_SET_SEEN);
+        if (i % 3 == 0)
+            GetSetPokedexFlag(i, FLAG_SET_CAUGHT);
+    }
+    // Setting a flag twice must not count it twice.
+    GetSetPokedexFlag(NATIONAL_DEX_BULBASAUR, FLAG_SET_SEEN);
+    GetSetPokedexFlag(NATIONAL_DEX_TREECKO, FLAG_SET_SEEN);
+    GetSetPokedexFlag(NATIONAL_DEX_TREECKO, FLAG_SET_SEEN);
+
+    EXPECT_EQ(GetNationalPokedexCount(FLAG_GET_SEEN), CountFlags(FLAG_GET_SEEN, FALSE));
+    EXPECT_EQ(GetNationalPokedexCount(FLAG_GET_CAUGHT), CountFlags(FLAG_GET_CAUGHT, FALSE));
+    EXPECT_EQ(GetHoennPokedexCount(FLAG_GET_SEEN), CountFlags(FLAG_GET_SEEN, TRUE));
+    EXPECT_EQ(GetHoennPokedexCount(FLAG_GET_CAUGHT), CountFlags(FLAG_GET_CAUGHT, TRUE));
+
+    // Counting again from the flags must agree with the running counts.
+    InvalidatePokedexCounts();
+    EXPECT_EQ(GetNationalPokedexCount(FLAG_GET_SEEN), CountFlags(FLAG_GET_SEEN, FALSE));
+    EXPECT_EQ(GetHoennPokedexCount(FLAG_GET_CAUGHT), CountFlags(FLAG_GET_CAUGHT, TRUE));
+    ResetPokedex();
+}
@@ -68,6 +68,7 @@ static void BenchmarkBuildOamBuffer(bool32 preSort)
     }
 
     ExpectEqOamBuffers(oldOamBuffer, gMain.oamBuffer);
+    REPORT_BENCHMARK(newBuildOamBuffer);
     EXPECT_FASTER(newBuildOamBuffer, oldBuildOamBuffer);
     Free(oldOamBuffer);
 }
@@ -121,8 +122,85 @@ TEST("BuildOamBuffer faster with mix of sprites")
     BenchmarkBuildOamBuffer(FALSE);
 }
 
+static EWRAM_DATA u8 sCallbackOrder[MAX_SPRITES] = {0};
+static EWRAM_DATA u32 sCallbackCount = 0;
+
+static void SpriteCB_RecordOrder(struct Sprite *sprite)
+{
+    sCallbackOrder[sCallbackCount++] = sprite - gSprites;
+}
+
+static void SpriteCB_ReplaceSprite(struct Sprite *sprite)
+{
+    u32 spriteId;
+
+    SpriteCB_RecordOrder(sprite);
+    DestroySprite(&gSprites[sprite->data[0]]);
+    spriteId = CreateSpriteAtEnd(&gDummySpriteTemplate, 0, 0, 0);
+    gSprites[spriteId].callback = SpriteCB_RecordOrder;
+    sprite->callback = SpriteCallbackDummy;
+}
+
+TEST("AnimateSprites updates sprites created and destroyed by callbacks in index order")
+{
+    u32 replacer;
+
+    ResetSpriteData_();
+    replacer = CreateInvisibleSprite(SpriteCB_ReplaceSprite);
+    CreateInvisibleSprite(SpriteCB_RecordOrder);
+    gSprites[replacer].data[0] = CreateInvisibleSprite(SpriteCB_RecordOrder);
+
+    sCallbackCount = 0;
+    AnimateSprites();
+    EXPECT_EQ(sCallbackCount, 3);
+    EXPECT_EQ(sCallbackOrder[0], 0);
+    EXPECT_EQ(sCallbackOrder[1], 1);
+    EXPECT_EQ(sCallbackOrder[2], MAX_SPRITES - 1);
+}
+
+static void Old_AnimateSprites(void);
+
+TEST("AnimateSprites faster with few sprites")
+{
+    u32 i;
+    struct Benchmark oldAnimateSprites, newAnimateSprites;
+
+    ResetSpriteData_();
+    for (i = 0; i < 4; i++)
+        CreateSprite(&gDummySpriteTemplate, 0, 0, 0);
+
+    BENCHMARK(&oldAnimateSprites)
+    {
+        Old_AnimateSprites();
+    }
+    BENCHMARK(&newAnimateSprites)
+    {
+        AnimateSprites();
+    }
+
+    REPORT_BENCHMARK(newAnimateSprites);
+    EXPECT_FASTER(newAnimateSprites, oldAnimateSprites);
+}
+
 // Old implementation.
 
+static void Old_AnimateSprites(void)
+{
+    u32 i;
+    for (i = 0; i < MAX_SPRITES; i++)
+    {
+        struct Sprite *sprite = &gSprites[i];
+
+        if (sprite->inUse)
+        {
+            sprite->callback(sprite);
+
+            if (sprite->inUse)
+                AnimateSprite(sprite);
+        }
+    }
+}
+
 #define UBFIX
 
 static void UpdateOamCoords(void)
@@ -27,12 +27,31 @@ __attribute__((section(".persistent"))) static struct {
     u32 state:1;
 } sCurrentTest = {0};
 
+// Index of the test that Hydra most recently assigned to this runner.
+__attribute__((section(".persistent"))) static u32 sDynamicTestIndex = 0;
+
+// Shared with Hydra in dynamic mode. Hydra locates the mailbox by
+// searching the emulator's memory for the cookie, and answers each ':Q'
+// request by writing response and then sequence.
+struct HydraMailbox
+{
+    vu32 cookie[4];
+    vu32 response;
+    vu32 sequence;
+};
+
+EWRAM_DATA static struct HydraMailbox sHydraMailbox;
+
+// The file whose ASSUMPTIONS have run since the ROM (re)started.
+EWRAM_DATA static const char *sAssumptionsFilename;
+
 void TestRunner_Battle(const struct Test *);
 
 static bool32 MgbaOpen_(void);
 static void MgbaExit_(u8 exitCode);
 static s32 MgbaVPrintf_(const char *fmt, va_list va);
 static void Intr_Timer2(void);
+static void Intr_Timer3(void);
 
 extern const struct Test __start_tests[];
 extern const struct Test __stop_tests[];
@@ -63,27 +82,50 @@ enum
     STATE_EXIT,
 };
 
-static u32 MinCostProcess(void)
+// Min-heap of the runners ordered by their assigned cost so far. Each
+// entry is (cost << RUNNER_HEAP_SHIFT) | runner so that ties are broken
+// towards the lowest runner. The heap is persistent so that restarting
+// after a crash does not have to replay the assignment of every test.
+#define RUNNER_HEAP_SHIFT 5
+#define RUNNER_HEAP_MASK ((1 << RUNNER_HEAP_SHIFT) - 1)
+STATIC_ASSERT(MAX_PROCESSES <= (1 << RUNNER_HEAP_SHIFT), RunnerHeapShiftTooSmall);
+
+__attribute__((section(".persistent"))) static u32 sRunnerHeap[MAX_PROCESSES] = {0};
+
+static u32 RunnerHeapSize(void)
+{
+    return gTestRunnerN != 0 ? gTestRunnerN : 1;
+}
+
+static void InitRunnerHeap(void)
 {
     u32 i;
-    u32 minCost, minCostProcess;
+    for (i = 0; i < RunnerHeapSize(); i++)
+        sRunnerHeap[i] = i;
+}
+
+static u32 MinCostProcess(void)
+{
+    return sRunnerHeap[0] & RUNNER_HEAP_MASK;
+}
 
-    minCost = gTestRunnerState.processCosts[0];
-    minCostProcess = 0;
-    for (i = 1; i < gTestRunnerN; i++)
+static void AddCostToMinCostProcess(u32 cost)
+{
+    u32 i, child, size = RunnerHeapSize();
+    u32 entry = sRunnerHeap[0] + (cost << RUNNER_HEAP_SHIFT);
+
+    for (i = 0; (child = 2 * i + 1) < size; i = child)
     {
-        if (gTestRunnerState.processCosts[i] < minCost)
-        {
-            minCost = gTestRunnerState.processCosts[i];
-            minCostProcess = i;
-        }
+        if (child + 1 < size && sRunnerHeap[child + 1] < sRunnerHeap[child])
+            child++;
+        if (entry < sRunnerHeap[child])
+            break;
+        sRunnerHeap[i] = sRunnerHeap[child];
     }
-
-    return minCostProcess;
+    sRunnerHeap[i] = entry;
 }
 
 // Greedily assign tests to processes based on estimated cost.
-// TODO: Make processCosts a min heap.
 static u32 AssignCostToRunner(void)
 {
     u32 minCostProcess;
@@ -94,16 +136,72 @@ static u32 AssignCostToRunner(void)
     minCostProcess = MinCostProcess();
 
     // XXX: If estimateCost returns only on some processes, or
-    // returns inconsistent results then processCosts will be
+    // returns inconsistent results then the heap will be
     // inconsistent and some tests may not run.
     if (gTestRunnerState.test->runner->estimateCost)
-        gTestRunnerState.processCosts[minCostProcess] += gTestRunnerState.test->runner->estimateCost(gTestRunnerState.test->data);
+        AddCostToMinCostProcess(gTestRunnerState.test->runner->estimateCost(gTestRunnerState.test->data));
     else
-        gTestRunnerState.processCosts[minCostProcess] += 1;
+        AddCostToMinCostProcess(1);
 
     return minCostProcess;
 }
 
+static void InitHydraMailbox(void)
+{
+    u32 i;
+    // Store the complement so that the cookie is not also found in ROM.
+    for (i = 0; i < ARRAY_COUNT(sHydraMailbox.cookie); i++)
+        sHydraMailbox.cookie[i] = ~gTestRunnerNonce[i];
+    sHydraMailbox.response = 0;
+    sHydraMailbox.sequence = 0;
+}
+
+static u32 RequestTestIndex(void)
+{
+    u32 sequence = sHydraMailbox.sequence + 1;
+    Test_MgbaPrintf(":Q%d", sequence);
+    while (sHydraMailbox.sequence != sequence)
+        ;
+    return sHydraMailbox.response;
+}
+
+// Hydra hands out tests one at a time, so a runner that finishes early
+// takes work which would otherwise wait for a slower runner. Tests
+// before the assigned test in the same file are visited so that their
+// ASSUMPTIONS run first. Returns FALSE when there are no more tests.
+static bool32 AssignDynamicTest(void)
+{
+    const struct Test *test = gTestRunnerState.test;
+    const struct Test *target = &__start_tests[sDynamicTestIndex];
+
+    while (TRUE)
+    {
+        if (test == NULL || test > target)
+        {
+            sDynamicTestIndex = RequestTestIndex();
+            if (sDynamicTestIndex >= __stop_tests - __start_tests)
+                return FALSE;
+            target = &__start_tests[sDynamicTestIndex];
+            test = target;
+            if (target->filename != sAssumptionsFilename)
+            {
+                while (test > __start_tests && test[-1].filename == target->filename)
+                    test--;
+                sAssumptionsFilename = target->filename;
+            }
+        }
+
+        if (test->runner == &gAssumptionsRunner)
+            break;
+        if (test == target && PrefixMatch(gTestRunnerArgv, test->name))
+            break;
+        test++;
+    }
+
+    gTestRunnerState.test = test;
+    return TRUE;
+}
+
 void CB2_TestRunner(void)
 {
 top:
@@ -123,23 +221,29 @@ top:
         ClearSav2();
         ClearSav3();
 
+        gIntrTable[2] = Intr_Timer3;
         gIntrTable[7] = Intr_Timer2;
 
         gSaveBlock2Ptr->optionsBattleStyle = OPTIONS_BATTLE_STYLE_SET;
 
+        if (gTestRunnerDynamic)
+            InitHydraMailbox();
+        sAssumptionsFilename = NULL;
+
         // The current test restarted the ROM (e.g. by jumping to NULL).
-        if (sCurrentTest.address != 0)
+        if (sCurrentTest.address != 0 && gTestRunnerDynamic)
         {
-            gTestRunnerState.test = __start_tests;
-            while ((uintptr_t)gTestRunnerState.test != sCurrentTest.address)
-            {
-                AssignCostToRunner();
-                gTestRunnerState.test++;
-            }
+            gTestRunnerState.test = (const struct Test *)sCurrentTest.address;
+            gTestRunnerState.state = STATE_REPORT_RESULT;
+            gTestRunnerState.result = TEST_RESULT_CRASH;
+        }
+        else if (sCurrentTest.address != 0)
+        {
+            gTestRunnerState.test = (const struct Test *)sCurrentTest.address;
             if (sCurrentTest.state == CURRENT_TEST_STATE_ESTIMATE)
             {
                 u32 runner = MinCostProcess();
-                gTestRunnerState.processCosts[runner] += 1;
+                AddCostToMinCostProcess(1);
                 if (runner == gTestRunnerI)
                 {
                     gTestRunnerState.state = STATE_REPORT_RESULT;
@@ -156,10 +260,16 @@ top:
                 gTestRunnerState.result = TEST_RESULT_CRASH;
             }
         }
+        else if (gTestRunnerDynamic)
+        {
+            gTestRunnerState.state = STATE_ASSIGN_TEST;
+            gTestRunnerState.test = NULL;
+        }
         else
         {
             gTestRunnerState.state = STATE_ASSIGN_TEST;
             gTestRunnerState.test = __start_tests;
+            InitRunnerHeap();
         }
         gTestRunnerState.exitCode = 0;
         gTestRunnerState.skipFilename = NULL;
@@ -167,18 +277,29 @@ top:
         break;
 
     case STATE_ASSIGN_TEST:
-        while (1)
+        if (gTestRunnerDynamic)
         {
-            if (gTestRunnerState.test == __stop_tests)
+            if (!AssignDynamicTest())
             {
                 gTestRunnerState.state = STATE_EXIT;
                 return;
             }
-            if (gTestRunnerState.test->runner != &gAssumptionsRunner
-              && !PrefixMatch(gTestRunnerArgv, gTestRunnerState.test->name))
-                ++gTestRunnerState.test;
-            else
-                break;
+        }
+        else
+        {
+            while (1)
+            {
+                if (gTestRunnerState.test == __stop_tests)
+                {
+                    gTestRunnerState.state = STATE_EXIT;
+                    return;
+                }
+                if (gTestRunnerState.test->runner != &gAssumptionsRunner
+                  && !PrefixMatch(gTestRunnerArgv, gTestRunnerState.test->name))
+                    ++gTestRunnerState.test;
+                else
+                    break;
+            }
         }
 
         Test_MgbaPrintf(":N%s", gTestRunnerState.test->name);
@@ -192,16 +313,15 @@ top:
             gTestRunnerState.timeoutSeconds = UINT_MAX;
         InitHeap(gHeap, HEAP_SIZE);
         ResetTasks();
-        EnableInterrupts(INTR_FLAG_TIMER2);
-        REG_TM2CNT_L = UINT16_MAX - (274 * 60); // Approx. 1 second.
-        REG_TM2CNT_H = TIMER_ENABLE | TIMER_INTR_ENABLE | TIMER_1024CLK;
+        EnableInterrupts(INTR_FLAG_TIMER2 | INTR_FLAG_TIMER3);
+        StartTimeoutTimer();
 
         sCurrentTest.address = (uintptr_t)gTestRunnerState.test;
         sCurrentTest.state = CURRENT_TEST_STATE_ESTIMATE;
 
         // If AssignCostToRunner fails, we want to report the failure.
         gTestRunnerState.state = STATE_REPORT_RESULT;
-        if (AssignCostToRunner() == gTestRunnerI)
+        if (gTestRunnerDynamic || AssignCostToRunner() == gTestRunnerI)
             gTestRunnerState.state = STATE_RUN_TEST;
         else
             gTestRunnerState.state = STATE_NEXT_TEST;
@@ -233,6 +353,7 @@ top:
 
     case STATE_REPORT_RESULT:
         REG_TM2CNT_H = 0;
+        REG_TM3CNT_H = 0;
 
         gTestRunnerState.state = STATE_NEXT_TEST;
 
@@ -481,6 +602,16 @@ void ReinitCallbacks(void)
     gMain.hblankCallback = NULL;
 }
 
+static void Timeout(void)
+{
+    if (gTestRunnerState.state == STATE_RUN_TEST)
+        gTestRunnerState.state = STATE_REPORT_RESULT;
+    gTestRunnerState.result = TEST_RESULT_TIMEOUT;
+    Test_MgbaPrintf(":L%s:%d - TIMEOUT", gTestRunnerState.test->filename, SourceLine(0));
+    ReinitCallbacks();
+    IRQ_LR = ((uintptr_t)JumpToAgbMainLoop & ~1) + 4;
+}
+
 static void Intr_Timer2(void)
 {
     if (--gTestRunnerState.timeoutSeconds == 0)
@@ -492,16 +623,17 @@ static void Intr_Timer2(void)
         }
         else
         {
-            if (gTestRunnerState.state == STATE_RUN_TEST)
-                gTestRunnerState.state = STATE_REPORT_RESULT;
-            gTestRunnerState.result = TEST_RESULT_TIMEOUT;
-            Test_MgbaPrintf(":L%s:%d - TIMEOUT", gTestRunnerState.test->filename, SourceLine(0));
-            ReinitCallbacks();
-            IRQ_LR = ((uintptr_t)JumpToAgbMainLoop & ~1) + 4;
+            Timeout();
         }
     }
 }
 
+// Timer 3 only overflows if a benchmark has run for 2^32 cycles.
+static void Intr_Timer3(void)
+{
+    Timeout();
+}
+
 void Test_ExitWithResult(enum TestResult result, u32 stopLine, const char *fmt, ...)
 {
     gTestRunnerState.result = result;
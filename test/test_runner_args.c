@@ -5,4 +5,6 @@
 const bool8 gTestRunnerEnabled = TRUE;
 const u8 gTestRunnerN = 0;
 const u8 gTestRunnerI = 0;
+const bool8 gTestRunnerDynamic = FALSE;
+const u32 gTestRunnerNonce[4] = {0};
 const char gTestRunnerArgv[256] = {'\0'};
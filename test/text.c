@@ -9,6 +9,7 @@
 #include "main_menu.h"
 #include "string_util.h"
 #include "text.h"
+#include "window.h"
 #include "constants/abilities.h"
 #include "constants/battle.h"
 #include "constants/battle_string_ids.h"
@@ -824,3 +825,98 @@ TEST("Battle strings fit on the battle message window")
     Free(battleString);
 }
 //*/
+
+#define GLYPH_TEST_WINDOW 0
+#define GLYPH_TEST_WINDOW_WIDTH 20
+#define GLYPH_TEST_WINDOW_HEIGHT 2
+#define GLYPH_TEST_WINDOW_SIZE (GLYPH_TEST_WINDOW_WIDTH * GLYPH_TEST_WINDOW_HEIGHT * TILE_SIZE_4BPP)
+
+static void PrintToGlyphTestWindow(const u8 *str, u32 fgColor, u32 bgColor, u32 shadowColor)
+{
+    struct TextPrinterTemplate printer = {
+        .currentChar = str,
+        .windowId = GLYPH_TEST_WINDOW,
+        .fontId = FONT_NORMAL,
+        .fgColor = fgColor,
+        .bgColor = bgColor,
+        .shadowColor = shadowColor,
+    };
+
+    FillWindowPixelBuffer(GLYPH_TEST_WINDOW, PIXEL_FILL(bgColor));
+    AddTextPrinter(&printer, TEXT_SKIP_DRAW, NULL);
+}
+
+static void SetUpGlyphTestWindow(struct Window *savedWindow)
+{
+    *savedWindow = gWindows[GLYPH_TEST_WINDOW];
+    gWindows[GLYPH_TEST_WINDOW].window = (struct WindowTemplate) { .width = GLYPH_TEST_WINDOW_WIDTH, .height = GLYPH_TEST_WINDOW_HEIGHT };
+    gWindows[GLYPH_TEST_WINDOW].tileData = Alloc(GLYPH_TEST_WINDOW_SIZE);
+}
+
+static void TearDownGlyphTestWindow(const struct Window *savedWindow)
+{
+    Free(gWindows[GLYPH_TEST_WINDOW].tileData);
+    gWindows[GLYPH_TEST_WINDOW] = *savedWindow;
+}
+
+TEST("Cached glyphs are drawn with the current colors")
+{
+    struct Window savedWindow;
+    u8 *coldPixels = Alloc(GLYPH_TEST_WINDOW_SIZE);
+    const u8 *str = COMPOUND_STRING("Wobbuffet used Splash!");
+    u32 hits, misses, warmHits, warmMisses;
+
+    SetUpGlyphTestWindow(&savedWindow);
+
+    // The same text in other colors, drawn with nothing cached.
+    ResetGlyphCache();
+    PrintToGlyphTestWindow(str, TEXT_COLOR_RED, TEXT_COLOR_WHITE, TEXT_COLOR_LIGHT_RED);
+    memcpy(coldPixels, gWindows[GLYPH_TEST_WINDOW].tileData, GLYPH_TEST_WINDOW_SIZE);
+
+    ResetGlyphCache();
+    PrintToGlyphTestWindow(str, TEXT_COLOR_DARK_GRAY, TEXT_COLOR_WHITE, TEXT_COLOR_LIGHT_GRAY);
+    PrintToGlyphTestWindow(str, TEXT_COLOR_RED, TEXT_COLOR_WHITE, TEXT_COLOR_LIGHT_RED);
+    EXPECT_EQ(memcmp(coldPixels, gWindows[GLYPH_TEST_WINDOW].tileData, GLYPH_TEST_WINDOW_SIZE), 0);
+
+    // Printing it again in the same colors only uses cached glyphs.
+    GetGlyphCacheStats(&hits, &misses);
+    PrintToGlyphTestWindow(str, TEXT_COLOR_RED, TEXT_COLOR_WHITE, TEXT_COLOR_LIGHT_RED);
+    GetGlyphCacheStats(&warmHits, &warmMisses);
+    EXPECT_EQ(warmMisses, misses);
+    EXPECT_GT(warmHits, hits);
+    EXPECT_EQ(memcmp(coldPixels, gWindows[GLYPH_TEST_WINDOW].tileData, GLYPH_TEST_WINDOW_SIZE), 0);
+
+    TearDownGlyphTestWindow(&savedWindow);
+    Free(coldPixels);
+}
+
+TEST("Printing cached glyphs is faster than expanding them")
+{
+    struct Window savedWindow;
+    struct Benchmark uncachedPrint, cachedPrint;
+    u8 *uncachedPixels = Alloc(GLYPH_TEST_WINDOW_SIZE);
+    const u8 *str = COMPOUND_STRING("Wobbuffet used Splash!");
+
+    SetUpGlyphTestWindow(&savedWindow);
+
+    gTestSkipGlyphCache = TRUE;
+    BENCHMARK(&uncachedPrint)
+    {
+        PrintToGlyphTestWindow(str, TEXT_COLOR_DARK_GRAY, TEXT_COLOR_WHITE, TEXT_COLOR_LIGHT_GRAY);
+    }
+    gTestSkipGlyphCache = FALSE;
+    memcpy(uncachedPixels, gWindows[GLYPH_TEST_WINDOW].tileData, GLYPH_TEST_WINDOW_SIZE);
+
+    ResetGlyphCache();
+    PrintToGlyphTestWindow(str, TEXT_COLOR_DARK_GRAY, TEXT_COLOR_WHITE, TEXT_COLOR_LIGHT_GRAY);
+    BENCHMARK(&cachedPrint)
+    {
+        PrintToGlyphTestWindow(str, TEXT_COLOR_DARK_GRAY, TEXT_COLOR_WHITE, TEXT_COLOR_LIGHT_GRAY);
+    }
+
+    EXPECT_EQ(memcmp(uncachedPixels, gWindows[GLYPH_TEST_WINDOW].tileData, GLYPH_TEST_WINDOW_SIZE), 0);
+    REPORT_BENCHMARK(cachedPrint);
+    EXPECT_FASTER(cachedPrint, uncachedPrint);
+    TearDownGlyphTestWindow(&savedWindow);
+    Free(uncachedPixels);
+}
@@ -0,0 +1,74 @@
+#include "global.h"
+#include "event_data.h"
+#include "wild_encounter.h"
+#include "test/test.h"
+#include "constants/maps.h"
+#include "constants/wild_encounter.h"
+
+static u16 Old_GetCurrentMapWildMonHeaderId(void);
+
+static void SetLocation(u32 mapGroup, u32 mapNum)
+{
+    gSaveBlock1Ptr->location.mapGroup = mapGroup;
+    gSaveBlock1Ptr->location.mapNum = mapNum;
+}
+
+TEST("GetCurrentMapWildMonHeaderId finds the same header as a scan of gWildMonHeaders")
+{
+    u32 i;
+    struct WarpData location = gSaveBlock1Ptr->location;
+
+    VarSet(VAR_ALTERING_CAVE_WILD_SET, 0);
+    for (i = 0; gWildMonHeaders[i].mapGroup != MAP_GROUP(UNDEFINED); i++)
+    {
+        SetLocation(gWildMonHeaders[i].mapGroup, gWildMonHeaders[i].mapNum);
+        EXPECT_EQ(GetCurrentMapWildMonHeaderId(), Old_GetCurrentMapWildMonHeaderId());
+    }
+
+    SetLocation(MAP_GROUP(ALTERING_CAVE), MAP_NUM(ALTERING_CAVE));
+    for (i = 0; i <= NUM_ALTERING_CAVE_TABLES; i++)
+    {
+        VarSet(VAR_ALTERING_CAVE_WILD_SET, i);
+        EXPECT_EQ(GetCurrentMapWildMonHeaderId(), Old_GetCurrentMapWildMonHeaderId());
+    }
+    VarSet(VAR_ALTERING_CAVE_WILD_SET, 0);
+
+    SetLocation(MAP_GROUP(LITTLEROOT_TOWN), MAP_NUM(LITTLEROOT_TOWN));
+    EXPECT_EQ(GetCurrentMapWildMonHeaderId(), Old_GetCurrentMapWildMonHeaderId());
+    SetLocation(MAP_GROUP(UNDEFINED), MAP_NUM(UNDEFINED));
+    EXPECT_EQ(GetCurrentMapWildMonHeaderId(), Old_GetCurrentMapWildMonHeaderId());
+
+    gSaveBlock1Ptr->location = location;
+}
+
+// Old implementation.
+
+static u16 Old_GetCurrentMapWildMonHeaderId(void)
+{
+    u16 i;
+
+    for (i = 0; ; i++)
+    {
+        const struct WildPokemonHeader *wildHeader = &gWildMonHeaders[i];
+        if (wildHeader->mapGroup == MAP_GROUP(UNDEFINED))
+            break;
+
+        if (gWildMonHeaders[i].mapGroup == gSaveBlock1Ptr->location.mapGroup &&
+            gWildMonHeaders[i].mapNum == gSaveBlock1Ptr->location.mapNum)
+        {
+            if (gSaveBlock1Ptr->location.mapGroup == MAP_GROUP(ALTERING_CAVE) &&
+                gSaveBlock1Ptr->location.mapNum == MAP_NUM(ALTERING_CAVE))
+            {
+                u16 alteringCaveId = VarGet(VAR_ALTERING_CAVE_WILD_SET);
+                if (alteringCaveId >= NUM_ALTERING_CAVE_TABLES)
+                    alteringCaveId = 0;
+
+                i += alteringCaveId;
+            }
+
+            return i;
+        }
+    }
+
+    return 0xFFFF;
+}
@@ -0,0 +1,61 @@
+import re
+
+# Generates the table of which abilities AbilityBattleEffects handles for
+# each of its ability-keyed cases, so calls for other abilities can return
+# before doing any work.
+
+SOURCE = "./src/battle_util.c"
+OUTPUT = "./src/data/battle/ability_hooks.h"
+
+# Cases whose block is one switch on the ability and nothing else, with the
+# expression that block switches on.
+KEYED_CASES = {
+    "ABILITYEFFECT_ON_SWITCHIN": "gLastUsedAbility",
+    "ABILITYEFFECT_ENDTURN": "gLastUsedAbility",
+    "ABILITYEFFECT_MOVE_END": "gLastUsedAbility",
+    "ABILITYEFFECT_MOVE_END_ATTACKER": "gLastUsedAbility",
+    "ABILITYEFFECT_MOVE_END_OTHER": "GetBattlerAbility(battler)",
+    "ABILITYEFFECT_ON_WEATHER": "gLastUsedAbility",
+    "ABILITYEFFECT_ON_TERRAIN": "gLastUsedAbility",
+}
+
+with open(SOURCE, "r") as file:
+    source = file.read()
+
+start = source.index("u32 AbilityBattleEffects(u32 caseID")
+end = source.index("\n}\n", start)
+parts = re.split(r"\n    case (ABILITYEFFECT_\w+):[^\n]*", source[start:end])
+blocks = dict(zip(parts[1::2], parts[2::2]))
+
+hooks = {}
+for case, key in KEYED_CASES.items():
+    if case not in blocks:
+        quit("%s: %s is not a case of AbilityBattleEffects" % (SOURCE, case))
+    block = blocks[case]
+    switches = re.findall(r"switch \((.*)\)\n", block)
+    if not switches or switches[0] != key:
+        quit("%s: %s no longer switches on %s" % (SOURCE, case, key))
+    if "default:" in block:
+        quit("%s: %s has a default case, so every ability has a hook" % (SOURCE, case))
+    for ability in re.findall(r"case (ABILITY_\w+):", block):
+        hooks.setdefault(ability, [])
+        if case not in hooks[ability]:
+            hooks[ability].append(case)
+
+header = "//\n// DO NOT MODIFY THIS FILE! It is auto-generated from tools/battle_helpers/ability_hooks.py\n//\n\n"
+output = header
+output += "#define ABILITY_EFFECT_KEYED_CASES (" + " | ".join("(1u << %s)" % case for case in KEYED_CASES) + ")\n\n"
+output += "static const u32 sAbilityEffectHooks[ABILITIES_COUNT] =\n{\n"
+for ability in sorted(hooks):
+    output += "    [%s] = %s,\n" % (ability, " | ".join("(1u << %s)" % case for case in hooks[ability]))
+output += "};\n"
+
+try:
+    with open(OUTPUT, "r") as file:
+        if file.read() == output:
+            quit()
+except FileNotFoundError:
+    pass
+
+with open(OUTPUT, "w") as file:
+    file.write(output)
@@ -69,7 +69,133 @@ fail:
 	FATAL_ERROR("Fatal error while decompressing LZ file.\n");
 }
 
-unsigned char *LZCompress(unsigned char *src, int srcSize, int *compressedSize, const int minDistance)
+#define LZ_MIN_BLOCK_SIZE 3
+#define LZ_MAX_BLOCK_SIZE 18
+#define LZ_MAX_DISTANCE 0x1000
+#define LZ_HASH_BITS 14
+#define LZ_OPTIMAL_MAX_CANDIDATES 1024
+
+// Hash chains over every 3-byte sequence seen so far. prev[] links each
+// position to the previous one with the same hash, so walking a chain
+// visits candidates in order of increasing distance. That makes the first
+// longest match found the closest one, which is what the exhaustive search
+// used to pick, so the output is unchanged.
+struct MatchFinder {
+	int head[1 << LZ_HASH_BITS];
+	int *prev;
+	int nextPos;
+};
+
+static int HashBlock(const unsigned char *src)
+{
+	unsigned int value = (src[0] << 16) | (src[1] << 8) | src[2];
+	return (value * 2654435761u) >> (32 - LZ_HASH_BITS);
+}
+
+static void InitMatchFinder(struct MatchFinder *finder, int srcSize)
+{
+	for (int i = 0; i < (1 << LZ_HASH_BITS); i++)
+		finder->head[i] = -1;
+
+	finder->prev = malloc(srcSize * sizeof(int));
+
+	if (finder->prev == NULL)
+		FATAL_ERROR("Fatal error while compressing LZ file.\n");
+
+	finder->nextPos = 0;
+}
+
+// Returns the size of the longest block at srcPos among the first
+// maxCandidates on its chain, and its distance. Positions must be visited
+// in increasing order.
+static int FindBlock(struct MatchFinder *finder, unsigned char *src, int srcSize, int srcPos, int minDistance, int maxCandidates, int *bestBlockDistance)
+{
+	for (; finder->nextPos < srcPos; finder->nextPos++) {
+		int pos = finder->nextPos;
+
+		if (pos + LZ_MIN_BLOCK_SIZE <= srcSize) {
+			int hash = HashBlock(&src[pos]);
+			finder->prev[pos] = finder->head[hash];
+			finder->head[hash] = pos;
+		}
+	}
+
+	if (srcPos + LZ_MIN_BLOCK_SIZE > srcSize)
+		return 0;
+
+	int maxBlockSize = srcSize - srcPos;
+
+	if (maxBlockSize > LZ_MAX_BLOCK_SIZE)
+		maxBlockSize = LZ_MAX_BLOCK_SIZE;
+
+	int bestBlockSize = 0;
+
+	for (int blockStart = finder->head[HashBlock(&src[srcPos])]; blockStart >= 0 && maxCandidates > 0; blockStart = finder->prev[blockStart], maxCandidates--) {
+		int blockDistance = srcPos - blockStart;
+
+		if (blockDistance > LZ_MAX_DISTANCE)
+			break;
+
+		if (blockDistance < minDistance)
+			continue;
+
+		int blockSize = 0;
+
+		while (blockSize < maxBlockSize && src[blockStart + blockSize] == src[srcPos + blockSize])
+			blockSize++;
+
+		if (blockSize > bestBlockSize) {
+			*bestBlockDistance = blockDistance;
+			bestBlockSize = blockSize;
+
+			if (blockSize == maxBlockSize)
+				break;
+		}
+	}
+
+	return bestBlockSize >= LZ_MIN_BLOCK_SIZE ? bestBlockSize : 0;
+}
+
+// Picks the block size at every position that minimizes the total size,
+// working back from the end of the data. A block costs 17 bits (a flag bit
+// and two bytes) and a literal 9. Any prefix of the longest block at a
+// position is also a valid block, at the same distance.
+static void ParseOptimal(unsigned char *src, int srcSize, int minDistance, int *blockSizes, int *blockDistances)
+{
+	struct MatchFinder finder;
+	InitMatchFinder(&finder, srcSize);
+
+	int *longestBlockSizes = malloc(srcSize * sizeof(int));
+	int *costs = malloc((srcSize + 1) * sizeof(int));
+
+	if (longestBlockSizes == NULL || costs == NULL)
+		FATAL_ERROR("Fatal error while compressing LZ file.\n");
+
+	for (int srcPos = 0; srcPos < srcSize; srcPos++)
+		longestBlockSizes[srcPos] = FindBlock(&finder, src, srcSize, srcPos, minDistance, LZ_OPTIMAL_MAX_CANDIDATES, &blockDistances[srcPos]);
+
+	costs[srcSize] = 0;
+
+	for (int srcPos = srcSize - 1; srcPos >= 0; srcPos--) {
+		costs[srcPos] = costs[srcPos + 1] + 9;
+		blockSizes[srcPos] = 0;
+
+		for (int blockSize = LZ_MIN_BLOCK_SIZE; blockSize <= longestBlockSizes[srcPos]; blockSize++) {
+			int cost = costs[srcPos + blockSize] + 17;
+
+			if (cost < costs[srcPos]) {
+				costs[srcPos] = cost;
+				blockSizes[srcPos] = blockSize;
+			}
+		}
+	}
+
+	free(costs);
+	free(longestBlockSizes);
+	free(finder.prev);
+}
+
+unsigned char *LZCompress(unsigned char *src, int srcSize, int *compressedSize, const int minDistance, bool optimal)
 {
 	if (srcSize <= 0)
 		goto fail;
@@ -90,6 +216,22 @@ unsigned char *LZCompress(unsigned char *src, int srcSize, int *compressedSize,
 	dest[2] = (unsigned char)(srcSize >> 8);
 	dest[3] = (unsigned char)(srcSize >> 16);
 
+	struct MatchFinder finder;
+	int *blockSizes = NULL;
+	int *blockDistances = NULL;
+
+	if (optimal) {
+		blockSizes = malloc(srcSize * sizeof(int));
+		blockDistances = malloc(srcSize * sizeof(int));
+
+		if (blockSizes == NULL || blockDistances == NULL)
+			goto fail;
+
+		ParseOptimal(src, srcSize, minDistance, blockSizes, blockDistances);
+	} else {
+		InitMatchFinder(&finder, srcSize);
+	}
+
 	int srcPos = 0;
 	int destPos = 4;
 
@@ -99,30 +241,16 @@ unsigned char *LZCompress(unsigned char *src, int srcSize, int *compressedSize,
 
 		for (int i = 0; i < 8; i++) {
 			int bestBlockDistance = 0;
-			int bestBlockSize = 0;
-			int blockDistance = minDistance;
-
-			while (blockDistance <= srcPos && blockDistance <= 0x1000) {
-				int blockStart = srcPos - blockDistance;
-				int blockSize = 0;
+			int bestBlockSize;
 
-				while (blockSize < 18
-				    && srcPos + blockSize < srcSize
-				    && src[blockStart + blockSize] == src[srcPos + blockSize])
-					blockSize++;
-
-				if (blockSize > bestBlockSize) {
-					bestBlockDistance = blockDistance;
-					bestBlockSize = blockSize;
-
-					if (blockSize == 18)
-						break;
-				}
-
-				blockDistance++;
+			if (optimal) {
+				bestBlockSize = blockSizes[srcPos];
+				bestBlockDistance = blockDistances[srcPos];
+			} else {
+				bestBlockSize = FindBlock(&finder, src, srcSize, srcPos, minDistance, LZ_MAX_DISTANCE, &bestBlockDistance);
 			}
 
-			if (bestBlockSize >= 3) {
+			if (bestBlockSize >= LZ_MIN_BLOCK_SIZE) {
 				*flags |= (0x80 >> i);
 				srcPos += bestBlockSize;
 				bestBlockSize -= 3;
@@ -142,6 +270,13 @@ unsigned char *LZCompress(unsigned char *src, int srcSize, int *compressedSize,
 						dest[destPos++] = 0;
 				}
 
+				if (optimal) {
+					free(blockSizes);
+					free(blockDistances);
+				} else {
+					free(finder.prev);
+				}
+
 				*compressedSize = destPos;
 				return dest;
 			}
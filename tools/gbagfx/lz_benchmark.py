@@ -0,0 +1,91 @@
+#!/usr/bin/env python3
+# Compresses every built graphics file under a directory with gbagfx, and
+# reports the time taken and the total compressed size of each LZ mode.
+# The optimal parse output is checked to decompress to the original data.
+#
+# Pass --reference with another gbagfx build (e.g. one from an older
+# commit) to compare its speed, and to check that the greedy output is
+# byte-identical to it.
+#
+# Usage: python3 tools/gbagfx/lz_benchmark.py [--reference GBAGFX] [DIR]
+# The graphics must have been built first, e.g. with 'make'.
+
+import argparse
+import os
+import resource
+import subprocess
+import sys
+import tempfile
+import time
+
+EXTENSIONS = (".1bpp", ".4bpp", ".8bpp", ".gbapal", ".bin")
+
+def find_inputs(root):
+    inputs = []
+    for dirpath, _, files in os.walk(root):
+        for name in files:
+            if name.endswith(EXTENSIONS):
+                inputs.append(os.path.join(dirpath, name))
+    return sorted(inputs)
+
+def compress_all(gbagfx, inputs, out_dir, options):
+    # Process startup dominates the wall time for small files, so the CPU
+    # time of the children is reported as well.
+    outputs = []
+    start = time.perf_counter()
+    start_usage = resource.getrusage(resource.RUSAGE_CHILDREN)
+    for i, path in enumerate(inputs):
+        output = os.path.join(out_dir, "%d.lz" % i)
+        subprocess.run([gbagfx, path, output] + options, check=True)
+        outputs.append(output)
+    usage = resource.getrusage(resource.RUSAGE_CHILDREN)
+    elapsed = time.perf_counter() - start
+    cpu = usage.ru_utime - start_usage.ru_utime
+    return elapsed, cpu, outputs
+
+def read(path):
+    with open(path, "rb") as f:
+        return f.read()
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument("--gbagfx", default=os.path.join(os.path.dirname(__file__), "gbagfx"))
+    parser.add_argument("--reference")
+    parser.add_argument("dir", nargs="?", default="graphics")
+    args = parser.parse_args()
+
+    inputs = find_inputs(args.dir)
+    if not inputs:
+        sys.exit("No built graphics found in %s" % args.dir)
+    raw_size = sum(os.path.getsize(path) for path in inputs)
+    print("%d files, %d bytes uncompressed" % (len(inputs), raw_size))
+
+    modes = [("greedy", args.gbagfx, []), ("optimal", args.gbagfx, ["-optimal"])]
+    if args.reference:
+        modes.insert(0, ("reference", args.reference, []))
+
+    with tempfile.TemporaryDirectory() as tmp:
+        results = {}
+        for name, gbagfx, options in modes:
+            out_dir = os.path.join(tmp, name)
+            os.mkdir(out_dir)
+            elapsed, cpu, outputs = compress_all(gbagfx, inputs, out_dir, options)
+            size = sum(os.path.getsize(path) for path in outputs)
+            results[name] = outputs
+            print("%-9s %8.2fs wall %8.2fs user %10d bytes (%.1f%%)" % (name, elapsed, cpu, size, 100.0 * size / raw_size))
+
+        if args.reference:
+            mismatches = [inputs[i] for i, (a, b) in enumerate(zip(results["reference"], results["greedy"])) if read(a) != read(b)]
+            for path in mismatches:
+                print("greedy output differs from reference: %s" % path)
+            if mismatches:
+                sys.exit(1)
+
+        for i, path in enumerate(results["optimal"]):
+            roundtrip = os.path.join(tmp, "roundtrip" + os.path.splitext(inputs[i])[1])
+            subprocess.run([args.gbagfx, path, roundtrip], check=True)
+            if read(roundtrip) != read(inputs[i]):
+                sys.exit("optimal output does not decompress to %s" % inputs[i])
+
+if __name__ == "__main__":
+    main()
@@ -125,9 +125,54 @@ def construct_compatibility_dict(force_custom_check):
 
 compatibility_dict = construct_compatibility_dict(True)
 
+# remove the bitsets added by add_bitsets, so that the learnsets can be read and updated
+def remove_bitsets(text):
+    text = re.sub(r"#define TEACHABLE_BITSET_SIZE[\s\S]*?\n};\n\n", "", text)
+    text = re.sub(r"\n    TEACHABLE_BITSET\(.*\),", "", text)
+    text = re.sub(r"\n#define s\w*TeachableLearnset \(.*\)", "", text)
+    return re.sub(r"TeachableLearnsetWithBitset\[\]", "TeachableLearnset[]", text)
+
+# put a bitset of its moves in front of each learnset, so that CanLearnTeachableMove does not have to search it
+def add_bitsets(text):
+    learnsets = re.findall(r"static const u16 s(\w*)TeachableLearnset\[\] = {\n([\s\S]*?)\n};", text)
+    learnset_moves = {}
+    all_moves = []
+    for mon, body in learnsets:
+        learnset_moves[mon] = [x.strip() for x in body.replace(",", "\n").split("\n") if x.strip() not in ["", "MOVE_UNAVAILABLE"]]
+        for move in learnset_moves[mon]:
+            if not move in all_moves:
+                all_moves.append(move)
+    # TMs and tutors first, so that the bits stay put when other moves are added
+    all_moves = [x for x in tm_moves + tutor_moves if x in all_moves] + sorted([x for x in all_moves if not x in tm_moves + tutor_moves])
+    bit_indexes = {move: i for i, move in enumerate(all_moves)}
+    bitset_size = (len(all_moves) + 15) // 16
+
+    def replace_learnset(match):
+        bits = [0] * bitset_size
+        for move in learnset_moves[match.group(1)]:
+            bits[bit_indexes[move] // 16] |= 1 << (bit_indexes[move] % 16)
+        repl = "static const u16 s%sTeachableLearnsetWithBitset[] = {\n" % match.group(1)
+        repl += "    TEACHABLE_BITSET(%s),\n" % ", ".join("0x%04X" % x for x in bits)
+        repl += match.group(2) + "\n};\n"
+        repl += "#define s%sTeachableLearnset (s%sTeachableLearnsetWithBitset + TEACHABLE_BITSET_SIZE)" % (match.group(1), match.group(1))
+        return repl
+    text = re.sub(r"static const u16 s(\w*)TeachableLearnset\[\] = {\n([\s\S]*?)\n};", replace_learnset, text)
+
+    index_type = "u8" if len(all_moves) < 255 else "u16"
+    preamble = "#define TEACHABLE_BITSET_SIZE %d\n" % bitset_size
+    preamble += "#define TEACHABLE_BITSET(...) __VA_ARGS__\n\n"
+    preamble += "// 1 + the index of each move's bit in the learnsets' bitsets, or 0 if no learnset has the move.\n"
+    preamble += "static const %s sTeachableMoveBitIndexes[MOVES_COUNT] = {\n" % index_type
+    for move in all_moves:
+        preamble += "    [%s] = %d,\n" % (move, bit_indexes[move] + 1)
+    preamble += "};\n\n"
+    # after the header
+    header_end = text.find("//\n\n", text.find("// DO NOT MODIFY THIS FILE!")) + len("//\n\n")
+    return text[:header_end] + preamble + text[header_end:]
+
 # actually prepare the file
 with open("./src/data/pokemon/teachable_learnsets.h", 'r') as file:
-    out = file.read()
+    out = remove_bitsets(file.read())
     list_of_mons = re.findall(r'static const u16 s(.*)TeachableLearnset', out)
 for mon in list_of_mons:
     mon_parsed = parse_mon_name(mon)
@@ -210,5 +255,7 @@ if not "// DO NOT MODIFY THIS FILE!" in out:
 else:
     out = re.sub(r"\/\/\n\/\/ DO NOT MODIFY THIS FILE!(.|\n)*\* \/\/\n\n", header, out)
 
+out = add_bitsets(out)
+
 with open("./src/data/pokemon/teachable_learnsets.h", 'w') as file:
     file.write(out)
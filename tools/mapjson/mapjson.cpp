@@ -63,6 +63,22 @@ void write_text_file(string filepath, string text) {
     out_file.close();
 }
 
+// Leaves the file, and so its modification time, alone if it already has this text.
+void write_text_file_if_changed(string filepath, string text) {
+    ifstream in_file(filepath, std::ifstream::binary);
+
+    if (in_file.is_open()) {
+        ostringstream existing;
+        existing << in_file.rdbuf();
+        in_file.close();
+
+        if (existing.str() == text)
+            return;
+    }
+
+    write_text_file(filepath, text);
+}
+
 
 string json_to_string(const Json &data, const string &field = "", bool silent = false) {
     const Json value = !field.empty() ? data[field] : data;
@@ -96,20 +112,25 @@ string json_to_string(const Json &data, const string &field = "", bool silent =
     return output;
 }
 
-string generate_map_header_text(Json map_data, Json layouts_data) {
-    string map_layout_id = json_to_string(map_data, "layout");
+// Maps each layout id to its layouts, so that maps can find theirs without a linear search.
+map<string, vector<Json>> index_layouts(const Json &layouts_data) {
+    map<string, vector<Json>> layouts_by_id;
 
-    vector<Json> matched;
+    for (auto &layout : layouts_data["layouts"].array_items())
+        layouts_by_id[json_to_string(layout, "id", true)].push_back(layout);
 
-    for (auto &layout : layouts_data["layouts"].array_items()) {
-        if (map_layout_id == json_to_string(layout, "id", true))
-            matched.push_back(layout);
-    }
+    return layouts_by_id;
+}
+
+string generate_map_header_text(Json map_data, const map<string, vector<Json>> &layouts_by_id) {
+    string map_layout_id = json_to_string(map_data, "layout");
 
-    if (matched.size() != 1)
+    auto matched = layouts_by_id.find(map_layout_id);
+
+    if (matched == layouts_by_id.end() || matched->second.size() != 1)
         FATAL_ERROR("Failed to find matching layout for %s.\n", map_layout_id.c_str());
 
-    Json layout = matched[0];
+    Json layout = matched->second[0];
 
     ostringstream text;
 
@@ -347,28 +368,45 @@ string file_parent(string filename){
     return filename.substr(0, dir_pos + 1);
 }
 
-void process_map(string map_filepath, string layouts_filepath, string output_dir) {
-    string mapdata_err, layouts_err;
+Json read_layouts(string layouts_filepath) {
+    string layouts_err;
+
+    Json layouts_data = Json::parse(read_text_file(layouts_filepath), layouts_err);
+    if (layouts_data == Json())
+        FATAL_ERROR("%s\n", layouts_err.c_str());
+
+    return layouts_data;
+}
+
+void process_map(string map_filepath, const map<string, vector<Json>> &layouts_by_id, string output_dir, bool only_if_changed) {
+    string mapdata_err;
 
     string mapdata_json_text = read_text_file(map_filepath);
-    string layouts_json_text = read_text_file(layouts_filepath);
 
     Json map_data = Json::parse(mapdata_json_text, mapdata_err);
     if (map_data == Json())
-        FATAL_ERROR("%s\n", mapdata_err.c_str());
-
-    Json layouts_data = Json::parse(layouts_json_text, layouts_err);
-    if (layouts_data == Json())
-        FATAL_ERROR("%s\n", layouts_err.c_str());
+        FATAL_ERROR("%s: %s\n", map_filepath.c_str(), mapdata_err.c_str());
 
-    string header_text = generate_map_header_text(map_data, layouts_data);
+    string header_text = generate_map_header_text(map_data, layouts_by_id);
     string events_text = generate_map_events_text(map_data);
     string connections_text = generate_map_connections_text(map_data);
 
+    auto write = only_if_changed ? write_text_file_if_changed : write_text_file;
     string out_dir = strip_trailing_separator(output_dir).append(sep);
-    write_text_file(out_dir + "header.inc", header_text);
-    write_text_file(out_dir + "events.inc", events_text);
-    write_text_file(out_dir + "connections.inc", connections_text);
+    write(out_dir + "header.inc", header_text);
+    write(out_dir + "events.inc", events_text);
+    write(out_dir + "connections.inc", connections_text);
+}
+
+// Like process_map for each map, but layouts.json is only read once. Each
+// map's files are written next to its map.json.
+void process_maps(string layouts_filepath, const vector<string> &map_filepaths) {
+    map<string, vector<Json>> layouts_by_id = index_layouts(read_layouts(layouts_filepath));
+
+    for (const string &map_filepath : map_filepaths) {
+        infer_separator(map_filepath);
+        process_map(map_filepath, layouts_by_id, file_parent(map_filepath), true);
+    }
 }
 
 string generate_groups_text(Json groups_data) {
@@ -641,8 +679,8 @@ int main(int argc, char *argv[]) {
 
     char *mode_arg = argv[1];
     string mode(mode_arg);
-    if (mode != "layouts" && mode != "map" && mode != "groups")
-        FATAL_ERROR("ERROR: <mode> must be 'layouts', 'map', or 'groups'.\n");
+    if (mode != "layouts" && mode != "map" && mode != "maps" && mode != "groups")
+        FATAL_ERROR("ERROR: <mode> must be 'layouts', 'map', 'maps', or 'groups'.\n");
 
     if (mode == "map") {
         if (argc != 6)
@@ -653,7 +691,16 @@ int main(int argc, char *argv[]) {
         string layouts_filepath(argv[4]);
         string output_dir(argv[5]);
 
-        process_map(filepath, layouts_filepath, output_dir);
+        process_map(filepath, index_layouts(read_layouts(layouts_filepath)), output_dir, false);
+    }
+    else if (mode == "maps") {
+        if (argc < 5)
+            FATAL_ERROR("USAGE: mapjson maps <game-version> <layouts_file> <map_file>...\n");
+
+        string layouts_filepath(argv[3]);
+        vector<string> map_filepaths(argv + 4, argv + argc);
+
+        process_maps(layouts_filepath, map_filepaths);
     }
     else if (mode == "groups") {
         if (argc != 6)
@@ -678,7 +725,7 @@ int main(int argc, char *argv[]) {
         process_layouts(filepath, output_asm, output_c);
     }
     else {
-        FATAL_ERROR("ERROR: <mode> must be 'layouts', 'map', or 'groups'.\n");
+        FATAL_ERROR("ERROR: <mode> must be 'layouts', 'map', 'maps', or 'groups'.\n");
     }
 
     return 0;
@@ -14,7 +14,38 @@
  * P/K/F/A: Sets the result to the remaining of the line, flushes any
  *    output since the previous P/K/F/A and increment the number of
  *    passes/known fails/assumption fails/fails.
+ * Q: Requests the index of the next test to run. The remainder of the
+ *    line is a sequence number which is written back with the index.
+ * B: Reports a benchmark. The remainder of the line is the number of
+ *    cycles it took, a space, and its name.
+ *
+ * DYNAMIC MODE
+ * Where Hydra can write to the memory of its child processes (Linux),
+ * tests are handed out one at a time from a shared queue rather than
+ * being divided between the runners up front. Each runner stores a
+ * cookie derived from gTestRunnerNonce in its mailbox, Hydra finds the
+ * mailbox by searching the runner's memory for the cookie, and then
+ * answers each Q by writing into the mailbox.
+ *
+ * TIMINGS
+ * If a timings file is passed, Hydra reads how long each test took on
+ * the previous run and hands out the slowest tests first (longest-
+ * processing-time scheduling), then records the new durations. Tests
+ * without a duration are handed out before all others, in order.
+ *
+ * If test files are passed after the timings file, only tests from
+ * those files are handed out (see tools/mgba-rom-test-hydra/watch.py).
+ *
+ * BENCHMARKS
+ * Benchmarks reported with B are written to the file passed with -o, as
+ * a JSON object from "<filename>: <test name>: <benchmark name>" to
+ * cycles. If a baseline in the same format is passed with -b, every
+ * benchmark more than -t percent (default 5) slower than in the
+ * baseline is listed as a regression and Hydra exits with a failure.
  */
+#ifdef __linux__
+#define _GNU_SOURCE
+#endif
 #include <fcntl.h>
 #include <math.h>
 #include <poll.h>
@@ -31,7 +62,11 @@
 #include <sys/prctl.h>
 #endif
 #include <sys/stat.h>
+#ifdef __linux__
+#include <sys/uio.h>
+#endif
 #include <sys/wait.h>
+#include <time.h>
 #include <unistd.h>
 #include "elf.h"
 
@@ -47,6 +82,9 @@ struct Runner
 {
     pid_t pid;
     int outfd;
+    uintptr_t mailbox;
+    uint32_t current_test;
+    double current_test_start;
     char rom_path[FILENAME_MAX];
     char test_name[256];
     char filename_line[256];
@@ -82,10 +120,46 @@ struct SymbolTable {
     size_t symbols_n;
 };
 
+// Layout of 'struct Test' in include/test/test.h.
+struct Test {
+    uint32_t name;
+    uint32_t filename;
+    uint32_t runner;
+    uint32_t data;
+    uint16_t sourceLine;
+};
+
+struct TestInfo {
+    const char *name;
+    const char *filename;
+    double duration; // Seconds, or negative if unknown.
+};
+
 static unsigned nrunners = 0;
 static unsigned runners_digits = 0;
 static struct Runner *runners = NULL;
 
+static bool dynamic = false;
+static uint32_t nonce[4];
+static uint32_t next_test = 0;
+
+static struct TestInfo *tests = NULL;
+static uint32_t tests_n = 0;
+// Order in which tests are handed out in dynamic mode.
+static uint32_t *test_queue = NULL;
+static uint32_t test_queue_n = 0;
+static char **test_files = NULL;
+static int test_files_n = 0;
+
+struct BenchmarkResult {
+    char *name;
+    uint32_t cycles;
+};
+
+static struct BenchmarkResult *benchmarks = NULL;
+static size_t benchmarks_n = 0;
+static size_t benchmarks_capacity = 0;
+
 // TODO: Build the symbol table on demand.
 static struct SymbolTable symbol_table = { NULL, 0 };
 
@@ -190,6 +264,332 @@ static void fprint_buffer(FILE *f, const char *buffer, size_t size)
     }
 }
 
+static double now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+#ifdef __linux__
+// Layout of 'struct HydraMailbox' in test/test_runner.c.
+#define MAILBOX_COOKIE_SIZE     16
+#define MAILBOX_RESPONSE_OFFSET 16
+#define MAILBOX_SEQUENCE_OFFSET 20
+
+static uintptr_t find_mailbox(pid_t pid)
+{
+    char maps_path[64];
+    snprintf(maps_path, sizeof(maps_path), "/proc/%d/maps", pid);
+    FILE *maps = fopen(maps_path, "r");
+    if (!maps)
+        return 0;
+
+    uint32_t cookie[4];
+    for (int i = 0; i < ARRAY_COUNT(cookie); i++)
+        cookie[i] = ~nonce[i];
+
+    size_t chunk_capacity = 1024 * 1024;
+    char *chunk = malloc(chunk_capacity);
+    if (!chunk)
+    {
+        perror("malloc chunk failed");
+        exit(2);
+    }
+
+    uintptr_t mailbox = 0;
+    char line[1024];
+    while (!mailbox && fgets(line, sizeof(line), maps))
+    {
+        unsigned long start, end;
+        char perms[5];
+        if (sscanf(line, "%lx-%lx %4s", &start, &end, perms) != 3)
+            continue;
+        if (perms[0] != 'r' || perms[1] != 'w')
+            continue;
+
+        // Overlap consecutive chunks so that a cookie which straddles
+        // them is still found.
+        for (unsigned long address = start; !mailbox && address + MAILBOX_COOKIE_SIZE <= end; address += chunk_capacity - MAILBOX_COOKIE_SIZE)
+        {
+            struct iovec local = { chunk, min(chunk_capacity, end - address) };
+            struct iovec remote = { (void *)address, local.iov_len };
+            ssize_t n = process_vm_readv(pid, &local, 1, &remote, 1, 0);
+            if (n < MAILBOX_COOKIE_SIZE)
+                break;
+            for (size_t j = 0; j + MAILBOX_COOKIE_SIZE <= n; j += 4)
+            {
+                if (memcmp(chunk + j, cookie, MAILBOX_COOKIE_SIZE) == 0)
+                {
+                    mailbox = address + j;
+                    break;
+                }
+            }
+        }
+    }
+
+    free(chunk);
+    fclose(maps);
+    return mailbox;
+}
+
+static void write_mailbox(struct Runner *runner, size_t offset, uint32_t value)
+{
+    struct iovec local = { &value, sizeof(value) };
+    struct iovec remote = { (void *)(runner->mailbox + offset), sizeof(value) };
+    if (process_vm_writev(runner->pid, &local, 1, &remote, 1, 0) != sizeof(value))
+    {
+        perror("process_vm_writev mailbox failed");
+        exit(2);
+    }
+}
+
+// Checks that we are allowed to access the memory of our children
+// before we commit the runners to dynamic mode.
+static bool can_access_children(void)
+{
+    static volatile uint32_t probe = 0x4859;
+    pid_t pid = fork();
+    if (pid == -1)
+    {
+        perror("fork probe failed");
+        exit(2);
+    }
+    else if (pid == 0)
+    {
+        pause();
+        _exit(0);
+    }
+
+    uint32_t value = 0;
+    struct iovec local = { &value, sizeof(value) };
+    struct iovec remote = { (void *)&probe, sizeof(value) };
+    bool ok = process_vm_readv(pid, &local, 1, &remote, 1, 0) == sizeof(value) && value == probe;
+    kill(pid, SIGKILL);
+    waitpid(pid, NULL, 0);
+    return ok;
+}
+#endif
+
+static void handle_request(int i, struct Runner *runner, const char *soc)
+{
+#ifdef __linux__
+    if (!runner->mailbox && !(runner->mailbox = find_mailbox(runner->pid)))
+    {
+        fprintf(stderr, "[%0*d] could not find mailbox\n", runners_digits, i);
+        exit(2);
+    }
+    if (!test_queue)
+        runner->current_test = next_test++;
+    else if (next_test < test_queue_n)
+        runner->current_test = test_queue[next_test++];
+    else
+        runner->current_test = UINT32_MAX;
+    runner->current_test_start = now();
+    write_mailbox(runner, MAILBOX_RESPONSE_OFFSET, runner->current_test);
+    write_mailbox(runner, MAILBOX_SEQUENCE_OFFSET, strtoul(soc, NULL, 10));
+#else
+    fprintf(stderr, "[%0*d] unexpected request in static mode\n", runners_digits, i);
+    exit(2);
+#endif
+}
+
+static void add_benchmark(struct Runner *runner, const char *soc, const char *eol)
+{
+    char *name_start;
+    unsigned long cycles = strtoul(soc, &name_start, 10);
+    if (name_start == soc || *name_start++ != ' ')
+    {
+        fprintf(stderr, "malformed benchmark: '%.*s'\n", (int)(eol - soc - 1), soc);
+        return;
+    }
+
+    // The tests' filenames are only known in dynamic mode, otherwise use
+    // the filename from the last L.
+    const char *filename = runner->filename_line;
+    size_t filename_n = strcspn(filename, ":");
+    if (runner->current_test < tests_n)
+    {
+        filename = tests[runner->current_test].filename;
+        filename_n = strlen(filename);
+    }
+
+    if (benchmarks_n == benchmarks_capacity)
+    {
+        benchmarks_capacity = benchmarks_capacity ? 2 * benchmarks_capacity : 64;
+        benchmarks = realloc(benchmarks, benchmarks_capacity * sizeof(*benchmarks));
+        if (!benchmarks)
+        {
+            perror("realloc benchmarks failed");
+            exit(2);
+        }
+    }
+
+    struct BenchmarkResult *benchmark = &benchmarks[benchmarks_n++];
+    int name_n = eol - name_start - 1;
+    size_t size = snprintf(NULL, 0, "%.*s: %s: %.*s", (int)filename_n, filename, runner->test_name, name_n, name_start) + 1;
+    if (!(benchmark->name = malloc(size)))
+    {
+        perror("malloc benchmark failed");
+        exit(2);
+    }
+    snprintf(benchmark->name, size, "%.*s: %s: %.*s", (int)filename_n, filename, runner->test_name, name_n, name_start);
+    benchmark->cycles = cycles;
+}
+
+static int compare_benchmarks(const void *a, const void *b)
+{
+    const struct BenchmarkResult *ba = a, *bb = b;
+    return strcmp(ba->name, bb->name);
+}
+
+static void fprint_json_string(FILE *f, const char *string)
+{
+    fputc('"', f);
+    for (; *string; string++)
+    {
+        if (*string == '"' || *string == '\\')
+            fputc('\\', f);
+        fputc(*string, f);
+    }
+    fputc('"', f);
+}
+
+static void write_benchmarks(const char *path)
+{
+    char tmp_path[FILENAME_MAX];
+    snprintf(tmp_path, sizeof(tmp_path), "%s.tmp", path);
+    FILE *f = fopen(tmp_path, "w");
+    if (!f)
+    {
+        perror("fopen benchmarks failed");
+        return;
+    }
+    fprintf(f, "{");
+    for (size_t i = 0; i < benchmarks_n; i++)
+    {
+        fprintf(f, i == 0 ? "\n  " : ",\n  ");
+        fprint_json_string(f, benchmarks[i].name);
+        fprintf(f, ": %u", benchmarks[i].cycles);
+    }
+    fprintf(f, "\n}\n");
+    if (fclose(f) != 0 || rename(tmp_path, path) == -1)
+        perror("write benchmarks failed");
+}
+
+// Reads a JSON object of names to cycles, as written by
+// 'write_benchmarks'. Returns false if the file cannot be read.
+static bool read_benchmarks(const char *path, struct BenchmarkResult **results, size_t *results_n)
+{
+    FILE *f = fopen(path, "r");
+    if (!f)
+        return false;
+
+    size_t capacity = 64;
+    *results_n = 0;
+    *results = malloc(capacity * sizeof(**results));
+    if (!*results)
+    {
+        perror("malloc benchmarks failed");
+        exit(2);
+    }
+
+    char line[1024];
+    while (fgets(line, sizeof(line), f))
+    {
+        char *start = strchr(line, '"');
+        if (!start)
+            continue;
+
+        // Unescape the name in place.
+        char *src = start + 1, *dst = start;
+        while (*src && *src != '"')
+        {
+            if (*src == '\\' && src[1])
+                src++;
+            *dst++ = *src++;
+        }
+        if (*src != '"')
+            continue;
+        *dst = '\0';
+
+        char *colon = strchr(src + 1, ':');
+        if (!colon)
+            continue;
+        char *end;
+        unsigned long cycles = strtoul(colon + 1, &end, 10);
+        if (end == colon + 1)
+            continue;
+
+        if (*results_n == capacity)
+        {
+            capacity *= 2;
+            *results = realloc(*results, capacity * sizeof(**results));
+            if (!*results)
+            {
+                perror("realloc benchmarks failed");
+                exit(2);
+            }
+        }
+        (*results)[*results_n].name = strdup(start);
+        (*results)[*results_n].cycles = cycles;
+        (*results_n)++;
+    }
+
+    fclose(f);
+    qsort(*results, *results_n, sizeof(**results), compare_benchmarks);
+    return true;
+}
+
+// Lists the benchmarks that are more than 'threshold' percent slower
+// than in the baseline, and returns how many there are.
+static int report_benchmark_regressions(const char *baseline_path, unsigned threshold)
+{
+    struct BenchmarkResult *baseline;
+    size_t baseline_n;
+    if (!read_benchmarks(baseline_path, &baseline, &baseline_n))
+    {
+        perror("read benchmark baseline failed");
+        return 0;
+    }
+
+    int regressions = 0;
+    int improvements = 0;
+    int missing = 0;
+    for (size_t i = 0; i < benchmarks_n; i++)
+    {
+        struct BenchmarkResult *old = bsearch(&benchmarks[i], baseline, baseline_n, sizeof(*baseline), compare_benchmarks);
+        if (!old)
+        {
+            missing++;
+            continue;
+        }
+
+        uint64_t cycles = benchmarks[i].cycles;
+        if (cycles * 100 > (uint64_t)old->cycles * (100 + threshold))
+        {
+            if (regressions == 0)
+                fprintf(stdout, "\n  Benchmark \e[31mREGRESSIONS\e[0m (more than %u%% slower than %s):\n", threshold, baseline_path);
+            fprintf(stdout, "  - \e[31m%s\e[0m: %u -> %u cycles (%+.1f%%)\n", benchmarks[i].name, old->cycles, benchmarks[i].cycles, 100.0 * benchmarks[i].cycles / old->cycles - 100.0);
+            regressions++;
+        }
+        else if (cycles * (100 + threshold) < (uint64_t)old->cycles * 100)
+        {
+            improvements++;
+        }
+    }
+
+    fprintf(stdout, "\n- Benchmarks \e[31mSLOWER\e[0m:       %d\n", regressions);
+    fprintf(stdout, "- Benchmarks \e[32mFASTER\e[0m:       %d\n", improvements);
+    if (missing > 0)
+        fprintf(stdout, "- Benchmarks not in baseline: %d\n", missing);
+
+    for (size_t i = 0; i < baseline_n; i++)
+        free(baseline[i].name);
+    free(baseline);
+    return regressions;
+}
+
 static void handle_read(int i, struct Runner *runner)
 {
     char *sol = runner->input_buffer;
@@ -235,6 +635,12 @@ static void handle_read(int i, struct Runner *runner)
                     strncpy(runner->filename_line, soc, eol - soc - 1);
                     runner->filename_line[eol - soc - 1] = '\0';
                     break;
+                case 'Q':
+                    handle_request(i, runner, soc + 2);
+                    break;
+                case 'B':
+                    add_benchmark(runner, soc + 2, eol);
+                    break;
 
                 case 'P':
                     runner->passes++;
@@ -270,6 +676,8 @@ static void handle_read(int i, struct Runner *runner)
                     runner->fails++;
 add_to_results:
                     runner->results++;
+                    if (runner->current_test < tests_n)
+                        tests[runner->current_test].duration = now() - runner->current_test_start;
                     soc += 2;
                     fprintf(stdout, "[%0*d] %s: ", runners_digits, i, runner->test_name);
                     fwrite(soc, 1, eol - soc, stdout);
@@ -422,13 +830,361 @@ error:
     symbol_table.symbols_n = 0;
 }
 
+static const Elf32_Sym *find_symbol(void *elf, const char *name)
+{
+    const Elf32_Ehdr *ehdr = (Elf32_Ehdr *)elf;
+    const Elf32_Shdr *shdrs = (Elf32_Shdr *)(elf + ehdr->e_shoff);
+    for (int i = 0; i < ehdr->e_shnum; i++)
+    {
+        if (shdrs[i].sh_type != SHT_SYMTAB)
+            continue;
+        const Elf32_Sym *symtab = (Elf32_Sym *)(elf + shdrs[i].sh_offset);
+        const char *strtab = (const char *)(elf + shdrs[shdrs[i].sh_link].sh_offset);
+        for (int j = 0; j < shdrs[i].sh_size / shdrs[i].sh_entsize; j++)
+        {
+            if (strcmp(strtab + symtab[j].st_name, name) == 0)
+                return &symtab[j];
+        }
+    }
+    return NULL;
+}
+
+// Translates a GBA address into a pointer into the ELF.
+static const void *elf_address(void *elf, uint32_t address)
+{
+    const Elf32_Ehdr *ehdr = (Elf32_Ehdr *)elf;
+    const Elf32_Shdr *shdrs = (Elf32_Shdr *)(elf + ehdr->e_shoff);
+    for (int i = 0; i < ehdr->e_shnum; i++)
+    {
+        if (!(shdrs[i].sh_flags & SHF_ALLOC) || shdrs[i].sh_type == SHT_NOBITS)
+            continue;
+        if (shdrs[i].sh_addr <= address && address < shdrs[i].sh_addr + shdrs[i].sh_size)
+            return elf + shdrs[i].sh_offset + (address - shdrs[i].sh_addr);
+    }
+    return NULL;
+}
+
+// The ROM passed to mgba-rom-test. mgba-rom-test can load the ELF
+// directly, except on macOS where it needs a raw binary.
+struct Image
+{
+    char *data;
+    size_t size;
+    bool binary;
+    uint32_t base;
+};
+
+// The load address of a section, which differs from its address for
+// sections which are copied into RAM at startup.
+static uint32_t section_lma(void *elf, const Elf32_Shdr *shdr)
+{
+    const Elf32_Ehdr *ehdr = (Elf32_Ehdr *)elf;
+    const Elf32_Phdr *phdrs = (Elf32_Phdr *)(elf + ehdr->e_phoff);
+    for (int i = 0; i < ehdr->e_phnum; i++)
+    {
+        if (phdrs[i].p_type == PT_LOAD
+         && phdrs[i].p_offset <= shdr->sh_offset
+         && shdr->sh_offset + shdr->sh_size <= phdrs[i].p_offset + phdrs[i].p_filesz)
+            return phdrs[i].p_paddr + (shdr->sh_offset - phdrs[i].p_offset);
+    }
+    return shdr->sh_addr;
+}
+
+#ifdef __APPLE__
+// Equivalent to 'objcopy -O binary'.
+static bool build_binary_image(void *elf, struct Image *image)
+{
+    const Elf32_Ehdr *ehdr = (Elf32_Ehdr *)elf;
+    const Elf32_Shdr *shdrs = (Elf32_Shdr *)(elf + ehdr->e_shoff);
+    uint32_t lo = UINT32_MAX, hi = 0;
+    for (int i = 0; i < ehdr->e_shnum; i++)
+    {
+        if (!(shdrs[i].sh_flags & SHF_ALLOC) || shdrs[i].sh_type == SHT_NOBITS || shdrs[i].sh_size == 0)
+            continue;
+        uint32_t lma = section_lma(elf, &shdrs[i]);
+        if (lma < lo)
+            lo = lma;
+        if (lma + shdrs[i].sh_size > hi)
+            hi = lma + shdrs[i].sh_size;
+    }
+    if (lo >= hi)
+    {
+        fprintf(stderr, "no loadable sections\n");
+        return false;
+    }
+
+    image->binary = true;
+    image->base = lo;
+    image->size = hi - lo;
+    if (!(image->data = calloc(image->size, 1)))
+    {
+        perror("calloc image failed");
+        return false;
+    }
+    for (int i = 0; i < ehdr->e_shnum; i++)
+    {
+        if (!(shdrs[i].sh_flags & SHF_ALLOC) || shdrs[i].sh_type == SHT_NOBITS || shdrs[i].sh_size == 0)
+            continue;
+        memcpy(image->data + section_lma(elf, &shdrs[i]) - lo, elf + shdrs[i].sh_offset, shdrs[i].sh_size);
+    }
+    return true;
+}
+#endif
+
+static bool build_image(void *elf, size_t elf_size, struct Image *image)
+{
+#ifdef __APPLE__
+    return build_binary_image(elf, image);
+#else
+    image->data = elf;
+    image->size = elf_size;
+    image->binary = false;
+    image->base = 0;
+    return true;
+#endif
+}
+
+static void patch_symbol(struct Image *image, void *elf, const char *name, const void *value, size_t size)
+{
+    const Elf32_Ehdr *ehdr = (Elf32_Ehdr *)elf;
+    const Elf32_Shdr *shdrs = (Elf32_Shdr *)(elf + ehdr->e_shoff);
+    const Elf32_Sym *symbol = find_symbol(elf, name);
+    if (!symbol || symbol->st_shndx >= ehdr->e_shnum)
+    {
+        fprintf(stderr, "%s: symbol not found\n", name);
+        exit(2);
+    }
+    if (size > symbol->st_size)
+    {
+        fprintf(stderr, "%s: overflows size (%u)\n", name, symbol->st_size);
+        exit(2);
+    }
+
+    const Elf32_Shdr *shdr = &shdrs[symbol->st_shndx];
+    size_t offset;
+    if (image->binary)
+        offset = section_lma(elf, shdr) + (symbol->st_value - shdr->sh_addr) - image->base;
+    else
+        offset = shdr->sh_offset + (symbol->st_value - shdr->sh_addr);
+    memcpy(image->data + offset, value, size);
+}
+
+static bool write_image(const struct Image *image, const char *path)
+{
+    int fd;
+    if ((fd = open(path, O_WRONLY | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR)) == -1)
+    {
+        perror("open rom_path failed");
+        return false;
+    }
+    for (size_t written = 0; written < image->size;)
+    {
+        ssize_t n = write(fd, image->data + written, image->size - written);
+        if (n == -1)
+        {
+            perror("write rom_path failed");
+            close(fd);
+            return false;
+        }
+        written += n;
+    }
+    if (close(fd) == -1)
+    {
+        perror("close rom_path failed");
+        return false;
+    }
+    return true;
+}
+
+static void load_tests(void *elf)
+{
+    const Elf32_Sym *start = find_symbol(elf, "__start_tests");
+    const Elf32_Sym *stop = find_symbol(elf, "__stop_tests");
+    if (!start || !stop || start->st_value == stop->st_value)
+        return;
+
+    const struct Test *elf_tests = elf_address(elf, start->st_value);
+    if (!elf_tests)
+        return;
+
+    tests_n = (stop->st_value - start->st_value) / sizeof(struct Test);
+    tests = calloc(tests_n, sizeof(*tests));
+    if (!tests)
+    {
+        perror("calloc tests failed");
+        exit(2);
+    }
+    for (uint32_t i = 0; i < tests_n; i++)
+    {
+        tests[i].name = elf_address(elf, elf_tests[i].name);
+        tests[i].filename = elf_address(elf, elf_tests[i].filename);
+        tests[i].duration = -1;
+        if (!tests[i].name || !tests[i].filename)
+        {
+            free(tests);
+            tests = NULL;
+            tests_n = 0;
+            return;
+        }
+    }
+}
+
+static int compare_test_infos(const void *a, const void *b)
+{
+    const struct TestInfo *ta = a, *tb = b;
+    int c = strcmp(ta->filename, tb->filename);
+    if (c == 0)
+        c = strcmp(ta->name, tb->name);
+    return c;
+}
+
+static void read_timings(const char *path)
+{
+    FILE *f = fopen(path, "r");
+    if (!f)
+        return;
+
+    struct TestInfo *sorted = malloc(tests_n * sizeof(*sorted));
+    if (!sorted)
+    {
+        perror("malloc sorted failed");
+        exit(2);
+    }
+    for (uint32_t i = 0; i < tests_n; i++)
+    {
+        sorted[i] = tests[i];
+        // Stash the index so that the duration can be written back.
+        sorted[i].duration = i;
+    }
+    qsort(sorted, tests_n, sizeof(*sorted), compare_test_infos);
+
+    // Each line is '<seconds>\t<filename>\t<name>'.
+    char line[1024];
+    while (fgets(line, sizeof(line), f))
+    {
+        char *filename, *name, *end;
+        double duration = strtod(line, &filename);
+        if (filename == line || *filename++ != '\t')
+            continue;
+        if (!(name = strchr(filename, '\t')))
+            continue;
+        *name++ = '\0';
+        if ((end = strchr(name, '\n')))
+            *end = '\0';
+
+        struct TestInfo key = { .name = name, .filename = filename };
+        struct TestInfo *match = bsearch(&key, sorted, tests_n, sizeof(*sorted), compare_test_infos);
+        if (match)
+            tests[(uint32_t)match->duration].duration = duration;
+    }
+
+    free(sorted);
+    fclose(f);
+}
+
+static void write_timings(const char *path)
+{
+    char tmp_path[FILENAME_MAX];
+    snprintf(tmp_path, sizeof(tmp_path), "%s.tmp", path);
+    FILE *f = fopen(tmp_path, "w");
+    if (!f)
+    {
+        perror("fopen timings failed");
+        return;
+    }
+    for (uint32_t i = 0; i < tests_n; i++)
+    {
+        if (tests[i].duration >= 0)
+            fprintf(f, "%f\t%s\t%s\n", tests[i].duration, tests[i].filename, tests[i].name);
+    }
+    if (fclose(f) != 0 || rename(tmp_path, path) == -1)
+        perror("write timings failed");
+}
+
+// Slowest first, with tests of unknown duration before all others.
+static int compare_queue_entries(const void *a, const void *b)
+{
+    uint32_t ia = *(const uint32_t *)a, ib = *(const uint32_t *)b;
+    double da = tests[ia].duration, db = tests[ib].duration;
+    if (da < 0) da = INFINITY;
+    if (db < 0) db = INFINITY;
+    if (da > db)
+        return -1;
+    else if (da < db)
+        return 1;
+    else
+        return ia < ib ? -1 : ia > ib;
+}
+
+static bool is_test_file(const char *filename)
+{
+    if (test_files_n == 0)
+        return true;
+    for (int i = 0; i < test_files_n; i++)
+    {
+        if (strcmp(filename, test_files[i]) == 0)
+            return true;
+    }
+    return false;
+}
+
+static void build_test_queue(void)
+{
+    if (tests_n == 0)
+        return;
+    test_queue = malloc(tests_n * sizeof(*test_queue));
+    if (!test_queue)
+    {
+        perror("malloc test_queue failed");
+        exit(2);
+    }
+    for (uint32_t i = 0; i < tests_n; i++)
+    {
+        if (is_test_file(tests[i].filename))
+            test_queue[test_queue_n++] = i;
+    }
+    qsort(test_queue, test_queue_n, sizeof(*test_queue), compare_queue_entries);
+}
+
 int main(int argc, char *argv[])
 {
-    if (argc < 4)
+    const char *benchmarks_path = NULL;
+    const char *baseline_path = NULL;
+    unsigned threshold = 5;
+    int opt;
+    while ((opt = getopt(argc, argv, "+b:o:t:")) != -1)
     {
-        fprintf(stderr, "usage %s mgba-rom-test objcopy rom\n", argv[0]);
+        switch (opt)
+        {
+        case 'b':
+            baseline_path = optarg;
+            break;
+        case 'o':
+            benchmarks_path = optarg;
+            break;
+        case 't':
+            threshold = strtoul(optarg, NULL, 10);
+            break;
+        default:
+            exit(2);
+        }
+    }
+    // Make the remaining arguments look like the only arguments.
+    argv[optind - 1] = argv[0];
+    argv += optind - 1;
+    argc -= optind - 1;
+
+    if (argc < 3)
+    {
+        fprintf(stderr, "usage %s [-b baseline] [-o benchmarks] [-t threshold] mgba-rom-test rom [timings [test-file...]]\n", argv[0]);
         exit(2);
     }
+    const char *timings_path = argc >= 4 ? argv[3] : NULL;
+    if (argc >= 5)
+    {
+        test_files = &argv[4];
+        test_files_n = argc - 4;
+    }
 
     bool tty = isatty(STDOUT_FILENO);
     if (!tty)
@@ -453,7 +1209,7 @@ int main(int argc, char *argv[])
     }
 
     int elffd;
-    if ((elffd = open(argv[3], O_RDONLY)) == -1)
+    if ((elffd = open(argv[2], O_RDONLY)) == -1)
     {
         perror("open elffd failed");
         exit(2);
@@ -466,14 +1222,19 @@ int main(int argc, char *argv[])
         exit(2);
     }
 
+    // The mapping is private, so patches to it are copy-on-write and
+    // never reach the file.
     void *elf;
-    if ((elf = mmap(NULL, elfst.st_size, PROT_READ, MAP_PRIVATE, elffd, 0)) == MAP_FAILED)
+    if ((elf = mmap(NULL, elfst.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, elffd, 0)) == MAP_FAILED)
     {
         perror("mmap elffd failed");
         exit(2);
     }
 
     build_symbol_table(elf);
+    load_tests(elf);
+    if (timings_path)
+        read_timings(timings_path);
 
     nrunners = 1;
     const char *makeflags = getenv("MAKEFLAGS");
@@ -513,6 +1274,7 @@ int main(int argc, char *argv[])
         runners[i].input_buffer = malloc(runners[i].input_buffer_capacity);
         runners[i].output_buffer_capacity = 4096;
         runners[i].output_buffer = malloc(runners[i].output_buffer_capacity);
+        runners[i].current_test = UINT32_MAX;
         strcpy(runners[i].test_name, "WAITING...");
         if (tty)
             fprintf(stdout, "[%0*d] %s\n", runners_digits, i, runners[i].test_name);
@@ -522,6 +1284,57 @@ int main(int argc, char *argv[])
     signal(SIGINT, exit2);
     signal(SIGTERM, exit2);
 
+#ifdef __linux__
+    dynamic = can_access_children();
+#endif
+    if (dynamic)
+    {
+        int urandomfd;
+        if ((urandomfd = open("/dev/urandom", O_RDONLY)) == -1
+         || read(urandomfd, nonce, sizeof(nonce)) != sizeof(nonce))
+        {
+            perror("read /dev/urandom failed");
+            exit(2);
+        }
+        close(urandomfd);
+        build_test_queue();
+    }
+    else if (test_files_n > 0)
+    {
+        fprintf(stderr, "Test files are only supported in dynamic mode, running all tests\n");
+    }
+
+    // Prepare the ROMs. In dynamic mode the runners do not need to know
+    // their index, so they share a single ROM.
+    struct Image image;
+    if (!build_image(elf, elfst.st_size, &image))
+        exit(2);
+    uint8_t value = nrunners;
+    patch_symbol(&image, elf, "gTestRunnerN", &value, sizeof(value));
+    if (dynamic)
+    {
+        uint8_t nonce_bytes[sizeof(nonce)];
+        // gTestRunnerNonce is little-endian.
+        for (int j = 0; j < sizeof(nonce); j++)
+            nonce_bytes[j] = nonce[j / 4] >> (8 * (j % 4));
+        value = true;
+        patch_symbol(&image, elf, "gTestRunnerDynamic", &value, sizeof(value));
+        patch_symbol(&image, elf, "gTestRunnerNonce", nonce_bytes, sizeof(nonce_bytes));
+    }
+    for (int i = 0; i < nrunners; i++)
+    {
+        if (dynamic && i > 0)
+        {
+            strcpy(runners[i].rom_path, runners[0].rom_path);
+            continue;
+        }
+        value = i;
+        patch_symbol(&image, elf, "gTestRunnerI", &value, sizeof(value));
+        sprintf(runners[i].rom_path, "/tmp/mgba-rom-test-hydra-%05d-%02d", getpid(), i);
+        if (!write_image(&image, runners[i].rom_path))
+            exit(2);
+    }
+
     // Start test runners.
     pid_t parent_pid = getpid();
     for (int i = 0; i < nrunners; i++)
@@ -563,90 +1376,15 @@ int main(int argc, char *argv[])
                 perror("close pipefds[1] failed");
                 _exit(2);
             }
-            char rom_path[FILENAME_MAX];
-            sprintf(rom_path, "/tmp/mgba-rom-test-hydra-%05d", getpid());
-            int tmpfd;
-            if ((tmpfd = open(rom_path, O_WRONLY | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR)) == -1)
-            {
-                perror("open tmpfd failed");
-                _exit(2);
-            }
-            if ((write(tmpfd, elf, elfst.st_size)) == -1)
-            {
-                perror("write tmpfd failed");
-                _exit(2);
-            }
-            pid_t patchelfpid = fork();
-            if (patchelfpid == -1)
-            {
-                perror("fork patchelf failed");
-                _exit(2);
-            }
-            else if (patchelfpid == 0)
-            {
-                char n_arg[5], i_arg[5];
-                snprintf(n_arg, sizeof(n_arg), "\\x%02x", nrunners);
-                snprintf(i_arg, sizeof(i_arg), "\\x%02x", i);
-                if (execlp("tools/patchelf/patchelf", "tools/patchelf/patchelf", rom_path, "gTestRunnerN", n_arg, "gTestRunnerI", i_arg, NULL) == -1)
-                {
-                    perror("execlp patchelf failed");
-                    _exit(2);
-                }
-            }
-            else
-            {
-                int wstatus;
-                if (waitpid(patchelfpid, &wstatus, 0) == -1)
-                {
-                    perror("waitpid patchelfpid failed");
-                    _exit(2);
-                }
-                if (!WIFEXITED(wstatus) || WEXITSTATUS(wstatus) != 0)
-                {
-                    fprintf(stderr, "patchelf exited with an error\n");
-                    _exit(2);
-                }
-            }
-#ifdef __APPLE__
-            pid_t objcopypid = fork();
-            if (objcopypid == -1)
-            {
-                perror("fork objcopy failed");
-                _exit(2);
-            }
-            else if (objcopypid == 0)
-            {
-                if (execlp(argv[2], argv[2], "-O", "binary", rom_path, rom_path, NULL) == -1)
-                {
-                    perror("execlp objcopy failed");
-                    _exit(2);
-                }
-            }
-            else
-            {
-                int wstatus;
-                if (waitpid(objcopypid, &wstatus, 0) == -1)
-                {
-                    perror("waitpid objcopy failed");
-                    _exit(2);
-                }
-                if (!WIFEXITED(wstatus) || WEXITSTATUS(wstatus) != 0)
-                {
-                    fprintf(stderr, "objcopy exited with an error\n");
-                    _exit(2);
-                }
-            }
-#endif
             // stdbuf is required because otherwise mgba never flushes
             // stdout.
-            if (execlp("stdbuf", "stdbuf", "-oL", argv[1], "-l15", "-ClogLevel.gba.dma=16", "-Rr0", rom_path, NULL) == -1)
+            if (execlp("stdbuf", "stdbuf", "-oL", argv[1], "-l15", "-ClogLevel.gba.dma=16", "-Rr0", runners[i].rom_path, NULL) == -1)
             {
                 perror("execl stdbuf mgba-rom-test failed");
                 _exit(2);
             }
         } else {
             runners[i].pid = pid;
-            sprintf(runners[i].rom_path, "/tmp/mgba-rom-test-hydra-%05d", runners[i].pid);
             runners[i].outfd = pipefds[0];
             if (close(pipefds[1]) == -1)
             {
@@ -867,5 +1605,19 @@ int main(int argc, char *argv[])
     fprintf(stdout, "\n");
 
     fflush(stdout);
+
+    if (dynamic && timings_path)
+        write_timings(timings_path);
+
+    if (benchmarks_n > 0)
+    {
+        qsort(benchmarks, benchmarks_n, sizeof(*benchmarks), compare_benchmarks);
+        if (benchmarks_path)
+            write_benchmarks(benchmarks_path);
+        if (baseline_path && report_benchmark_regressions(baseline_path, threshold) > 0 && exit_code == 0)
+            exit_code = 1;
+        fflush(stdout);
+    }
+
     return exit_code;
 }
@@ -0,0 +1,104 @@
+#!/usr/bin/env python3
+# Watches src, include and test, and reruns the tests affected by each
+# change with 'make check TEST_FILES=...'.
+#
+# A test file is affected if it changed, or if its dependency file
+# (written by scaninc) lists a changed file. A change to src/foo.c is
+# treated as a change to include/foo.h, because tests reach the code in
+# src through its header. If nothing can be attributed to a change, the
+# whole suite runs.
+#
+# Usage: python3 tools/mgba-rom-test-hydra/watch.py build/modern-test
+
+import glob
+import os
+import shlex
+import subprocess
+import sys
+import time
+
+WATCHED_DIRS = ["src", "include", "test"]
+WATCHED_EXTENSIONS = (".c", ".h", ".inc", ".party", ".json", ".s")
+POLL_SECONDS = 0.5
+
+def snapshot():
+    mtimes = {}
+    for watched_dir in WATCHED_DIRS:
+        for root, _, files in os.walk(watched_dir):
+            for name in files:
+                if name.endswith(WATCHED_EXTENSIONS):
+                    path = os.path.join(root, name)
+                    try:
+                        mtimes[path] = os.stat(path).st_mtime_ns
+                    except FileNotFoundError:
+                        pass
+    return mtimes
+
+def changed_files(old, new):
+    return sorted(path for path in set(old) | set(new) if old.get(path) != new.get(path))
+
+def test_dependencies(obj_dir):
+    dependencies = {}
+    for d_path in glob.glob(os.path.join(obj_dir, "test", "**", "*.d"), recursive=True):
+        test_file = os.path.relpath(d_path, obj_dir)[:-len(".d")] + ".c"
+        with open(d_path, "r") as f:
+            first_line = f.readline()
+        _, _, deps = first_line.partition(":")
+        dependencies[test_file] = set(deps.split())
+    return dependencies
+
+def affected_tests(changes, dependencies):
+    targets = set()
+    for path in changes:
+        targets.add(path)
+        if path.startswith("src/") and path.endswith(".c"):
+            targets.add("include/" + path[len("src/"):-len(".c")] + ".h")
+
+    affected = set()
+    for test_file, deps in dependencies.items():
+        if test_file in targets or deps & targets:
+            affected.add(test_file)
+    for path in changes:
+        if path.startswith("test/") and path.endswith(".c") and os.path.exists(path):
+            affected.add(path)
+    return sorted(affected)
+
+def run_tests(test_files):
+    command = ["make", "-j%d" % os.cpu_count(), "check"]
+    if test_files:
+        command.append("TEST_FILES=" + " ".join(test_files))
+    print("$ " + " ".join(shlex.quote(arg) for arg in command), flush=True)
+    subprocess.call(command)
+
+def main():
+    if len(sys.argv) != 2:
+        sys.exit("Usage: %s <test-obj-dir>" % sys.argv[0])
+    obj_dir = sys.argv[1]
+
+    mtimes = snapshot()
+    run_tests([])
+    print("Watching %s for changes..." % ", ".join(WATCHED_DIRS), flush=True)
+    while True:
+        time.sleep(POLL_SECONDS)
+        new_mtimes = snapshot()
+        changes = changed_files(mtimes, new_mtimes)
+        if not changes:
+            continue
+        # Wait for editors which write several files to settle.
+        time.sleep(POLL_SECONDS)
+        new_mtimes = snapshot()
+        changes = changed_files(mtimes, new_mtimes)
+        mtimes = new_mtimes
+
+        affected = affected_tests(changes, test_dependencies(obj_dir))
+        print("Changed: " + " ".join(changes), flush=True)
+        if not affected:
+            print("No tests depend on the changes, running all tests.", flush=True)
+        run_tests(affected)
+        mtimes = snapshot()
+
+if __name__ == "__main__":
+    try:
+        main()
+    except KeyboardInterrupt:
+        pass
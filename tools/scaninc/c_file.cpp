@@ -23,6 +23,8 @@
 CFile::CFile(std::string path)
 {
     m_path = path;
+    m_pos = 0;
+    m_lineNum = 1;
 
     FILE *fp = std::fopen(path.c_str(), "rb");
 
@@ -36,7 +38,10 @@ CFile::CFile(std::string path)
     if (m_size < 0)
         FATAL_ERROR("File size of \"%s\" is less than zero.\n", path.c_str());
     else if (m_size == 0)
+    {
+        std::fclose(fp);
         return; // Empty file
+    }
 
     m_buffer = new char[m_size + 1];
     m_buffer[m_size] = 0;
@@ -47,9 +52,6 @@ CFile::CFile(std::string path)
         FATAL_ERROR("Failed to read \"%s\".\n", path.c_str());
 
     std::fclose(fp);
-
-    m_pos = 0;
-    m_lineNum = 1;
 }
 
 CFile::~CFile()
@@ -0,0 +1,276 @@
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include "dependency_scanner.h"
+#include "source_file.h"
+
+// Bump this whenever the parsers change what they report for a file.
+static const char *const CACHE_HEADER = "scaninc cache 1";
+
+DependencyScanner::DependencyScanner(const std::vector<std::string>& includeDirs)
+    : m_includeDirs(includeDirs)
+{
+}
+
+const DependencyScanner::FileStat& DependencyScanner::Stat(const std::string& path)
+{
+    auto it = m_stats.find(path);
+    if (it != m_stats.end())
+        return it->second;
+
+    FileStat fileStat = {false, 0, 0};
+    struct stat st;
+    if (stat(path.c_str(), &st) == 0 && !S_ISDIR(st.st_mode))
+    {
+        fileStat.exists = true;
+#if defined(__APPLE__)
+        fileStat.mtime = st.st_mtimespec.tv_sec * 1000000000LL + st.st_mtimespec.tv_nsec;
+#elif defined(_WIN32) && !defined(__CYGWIN__)
+        fileStat.mtime = st.st_mtime * 1000000000LL;
+#else
+        fileStat.mtime = st.st_mtim.tv_sec * 1000000000LL + st.st_mtim.tv_nsec;
+#endif
+        fileStat.size = st.st_size;
+    }
+    return m_stats.emplace(path, fileStat).first->second;
+}
+
+DependencyScanner::FileInfo& DependencyScanner::Scan(const std::string& path)
+{
+    FileInfo& info = m_files[path];
+    if (info.scanned)
+        return info;
+
+    const FileStat& fileStat = Stat(path);
+    if (!fileStat.exists)
+        FATAL_ERROR("Failed to open \"%s\" for reading.\n", path.c_str());
+
+    if (info.mtime != fileStat.mtime || info.size != fileStat.size)
+    {
+        SourceFile file(path);
+        info.mtime = fileStat.mtime;
+        info.size = fileStat.size;
+        info.incbins = file.GetIncbins();
+        info.includes = file.GetIncludes();
+    }
+    info.scanned = true;
+    return info;
+}
+
+const std::vector<std::string>& DependencyScanner::ResolveIncludes(const std::string& path)
+{
+    FileInfo& info = Scan(path);
+    if (info.resolved)
+        return info.resolvedIncludes;
+
+    std::string srcDir("");
+    std::size_t slash = path.rfind('/');
+    if (slash != std::string::npos)
+        srcDir = path.substr(0, slash + 1);
+
+    std::string mutablePath(path);
+    SourceFileType fileType = GetFileType(mutablePath);
+
+    for (const std::string& include : info.includes)
+    {
+        bool exists = false;
+        std::string includePath("");
+        for (const std::string& includeDir : m_includeDirs)
+        {
+            includePath = includeDir + include;
+            if (Stat(includePath).exists)
+            {
+                exists = true;
+                break;
+            }
+        }
+        if (!exists)
+        {
+            includePath = srcDir + include;
+            exists = Stat(includePath).exists;
+        }
+        if (!exists && (fileType == SourceFileType::Asm || fileType == SourceFileType::Inc))
+        {
+            includePath = include;
+            exists = Stat(includePath).exists;
+        }
+        if (exists)
+            info.resolvedIncludes.push_back(includePath);
+    }
+    info.resolved = true;
+    return info.resolvedIncludes;
+}
+
+void DependencyScanner::GetDependencies(const std::string& path, std::set<std::string>& dependencies, std::set<std::string>& dependencies_includes)
+{
+    std::vector<std::string> filesToProcess;
+    filesToProcess.push_back(path);
+
+    while (!filesToProcess.empty())
+    {
+        std::string filePath = filesToProcess.back();
+        filesToProcess.pop_back();
+
+        for (const std::string& incbin : Scan(filePath).incbins)
+            dependencies.insert(incbin);
+        for (const std::string& include : ResolveIncludes(filePath))
+        {
+            dependencies_includes.insert(include);
+            if (dependencies.insert(include).second)
+                filesToProcess.push_back(include);
+        }
+    }
+}
+
+void DependencyScanner::WriteDependencyFile(const std::string& path, const std::string& make_outfile, bool onlyIfStale)
+{
+    std::set<std::string> dependencies;
+    std::set<std::string> dependencies_includes;
+    GetDependencies(path, dependencies, dependencies_includes);
+
+    std::ostringstream output;
+
+    // Print a make rule for the object file
+    size_t ext_pos = make_outfile.find_last_of(".");
+    auto object_file = make_outfile.substr(0, ext_pos + 1) + "o";
+    output << object_file << ":";
+    for (const std::string &dependency : dependencies)
+    {
+        output << " " << dependency;
+    }
+    output << '\n';
+
+    // Dependency list rule.
+    // Although these rules are identical, they need to be separate, else make will trigger the rule again after the file is created for the first time.
+    output << make_outfile << ":";
+    for (const std::string &dependency : dependencies_includes)
+    {
+        output << " " << dependency;
+    }
+    output << '\n';
+
+    // Dummy rules
+    // If a dependency is deleted, make will try to make it, instead of rescanning the dependencies before trying to do that.
+    for (const std::string &dependency : dependencies)
+    {
+        output << dependency << ":\n";
+    }
+
+    std::string contents = output.str();
+
+    if (onlyIfStale)
+    {
+        // Leave the file alone if it is already what make would produce.
+        // It must still be newer than everything it lists, or make would
+        // run the per-file rule for it anyway.
+        const FileStat& outStat = Stat(make_outfile);
+        if (outStat.exists)
+        {
+            bool stale = outStat.mtime < Stat(path).mtime;
+            for (const std::string &dependency : dependencies_includes)
+            {
+                if (outStat.mtime < Stat(dependency).mtime)
+                {
+                    stale = true;
+                    break;
+                }
+            }
+
+            if (!stale && outStat.size == (long long)contents.size())
+            {
+                std::ifstream existing(make_outfile, std::ios::binary);
+                std::ostringstream existingContents;
+                existingContents << existing.rdbuf();
+                if (existingContents.str() == contents)
+                    return;
+            }
+        }
+    }
+
+    std::ofstream file(make_outfile, std::ios::binary);
+    if (!file)
+        FATAL_ERROR("Failed to open \"%s\" for writing.\n", make_outfile.c_str());
+    file << contents;
+    file.close();
+}
+
+void DependencyScanner::LoadCache(const std::string& path)
+{
+    std::ifstream cache(path);
+    std::string line;
+
+    if (!std::getline(cache, line) || line != CACHE_HEADER)
+        return;
+
+    FileInfo *info = nullptr;
+    while (std::getline(cache, line))
+    {
+        if (line.size() < 2 || line[1] != ' ')
+        {
+            m_files.clear();
+            return;
+        }
+
+        std::string value = line.substr(2);
+        switch (line[0])
+        {
+        case 'F':
+        {
+            // F <mtime> <size> <path>
+            std::size_t sizePos = value.find(' ');
+            std::size_t pathPos = value.find(' ', sizePos + 1);
+            if (sizePos == std::string::npos || pathPos == std::string::npos)
+                break;
+            info = &m_files[value.substr(pathPos + 1)];
+            info->mtime = std::atoll(value.substr(0, sizePos).c_str());
+            info->size = std::atoll(value.substr(sizePos + 1, pathPos - sizePos - 1).c_str());
+            continue;
+        }
+        case 'I':
+            if (info == nullptr)
+                break;
+            info->includes.insert(value);
+            continue;
+        case 'B':
+            if (info == nullptr)
+                break;
+            info->incbins.insert(value);
+            continue;
+        }
+
+        // A damaged cache is not worth trusting at all.
+        m_files.clear();
+        return;
+    }
+}
+
+void DependencyScanner::SaveCache(const std::string& path)
+{
+    // Only files seen by this run are kept, so deleted files drop out.
+    std::string tmpPath = path + ".tmp";
+    std::ofstream cache(tmpPath, std::ios::binary);
+    if (!cache)
+        FATAL_ERROR("Failed to open \"%s\" for writing.\n", tmpPath.c_str());
+
+    cache << CACHE_HEADER << '\n';
+    for (const auto &entry : m_files)
+    {
+        const FileInfo &info = entry.second;
+        if (!info.scanned)
+            continue;
+        cache << "F " << info.mtime << " " << info.size << " " << entry.first << '\n';
+        for (const std::string &include : info.includes)
+            cache << "I " << include << '\n';
+        for (const std::string &incbin : info.incbins)
+            cache << "B " << incbin << '\n';
+    }
+    cache.close();
+
+#ifdef _WIN32
+    std::remove(path.c_str());
+#endif
+    if (std::rename(tmpPath.c_str(), path.c_str()) != 0)
+        FATAL_ERROR("Failed to rename \"%s\" to \"%s\".\n", tmpPath.c_str(), path.c_str());
+}
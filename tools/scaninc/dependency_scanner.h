@@ -0,0 +1,53 @@
+#ifndef DEPENDENCY_SCANNER_H
+#define DEPENDENCY_SCANNER_H
+
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+#include "scaninc.h"
+
+// Resolves the dependencies of many source files in one process. Every
+// file is read and parsed at most once, and each file's includes are
+// resolved against the include directories at most once, so headers shared
+// by many sources cost nothing after the first. The parse results can be
+// saved to a cache file and reused by the next run for every file whose
+// modification time and size have not changed.
+class DependencyScanner
+{
+public:
+    DependencyScanner(const std::vector<std::string>& includeDirs);
+    void LoadCache(const std::string& path);
+    void SaveCache(const std::string& path);
+    void GetDependencies(const std::string& path, std::set<std::string>& dependencies, std::set<std::string>& dependencies_includes);
+    void WriteDependencyFile(const std::string& path, const std::string& make_outfile, bool onlyIfStale);
+
+private:
+    struct FileStat
+    {
+        bool exists;
+        long long mtime;
+        long long size;
+    };
+
+    struct FileInfo
+    {
+        long long mtime = -1;
+        long long size = -1;
+        bool scanned = false;
+        bool resolved = false;
+        std::set<std::string> incbins;
+        std::set<std::string> includes;
+        std::vector<std::string> resolvedIncludes;
+    };
+
+    std::vector<std::string> m_includeDirs;
+    std::map<std::string, FileStat> m_stats;
+    std::map<std::string, FileInfo> m_files;
+
+    const FileStat& Stat(const std::string& path);
+    FileInfo& Scan(const std::string& path);
+    const std::vector<std::string>& ResolveIncludes(const std::string& path);
+};
+
+#endif // DEPENDENCY_SCANNER_H
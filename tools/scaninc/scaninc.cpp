@@ -20,44 +20,35 @@
 
 #include <cstdio>
 #include <cstdlib>
-#include <list>
-#include <queue>
 #include <set>
 #include <string>
 #include <iostream>
-#include <tuple>
-#include <fstream>
+#include <vector>
 #include "scaninc.h"
-#include "source_file.h"
+#include "dependency_scanner.h"
 
-bool CanOpenFile(std::string path)
-{
-    FILE *fp = std::fopen(path.c_str(), "rb");
-
-    if (fp == NULL)
-        return false;
-
-    std::fclose(fp);
-    return true;
-}
-
-const char *const USAGE = "Usage: scaninc [-I INCLUDE_PATH] [-M DEPENDENCY_OUT_PATH] FILE_PATH\n";
+const char *const USAGE =
+    "Usage: scaninc [-I INCLUDE_PATH] [-M DEPENDENCY_OUT_PATH] FILE_PATH\n"
+    "       scaninc [-I INCLUDE_PATH] -B OBJ_DIR [-C CACHE_PATH] FILE_PATH...\n"
+    "\n"
+    "With -B, the dependency file of each FILE_PATH is written to\n"
+    "OBJ_DIR/FILE_PATH with its extension replaced by .d, unless it is already\n"
+    "up to date. -C keeps what was found in each file between runs.\n";
 
 int main(int argc, char **argv)
 {
-    std::queue<std::string> filesToProcess;
-    std::set<std::string> dependencies;
-    std::set<std::string> dependencies_includes;
-
     std::vector<std::string> includeDirs;
 
     bool makeformat = false;
     std::string make_outfile;
+    bool batch = false;
+    std::string objDir;
+    std::string cachePath;
 
     argc--;
     argv++;
 
-    while (argc > 1)
+    while (argc > 1 && argv[0][0] == '-')
     {
         std::string arg(argv[0]);
         if (arg.substr(0, 2) == "-I")
@@ -82,6 +73,21 @@ int main(int argc, char **argv)
             argv++;
             make_outfile = std::string(argv[0]);
         }
+        else if (arg == "-B")
+        {
+            batch = true;
+            argc--;
+            argv++;
+            objDir = std::string(argv[0]);
+            if (!objDir.empty() && objDir.back() != '/')
+                objDir += '/';
+        }
+        else if (arg == "-C")
+        {
+            argc--;
+            argv++;
+            cachePath = std::string(argv[0]);
+        }
         else
         {
             FATAL_ERROR(USAGE);
@@ -90,59 +96,36 @@ int main(int argc, char **argv)
         argv++;
     }
 
-    if (argc != 1) {
+    if (batch ? (argc < 1 || makeformat) : (argc != 1 || !cachePath.empty())) {
         FATAL_ERROR(USAGE);
     }
 
-    std::string initialPath(argv[0]);
-
-    filesToProcess.push(initialPath);
+    DependencyScanner scanner(includeDirs);
 
-    while (!filesToProcess.empty())
+    if (batch)
     {
-        std::string filePath = filesToProcess.front();
-        SourceFile file(filePath);
-        filesToProcess.pop();
+        if (!cachePath.empty())
+            scanner.LoadCache(cachePath);
 
-        includeDirs.push_back(file.GetSrcDir());
-        for (auto incbin : file.GetIncbins())
+        for (int i = 0; i < argc; i++)
         {
-            dependencies.insert(incbin);
+            std::string path(argv[i]);
+            std::size_t ext_pos = path.find_last_of(".");
+            std::size_t slash_pos = path.find_last_of("/");
+            if (ext_pos == std::string::npos || (slash_pos != std::string::npos && ext_pos < slash_pos))
+                FATAL_ERROR("no file extension in path \"%s\"\n", path.c_str());
+            scanner.WriteDependencyFile(path, objDir + path.substr(0, ext_pos) + ".d", true);
         }
-        for (auto include : file.GetIncludes())
-        {
-            bool exists = false;
-            std::string path("");
-            for (auto includeDir : includeDirs)
-            {
-                path = includeDir + include;
-                if (CanOpenFile(path))
-                {
-                    exists = true;
-                    break;
-                }
-            }
-            if (!exists && (file.FileType() == SourceFileType::Asm || file.FileType() == SourceFileType::Inc))
-            {
-                path = include;
-                if (CanOpenFile(path))
-                    exists = true;
-            }
-            if (!exists)
-                continue;
 
-            dependencies_includes.insert(path);
-            bool inserted = dependencies.insert(path).second;
-            if (inserted && exists)
-            {
-                filesToProcess.push(path);
-            }
-        }
-        includeDirs.pop_back();
+        if (!cachePath.empty())
+            scanner.SaveCache(cachePath);
     }
-
-    if(!makeformat)
+    else if (!makeformat)
     {
+        std::set<std::string> dependencies;
+        std::set<std::string> dependencies_includes;
+        scanner.GetDependencies(argv[0], dependencies, dependencies_includes);
+
         for (const std::string &path : dependencies)
         {
             std::printf("%s\n", path.c_str());
@@ -152,35 +135,6 @@ int main(int argc, char **argv)
     else
     {
         // Write out make rules to a file
-        std::ofstream output(make_outfile);
-
-        // Print a make rule for the object file
-        size_t ext_pos = make_outfile.find_last_of(".");
-        auto object_file = make_outfile.substr(0, ext_pos + 1) + "o";
-        output << object_file.c_str() << ":";
-        for (const std::string &path : dependencies)
-        {
-            output << " " << path;
-        }
-        output << '\n';
-
-        // Dependency list rule.
-        // Although these rules are identical, they need to be separate, else make will trigger the rule again after the file is created for the first time.
-        output << make_outfile.c_str() << ":";
-        for (const std::string &path : dependencies_includes)
-        {
-            output << " " << path;
-        }
-        output << '\n';
-
-        // Dummy rules
-        // If a dependency is deleted, make will try to make it, instead of rescanning the dependencies before trying to do that.
-        for (const std::string &path : dependencies)
-        {
-            output << path << ":\n";
-        }
-
-        output.flush();
-        output.close();
+        scanner.WriteDependencyFile(argv[0], make_outfile, false);
     }
 }